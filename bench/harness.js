@@ -0,0 +1,115 @@
+'use strict';
+
+/**
+ * Benchmark harness
+ * Calibrates a batch size per case so one sample runs for about sampleTimeMs,
+ * then records ns/op for each sample and reports percentiles over them.
+ */
+
+const now = () => process.hrtime.bigint();
+
+/**
+ * Runs fn `batch` times synchronously
+ * @returns Elapsed nanoseconds
+ */
+function runSync(fn, batch) {
+  const start = now();
+  for (let i = 0; i < batch; i++) fn();
+  return Number(now() - start);
+}
+
+/**
+ * Runs fn `batch` times, awaiting each call
+ * @returns Elapsed nanoseconds
+ */
+async function runAsync(fn, batch) {
+  const start = now();
+  for (let i = 0; i < batch; i++) await fn();
+  return Number(now() - start);
+}
+
+/**
+ * Nearest-rank percentile of an ascending array
+ */
+function percentile(sorted, p) {
+  const rank = Math.ceil((p / 100) * sorted.length) - 1;
+  return sorted[Math.min(sorted.length - 1, Math.max(0, rank))];
+}
+
+/**
+ * Measures one implementation
+ * @param fn - Operation to time; returns a promise when isAsync
+ * @param options - samples, sampleTimeMs, warmupMs, isAsync
+ * @returns ops/s, mean ns/op and ns/op percentiles
+ */
+async function measure(fn, options = {}) {
+  const { samples = 30, sampleTimeMs = 20, warmupMs = 50, isAsync = false } = options;
+  const run = isAsync ? (batch) => runAsync(fn, batch) : (batch) => Promise.resolve(runSync(fn, batch));
+
+  // Double the batch until one run takes a full sample, warming up the JIT on the way
+  const sampleNs = sampleTimeMs * 1e6;
+  let batch = 1;
+  let warmed = 0;
+  for (;;) {
+    const elapsed = await run(batch);
+    warmed += elapsed;
+    if (elapsed >= sampleNs && warmed >= warmupMs * 1e6) break;
+    if (elapsed < sampleNs) batch = Math.min(batch * 2, 1 << 30);
+  }
+
+  const perOp = [];
+  let totalNs = 0;
+  for (let i = 0; i < samples; i++) {
+    const elapsed = await run(batch);
+    totalNs += elapsed;
+    perOp.push(elapsed / batch);
+  }
+  perOp.sort((a, b) => a - b);
+
+  const mean = totalNs / (samples * batch);
+  return {
+    opsPerSec: 1e9 / mean,
+    nsPerOp: mean,
+    min: perOp[0],
+    p50: percentile(perOp, 50),
+    p90: percentile(perOp, 90),
+    p99: percentile(perOp, 99),
+    samples,
+    batch
+  };
+}
+
+/**
+ * Key identifying a result across runs
+ */
+function resultKey(result) {
+  return `${result.suite}/${result.name}/${result.size}/${result.impl}`;
+}
+
+/**
+ * Compares LLJS results against a stored baseline by median ns/op
+ * @param results - Results of this run
+ * @param baseline - Results of a previous run
+ * @param thresholdPercent - Slowdown above which a case counts as a regression
+ * @returns One entry per case present in both runs
+ */
+function compare(results, baseline, thresholdPercent) {
+  const previous = new Map(baseline.map((result) => [resultKey(result), result]));
+  const entries = [];
+  for (const result of results) {
+    if (result.impl !== 'lljs') continue;
+    const before = previous.get(resultKey(result));
+    if (!before) continue;
+    const change = ((result.p50 - before.p50) / before.p50) * 100;
+    entries.push({
+      key: resultKey(result),
+      before: before.p50,
+      after: result.p50,
+      changePercent: change,
+      regression: change > thresholdPercent
+    });
+  }
+  return entries;
+}
+
+module.exports = { measure, compare, percentile, resultKey };
@@ -0,0 +1,115 @@
+'use strict';
+
+/**
+ * LLJS benchmark runner
+ *
+ *   node bench/run.js [--filter <regex>] [--quick] [--output <file>]
+ *                     [--compare <baseline.json>] [--threshold <percent>]
+ *
+ * Prints a table to stderr and the JSON report to stdout (or --output).
+ * With --compare, exits with status 1 if any LLJS case is slower than the
+ * baseline by more than --threshold percent (default 10) at the median.
+ */
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { measure, compare } = require('./harness');
+const suites = require('./suites');
+
+function parseArgs(argv) {
+  const args = { filter: null, quick: false, output: null, compare: null, threshold: 10 };
+  for (let i = 0; i < argv.length; i++) {
+    switch (argv[i]) {
+      case '--filter': args.filter = new RegExp(argv[++i]); break;
+      case '--quick': args.quick = true; break;
+      case '--output': args.output = argv[++i]; break;
+      case '--compare': args.compare = argv[++i]; break;
+      case '--threshold': args.threshold = Number(argv[++i]); break;
+      default: throw new Error(`Unknown argument ${argv[i]}`);
+    }
+  }
+  return args;
+}
+
+function loadLLJS() {
+  const entry = path.join(__dirname, '..', 'dist', 'index.js');
+  if (!fs.existsSync(entry)) {
+    throw new Error('dist/ not found; run "npm run build" first');
+  }
+  const lljs = require(entry);
+  if (lljs.CPU.getCPUInfo().vendor === 'Mock') {
+    throw new Error('LLJS native module not built; run "npm run build:native" first');
+  }
+  return lljs;
+}
+
+function format(ns) {
+  if (ns >= 1e6) return `${(ns / 1e6).toFixed(2)} ms`;
+  if (ns >= 1e3) return `${(ns / 1e3).toFixed(2)} us`;
+  return `${ns.toFixed(1)} ns`;
+}
+
+async function main() {
+  const args = parseArgs(process.argv.slice(2));
+  const lljs = loadLLJS();
+  const options = args.quick ? { samples: 10, sampleTimeMs: 5, warmupMs: 10 } : {};
+
+  const results = [];
+  for (const benchmark of suites) {
+    for (const size of benchmark.sizes) {
+      const label = `${benchmark.suite}/${benchmark.name}/${size}`;
+      if (args.filter && !args.filter.test(label)) continue;
+
+      const cases = await benchmark.setup(size, lljs);
+      const measured = {};
+      for (const impl of ['lljs', 'js']) {
+        const stats = await measure(cases[impl], { ...options, isAsync: !!cases.isAsync });
+        measured[impl] = stats;
+        results.push({ suite: benchmark.suite, name: benchmark.name, size, impl, ...stats });
+      }
+      if (cases.teardown) await cases.teardown();
+
+      const speedup = measured.js.p50 / measured.lljs.p50;
+      process.stderr.write(`${label.padEnd(32)} lljs ${format(measured.lljs.p50).padStart(11)}` +
+        `  js ${format(measured.js.p50).padStart(11)}  x${speedup.toFixed(2)}\n`);
+    }
+  }
+
+  const report = {
+    meta: {
+      date: new Date().toISOString(),
+      node: process.version,
+      platform: process.platform,
+      arch: process.arch,
+      cpu: os.cpus()[0] ? os.cpus()[0].model : 'unknown',
+      simd: lljs.CPU.getCPUInfo().simd
+    },
+    results
+  };
+  const json = JSON.stringify(report, null, 2);
+  if (args.output) fs.writeFileSync(args.output, json + '\n');
+  else process.stdout.write(json + '\n');
+
+  if (args.compare) {
+    const baseline = JSON.parse(fs.readFileSync(args.compare, 'utf8'));
+    const entries = compare(results, baseline.results, args.threshold);
+    let regressions = 0;
+    for (const entry of entries) {
+      const sign = entry.changePercent >= 0 ? '+' : '';
+      process.stderr.write(`${entry.regression ? 'REGRESSION' : 'ok        '} ${entry.key.padEnd(40)}` +
+        ` ${format(entry.before).padStart(11)} -> ${format(entry.after).padStart(11)}` +
+        ` (${sign}${entry.changePercent.toFixed(1)}%)\n`);
+      if (entry.regression) regressions++;
+    }
+    if (regressions > 0) {
+      process.stderr.write(`${regressions} regression(s) above ${args.threshold}%\n`);
+      process.exitCode = 1;
+    }
+  }
+}
+
+main().catch((error) => {
+  process.stderr.write(`${error.message}\n`);
+  process.exitCode = 2;
+});
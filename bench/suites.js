@@ -0,0 +1,377 @@
+'use strict';
+
+/**
+ * Benchmark cases
+ * Every case pairs an LLJS export with the closest pure-JS or Node built-in
+ * equivalent over the same inputs. setup(size, lljs) returns { lljs, js } and
+ * optionally isAsync and teardown.
+ */
+
+const buffer = require('buffer');
+const childProcess = require('child_process');
+const crypto = require('crypto');
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+
+const KB = 1024;
+const MB = 1024 * KB;
+
+/**
+ * Deterministic Float64Array of length n
+ */
+function floats(n, seed = 1) {
+  const out = new Float64Array(n);
+  for (let i = 0; i < n; i++) out[i] = ((i * 2654435761 + seed) % 1000) / 1000;
+  return out;
+}
+
+/**
+ * ASCII log-like text with a few multi-byte characters
+ */
+function text(size) {
+  const line = Buffer.from('2026-10-15 INFO request served in 12 ms, status=200 größe=ok\n');
+  const out = Buffer.alloc(size);
+  for (let i = 0; i < size; i += line.length) line.copy(out, i, 0, Math.min(line.length, size - i));
+  return out;
+}
+
+/**
+ * Temp file of `size` bytes; removed by the returned cleanup
+ */
+function tempFile(size) {
+  const file = path.join(os.tmpdir(), `lljs-bench-${process.pid}-${size}`);
+  fs.writeFileSync(file, text(size));
+  return { file, cleanup: () => fs.rmSync(file, { force: true }) };
+}
+
+/**
+ * In-place iterative radix-2 FFT over interleaved complex samples
+ */
+function fftJS(data, n) {
+  for (let i = 1, j = 0; i < n; i++) {
+    let bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      let t = data[2 * i]; data[2 * i] = data[2 * j]; data[2 * j] = t;
+      t = data[2 * i + 1]; data[2 * i + 1] = data[2 * j + 1]; data[2 * j + 1] = t;
+    }
+  }
+  for (let len = 2; len <= n; len <<= 1) {
+    const angle = (-2 * Math.PI) / len;
+    const wr = Math.cos(angle);
+    const wi = Math.sin(angle);
+    for (let i = 0; i < n; i += len) {
+      let cr = 1;
+      let ci = 0;
+      for (let k = 0; k < len / 2; k++) {
+        const a = 2 * (i + k);
+        const b = 2 * (i + k + len / 2);
+        const xr = data[b] * cr - data[b + 1] * ci;
+        const xi = data[b] * ci + data[b + 1] * cr;
+        data[b] = data[a] - xr; data[b + 1] = data[a + 1] - xi;
+        data[a] += xr; data[a + 1] += xi;
+        const next = cr * wr - ci * wi;
+        ci = cr * wi + ci * wr;
+        cr = next;
+      }
+    }
+  }
+}
+
+const isUtf8 = buffer.isUtf8 || ((bytes) => {
+  try {
+    new TextDecoder('utf-8', { fatal: true }).decode(bytes);
+    return true;
+  } catch {
+    return false;
+  }
+});
+
+module.exports = [
+  {
+    suite: 'math', name: 'vector-add', sizes: [1000, 100000, 1000000],
+    setup(n, { Math: M }) {
+      const a = floats(n, 1);
+      const b = floats(n, 2);
+      const out = new Float64Array(n);
+      return {
+        lljs: () => M.vectorOperations({ operation: 'add', a, b, out }),
+        js: () => { for (let i = 0; i < n; i++) out[i] = a[i] + b[i]; }
+      };
+    }
+  },
+  {
+    suite: 'math', name: 'vector-dot', sizes: [1000, 100000, 1000000],
+    setup(n, { Math: M }) {
+      const a = floats(n, 1);
+      const b = floats(n, 2);
+      return {
+        lljs: () => M.vectorOperations({ operation: 'dot', a, b }),
+        js: () => { let sum = 0; for (let i = 0; i < n; i++) sum += a[i] * b[i]; return sum; }
+      };
+    }
+  },
+  {
+    suite: 'math', name: 'matrix-multiply', sizes: [64, 256],
+    setup(n, { Math: M }) {
+      const a = { data: floats(n * n, 1), rows: n, cols: n };
+      const b = { data: floats(n * n, 2), rows: n, cols: n };
+      const out = { data: new Float64Array(n * n), rows: n, cols: n };
+      const c = out.data;
+      return {
+        lljs: () => M.matrixOperations({ operation: 'multiply', matrix: a, matrix2: b, out }),
+        js: () => {
+          c.fill(0);
+          for (let i = 0; i < n; i++) {
+            for (let k = 0; k < n; k++) {
+              const aik = a.data[i * n + k];
+              for (let j = 0; j < n; j++) c[i * n + j] += aik * b.data[k * n + j];
+            }
+          }
+        }
+      };
+    }
+  },
+  {
+    suite: 'math', name: 'fft', sizes: [1024, 65536],
+    setup(n, { Math: M }) {
+      const input = floats(2 * n);
+      const output = new Float64Array(2 * n);
+      const work = new Float64Array(2 * n);
+      const plan = M.createFFTPlan(n);
+      return {
+        lljs: () => M.executeFFTPlan(plan, input, output),
+        js: () => { work.set(input); fftJS(work, n); },
+        teardown: () => M.destroyFFTPlan(plan)
+      };
+    }
+  },
+  {
+    suite: 'math', name: 'sqrt-batch', sizes: [1, 1024],
+    setup(n, { Math: M, MathOpcode }) {
+      const batch = M.createCommandBuffer(n);
+      for (let i = 0; i < n; i++) batch.push(MathOpcode.sqrt, i + 1);
+      const results = new Float64Array(n);
+      return {
+        lljs: n === 1 ? () => M.fastSqrt(2) : () => batch.execute(),
+        js: () => { for (let i = 0; i < n; i++) results[i] = Math.sqrt(i + 1); }
+      };
+    }
+  },
+  {
+    suite: 'string', name: 'search', sizes: [64 * KB, 4 * MB],
+    setup(size, { String: S }) {
+      const haystack = text(size);
+      const needle = Buffer.from('status=500');
+      return {
+        lljs: () => S.findAll(haystack, needle),
+        js: () => {
+          const found = [];
+          for (let i = haystack.indexOf(needle); i !== -1; i = haystack.indexOf(needle, i + 1)) found.push(i);
+          return found;
+        }
+      };
+    }
+  },
+  {
+    // Node has no built-in non-cryptographic hash; md5 is the fastest built-in digest
+    suite: 'string', name: 'hash', sizes: [64, 4 * KB, 1 * MB],
+    setup(size, { String: S }) {
+      const data = text(size);
+      return {
+        lljs: () => S.hash(data, 'xxh3'),
+        js: () => crypto.createHash('md5').update(data).digest()
+      };
+    }
+  },
+  {
+    suite: 'string', name: 'validate-utf8', sizes: [4 * KB, 1 * MB],
+    setup(size, { String: S }) {
+      const data = text(size);
+      return {
+        lljs: () => S.bufferValidate(data, 'utf8'),
+        js: () => isUtf8(data)
+      };
+    }
+  },
+  {
+    suite: 'io', name: 'read', sizes: [4 * KB, 1 * MB],
+    async setup(size, { IO }) {
+      const { file, cleanup } = tempFile(8 * MB);
+      const target = Buffer.alloc(size);
+      const handle = IO.openFile(file, 'r');
+      const node = await fs.promises.open(file, 'r');
+      let position = 0;
+      const next = () => (position = (position + size) % (8 * MB - size));
+      return {
+        isAsync: true,
+        lljs: () => IO.readAt(handle, target, next(), size),
+        js: () => node.read(target, 0, size, next()),
+        teardown: async () => { IO.closeFile(handle); await node.close(); cleanup(); }
+      };
+    }
+  },
+  {
+    suite: 'io', name: 'write', sizes: [4 * KB, 1 * MB],
+    async setup(size, { IO }) {
+      const { file, cleanup } = tempFile(8 * MB);
+      const data = text(size);
+      const handle = IO.openFile(file, 'rw');
+      const node = await fs.promises.open(file, 'r+');
+      let position = 0;
+      const next = () => (position = (position + size) % (8 * MB - size));
+      return {
+        isAsync: true,
+        lljs: () => IO.writeAt(handle, data, next(), size),
+        js: () => node.write(data, 0, size, next()),
+        teardown: async () => { IO.closeFile(handle); await node.close(); cleanup(); }
+      };
+    }
+  },
+  {
+    // 64 random 4 KB reads per op: one ring submission vs 64 fs.promises reads
+    suite: 'io', name: 'ring-random-read', sizes: [64],
+    async setup(count, { IO }) {
+      const { file, cleanup } = tempFile(8 * MB);
+      const target = Buffer.alloc(count * 4 * KB);
+      let done = () => {};
+      let pending = 0;
+      const ring = IO.createRing((batch) => { pending -= batch.count; if (pending === 0) done(); });
+      const fileIndex = ring.registerFile(file, 'r');
+      const bufferIndex = ring.registerBuffer(target);
+      const node = await fs.promises.open(file, 'r');
+      let seed = 1;
+      const nextPage = () => ((seed = (seed * 1103515245 + 12345) % 2147483648) % (2 * KB)) * 4 * KB;
+      return {
+        isAsync: true,
+        lljs: () => new Promise((resolve) => {
+          for (let i = 0; i < count; i++) ring.read(fileIndex, bufferIndex, nextPage(), i, 4 * KB, i * 4 * KB);
+          pending = count;
+          done = resolve;
+          ring.submit();
+        }),
+        js: () => Promise.all(Array.from({ length: count }, (_, i) => node.read(target, i * 4 * KB, 4 * KB, nextPage()))),
+        teardown: async () => { ring.close(); await node.close(); cleanup(); }
+      };
+    }
+  },
+  {
+    // Maps (or reads) the whole file and touches one byte per page
+    suite: 'io', name: 'mmap', sizes: [1 * MB, 16 * MB],
+    setup(size, { IO }) {
+      const { file, cleanup } = tempFile(size);
+      const touch = (bytes) => { let sum = 0; for (let i = 0; i < bytes.length; i += 4096) sum += bytes[i]; return sum; };
+      return {
+        lljs: () => touch(IO.mapFile(file)),
+        js: () => touch(fs.readFileSync(file)),
+        teardown: cleanup
+      };
+    }
+  },
+  {
+    suite: 'memory', name: 'copy', sizes: [4 * KB, 1 * MB, 64 * MB],
+    setup(size, { Memory }) {
+      const src = text(size);
+      const dest = Buffer.alloc(size);
+      return {
+        lljs: () => Memory.copyMemory(dest, src, size),
+        js: () => src.copy(dest, 0, 0, size)
+      };
+    }
+  },
+  {
+    suite: 'memory', name: 'fill', sizes: [4 * KB, 1 * MB, 64 * MB],
+    setup(size, { Memory }) {
+      const dest = Buffer.alloc(size);
+      return {
+        lljs: () => Memory.setMemory(dest, 0x5a, size),
+        js: () => dest.fill(0x5a, 0, size)
+      };
+    }
+  },
+  {
+    suite: 'memory', name: 'allocate', sizes: [256, 64 * KB],
+    setup(size, { Memory }) {
+      return {
+        lljs: () => Memory.freeBuffer(Memory.allocateBuffer(size)),
+        js: () => Buffer.allocUnsafeSlow(size)
+      };
+    }
+  },
+  {
+    suite: 'memory', name: 'pool-allocate', sizes: [256, 16 * KB],
+    setup(size, { Memory }) {
+      const pool = Memory.createPool();
+      return {
+        lljs: () => Memory.poolRelease(pool, Memory.poolAlloc(pool, size)),
+        js: () => Buffer.allocUnsafe(size),
+        teardown: () => Memory.destroyPool(pool)
+      };
+    }
+  },
+  {
+    // Full process table with CPU times and RSS; the JS side parses /proc itself
+    suite: 'system', name: 'process-table', sizes: process.platform === 'linux' ? [1] : [],
+    setup(_size, { System }) {
+      const snapshot = System.createProcessSnapshot();
+      return {
+        lljs: () => snapshot.read({ names: false }),
+        js: () => {
+          const rows = [];
+          for (const entry of fs.readdirSync('/proc')) {
+            if (!/^\d+$/.test(entry)) continue;
+            try {
+              const stat = fs.readFileSync(`/proc/${entry}/stat`, 'latin1');
+              const fields = stat.slice(stat.lastIndexOf(')') + 2).split(' ');
+              rows.push({ pid: +entry, ppid: +fields[1], utime: +fields[11], stime: +fields[12], rss: +fields[21] });
+            } catch {
+              // Exited while listing
+            }
+          }
+          return rows;
+        },
+        teardown: () => snapshot.close()
+      };
+    }
+  },
+  {
+    // Start and reap a short-lived helper with its stdout piped
+    suite: 'system', name: 'spawn', sizes: process.platform === 'win32' ? [] : [1],
+    setup(_size, { System }) {
+      return {
+        isAsync: true,
+        lljs: () => System.spawn('true').exited,
+        js: () => new Promise((resolve) => childProcess.spawn('true', { stdio: ['ignore', 'pipe', 'pipe'] }).on('close', resolve))
+      };
+    }
+  },
+  {
+    // Uncontended lock/unlock pair
+    suite: 'threading', name: 'mutex', sizes: [1],
+    setup(_size, { Threading }) {
+      const mutex = Threading.createMutex();
+      const lock = new Int32Array(new SharedArrayBuffer(4));
+      return {
+        lljs: () => { Threading.lockMutex(mutex); Threading.unlockMutex(mutex); },
+        js: () => { while (Atomics.compareExchange(lock, 0, 0, 1) !== 0); Atomics.store(lock, 0, 0); },
+        teardown: () => Threading.destroyMutex(mutex)
+      };
+    }
+  },
+  {
+    // One push and one pop of a slot-sized message
+    suite: 'threading', name: 'ring', sizes: [64, 4 * KB],
+    setup(size, { Threading }) {
+      const ring = Threading.createRing(1024, size, 'spsc');
+      const message = new Uint8Array(size);
+      const out = new Uint8Array(size);
+      const queue = [];
+      return {
+        lljs: () => { Threading.ringPush(ring, message); Threading.ringPop(ring, out); },
+        js: () => { queue.push(message.slice()); out.set(queue.shift()); }
+      };
+    }
+  }
+];
@@ -29,21 +29,41 @@ function createMockNative(): any {
     setMemory: mockFunction,
     compareMemory: mockFunction,
     getMemoryUsage: () => ({ rss: 0, peak: 0, pageFaults: 0 }),
-    alignedAlloc: mockFunction,
+    alignedAlloc: (size: number, _alignment: number, options?: object) =>
+      options ? Object.assign(Buffer.alloc(size), { pageSize: 4096, transparentHugePages: false, locked: false }) : mockFunction(),
     getPointerValue: mockFunction,
     setPointerValue: mockFunction,
+    createPool: () => ({ id: 0, handle: null, slabs: [] }),
+    poolAlloc: (_pool: unknown, size: number) => new Uint8Array(size),
+    poolArenaAlloc: (_pool: unknown, size: number) => new Uint8Array(size),
+    poolRelease: () => false,
+    poolReset: () => true,
+    destroyPool: () => true,
+    allocateOnNode: (size: number) => Buffer.alloc(size),
+    getMemoryNode: () => -1,
     
     // CPU functions
-    getCPUInfo: () => ({ vendor: 'Mock', model: 'Mock CPU', cores: 1, features: {}, cache: {} }),
+    getCPUInfo: () => ({ vendor: 'Mock', model: 'Mock CPU', cores: 1, features: {}, simd: 'scalar', cache: {} }),
     getCoreCount: () => 1,
     getCacheInfo: () => ({ l1d: 0, l1i: 0, l2: 0, l3: 0 }),
     executeAssembly: mockFunction,
     getCPUUsage: () => 0,
     setCPUAffinity: () => false,
+    getTopology: () => ({
+      cpus: [{ cpu: 0, package: 0, core: 0, node: 0, l2: -1, l3: -1 }],
+      packages: [[0]], cores: [[0]], l2: [], l3: [], nodes: [{ node: 0, cpus: [0], memory: 0 }]
+    }),
     getRegisters: () => ({ eax: 0, ebx: 0, ecx: 0, edx: 0 }),
     prefetchMemory: () => false,
+    prefetchRange: (view: ArrayBufferView, offset = 0, length?: number) =>
+      length === undefined ? view.byteLength - offset : length,
     getCPUTemperature: () => -1,
     getCPUFrequency: () => ({ base: 0, current: 0, max: 0 }),
+    perfOpen: (events: string[]) => ({ id: 0, handle: null, events, rdpmc: false }),
+    perfStart: mockFunction,
+    perfStop: (_group: any, output?: Float64Array) => output || new Float64Array(0),
+    perfRead: (_group: any, output?: Float64Array) => output || new Float64Array(0),
+    perfClose: () => true,
     
     // System functions
     getSystemInfo: () => ({ platform: 'mock', arch: 'mock', version: '0.0.0', totalMemory: 0, freeMemory: 0, uptime: 0 }),
@@ -53,7 +73,16 @@ function createMockNative(): any {
     getProcessId: () => 0,
     killProcess: () => false,
     createProcess: () => -1,
+    spawnProcess: () => ({ id: 0, pid: -1, exited: Promise.resolve({ code: null, signal: null }) }),
+    killSpawnedProcess: () => false,
     getProcessList: () => [],
+    createProcessSnapshot: () => ({ id: 0, handle: null }),
+    readProcessSnapshot: () => ({
+      count: 0, pid: new Int32Array(0), ppid: new Int32Array(0), state: new Uint8Array(0),
+      userTime: new Float64Array(0), systemTime: new Float64Array(0), rss: new Float64Array(0),
+      threads: new Uint32Array(0), startTime: new Float64Array(0), names: [], removed: new Int32Array(0)
+    }),
+    destroyProcessSnapshot: () => true,
     
     // I/O functions
     readFile: mockFunction,
@@ -64,6 +93,22 @@ function createMockNative(): any {
     flushFile: mockFunction,
     getFileInfo: mockFunction,
     directoryOperations: mockFunction,
+    walkDirectory: () => Promise.resolve({ entries: 0, directories: 0, errors: 0, stopped: false }),
+    createIoRing: () => ({ id: 0, handle: null, backend: 'threadpool' }),
+    ioRingRegisterFile: () => 0,
+    ioRingRegisterBuffer: () => 0,
+    ioRingQueue: () => 0,
+    ioRingSubmit: () => 0,
+    destroyIoRing: () => true,
+    readFileAsync: () => Promise.resolve(0),
+    writeFileAsync: () => Promise.resolve(0),
+    readAt: () => Promise.resolve(0),
+    writeAt: () => Promise.resolve(0),
+    preadv: () => Promise.resolve(0),
+    pwritev: () => Promise.resolve(0),
+    mapFile: () => Buffer.alloc(0),
+    msync: () => false,
+    madvise: () => false,
     
     // Threading functions
     createThread: mockFunction,
@@ -73,9 +118,20 @@ function createMockNative(): any {
     createMutex: mockFunction,
     lockMutex: mockFunction,
     unlockMutex: mockFunction,
+    destroyMutex: mockFunction,
     createSemaphore: mockFunction,
     waitSemaphore: mockFunction,
     signalSemaphore: mockFunction,
+    destroySemaphore: mockFunction,
+    runBatch: (kernel: string, items: unknown[]) =>
+      Promise.resolve(kernel === 'hash' ? new BigUint64Array(items.length) : new Float64Array(items.length)),
+    getPoolInfo: () => ({ threads: 0, pending: 0, executed: 0, stolen: 0 }),
+    setPoolAffinity: () => false,
+    ringByteLength: () => 256,
+    ringInit: () => true,
+    ringPush: () => false,
+    ringPop: () => -1,
+    ringInfo: () => ({ kind: 'spsc', capacity: 0, slotSize: 0, size: 0 }),
     
     // Time functions
     getHighResTime: () => Date.now() * 1000000,
@@ -89,6 +145,18 @@ function createMockNative(): any {
     getMonotonicTime: () => Date.now() * 1000000,
     measureElapsed: (start: number, end: number) => end - start,
     getTimeZoneInfo: () => ({ bias: 0, standardName: 'Mock', daylightName: 'Mock', isDST: false }),
+    readCycles: () => process.hrtime.bigint(),
+    writeCycles: (target: BigUint64Array, index: number = 0) => { target[index] = process.hrtime.bigint(); },
+    cyclesToNanoseconds: (cycles: number | bigint) => Number(cycles),
+    getCycleClockInfo: () => ({ source: 'steady_clock', frequency: 1e9, invariant: true, ordered: true, overhead: 0 }),
+    createHistogram: () => ({ id: 0, handle: null, lowest: 1, highest: 3.6e12, sigfigs: 3 }),
+    histogramRecord: mockFunction,
+    histogramTime: (_histogram: any, fn: () => any) => fn(),
+    histogramAdd: () => 0,
+    histogramPercentile: () => 0,
+    histogramSnapshot: () => ({ count: 0, min: 0, max: 0, mean: 0, stddev: 0, p50: 0, p90: 0, p99: 0, p999: 0, p9999: 0 }),
+    histogramReset: () => true,
+    destroyHistogram: () => true,
     
     // Math functions
     fastSqrt: globalThis.Math.sqrt,
@@ -96,8 +164,22 @@ function createMockNative(): any {
     vectorOperations: mockFunction,
     matrixOperations: mockFunction,
     bitwiseOperations: mockFunction,
+    executeCommands: mockFunction,
     randomNumbers: (count: number) => Array(count).fill(0).map(() => globalThis.Math.random()),
+    fillRandom: <T extends RandomFillTarget>(array: T) => {
+      if (array instanceof Float64Array || array instanceof Float32Array) {
+        array.forEach((_, i) => { array[i] = globalThis.Math.random(); });
+      }
+      return array;
+    },
     fastFourierTransform: mockFunction,
+    createFFTPlan: (n: number, options: FFTPlanOptions = {}) => ({
+      id: 0, handle: null, n, real: !!options.real, inverse: !!options.inverse,
+      inputLength: options.real && options.inverse ? 2 * (globalThis.Math.floor(n / 2) + 1) : options.real ? n : 2 * n,
+      outputLength: options.real && !options.inverse ? 2 * (globalThis.Math.floor(n / 2) + 1) : options.real ? n : 2 * n
+    }),
+    executeFFTPlan: (_plan: FFTPlan, input: Float64Array, output?: Float64Array) => output || input,
+    destroyFFTPlan: () => true,
     
     // String functions
     fastStringCompare: (a: string, b: string) => a.localeCompare(b),
@@ -107,7 +189,29 @@ function createMockNative(): any {
     stringSearch: (haystack: string, needle: string) => haystack.indexOf(needle),
     stringHash: () => 0,
     stringValidate: mockFunction,
-    stringReplace: (str: string, search: string, replace: string) => str.replace(search, replace)
+    stringReplace: (str: string, search: string, replace: string) => str.replace(search, replace),
+    findAll: () => new Uint32Array(0),
+    createMatcher: (patterns: ByteInput[]) => ({ id: 0, handle: null, patternCount: patterns.length, states: 0 }),
+    matcherScan: () => ({ offsets: new Uint32Array(0), patterns: new Uint32Array(0) }),
+    destroyMatcher: () => true,
+    bufferLength: (buffer: Uint8Array) => buffer.length,
+    bufferHash: () => 0,
+    bufferValidate: () => true,
+    bufferCompare: () => 0,
+    hash: () => 0n,
+    createHasher: (algorithm: string = 'xxh3') => ({ id: 0, handle: null, algorithm }),
+    hasherUpdate: () => 0,
+    hasherDigest: () => 0n,
+    destroyHasher: () => true,
+    transcode: (input: Uint8Array) => Buffer.from(input),
+    decodeUtf8: (buffer: Uint8Array) => Buffer.from(buffer).toString(),
+    stringBatch: (operation: string, _packed: Uint8Array, offsets: Uint32Array) => {
+      const count = Math.max(offsets.length - 1, 0);
+      if (operation === 'hash') return new BigUint64Array(count);
+      if (operation === 'validate') return new Uint8Array(count);
+      if (operation === 'compare') return new Int32Array(count);
+      return new Uint32Array(count);
+    }
   };
 }
 
@@ -118,8 +222,190 @@ export interface MemoryUsage {
   pageFaults?: number;
   userTime?: number;
   systemTime?: number;
+  /** Totals across all buffer pools */
+  pools?: PoolStats;
+  /** Live buffers from allocateBuffer and alignedAlloc; reported to V8 as external memory */
+  buffers?: { count: number; bytes: number };
 }
 
+export interface PoolStats {
+  count: number;
+  /** Bytes of slab memory still allocated, including slabs only kept alive by views */
+  reservedBytes: number;
+  /** Bytes handed out, rounded to block or alignment size */
+  usedBytes: number;
+  allocations: number;
+  releases: number;
+  resets: number;
+}
+
+export interface PoolOptions {
+  /** Bytes per slab (default 1 MiB) */
+  slabSize?: number;
+  /** Block sizes in bytes (default [256, 1024, 4096, 16384, 65536]) */
+  classes?: number[];
+  /** Power-of-two alignment of every allocation (default 64) */
+  alignment?: number;
+}
+
+export interface BufferPool {
+  id: number;
+  handle: any;
+  /** Backing slabs; do not modify */
+  slabs: ArrayBuffer[];
+}
+
+export type RandomFillTarget =
+  | Float64Array | Float32Array
+  | Int8Array | Uint8Array | Uint8ClampedArray | Int16Array | Uint16Array | Int32Array | Uint32Array
+  | BigInt64Array | BigUint64Array;
+
+export interface RandomFillOptions {
+  /** Float arrays: 'uniform' | 'normal' | 'exponential'; integer arrays: 'uniform' only */
+  distribution?: 'uniform' | 'normal' | 'exponential';
+  /** Same seed, same output, independent of thread count; omitted means fresh entropy */
+  seed?: number | bigint;
+  /** Uniform lower bound (inclusive); integer arrays default to raw random bits when min/max are omitted */
+  min?: number;
+  /** Uniform upper bound (exclusive for floats, inclusive for integers) */
+  max?: number;
+  mean?: number;
+  stddev?: number;
+  /** Exponential rate */
+  lambda?: number;
+}
+
+/**
+ * Opcodes for Math.bitwiseOperations and command buffers. Bitwise opcodes
+ * treat operands and results as 32-bit unsigned integers (clz/ctz of 0 is 32).
+ */
+export const MathOpcode = {
+  sqrt: 0,
+  invSqrt: 1,
+  add: 2,
+  subtract: 3,
+  multiply: 4,
+  divide: 5,
+  min: 6,
+  max: 7,
+  abs: 8,
+  and: 16,
+  or: 17,
+  xor: 18,
+  not: 19,
+  shl: 20,
+  shr: 21,
+  rotl: 22,
+  rotr: 23,
+  popcount: 24,
+  clz: 25,
+  ctz: 26
+} as const;
+
+export type MathOpcodeValue = typeof MathOpcode[keyof typeof MathOpcode];
+
+/** Scalar operations queued in JS and run by one native call */
+export interface CommandBuffer {
+  /** Commands as [opcode, a, b, result] quadruples */
+  readonly commands: Float64Array;
+  /** Commands queued since the last clear() */
+  readonly length: number;
+  /**
+   * Queues an operation
+   * @returns Index of the command, for result()
+   */
+  push(opcode: MathOpcodeValue, a: number, b?: number): number;
+  /** Runs every queued command; returns the number executed */
+  execute(): number;
+  /** Result of a command after execute() */
+  result(index: number): number;
+  /** Empties the queue, keeping the storage */
+  clear(): void;
+}
+
+export interface FFTPlanOptions {
+  /** Real input (forward) or real output (inverse) using half spectra of n/2 + 1 bins */
+  real?: boolean;
+  /** Inverse transform, scaled by 1/n */
+  inverse?: boolean;
+}
+
+export interface FFTPlan {
+  id: number;
+  handle: any;
+  n: number;
+  real: boolean;
+  inverse: boolean;
+  /** Float64Array elements per input frame: 2n interleaved complex, n real, or n/2 + 1 complex bins */
+  inputLength: number;
+  /** Float64Array elements per output frame */
+  outputLength: number;
+}
+
+/** Strings are searched as UTF-8; binary inputs are read in place */
+export type ByteInput = string | ArrayBufferView | ArrayBuffer;
+
+export interface FindAllOptions {
+  caseSensitive?: boolean;
+  /** Report matches that overlap an earlier one (default false) */
+  overlapping?: boolean;
+  /** Maximum number of offsets to return */
+  limit?: number;
+}
+
+export interface PatternMatcher {
+  id: number;
+  handle: any;
+  patternCount: number;
+  /** Automaton state count */
+  states: number;
+}
+
+export interface MatcherResult {
+  /** Byte offset where each match starts, ordered by match end */
+  offsets: Uint32Array;
+  /** Index into the pattern list for each match */
+  patterns: Uint32Array;
+}
+
+/** Strings laid end to end; string i spans bytes offsets[i] to offsets[i + 1] */
+export interface PackedStrings {
+  buffer: Uint8Array;
+  offsets: Uint32Array;
+}
+
+/** 32-bit algorithms fit a Number; xxh3, xxh3-128 and wyhash need hash() for full precision */
+export type HashAlgorithmName =
+  'djb2' | 'fnv1a' | 'murmur3' | 'crc32' | 'sdbm' | 'crc32c' | 'xxh3' | 'xxh3-128' | 'wyhash';
+
+/** Encodings accepted by transcode; 'ucs2' and 'binary' are aliases as in Node */
+export type TextEncodingName = 'utf8' | 'utf-8' | 'utf16le' | 'utf-16le' | 'ucs2' | 'latin1' | 'binary';
+
+/** Incremental hasher; digest() can be called at any point without ending the stream */
+export interface Hasher {
+  id: number;
+  handle: any;
+  algorithm: HashAlgorithmName;
+  update(input: string | ByteInput, offset?: number, length?: number): Hasher;
+  digest(): bigint;
+}
+
+export interface StringBatchOptions {
+  /** Hash algorithm for 'hash' (default 'djb2'); xxh3-128 writes two words per string, low first */
+  algorithm?: HashAlgorithmName;
+  /** Seed for xxh3, xxh3-128 and wyhash */
+  seed?: number | bigint;
+  /** Preallocated result array, reused across calls instead of allocating */
+  output?: BigUint64Array | Uint32Array | Uint8Array | Int32Array;
+  /** 'utf8' (default) or 'ascii' for 'validate' */
+  type?: 'utf8' | 'ascii';
+  /** Value every string is ordered against for 'compare' */
+  needle?: ByteInput;
+  caseSensitive?: boolean;
+}
+
+export type SIMDLevel = 'scalar' | 'sse2' | 'avx2' | 'avx512' | 'neon';
+
 export interface CPUInfo {
   vendor: string;
   model: string;
@@ -135,7 +421,13 @@ export interface CPUInfo {
     sse42: boolean;
     avx: boolean;
     fma: boolean;
+    avx2: boolean;
+    avx512f: boolean;
+    avx512bw: boolean;
+    neon: boolean;
   };
+  /** SIMD level used by the native kernels; lower it with the LLJS_SIMD environment variable */
+  simd: SIMDLevel;
   cache: {
     l1d: number;
     l1i: number;
@@ -146,6 +438,70 @@ export interface CPUInfo {
   };
 }
 
+export interface TopologyCPU {
+  /** Logical CPU index, as used by affinity sets */
+  cpu: number;
+  /** Index into CPUTopology.packages */
+  package: number;
+  /** Index into CPUTopology.cores (SMT sibling group) */
+  core: number;
+  /** NUMA node id, or -1 if unknown */
+  node: number;
+  /** Index into CPUTopology.l2, or -1 if unknown */
+  l2: number;
+  /** Index into CPUTopology.l3, or -1 if unknown */
+  l3: number;
+}
+
+export interface NUMANode {
+  node: number;
+  cpus: number[];
+  /** Total memory on the node in bytes (0 if unknown) */
+  memory: number;
+}
+
+/** Groups are lists of logical CPU indices */
+export interface CPUTopology {
+  cpus: TopologyCPU[];
+  packages: number[][];
+  /** SMT siblings sharing one physical core */
+  cores: number[][];
+  /** CPUs sharing each L2 cache */
+  l2: number[][];
+  /** CPUs sharing each L3 cache */
+  l3: number[][];
+  nodes: NUMANode[];
+}
+
+export interface AlignedAllocOptions {
+  /** Explicit huge pages (hugetlbfs / MEM_LARGE_PAGES), or a transparent huge page hint */
+  hugePages?: '2M' | '1G' | 'transparent';
+  /** Pin the pages in RAM (mlock / VirtualLock) */
+  lock?: boolean;
+  /** Fault every page in before returning */
+  prefault?: boolean;
+}
+
+/** Buffer from alignedAlloc with options, describing what the OS granted */
+export type PageBuffer = Buffer & {
+  /** Page size backing the buffer; the base page size when huge pages were unavailable */
+  pageSize: number;
+  /** True if transparent huge pages were requested successfully */
+  transparentHugePages: boolean;
+  /** True if the pages are locked in RAM */
+  locked: boolean;
+};
+
+/** How copyMemory/setMemory move bytes; unset fields are chosen by size */
+export interface BulkMemoryOptions {
+  /** Non-temporal stores that bypass the cache (default: above half the last-level cache) */
+  streaming?: boolean;
+  /** Split across the worker pool (default: above 64 MB) */
+  parallel?: boolean;
+}
+
+export type NUMAPolicy = 'bind' | 'preferred' | 'interleave';
+
 export interface SystemInfo {
   platform: string;
   arch: string;
@@ -162,6 +518,105 @@ export interface ProcessInfo {
   memoryUsage: number;
 }
 
+export interface ProcessSnapshotOptions {
+  /** Stat fds kept open between reads on Linux (default half the fd limit, at most 16384) */
+  maxOpenFiles?: number;
+}
+
+export interface ProcessTableReadOptions {
+  /** Only return processes that are new or whose counters changed since the last read */
+  changedOnly?: boolean;
+  /** Include command names (default true) */
+  names?: boolean;
+}
+
+/** Process table in columns; row i of every array describes the same process */
+export interface ProcessTable {
+  count: number;
+  pid: Int32Array;
+  ppid: Int32Array;
+  /** Linux state letter as a char code ('R', 'S', 'D', 'Z', ...); 0 on Windows */
+  state: Uint8Array;
+  /** User CPU time in ms */
+  userTime: Float64Array;
+  /** Kernel CPU time in ms */
+  systemTime: Float64Array;
+  /** Resident set (working set on Windows) in bytes */
+  rss: Float64Array;
+  threads: Uint32Array;
+  /** Start time in ms since boot (Linux) or since 1601 (Windows); tells reused pids apart */
+  startTime: Float64Array;
+  names?: string[];
+  /** Pids that exited since the previous read */
+  removed: Int32Array;
+}
+
+export type SpawnStdio = 'pipe' | 'ignore' | 'inherit';
+
+export interface SpawnOptions {
+  cwd?: string;
+  /** Replaces the environment; inherited when omitted */
+  env?: Record<string, string | undefined>;
+  /** 'ignore' (default) or 'inherit' */
+  stdin?: 'ignore' | 'inherit';
+  /** Default 'pipe' */
+  stdout?: SpawnStdio;
+  /** Default 'pipe' */
+  stderr?: SpawnStdio;
+  /** Receives stdout chunks as they arrive; without it piped output is collected into the result */
+  onStdout?: (chunk: Buffer) => void;
+  onStderr?: (chunk: Buffer) => void;
+}
+
+export interface SpawnResult {
+  /** Exit status, or null when killed by a signal or reaped elsewhere */
+  code: number | null;
+  signal: number | null;
+  /** Collected output when piped without a callback */
+  stdout?: Buffer;
+  stderr?: Buffer;
+}
+
+export interface SpawnedProcess {
+  pid: number;
+  /** Resolves once the process has exited and its output is fully delivered */
+  exited: Promise<SpawnResult>;
+  /** Signals the process; false once it has exited, so a reused pid is never hit */
+  kill(signal?: number): boolean;
+}
+
+/** Reusable process table reader; keeps fds and buffers between reads */
+export interface ProcessSnapshot {
+  id: number;
+  handle: any;
+  read(options?: ProcessTableReadOptions): ProcessTable;
+  close(): boolean;
+}
+
+export interface PoolInfo {
+  /** Worker threads (one per logical core) */
+  threads: number;
+  /** Tasks queued but not yet started */
+  pending: number;
+  /** Tasks completed since startup */
+  executed: number;
+  /** Tasks an idle worker took from another worker's queue */
+  stolen: number;
+}
+
+export interface HashBatchOptions {
+  algorithm?: HashAlgorithmName;
+}
+
+export interface SearchBatchOptions {
+  pattern: string | Buffer;
+}
+
+export interface DotBatchOptions {
+  /** Vector every input is multiplied with; same element type as the inputs */
+  vector: Float64Array | Float32Array;
+}
+
 export interface ThreadHandle {
   id: number;
   handle: any;
@@ -178,12 +633,47 @@ export interface SemaphoreHandle {
   count: number;
 }
 
+/** 'spsc': one producer and one consumer thread; 'mpmc': any number of each */
+export type RingKind = 'spsc' | 'mpmc';
+
+/** Fixed-slot message ring laid out in a SharedArrayBuffer; post `buffer` to other workers */
+export interface Ring {
+  buffer: SharedArrayBuffer;
+  view: Uint8Array;
+}
+
+export interface RingInfo {
+  kind: RingKind;
+  capacity: number;
+  slotSize: number;
+  /** Approximate number of queued messages */
+  size: number;
+}
+
+/** File offsets and lengths; use bigint or a safe integer for positions past 2^53 - 1 */
+export type FileOffset = number | bigint;
+
 export interface FileHandle {
   fd: number;
   path: string;
   mode: string;
 }
 
+export type MapAdvice = 'normal' | 'sequential' | 'random' | 'willneed' | 'dontneed';
+
+export interface MapFileOptions {
+  /** File offset of the first mapped byte */
+  offset?: FileOffset;
+  /** Bytes to map (defaults to the rest of the file) */
+  length?: FileOffset;
+  /** Map read-only (default true); writable mappings are shared with the file */
+  readonly?: boolean;
+  /** Prefault the pages up front */
+  populate?: boolean;
+  /** Initial access pattern hint */
+  advice?: MapAdvice;
+}
+
 export interface FileInfo {
   size: number;
   created: Date;
@@ -193,12 +683,198 @@ export interface FileInfo {
   permissions: number;
 }
 
+export interface WalkOptions {
+  /** Globs a file must match; patterns with '/' match the path relative to the root, others the name */
+  include?: string | string[];
+  /** Globs for files and directories to skip; an excluded directory is not descended into */
+  exclude?: string | string[];
+  /** Size bounds in bytes for non-directory entries */
+  minSize?: number;
+  maxSize?: number;
+  /** Levels below the root to visit (default unlimited; 1 lists the root only) */
+  maxDepth?: number;
+  /** Report sizes and mtimes (default true); false skips the per-entry stat where possible */
+  stat?: boolean;
+  /** Also report directories (default false) */
+  directories?: boolean;
+  /** Entries per batch (default 4096) */
+  batchSize?: number;
+  /** Walker threads (default min(4, cores)) */
+  concurrency?: number;
+}
+
+/** Entry type codes in WalkBatch.types */
+export const WalkEntryType = {
+  other: 0,
+  file: 1,
+  directory: 2,
+  symlink: 3
+} as const;
+
+/** Walk results in columns; row i of every array describes the same entry */
+export interface WalkBatch {
+  count: number;
+  /** Paths relative to the root, '/'-separated */
+  paths: string[];
+  types: Uint8Array;
+  /** Present unless stat is false */
+  sizes?: Float64Array;
+  /** Modification times in ms since the epoch; present unless stat is false */
+  mtimes?: Float64Array;
+}
+
+export interface WalkSummary {
+  entries: number;
+  directories: number;
+  /** Directories or entries that could not be read */
+  errors: number;
+  /** True when onBatch stopped the walk */
+  stopped: boolean;
+}
+
+export interface IoRingOptions {
+  /** Submission queue size (default 256) */
+  entries?: number;
+  /** 'threadpool' skips io_uring and IOCP */
+  backend?: 'auto' | 'threadpool';
+}
+
+/** Completions in columns; results are bytes transferred or a negative errno (Windows error code) */
+export interface IoCompletionBatch {
+  count: number;
+  userData: Float64Array;
+  results: Float64Array;
+}
+
+/** Batched I/O against registered files and Buffers */
+export interface IoRing {
+  id: number;
+  handle: any;
+  backend: 'io_uring' | 'iocp' | 'threadpool';
+  /**
+   * Registers an OpenFile handle (kept open by the caller) or opens a path the
+   * ring closes itself; direct bypasses the page cache and needs aligned
+   * Buffers, positions and lengths (see Memory.alignedAlloc)
+   */
+  registerFile(file: FileHandle | string, mode?: string, direct?: boolean): number;
+  /** Pins a Buffer for the ring's lifetime */
+  registerBuffer(buffer: Buffer): number;
+  /** Queues a read into buffer[offset, offset + length) from position */
+  read(file: number, buffer: number, position: FileOffset, userData: number, length?: number, offset?: number): number;
+  /** Queues a write from buffer[offset, offset + length) at position */
+  write(file: number, buffer: number, position: FileOffset, userData: number, length?: number, offset?: number): number;
+  /**
+   * Queues a flush of file. Operations are not ordered, even within one
+   * submit(), so it only covers writes that have already completed
+   */
+  fsync(file: number, userData: number): number;
+  /** Hands every queued operation to the kernel in one batch; returns how many went, throws if the kernel refuses them */
+  submit(): number;
+  /** Waits for submitted operations, then closes ring-opened files */
+  close(): boolean;
+}
+
+export type PerfEventName =
+  'cycles' | 'instructions' | 'cache-references' | 'cache-misses' | 'branches' | 'branch-misses' |
+  'bus-cycles' | 'stalled-cycles-frontend' | 'stalled-cycles-backend' | 'ref-cycles' |
+  'l1d-loads' | 'l1d-misses' | 'l1i-misses' | 'llc-loads' | 'llc-misses' | 'dtlb-misses' |
+  'task-clock' | 'cpu-clock' | 'page-faults' | 'minor-faults' | 'major-faults' |
+  'context-switches' | 'cpu-migrations';
+
+export interface PerfCounterOptions {
+  /** Count the calling thread only (default true); false also counts threads started afterwards */
+  perThread?: boolean;
+  /** Leave out kernel-mode events (default true, needed when perf_event_paranoid >= 2) */
+  excludeKernel?: boolean;
+}
+
+/** perf_event counter group; counts are raw and reported in event order */
+export interface PerfCounterGroup {
+  id: number;
+  handle: any;
+  events: PerfEventName[];
+  /** Whether reads use user-space rdpmc instead of a syscall */
+  rdpmc: boolean;
+  start(): void;
+  /** Counts since start(); pass output to avoid allocating */
+  stop(output?: Float64Array): Float64Array;
+  /** Counts since open */
+  read(output?: Float64Array): Float64Array;
+  close(): boolean;
+}
+
 export interface CPUFrequencyInfo {
   base: number;
   current: number;
   max: number;
 }
 
+export interface TimerOptions {
+  /** Fire every interval until destroyed (default true); false fires once */
+  repeat?: boolean;
+  /** Don't keep the event loop alive while the timer is pending */
+  unref?: boolean;
+}
+
+/** Timer on the shared native timer wheel; callbacks run on the creating thread */
+export interface TimerHandle {
+  id: number;
+  /** Interval in microseconds */
+  interval: number;
+  repeat: boolean;
+}
+
+export interface CycleClockInfo {
+  /** Counter behind readCycles: 'rdtscp'/'rdtsc' (x86), 'cntvct' (ARM64) or 'steady_clock' (nanoseconds) */
+  source: 'rdtscp' | 'rdtsc' | 'cntvct' | 'steady_clock';
+  /** Ticks per second, calibrated against the monotonic clock for the TSC */
+  frequency: number;
+  /** False if the TSC may change rate with CPU frequency or sleep states */
+  invariant: boolean;
+  /** Whether reads wait for earlier instructions to complete */
+  ordered: boolean;
+  /** Ticks between two back-to-back reads */
+  overhead: number;
+}
+
+export interface HistogramOptions {
+  /** Smallest value distinguishable from 0 (default 1) */
+  lowest?: number;
+  /** Largest trackable value (default 3.6e12, an hour in nanoseconds); larger values count as this */
+  highest?: number;
+  /** Significant decimal digits kept for every value, 1-5 (default 3) */
+  sigfigs?: number;
+}
+
+export interface HistogramSnapshot {
+  count: number;
+  min: number;
+  max: number;
+  mean: number;
+  stddev: number;
+  p50: number;
+  p90: number;
+  p99: number;
+  p999: number;
+  p9999: number;
+}
+
+/** HDR histogram; post `id` to a worker and attachHistogram(id) there to record into the same counts */
+export interface Histogram {
+  id: number;
+  handle: any;
+  lowest: number;
+  highest: number;
+  sigfigs: number;
+  record(value: number | bigint, count?: number): void;
+  /** Runs fn and records its duration in nanoseconds, measured with the cycle counter */
+  time<T>(fn: () => T): T;
+  add(other: Histogram): number;
+  percentile(percentile: number): number;
+  snapshot(reset?: boolean): HistogramSnapshot;
+  reset(): boolean;
+}
+
 export interface TimeZoneInfo {
   bias: number;
   standardName: string;
@@ -212,12 +888,39 @@ export interface VectorOperation {
   b?: number[];
 }
 
+export type FloatVector = Float64Array | Float32Array;
+
+export interface TypedVectorOperation<T extends FloatVector = FloatVector> {
+  operation: VectorOperation['operation'];
+  a: T;
+  b?: T;
+  /** Preallocated destination; must match the type of a */
+  out?: T;
+}
+
 export interface MatrixOperation {
   operation: 'multiply' | 'transpose' | 'inverse' | 'determinant';
   matrix: number[][];
   matrix2?: number[][];
 }
 
+/** Row-major matrix over a typed array; stride (elements per row) defaults to cols */
+export interface FlatMatrix<T extends FloatVector = FloatVector> {
+  data: T;
+  rows: number;
+  cols: number;
+  stride?: number;
+}
+
+export interface TypedMatrixOperation<T extends FloatVector = FloatVector> {
+  operation: MatrixOperation['operation'] | 'solve';
+  matrix: FlatMatrix<T>;
+  /** Right operand for multiply, right-hand sides for solve */
+  matrix2?: FlatMatrix<T>;
+  /** Preallocated destination; must not overlap the operands of multiply/transpose */
+  out?: FlatMatrix<T>;
+}
+
 /**
  * Memory Management Module
  * Provides low-level memory operations
@@ -233,9 +936,10 @@ export namespace Memory {
   }
 
   /**
-   * Frees a memory buffer
+   * Frees a buffer from allocateBuffer or alignedAlloc immediately and detaches it,
+   * so it and every view of it become zero-length
    * @param buffer - Buffer to free
-   * @returns Success status
+   * @returns False for buffers not allocated by LLJS or already freed
    */
   export function freeBuffer(buffer: Buffer): boolean {
     return native.freeBuffer(buffer);
@@ -246,10 +950,11 @@ export namespace Memory {
    * @param dest - Destination buffer
    * @param src - Source buffer
    * @param size - Number of bytes to copy
+   * @param options - Streaming and multi-threaded copy; overlapping buffers always use memmove
    * @returns Success status
    */
-  export function copyMemory(dest: Buffer, src: Buffer, size: number): boolean {
-    return native.copyMemory(dest, src, size);
+  export function copyMemory(dest: Buffer, src: Buffer, size: number, options?: BulkMemoryOptions): boolean {
+    return native.copyMemory(dest, src, size, options);
   }
 
   /**
@@ -257,10 +962,11 @@ export namespace Memory {
    * @param buffer - Target buffer
    * @param value - Value to set (0-255)
    * @param size - Number of bytes to set
+   * @param options - Streaming and multi-threaded fill
    * @returns Success status
    */
-  export function setMemory(buffer: Buffer, value: number, size: number): boolean {
-    return native.setMemory(buffer, value, size);
+  export function setMemory(buffer: Buffer, value: number, size: number, options?: BulkMemoryOptions): boolean {
+    return native.setMemory(buffer, value, size, options);
   }
 
   /**
@@ -286,10 +992,38 @@ export namespace Memory {
    * Allocates aligned memory
    * @param size - Size in bytes
    * @param alignment - Alignment requirement (must be power of 2)
+   * @param options - Page-mapped allocation with huge pages, locking or prefaulting.
+   *                  Explicit huge pages fall back to transparent ones, then base
+   *                  pages, when none are reserved; check pageSize on the result.
    * @returns Aligned buffer or null on failure
    */
-  export function alignedAlloc(size: number, alignment: number): Buffer | null {
-    return native.alignedAlloc(size, alignment);
+  export function alignedAlloc(size: number, alignment: number): Buffer | null;
+  export function alignedAlloc(size: number, alignment: number, options: AlignedAllocOptions): PageBuffer;
+  export function alignedAlloc(size: number, alignment: number, options?: AlignedAllocOptions): Buffer | null {
+    return options ? native.alignedAlloc(size, alignment, options) : native.alignedAlloc(size, alignment);
+  }
+
+  /**
+   * Allocates page-backed memory placed on NUMA nodes (mbind / VirtualAllocExNuma).
+   * Pages are placed on first touch; free it with freeBuffer like other native buffers.
+   * @param size - Size in bytes
+   * @param node - Node id, or node ids for 'interleave' (Windows takes a single node)
+   * @param policy - 'bind' (default), 'preferred' or 'interleave'
+   * @returns Buffer backed by node-local pages
+   */
+  export function allocateOnNode(size: number, node: number | number[], policy: NUMAPolicy = 'bind'): Buffer {
+    return native.allocateOnNode(size, node, policy);
+  }
+
+  /**
+   * Gets the NUMA node holding a byte of a buffer; never touches the page,
+   * so read-only mappings and shared Buffers are safe to query
+   * @param buffer - Buffer to inspect
+   * @param offset - Byte offset (default 0)
+   * @returns Node id, or -1 if the page is not resident or the OS cannot report it
+   */
+  export function getMemoryNode(buffer: Buffer, offset: FileOffset = 0): number {
+    return native.getMemoryNode(buffer, offset);
   }
 
   /**
@@ -314,6 +1048,67 @@ export namespace Memory {
   export function setPointerValue(address: number, type: string, value: number): boolean {
     return native.setPointerValue(address, type, value);
   }
+
+  /**
+   * Creates a buffer pool with size-class slabs and a bump-pointer arena.
+   * Allocations are views into shared slabs: no malloc and no finalizer per buffer.
+   * @param options - Slab size, size classes and alignment
+   * @returns Pool handle; dropping it releases the pool
+   */
+  export function createPool(options?: PoolOptions): BufferPool {
+    return native.createPool(options);
+  }
+
+  /**
+   * Allocates an uninitialized buffer from the smallest fitting size class.
+   * Requests above the largest class get a dedicated slab.
+   * @param pool - Pool handle
+   * @param size - Size in bytes
+   * @returns Buffer backed by pool memory
+   */
+  export function poolAlloc(pool: BufferPool, size: number): Buffer {
+    const view: Uint8Array = native.poolAlloc(pool, size);
+    return Buffer.from(view.buffer, view.byteOffset, view.byteLength);
+  }
+
+  /**
+   * Bump-allocates an uninitialized buffer; arena memory is only reclaimed by poolReset
+   * @param pool - Pool handle
+   * @param size - Size in bytes
+   * @returns Buffer backed by pool memory
+   */
+  export function poolArenaAlloc(pool: BufferPool, size: number): Buffer {
+    const view: Uint8Array = native.poolArenaAlloc(pool, size);
+    return Buffer.from(view.buffer, view.byteOffset, view.byteLength);
+  }
+
+  /**
+   * Returns a poolAlloc buffer to its pool immediately; do not use it afterwards
+   * @param pool - Pool handle
+   * @param buffer - Buffer from poolAlloc
+   * @returns False for arena, foreign or already released buffers
+   */
+  export function poolRelease(pool: BufferPool, buffer: Uint8Array): boolean {
+    return native.poolRelease(pool, buffer);
+  }
+
+  /**
+   * Releases every allocation of a pool at once, keeping its slabs for reuse
+   * @param pool - Pool handle
+   * @returns Success status
+   */
+  export function poolReset(pool: BufferPool): boolean {
+    return native.poolReset(pool);
+  }
+
+  /**
+   * Destroys a pool; slab memory is freed once no buffers reference it
+   * @param pool - Pool handle
+   * @returns Success status
+   */
+  export function destroyPool(pool: BufferPool): boolean {
+    return native.destroyPool(pool);
+  }
 }
 
 /**
@@ -365,14 +1160,22 @@ export namespace CPU {
   }
 
   /**
-   * Sets CPU affinity for current process
-   * @param mask - CPU core mask
+   * Sets CPU affinity: the calling thread on Linux, the process on Windows
+   * @param mask - CPU core mask (CPUs 0-52), or an array of CPU indices of any width
    * @returns Success status
    */
-  export function setCPUAffinity(mask: number): boolean {
+  export function setCPUAffinity(mask: number | number[]): boolean {
     return native.setCPUAffinity(mask);
   }
 
+  /**
+   * Gets the processor topology: packages, NUMA nodes, SMT siblings and L2/L3 sharing groups
+   * @returns Topology with per-CPU group indices
+   */
+  export function getTopology(): CPUTopology {
+    return native.getTopology();
+  }
+
   /**
    * Gets CPU register values
    * @returns Register values object
@@ -391,6 +1194,18 @@ export namespace CPU {
     return native.prefetchMemory(address, locality);
   }
 
+  /**
+   * Prefetches every cache line of a buffer range
+   * @param buffer - Buffer or typed array
+   * @param offset - Byte offset into the view
+   * @param length - Byte count (default: to the end of the view)
+   * @param locality - 0 (non-temporal) to 3 (all cache levels)
+   * @returns Number of bytes covered
+   */
+  export function prefetchRange(buffer: ArrayBufferView, offset: number = 0, length?: number, locality: number = 3): number {
+    return native.prefetchRange(buffer, offset, length, locality);
+  }
+
   /**
    * Gets CPU temperature (if available)
    * @returns Temperature in Celsius or -1 if unavailable
@@ -406,6 +1221,35 @@ export namespace CPU {
   export function getCPUFrequency(): CPUFrequencyInfo {
     return native.getCPUFrequency();
   }
+
+  /**
+   * Hardware and software performance counters (Linux perf_event_open)
+   */
+  export namespace perfCounters {
+    /**
+     * Opens a counter group; throws if an event is unsupported or perf is disabled
+     * @param events - Events to count together
+     * @param options - perThread and excludeKernel
+     * @returns Counter group with start(), stop(), read() and close()
+     */
+    export function open(events: PerfEventName[], options?: PerfCounterOptions): PerfCounterGroup {
+      const group = native.perfOpen(events, options);
+      return Object.assign(group, {
+        start(): void {
+          native.perfStart(group);
+        },
+        stop(output?: Float64Array): Float64Array {
+          return native.perfStop(group, output);
+        },
+        read(output?: Float64Array): Float64Array {
+          return native.perfRead(group, output);
+        },
+        close(): boolean {
+          return native.perfClose(group);
+        }
+      });
+    }
+  }
 }
 
 /**
@@ -479,6 +1323,42 @@ export namespace System {
     return native.createProcess(command, args, options);
   }
 
+  /**
+   * Spawns a process directly (no shell) with posix_spawn, which avoids
+   * copying the parent's page tables. Output arrives in pooled Buffers and
+   * the exit is reported through the event loop. Not available on Windows.
+   * @param file - Executable, looked up in PATH
+   * @param args - Arguments after argv[0]
+   * @param options - cwd, env, stdio modes and output callbacks
+   * @returns Child with pid, exited promise and kill()
+   */
+  export function spawn(file: string, args: string[] = [], options: SpawnOptions = {}): SpawnedProcess {
+    const collected: { stdout?: Buffer[]; stderr?: Buffer[] } = {};
+    const streams = { ...options };
+    for (const name of ['stdout', 'stderr'] as const) {
+      const callback = name === 'stdout' ? 'onStdout' : 'onStderr';
+      if ((options[name] ?? 'pipe') === 'pipe' && !options[callback]) {
+        const chunks: Buffer[] = [];
+        collected[name] = chunks;
+        streams[callback] = (chunk) => chunks.push(chunk);
+      }
+    }
+
+    const child = native.spawnProcess(file, args, streams);
+    const exited = child.exited.then((result: SpawnResult) => {
+      if (collected.stdout) result.stdout = Buffer.concat(collected.stdout);
+      if (collected.stderr) result.stderr = Buffer.concat(collected.stderr);
+      return result;
+    });
+    return {
+      pid: child.pid,
+      exited,
+      kill(signal?: number): boolean {
+        return native.killSpawnedProcess(child.id, signal);
+      }
+    };
+  }
+
   /**
    * Gets list of running processes
    * @returns Array of process information
@@ -486,6 +1366,25 @@ export namespace System {
   export function getProcessList(): ProcessInfo[] {
     return native.getProcessList();
   }
+
+  /**
+   * Creates a process table reader for repeated polling. Linux reads /proc
+   * with getdents64 and one pread per process on cached fds; Windows uses
+   * one Toolhelp snapshot per read.
+   * @param options - fd cache size
+   * @returns Snapshot with read() and close()
+   */
+  export function createProcessSnapshot(options?: ProcessSnapshotOptions): ProcessSnapshot {
+    const snapshot = native.createProcessSnapshot(options);
+    return Object.assign(snapshot, {
+      read(readOptions?: ProcessTableReadOptions): ProcessTable {
+        return native.readProcessSnapshot(snapshot, readOptions);
+      },
+      close(): boolean {
+        return native.destroyProcessSnapshot(snapshot);
+      }
+    });
+  }
 }
 
 /**
@@ -497,10 +1396,10 @@ export namespace IO {
    * Reads file content
    * @param path - File path
    * @param offset - Read offset
-   * @param length - Number of bytes to read
+   * @param length - Number of bytes to read (clamped to the end of the file)
    * @returns File content buffer
    */
-  export function readFile(path: string, offset?: number, length?: number): Buffer {
+  export function readFile(path: string, offset?: FileOffset, length?: FileOffset): Buffer {
     return native.readFile(path, offset, length);
   }
 
@@ -511,7 +1410,7 @@ export namespace IO {
    * @param offset - Write offset
    * @returns Number of bytes written
    */
-  export function writeFile(path: string, data: Buffer, offset?: number): number {
+  export function writeFile(path: string, data: Buffer, offset?: FileOffset): number {
     return native.writeFile(path, data, offset);
   }
 
@@ -541,7 +1440,7 @@ export namespace IO {
    * @param whence - Seek origin (0=start, 1=current, 2=end)
    * @returns New position
    */
-  export function seekFile(handle: FileHandle, position: number, whence: number = 0): number {
+  export function seekFile(handle: FileHandle, position: FileOffset, whence: number = 0): number {
     return native.seekFile(handle, position, whence);
   }
 
@@ -572,6 +1471,156 @@ export namespace IO {
   export function directoryOperations(operation: string, path: string): any {
     return native.directoryOperations(operation, path);
   }
+
+  /**
+   * Walks a directory tree recursively on background threads. Linux reads
+   * directories with getdents64 and stats entries relative to their
+   * directory fd; Windows uses FindFirstFileEx with large fetch. Filters are
+   * applied natively and matches stream to onBatch in columnar batches.
+   * Symlinks are reported but never followed.
+   * @param root - Directory to walk
+   * @param onBatch - Receives each batch; return false to stop the walk
+   * @param options - Filters, depth, stat and batching options
+   * @returns Totals once the walk has finished; rejects with the error if onBatch throws
+   */
+  export function walk(root: string, onBatch: (batch: WalkBatch) => boolean | void, options: WalkOptions = {}): Promise<WalkSummary> {
+    return native.walkDirectory(root, options, onBatch);
+  }
+
+  /**
+   * Creates a batched I/O ring: operations are queued, then submitted together
+   * (one io_uring_enter on Linux 5.6+, IOCP on Windows, the worker pool
+   * elsewhere) and completions arrive in batches
+   * @param onCompletion - Receives each batch of completions
+   * @param options - Queue size and backend
+   * @returns Ring
+   */
+  export function createRing(onCompletion: (batch: IoCompletionBatch) => void, options: IoRingOptions = {}): IoRing {
+    const ring = native.createIoRing(options, onCompletion);
+    return Object.assign(ring, {
+      registerFile(file: FileHandle | string, mode: string = 'r', direct: boolean = false): number {
+        return native.ioRingRegisterFile(ring, file, mode, direct);
+      },
+      registerBuffer(buffer: Buffer): number {
+        return native.ioRingRegisterBuffer(ring, buffer);
+      },
+      read(file: number, buffer: number, position: FileOffset, userData: number, length?: number, offset?: number): number {
+        return native.ioRingQueue(ring, 0, file, userData, buffer, position, length, offset);
+      },
+      write(file: number, buffer: number, position: FileOffset, userData: number, length?: number, offset?: number): number {
+        return native.ioRingQueue(ring, 1, file, userData, buffer, position, length, offset);
+      },
+      fsync(file: number, userData: number): number {
+        return native.ioRingQueue(ring, 2, file, userData);
+      },
+      submit(): number {
+        return native.ioRingSubmit(ring);
+      },
+      close(): boolean {
+        return native.destroyIoRing(ring);
+      }
+    });
+  }
+
+  /**
+   * Reads a file into a caller-supplied buffer without blocking the event loop
+   * @param path - File path
+   * @param buffer - Destination buffer
+   * @param position - File offset to read from
+   * @param length - Number of bytes to read (defaults to buffer.length)
+   * @returns Promise resolving to the number of bytes read (short at EOF)
+   */
+  export function readFileAsync(path: string, buffer: Buffer, position?: FileOffset, length?: number): Promise<number> {
+    return native.readFileAsync(path, buffer, position, length);
+  }
+
+  /**
+   * Writes a buffer to a file without blocking the event loop
+   * @param path - File path (created or truncated)
+   * @param data - Data to write
+   * @param position - File offset to write at
+   * @param length - Number of bytes to write (defaults to data.length)
+   * @returns Promise resolving to the number of bytes written
+   */
+  export function writeFileAsync(path: string, data: Buffer, position?: FileOffset, length?: number): Promise<number> {
+    return native.writeFileAsync(path, data, position, length);
+  }
+
+  /**
+   * Positional read from an open file; does not move the seek pointer on POSIX
+   * @param handle - File handle from openFile
+   * @param buffer - Destination buffer (must stay unmodified until the promise settles)
+   * @param position - File offset to read from
+   * @param length - Number of bytes to read (defaults to buffer.length)
+   * @returns Promise resolving to the number of bytes read (short at EOF)
+   */
+  export function readAt(handle: FileHandle, buffer: Buffer, position: FileOffset, length?: number): Promise<number> {
+    return native.readAt(handle, buffer, position, length);
+  }
+
+  /**
+   * Positional write to an open file; does not move the seek pointer on POSIX
+   * @param handle - File handle from openFile
+   * @param data - Data to write
+   * @param position - File offset to write at
+   * @param length - Number of bytes to write (defaults to data.length)
+   * @returns Promise resolving to the number of bytes written
+   */
+  export function writeAt(handle: FileHandle, data: Buffer, position: FileOffset, length?: number): Promise<number> {
+    return native.writeAt(handle, data, position, length);
+  }
+
+  /**
+   * Scatter read: fills the buffers in order from consecutive file offsets with preadv
+   * @param handle - File handle from openFile
+   * @param buffers - Destination buffers
+   * @param position - File offset of the first buffer
+   * @returns Promise resolving to the total bytes read (short at EOF)
+   */
+  export function preadv(handle: FileHandle, buffers: Buffer[], position: FileOffset = 0): Promise<number> {
+    return native.preadv(handle, buffers, position);
+  }
+
+  /**
+   * Gather write: writes the buffers in order to consecutive file offsets with pwritev
+   * @param handle - File handle from openFile
+   * @param buffers - Source buffers
+   * @param position - File offset of the first buffer
+   * @returns Promise resolving to the total bytes written
+   */
+  export function pwritev(handle: FileHandle, buffers: Buffer[], position: FileOffset = 0): Promise<number> {
+    return native.pwritev(handle, buffers, position);
+  }
+
+  /**
+   * Maps a file into memory without copying it
+   * @param path - File path
+   * @param options - Mapping range, protection and paging hints
+   * @returns Buffer backed by the page cache; unmapped when garbage collected
+   */
+  export function mapFile(path: string, options?: MapFileOptions): Buffer {
+    return native.mapFile(path, options);
+  }
+
+  /**
+   * Flushes modified pages of a mapped buffer to its file
+   * @param buffer - Buffer from mapFile, or a subarray of one
+   * @param async - Schedule the write-back instead of waiting for it
+   * @returns Success status
+   */
+  export function msync(buffer: Buffer, async: boolean = false): boolean {
+    return native.msync(buffer, async);
+  }
+
+  /**
+   * Gives the kernel an access pattern hint for a mapped buffer
+   * @param buffer - Buffer from mapFile, or a subarray of one
+   * @param advice - Access pattern hint
+   * @returns Success status
+   */
+  export function madvise(buffer: Buffer, advice: MapAdvice): boolean {
+    return native.madvise(buffer, advice);
+  }
 }
 
 /**
@@ -636,12 +1685,21 @@ export namespace Threading {
   /**
    * Unlocks a mutex
    * @param handle - Mutex handle
-   * @returns Success status
+   * @returns Success status; false unless the calling thread holds the mutex
    */
   export function unlockMutex(handle: MutexHandle): boolean {
     return native.unlockMutex(handle);
   }
 
+  /**
+   * Destroys a mutex; its handle becomes invalid
+   * @param handle - Mutex handle
+   * @returns Success status (false while the mutex is locked)
+   */
+  export function destroyMutex(handle: MutexHandle): boolean {
+    return native.destroyMutex(handle);
+  }
+
   /**
    * Creates a semaphore
    * @param initialCount - Initial count
@@ -671,6 +1729,106 @@ export namespace Threading {
   export function signalSemaphore(handle: SemaphoreHandle, count: number = 1): number {
     return native.signalSemaphore(handle, count);
   }
+
+  /**
+   * Destroys a semaphore; its handle becomes invalid
+   * @param handle - Semaphore handle
+   * @returns Success status
+   */
+  export function destroySemaphore(handle: SemaphoreHandle): boolean {
+    return native.destroySemaphore(handle);
+  }
+
+  /**
+   * Runs a native kernel over a batch of inputs on the shared worker pool.
+   * Each input becomes one task; idle workers steal from busy ones.
+   * Inputs must not be modified until the promise settles.
+   * @param kernel - 'hash', 'search', 'sum' or 'dot'
+   * @param items - Buffers/TypedArrays (hash, search) or Float64Array/Float32Array (sum, dot)
+   * @param options - Kernel options
+   * @returns Promise resolving to one result per input (-1 for a search miss)
+   */
+  export function runBatch(kernel: 'hash', items: ArrayBufferView[], options?: HashBatchOptions): Promise<BigUint64Array>;
+  export function runBatch(kernel: 'search', items: ArrayBufferView[], options: SearchBatchOptions): Promise<Float64Array>;
+  export function runBatch(kernel: 'sum', items: FloatVector[]): Promise<Float64Array>;
+  export function runBatch(kernel: 'dot', items: FloatVector[], options: DotBatchOptions): Promise<Float64Array>;
+  export function runBatch(kernel: string, items: ArrayBufferView[], options?: object): Promise<BigUint64Array | Float64Array> {
+    return native.runBatch(kernel, items, options);
+  }
+
+  /**
+   * Gets worker pool statistics
+   * @returns Thread count and task counters
+   */
+  export function getPoolInfo(): PoolInfo {
+    return native.getPoolInfo();
+  }
+
+  /**
+   * Pins the worker pool threads
+   * @param cpus - One CPU set for every worker, one set per worker (assigned
+   *               round-robin, e.g. CPU.getTopology().cores), or null for all CPUs
+   * @returns True if every worker was pinned
+   */
+  export function setPoolAffinity(cpus: number[] | number[][] | null): boolean {
+    return native.setPoolAffinity(cpus ?? CPU.getTopology().cpus.map(entry => entry.cpu));
+  }
+
+  /**
+   * Creates a message ring in a new SharedArrayBuffer
+   * @param capacity - Number of slots, a power of two
+   * @param slotSize - Maximum message size in bytes
+   * @param kind - 'spsc' (default) or bounded 'mpmc'
+   * @returns Ring whose buffer can be posted to worker threads
+   */
+  export function createRing(capacity: number, slotSize: number, kind: RingKind = 'spsc'): Ring {
+    const buffer = new SharedArrayBuffer(native.ringByteLength(capacity, slotSize));
+    const view = new Uint8Array(buffer);
+    native.ringInit(view, capacity, slotSize, kind);
+    return { buffer, view };
+  }
+
+  /**
+   * Attaches to a ring created by another thread
+   * @param buffer - SharedArrayBuffer from createRing
+   * @returns Ring view over the same memory
+   */
+  export function attachRing(buffer: SharedArrayBuffer): Ring {
+    const view = new Uint8Array(buffer);
+    native.ringInfo(view);
+    return { buffer, view };
+  }
+
+  /**
+   * Enqueues a message; the caller parks (futex / WaitOnAddress) while the ring is full
+   * @param ring - Ring
+   * @param data - Message bytes, at most slotSize
+   * @param timeout - 0 (default) never blocks, negative blocks indefinitely, otherwise milliseconds
+   * @returns True if the message was enqueued
+   */
+  export function ringPush(ring: Ring, data: ArrayBufferView, timeout: number = 0): boolean {
+    return native.ringPush(ring.view, data, timeout);
+  }
+
+  /**
+   * Dequeues a message; the caller parks while the ring is empty
+   * @param ring - Ring
+   * @param out - Destination with room for slotSize bytes
+   * @param timeout - 0 (default) never blocks, negative blocks indefinitely, otherwise milliseconds
+   * @returns Message length in bytes, or -1 if no message arrived
+   */
+  export function ringPop(ring: Ring, out: ArrayBufferView, timeout: number = 0): number {
+    return native.ringPop(ring.view, out, timeout);
+  }
+
+  /**
+   * Gets ring geometry and fill level
+   * @param ring - Ring
+   * @returns Ring information
+   */
+  export function getRingInfo(ring: Ring): RingInfo {
+    return native.ringInfo(ring.view);
+  }
 }
 
 /**
@@ -712,13 +1870,14 @@ export namespace Time {
   }
 
   /**
-   * Creates a high-precision timer
-   * @param callback - Callback function
-   * @param interval - Interval in microseconds
+   * Creates a high-precision timer on the shared native timer wheel
+   * @param callback - Callback function, run on the JS thread
+   * @param interval - Interval in microseconds (fractions allowed)
+   * @param options - repeat (default true) and unref
    * @returns Timer handle
    */
-  export function createTimer(callback: Function, interval: number): any {
-    return native.createTimer(callback, interval);
+  export function createTimer(callback: () => void, interval: number, options?: TimerOptions): TimerHandle {
+    return native.createTimer(callback, interval, options);
   }
 
   /**
@@ -732,9 +1891,9 @@ export namespace Time {
   /**
    * Destroys a timer
    * @param handle - Timer handle
-   * @returns Success status
+   * @returns True if the timer was still active (a fired one-shot returns false)
    */
-  export function destroyTimer(handle: any): boolean {
+  export function destroyTimer(handle: TimerHandle): boolean {
     return native.destroyTimer(handle);
   }
 
@@ -771,6 +1930,95 @@ export namespace Time {
   export function getTimeZoneInfo(): TimeZoneInfo {
     return native.getTimeZoneInfo();
   }
+
+  /**
+   * Reads the cycle counter (TSC on x86, CNTVCT on ARM64)
+   * @returns Counter ticks; convert differences with cyclesToNanoseconds
+   */
+  export function readCycles(): bigint {
+    return native.readCycles();
+  }
+
+  /**
+   * Writes the cycle counter into a slot without allocating, for instrumenting hot code
+   * @param target - Slot array, typically reused for the whole measurement
+   * @param index - Slot index (default 0)
+   */
+  export function writeCycles(target: BigUint64Array, index: number = 0): void {
+    native.writeCycles(target, index);
+  }
+
+  /**
+   * Converts a number of cycle counter ticks to nanoseconds
+   * @param cycles - Tick count, usually the difference of two reads
+   * @returns Nanoseconds
+   */
+  export function cyclesToNanoseconds(cycles: number | bigint): number {
+    return native.cyclesToNanoseconds(cycles);
+  }
+
+  /**
+   * Adds the histogram methods to a native handle
+   * @param handle - Handle from createHistogram, or { id } when attaching
+   * @returns Histogram
+   */
+  function wrapHistogram(handle: any): Histogram {
+    return Object.assign(handle, {
+      record(value: number | bigint, count?: number): void {
+        native.histogramRecord(handle, value, count);
+      },
+      time<T>(fn: () => T): T {
+        return native.histogramTime(handle, fn);
+      },
+      add(other: Histogram): number {
+        return native.histogramAdd(handle, other);
+      },
+      percentile(percentile: number): number {
+        return native.histogramPercentile(handle, percentile);
+      },
+      snapshot(reset: boolean = false): HistogramSnapshot {
+        return native.histogramSnapshot(handle, reset);
+      },
+      reset(): boolean {
+        return native.histogramReset(handle);
+      }
+    });
+  }
+
+  /**
+   * Creates an HDR histogram with lock-free recording
+   * @param options - Trackable range and precision
+   * @returns Histogram handle with record(), time(), percentile() and snapshot()
+   */
+  export function createHistogram(options?: HistogramOptions): Histogram {
+    return wrapHistogram(native.createHistogram(options));
+  }
+
+  /**
+   * Uses a histogram created on another thread; the creating thread owns its lifetime
+   * @param id - Histogram id
+   * @returns Histogram sharing the creator's counts
+   */
+  export function attachHistogram(id: number): Histogram {
+    return wrapHistogram({ id, handle: null, lowest: 0, highest: 0, sigfigs: 0 });
+  }
+
+  /**
+   * Releases a histogram before garbage collection would
+   * @param histogram - Histogram from createHistogram
+   * @returns Success status
+   */
+  export function destroyHistogram(histogram: Histogram): boolean {
+    return native.destroyHistogram(histogram);
+  }
+
+  /**
+   * Describes the cycle counter; the first call may wait up to 10ms for calibration
+   * @returns Source, frequency and invariance of the counter
+   */
+  export function getCycleClockInfo(): CycleClockInfo {
+    return native.getCycleClockInfo();
+  }
 }
 
 /**
@@ -801,7 +2049,14 @@ export namespace Math {
    * @param operation - Operation configuration
    * @returns Operation result
    */
-  export function vectorOperations(operation: VectorOperation): number[] | number {
+  export function vectorOperations(operation: VectorOperation): number[] | number;
+  /**
+   * Vector operations on Float64Array/Float32Array without copying
+   * @param operation - Operation configuration with typed operands and optional output
+   * @returns Result written into out (or a new array of the same type), or a scalar
+   */
+  export function vectorOperations<T extends FloatVector>(operation: TypedVectorOperation<T>): T | number;
+  export function vectorOperations(operation: VectorOperation | TypedVectorOperation): number[] | FloatVector | number {
     return native.vectorOperations(operation);
   }
 
@@ -810,21 +2065,65 @@ export namespace Math {
    * @param operation - Operation configuration
    * @returns Operation result
    */
-  export function matrixOperations(operation: MatrixOperation): number[][] | number {
+  export function matrixOperations(operation: MatrixOperation): number[][] | number;
+  /**
+   * Matrix operations on flat Float64Array/Float32Array storage: blocked SIMD
+   * multi-core multiply, and LU-based determinant/inverse/solve
+   * @param operation - Operation configuration with flat operands and optional output
+   * @returns Result written into out (or a new matrix of the same type), or the determinant
+   */
+  export function matrixOperations<T extends FloatVector>(operation: TypedMatrixOperation<T>): FlatMatrix<T> | number;
+  export function matrixOperations(operation: MatrixOperation | TypedMatrixOperation): number[][] | FlatMatrix | number {
     return native.matrixOperations(operation);
   }
 
   /**
    * Bitwise operations
-   * @param operation - Operation type
+   * @param operation - Operation name, or a MathOpcode to skip name lookup
    * @param a - First operand
    * @param b - Second operand
    * @returns Operation result
    */
-  export function bitwiseOperations(operation: string, a: number, b?: number): number {
+  export function bitwiseOperations(operation: string | MathOpcodeValue, a: number, b?: number): number {
     return native.bitwiseOperations(operation, a, b);
   }
 
+  /**
+   * Creates a command buffer that runs many scalar operations per native call,
+   * so the JS/native transition is paid once per batch instead of per operation
+   * @param capacity - Maximum commands per batch
+   * @returns Command buffer backed by one Float64Array
+   */
+  export function createCommandBuffer(capacity: number): CommandBuffer {
+    const commands = new Float64Array(capacity * 4);
+    let length = 0;
+    return {
+      commands,
+      get length() {
+        return length;
+      },
+      push(opcode: MathOpcodeValue, a: number, b: number = 0): number {
+        if (length === capacity) {
+          throw new RangeError('Command buffer is full');
+        }
+        const base = length * 4;
+        commands[base] = opcode;
+        commands[base + 1] = a;
+        commands[base + 2] = b;
+        return length++;
+      },
+      execute(): number {
+        return native.executeCommands(commands, length);
+      },
+      result(index: number): number {
+        return commands[index * 4 + 3];
+      },
+      clear(): void {
+        length = 0;
+      }
+    };
+  }
+
   /**
    * Generate random numbers
    * @param count - Number of values to generate
@@ -842,6 +2141,16 @@ export namespace Math {
     return native.randomNumbers(count, min, max, distribution);
   }
 
+  /**
+   * Fills a typed array in place from a vectorized xoshiro256++ generator
+   * @param array - Destination array
+   * @param options - Distribution, seed and parameters
+   * @returns The same array
+   */
+  export function fillRandom<T extends RandomFillTarget>(array: T, options: RandomFillOptions = {}): T {
+    return native.fillRandom(array, options);
+  }
+
   /**
    * Fast Fourier Transform
    * @param data - Array of complex numbers or real numbers
@@ -850,6 +2159,37 @@ export namespace Math {
   export function fastFourierTransform(data: number[][] | number[]): number[][] {
     return native.fastFourierTransform(data);
   }
+
+  /**
+   * Creates a reusable FFT plan; any size works (non-powers of two use Bluestein)
+   * @param n - Transform size
+   * @param options - Real-input and direction options
+   * @returns Plan handle
+   */
+  export function createFFTPlan(n: number, options: FFTPlanOptions = {}): FFTPlan {
+    return native.createFFTPlan(n, options);
+  }
+
+  /**
+   * Runs a plan over one or more back-to-back frames (batch = input.length / plan.inputLength).
+   * Complex plans transform in place when output is omitted.
+   * @param plan - Plan handle
+   * @param input - Interleaved complex or real samples
+   * @param output - Optional destination of batch * plan.outputLength elements
+   * @returns Output array
+   */
+  export function executeFFTPlan(plan: FFTPlan, input: Float64Array, output?: Float64Array): Float64Array {
+    return native.executeFFTPlan(plan, input, output);
+  }
+
+  /**
+   * Releases a plan's tables
+   * @param plan - Plan handle
+   * @returns Success status
+   */
+  export function destroyFFTPlan(plan: FFTPlan): boolean {
+    return native.destroyFFTPlan(plan);
+  }
 }
 
 /**
@@ -911,10 +2251,10 @@ export namespace String {
   /**
    * Fast string hashing
    * @param str - String to hash
-   * @param algorithm - Hash algorithm ('djb2', 'fnv1a', 'murmur3', 'crc32', 'sdbm')
+   * @param algorithm - Hash algorithm ('djb2', 'fnv1a', 'murmur3', 'crc32', 'sdbm', 'crc32c')
    * @returns Hash value
    */
-  export function stringHash(str: string, algorithm: string = 'djb2'): number {
+  export function stringHash(str: string, algorithm: HashAlgorithmName = 'djb2'): number {
     return native.stringHash(str, algorithm);
   }
 
@@ -938,6 +2278,203 @@ export namespace String {
   export function stringValidate(string: string, validationType: string): boolean | string {
     return native.stringValidate(string, validationType);
   }
+
+  /**
+   * Finds every occurrence of a pattern with the SIMD substring search
+   * @param haystack - Text or bytes to search
+   * @param needle - Pattern
+   * @param options - Case, overlap and limit options
+   * @returns Byte offsets of the matches
+   */
+  export function findAll(haystack: ByteInput, needle: ByteInput, options: FindAllOptions = {}): Uint32Array {
+    return native.findAll(haystack, needle, options);
+  }
+
+  /**
+   * Compiles patterns into a reusable Aho-Corasick matcher
+   * @param patterns - Patterns to look for
+   * @param options - Case sensitivity
+   * @returns Matcher handle
+   */
+  export function createMatcher(patterns: ByteInput[], options: { caseSensitive?: boolean } = {}): PatternMatcher {
+    return native.createMatcher(patterns, options);
+  }
+
+  /**
+   * Reports every occurrence of every pattern, overlaps included
+   * @param matcher - Matcher handle
+   * @param haystack - Text or bytes to scan
+   * @param options - Optional match limit
+   * @returns Match offsets and pattern indexes
+   */
+  export function matcherScan(matcher: PatternMatcher, haystack: ByteInput, options: { limit?: number } = {}): MatcherResult {
+    return native.matcherScan(matcher, haystack, options);
+  }
+
+  /**
+   * Releases a matcher
+   * @param matcher - Matcher handle
+   * @returns Success status
+   */
+  export function destroyMatcher(matcher: PatternMatcher): boolean {
+    return native.destroyMatcher(matcher);
+  }
+
+  /**
+   * Counts UTF-8 characters in a byte slice without decoding it to a string
+   * @param buffer - Bytes to count
+   * @param offset - First byte of the slice
+   * @param length - Slice length (defaults to the rest of the view)
+   * @returns Length in characters
+   */
+  export function bufferLength(buffer: ByteInput, offset?: number, length?: number): number {
+    return native.bufferLength(buffer, offset, length);
+  }
+
+  /**
+   * Hashes a byte slice; matches stringHash of the same UTF-8 bytes
+   * @param buffer - Bytes to hash
+   * @param algorithm - Hash algorithm ('djb2', 'fnv1a', 'murmur3', 'crc32', 'sdbm', 'crc32c')
+   * @param offset - First byte of the slice
+   * @param length - Slice length (defaults to the rest of the view)
+   * @returns Hash value
+   */
+  export function bufferHash(buffer: ByteInput, algorithm: HashAlgorithmName = 'djb2', offset?: number, length?: number): number {
+    return native.bufferHash(buffer, algorithm, offset, length);
+  }
+
+  /**
+   * Validates the encoding of a byte slice. 'utf8' rejects overlong forms,
+   * surrogates and code points above U+10FFFF.
+   * @param buffer - Bytes to check
+   * @param validationType - 'utf8' or 'ascii'
+   * @param offset - First byte of the slice
+   * @param length - Slice length (defaults to the rest of the view)
+   * @returns Validation result
+   */
+  export function bufferValidate(buffer: ByteInput, validationType: 'utf8' | 'ascii', offset?: number, length?: number): boolean {
+    return native.bufferValidate(buffer, validationType, offset, length);
+  }
+
+  /**
+   * Byte-wise comparison of two slices
+   * @param a - First bytes
+   * @param b - Second bytes
+   * @param caseSensitive - Case sensitive comparison
+   * @param aOffset - First byte of the slice of a
+   * @param aLength - Slice length of a (defaults to the rest of the view)
+   * @param bOffset - First byte of the slice of b
+   * @param bLength - Slice length of b (defaults to the rest of the view)
+   * @returns Comparison result (-1, 0, 1)
+   */
+  export function bufferCompare(
+    a: ByteInput,
+    b: ByteInput,
+    caseSensitive: boolean = true,
+    aOffset?: number,
+    aLength?: number,
+    bOffset?: number,
+    bLength?: number
+  ): number {
+    return native.bufferCompare(a, b, caseSensitive, aOffset, aLength, bOffset, bLength);
+  }
+
+  /**
+   * Hashes a string or byte view to its full width
+   * @param input - String (hashed as UTF-8) or bytes
+   * @param algorithm - Any HashAlgorithmName (default 'xxh3')
+   * @param seed - Seed for xxh3, xxh3-128 and wyhash
+   * @returns Hash as a bigint; 128 bits for xxh3-128
+   */
+  export function hash(input: string | ByteInput, algorithm: HashAlgorithmName = 'xxh3', seed?: number | bigint): bigint {
+    return native.hash(input, algorithm, seed);
+  }
+
+  /**
+   * Creates a hasher that consumes input in pieces and matches hash() of the concatenation
+   * @param algorithm - Any HashAlgorithmName except 'wyhash' (default 'xxh3')
+   * @param seed - Seed for xxh3 and xxh3-128
+   * @returns Hasher handle with update() and digest()
+   */
+  export function createHasher(algorithm: HashAlgorithmName = 'xxh3', seed?: number | bigint): Hasher {
+    const hasher = native.createHasher(algorithm, seed);
+    return Object.assign(hasher, {
+      update(input: string | ByteInput, offset?: number, length?: number): Hasher {
+        native.hasherUpdate(hasher, input, offset, length);
+        return hasher;
+      },
+      digest(): bigint {
+        return native.hasherDigest(hasher);
+      }
+    });
+  }
+
+  /**
+   * Releases a hasher before garbage collection would
+   * @param hasher - Hasher from createHasher
+   * @returns Success status
+   */
+  export function destroyHasher(hasher: Hasher): boolean {
+    return native.destroyHasher(hasher);
+  }
+
+  /**
+   * Converts text between UTF-8, UTF-16LE and Latin-1
+   * @param input - Encoded bytes
+   * @param from - Source encoding
+   * @param to - Target encoding
+   * @param output - Destination for the converted bytes instead of a new Buffer
+   * @returns Converted bytes, or the byte count written into output
+   */
+  export function transcode(input: ByteInput, from: TextEncodingName, to: TextEncodingName): Buffer;
+  export function transcode(input: ByteInput, from: TextEncodingName, to: TextEncodingName, output: Uint8Array): number;
+  export function transcode(input: ByteInput, from: TextEncodingName, to: TextEncodingName, output?: Uint8Array): Buffer | number {
+    return native.transcode(input, from, to, output);
+  }
+
+  /**
+   * Decodes a UTF-8 byte slice; malformed sequences become U+FFFD
+   * @param buffer - UTF-8 bytes
+   * @param offset - First byte of the slice
+   * @param length - Slice length (defaults to the rest of the view)
+   * @returns Decoded string
+   */
+  export function decodeUtf8(buffer: ByteInput, offset?: number, length?: number): string {
+    return native.decodeUtf8(buffer, offset, length);
+  }
+
+  /**
+   * Encodes strings once into a packed buffer for stringBatch
+   * @param strings - Strings to pack
+   * @returns Packed UTF-8 bytes and n + 1 boundary offsets
+   */
+  export function packStrings(strings: string[]): PackedStrings {
+    const offsets = new Uint32Array(strings.length + 1);
+    for (let i = 0; i < strings.length; i++) {
+      offsets[i + 1] = offsets[i] + Buffer.byteLength(strings[i]);
+    }
+    const buffer = Buffer.allocUnsafe(offsets[strings.length]);
+    for (let i = 0; i < strings.length; i++) {
+      buffer.write(strings[i], offsets[i]);
+    }
+    return { buffer, offsets };
+  }
+
+  /**
+   * Runs one operation over every string of a packed buffer in a single native call
+   * @param operation - 'length', 'hash', 'validate' or 'compare'
+   * @param packed - Packed bytes
+   * @param offsets - n + 1 boundary offsets
+   * @param options - Algorithm and seed, validation type, comparison needle or output array
+   * @returns Per-string results (options.output when given)
+   */
+  export function stringBatch(operation: 'length', packed: ByteInput, offsets: Uint32Array): Uint32Array;
+  export function stringBatch(operation: 'hash', packed: ByteInput, offsets: Uint32Array, options?: StringBatchOptions): BigUint64Array;
+  export function stringBatch(operation: 'validate', packed: ByteInput, offsets: Uint32Array, options?: StringBatchOptions): Uint8Array;
+  export function stringBatch(operation: 'compare', packed: ByteInput, offsets: Uint32Array, options: StringBatchOptions): Int32Array;
+  export function stringBatch(operation: string, packed: ByteInput, offsets: Uint32Array, options: StringBatchOptions = {}): Uint32Array | BigUint64Array | Uint8Array | Int32Array {
+    return native.stringBatch(operation, packed, offsets, options);
+  }
 }
 
 // Default export with all modules
@@ -1,7 +1,19 @@
 #include "headers/lljs.h"
+#include "headers/handle_table.h"
 #include <thread>
 #include <chrono>
 #include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
 #ifdef _WIN32
 #include <windows.h>
 #include <intrin.h>
@@ -9,13 +21,21 @@
 #include <pdh.h>
 #include <powerbase.h>
 #else
+#ifdef LLJS_ARCH_X86
 #include <cpuid.h>
+#endif
 #include <unistd.h>
 #include <sys/sysinfo.h>
 #include <sys/stat.h>
 #include <fstream>
 #include <sched.h>
-#include <immintrin.h>
+#include <pthread.h>
+#include <dirent.h>
+#endif
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
 #endif
 
 namespace LLJS::CPU {
@@ -60,6 +80,134 @@ void InitCPUUsage() {
     cpuUsageInitialized = true;
 }
 
+// ISA level chosen by DetectISA at module initialization
+static SIMD::ISA activeISA = SIMD::ISA::Scalar;
+
+/**
+ * Executes CPUID for a leaf/subleaf pair
+ * @param leaf - CPUID leaf (EAX input)
+ * @param subleaf - CPUID subleaf (ECX input)
+ * @param regs - Receives EAX, EBX, ECX, EDX
+ * @returns False if the leaf is unsupported or CPUID is unavailable
+ */
+static bool QueryCPUID(unsigned int leaf, unsigned int subleaf, unsigned int regs[4]) {
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#if defined(LLJS_ARCH_X86) && defined(_WIN32)
+    int cpuInfo[4];
+    __cpuid(cpuInfo, static_cast<int>(leaf & 0x80000000));
+    if (static_cast<unsigned int>(cpuInfo[0]) < leaf) {
+        return false;
+    }
+    __cpuidex(cpuInfo, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; i++) {
+        regs[i] = static_cast<unsigned int>(cpuInfo[i]);
+    }
+    return true;
+#elif defined(LLJS_ARCH_X86)
+    return __get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3]) != 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Reads the XCR0 register to see which vector states the OS saves
+ * @returns XCR0 value, or 0 when XGETBV is unavailable
+ */
+static uint64_t ReadXCR0() {
+#if defined(LLJS_ARCH_X86) && defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#elif defined(LLJS_ARCH_X86)
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Probes the CPU and OS once and records the widest usable ISA level.
+ * LLJS_SIMD=scalar|sse2|avx2|avx512|neon can lower (never raise) the result.
+ * @returns Selected ISA level
+ */
+SIMD::ISA DetectISA() {
+    SIMD::ISA detected = SIMD::ISA::Scalar;
+    
+#if defined(LLJS_ARCH_X86)
+    unsigned int regs[4];
+    if (QueryCPUID(1, 0, regs)) {
+        bool sse2 = (regs[3] & (1u << 26)) != 0;
+        bool fma = (regs[2] & (1u << 12)) != 0;
+        bool osxsave = (regs[2] & (1u << 27)) != 0;
+        bool avx = (regs[2] & (1u << 28)) != 0;
+        
+        // The OS must save YMM (bits 1-2) and ZMM/opmask state (bits 5-7) on context switch
+        uint64_t xcr0 = osxsave ? ReadXCR0() : 0;
+        bool ymmEnabled = (xcr0 & 0x6) == 0x6;
+        bool zmmEnabled = (xcr0 & 0xE6) == 0xE6;
+        
+        unsigned int ext[4];
+        QueryCPUID(7, 0, ext);
+        bool avx2 = (ext[1] & (1u << 5)) != 0;
+        bool avx512f = (ext[1] & (1u << 16)) != 0;
+        bool avx512bw = (ext[1] & (1u << 30)) != 0;
+        
+        if (sse2) {
+            detected = SIMD::ISA::SSE2;
+        }
+        if (detected == SIMD::ISA::SSE2 && avx && avx2 && fma && ymmEnabled) {
+            detected = SIMD::ISA::AVX2;
+        }
+        if (detected == SIMD::ISA::AVX2 && avx512f && avx512bw && zmmEnabled) {
+            detected = SIMD::ISA::AVX512;
+        }
+    }
+#elif defined(LLJS_ARCH_ARM64)
+    // Advanced SIMD is mandatory on AArch64
+    detected = SIMD::ISA::NEON;
+#endif
+    
+    const char* cap = std::getenv("LLJS_SIMD");
+    if (cap) {
+        const SIMD::ISA levels[] = {
+            SIMD::ISA::Scalar, SIMD::ISA::SSE2, SIMD::ISA::AVX2, SIMD::ISA::AVX512, SIMD::ISA::NEON
+        };
+        for (SIMD::ISA level : levels) {
+            if (std::strcmp(cap, SIMD::ISAName(level)) != 0) {
+                continue;
+            }
+            bool sameFamily = (level == SIMD::ISA::NEON) == (detected == SIMD::ISA::NEON);
+            if (level == SIMD::ISA::Scalar || (sameFamily && level < detected)) {
+                detected = level;
+            }
+            break;
+        }
+    }
+    
+    activeISA = detected;
+    return detected;
+}
+
+/**
+ * Whether the TSC ticks at a constant rate through frequency and sleep-state
+ * changes (CPUID 0x80000007 EDX bit 8)
+ * @returns True if TSC deltas can be converted with one fixed frequency
+ */
+bool HasInvariantTSC() {
+    unsigned int regs[4];
+    return QueryCPUID(0x80000007, 0, regs) && (regs[3] & (1u << 8)) != 0;
+}
+
+/**
+ * Whether RDTSCP is available (CPUID 0x80000001 EDX bit 27)
+ * @returns True if reads can wait for earlier instructions to complete
+ */
+bool HasRDTSCP() {
+    unsigned int regs[4];
+    return QueryCPUID(0x80000001, 0, regs) && (regs[3] & (1u << 27)) != 0;
+}
+
 /**
  * Gets detailed CPU information using CPUID instruction
  * @param info - CallbackInfo (no parameters required)
@@ -72,63 +220,44 @@ Napi::Value GetCPUInfo(const Napi::CallbackInfo& info) {
     // CPU vendor and model information
     char vendor[13] = {0};
     char brand[49] = {0};
+    unsigned int regs[4];
     
-#ifdef _WIN32
-    int cpuInfo[4];
-    
-    // Get vendor string
-    __cpuid(cpuInfo, 0);
-    *reinterpret_cast<int*>(vendor) = cpuInfo[1];      // EBX
-    *reinterpret_cast<int*>(vendor + 4) = cpuInfo[3];  // EDX
-    *reinterpret_cast<int*>(vendor + 8) = cpuInfo[2];  // ECX
-    
-    // Get brand string
-    for (int i = 0x80000002; i <= 0x80000004; ++i) {
-        __cpuid(cpuInfo, i);
-        std::memcpy(brand + (i - 0x80000002) * 16, cpuInfo, sizeof(cpuInfo));
-    }
-    
-    // Get additional CPU features
-    __cpuid(cpuInfo, 1);
-    int features = cpuInfo[3]; // EDX features
-    int extFeatures = cpuInfo[2]; // ECX features
-    
-    // Get cache information
-    __cpuid(cpuInfo, 0x80000006);
-    int l2CacheSize = (cpuInfo[2] >> 16) & 0xFFFF; // L2 cache size in KB
-    int l3CacheSize = (cpuInfo[3] >> 18) & 0x3FFF; // L3 cache size in 512KB units
-    
-#else
-    unsigned int eax, ebx, ecx, edx;
-    
-    // Get vendor string
-    if (__get_cpuid(0, &eax, &ebx, &ecx, &edx)) {
-        *reinterpret_cast<unsigned int*>(vendor) = ebx;
-        *reinterpret_cast<unsigned int*>(vendor + 4) = edx;
-        *reinterpret_cast<unsigned int*>(vendor + 8) = ecx;
+    // Get vendor string (EBX, EDX, ECX)
+    if (QueryCPUID(0, 0, regs)) {
+        std::memcpy(vendor, &regs[1], 4);
+        std::memcpy(vendor + 4, &regs[3], 4);
+        std::memcpy(vendor + 8, &regs[2], 4);
     }
     
     // Get brand string
     for (unsigned int i = 0x80000002; i <= 0x80000004; ++i) {
-        if (__get_cpuid(i, &eax, &ebx, &ecx, &edx)) {
-            unsigned int* ptr = reinterpret_cast<unsigned int*>(brand + (i - 0x80000002) * 16);
-            ptr[0] = eax; ptr[1] = ebx; ptr[2] = ecx; ptr[3] = edx;
+        if (QueryCPUID(i, 0, regs)) {
+            std::memcpy(brand + (i - 0x80000002) * 16, regs, sizeof(regs));
         }
     }
     
     // Get CPU features
     int features = 0, extFeatures = 0;
-    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
-        features = edx;
-        extFeatures = ecx;
+    if (QueryCPUID(1, 0, regs)) {
+        features = static_cast<int>(regs[3]);    // EDX features
+        extFeatures = static_cast<int>(regs[2]); // ECX features
+    }
+    
+    // Get structured extended features (AVX2 / AVX-512)
+    unsigned int leaf7Features = 0;
+    if (QueryCPUID(7, 0, regs)) {
+        leaf7Features = regs[1]; // EBX features
     }
     
     // Get cache information
     int l2CacheSize = 0, l3CacheSize = 0;
-    if (__get_cpuid(0x80000006, &eax, &ebx, &ecx, &edx)) {
-        l2CacheSize = (ecx >> 16) & 0xFFFF;
-        l3CacheSize = (edx >> 18) & 0x3FFF;
+    if (QueryCPUID(0x80000006, 0, regs)) {
+        l2CacheSize = (regs[2] >> 16) & 0xFFFF; // L2 cache size in KB
+        l3CacheSize = (regs[3] >> 18) & 0x3FFF; // L3 cache size in 512KB units
     }
+    
+#ifdef LLJS_ARCH_ARM64
+    std::strncpy(vendor, "ARM", sizeof(vendor) - 1);
 #endif
     
     // Clean up strings
@@ -157,8 +286,19 @@ Napi::Value GetCPUInfo(const Napi::CallbackInfo& info) {
     featuresObj.Set("sse42", Napi::Boolean::New(env, (extFeatures & (1 << 20)) != 0));
     featuresObj.Set("avx", Napi::Boolean::New(env, (extFeatures & (1 << 28)) != 0));
     featuresObj.Set("fma", Napi::Boolean::New(env, (extFeatures & (1 << 12)) != 0));
+    featuresObj.Set("avx2", Napi::Boolean::New(env, (leaf7Features & (1u << 5)) != 0));
+    featuresObj.Set("avx512f", Napi::Boolean::New(env, (leaf7Features & (1u << 16)) != 0));
+    featuresObj.Set("avx512bw", Napi::Boolean::New(env, (leaf7Features & (1u << 30)) != 0));
+#ifdef LLJS_ARCH_ARM64
+    featuresObj.Set("neon", Napi::Boolean::New(env, true));
+#else
+    featuresObj.Set("neon", Napi::Boolean::New(env, false));
+#endif
     result.Set("features", featuresObj);
     
+    // SIMD kernel set selected at module initialization
+    result.Set("simd", Napi::String::New(env, SIMD::ISAName(SIMD::ActiveISA())));
+    
     // Cache information
     Napi::Object cache = Napi::Object::New(env);
     cache.Set("l1d", Napi::Number::New(env, 32 * 1024));  // Typical L1D size
@@ -239,19 +379,19 @@ Napi::Value GetCacheInfo(const Napi::CallbackInfo& info) {
     result.Set("l2", Napi::Number::New(env, l2Cache > 0 ? l2Cache * 1024 : 262144));
     result.Set("l3", Napi::Number::New(env, l3Cache > 0 ? l3Cache * 512 * 1024 : 8388608));
 #else
-    unsigned int eax, ebx, ecx, edx;
+    unsigned int regs[4];
     
     // Get cache information
     int l1DCache = 32, l1ICache = 32, l2Cache = 256, l3Cache = 8192; // Default values in KB
     
-    if (__get_cpuid(0x80000005, &eax, &ebx, &ecx, &edx)) {
-        l1DCache = (ecx >> 24) & 0xFF;
-        l1ICache = (edx >> 24) & 0xFF;
+    if (QueryCPUID(0x80000005, 0, regs)) {
+        l1DCache = (regs[2] >> 24) & 0xFF;
+        l1ICache = (regs[3] >> 24) & 0xFF;
     }
     
-    if (__get_cpuid(0x80000006, &eax, &ebx, &ecx, &edx)) {
-        l2Cache = (ecx >> 16) & 0xFFFF;
-        l3Cache = (edx >> 18) & 0x3FFF;
+    if (QueryCPUID(0x80000006, 0, regs)) {
+        l2Cache = (regs[2] >> 16) & 0xFFFF;
+        l3Cache = (regs[3] >> 18) & 0x3FFF;
         if (l3Cache > 0) l3Cache *= 512; // Convert to KB
     }
     
@@ -354,38 +494,411 @@ Napi::Value GetCPUUsage(const Napi::CallbackInfo& info) {
 }
 
 /**
- * Sets CPU affinity for current process
- * @param info - CallbackInfo containing CPU mask
- * @returns Success status
+ * Reads the CPU list of an affinity argument
+ * @param value - Bit mask number (CPUs 0-52) or array of CPU indices
+ * @param cpus - Receives sorted, unique CPU indices
+ * @returns False if the value is neither
+ */
+bool ToCPUSet(const Napi::Value& value, std::vector<uint32_t>& cpus) {
+    cpus.clear();
+    if (value.IsNumber()) {
+        // Doubles carry 53 exact bits, so masks beyond CPU 52 need the array form
+        double mask = std::floor(value.As<Napi::Number>().DoubleValue());
+        for (uint32_t cpu = 0; cpu < 53 && mask >= 1; cpu++) {
+            if (std::fmod(mask, 2) == 1) {
+                cpus.push_back(cpu);
+            }
+            mask = std::floor(mask / 2);
+        }
+        return true;
+    }
+    if (!value.IsArray()) {
+        return false;
+    }
+    Napi::Array array = value.As<Napi::Array>();
+    for (uint32_t i = 0; i < array.Length(); i++) {
+        Napi::Value entry = array.Get(i);
+        double cpu = entry.IsNumber() ? entry.As<Napi::Number>().DoubleValue() : -1;
+        if (!(cpu >= 0 && cpu < 65536) || cpu != std::floor(cpu)) {
+            return false;
+        }
+        cpus.push_back(static_cast<uint32_t>(cpu));
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return true;
+}
+
+/**
+ * Pins a thread to a set of logical CPUs of any width
+ * @param thread - Thread to pin, or nullptr for the calling thread
+ * @param cpus - Sorted CPU indices; on Windows they must share one processor group
+ * @returns True on success
+ */
+bool SetThreadAffinity(std::thread* thread, const std::vector<uint32_t>& cpus) {
+    if (cpus.empty()) {
+        return false;
+    }
+#ifdef _WIN32
+    WORD group = static_cast<WORD>(cpus.front() / 64);
+    GROUP_AFFINITY affinity = {};
+    affinity.Group = group;
+    for (uint32_t cpu : cpus) {
+        if (cpu / 64 != group) {
+            return false;
+        }
+        affinity.Mask |= static_cast<KAFFINITY>(1) << (cpu % 64);
+    }
+    HANDLE handle = thread ? static_cast<HANDLE>(thread->native_handle()) : GetCurrentThread();
+    return SetThreadGroupAffinity(handle, &affinity, nullptr) != 0;
+#elif defined(__linux__)
+    size_t count = cpus.back() + 1;
+    cpu_set_t* set = CPU_ALLOC(count);
+    if (!set) {
+        return false;
+    }
+    size_t bytes = CPU_ALLOC_SIZE(count);
+    CPU_ZERO_S(bytes, set);
+    for (uint32_t cpu : cpus) {
+        CPU_SET_S(cpu, bytes, set);
+    }
+    pthread_t handle = thread ? thread->native_handle() : pthread_self();
+    int result = pthread_setaffinity_np(handle, bytes, set);
+    CPU_FREE(set);
+    return result == 0;
+#else
+    (void)thread;
+    return false;
+#endif
+}
+
+/**
+ * Sets CPU affinity: the calling thread on Linux, the process on Windows
+ * @param info - CallbackInfo containing a bit mask number or an array of CPU indices
+ * @returns Boolean indicating success
  */
 Napi::Value SetCPUAffinity(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 1 || !info[0].IsNumber()) {
-        Napi::TypeError::New(env, "CPU mask parameter required").ThrowAsJavaScriptException();
+    std::vector<uint32_t> cpus;
+    if (info.Length() < 1 || !ToCPUSet(info[0], cpus)) {
+        Napi::TypeError::New(env, "CPU mask or array of CPU indices required").ThrowAsJavaScriptException();
         return Napi::Boolean::New(env, false);
     }
     
-    uint64_t mask = info[0].As<Napi::Number>().Uint32Value();
-    
 #ifdef _WIN32
-    DWORD_PTR affinityMask = static_cast<DWORD_PTR>(mask);
-    BOOL result = SetProcessAffinityMask(GetCurrentProcess(), affinityMask);
+    DWORD_PTR affinityMask = 0;
+    for (uint32_t cpu : cpus) {
+        if (cpu >= sizeof(DWORD_PTR) * 8) {
+            return Napi::Boolean::New(env, false); // process masks cover the first processor group only
+        }
+        affinityMask |= static_cast<DWORD_PTR>(1) << cpu;
+    }
+    BOOL result = affinityMask != 0 && SetProcessAffinityMask(GetCurrentProcess(), affinityMask);
     return Napi::Boolean::New(env, result != 0);
 #else
-    cpu_set_t cpuset;
-    CPU_ZERO(&cpuset);
+    return Napi::Boolean::New(env, SetThreadAffinity(nullptr, cpus));
+#endif
+}
+
+// Machine topology gathered from sysfs (Linux) or
+// GetLogicalProcessorInformationEx (Windows). Groups are CPU lists; each
+// CPU records the index of its group of every kind, or -1 when unknown.
+struct CPUTopology {
+    struct Entry {
+        uint32_t cpu;
+        int package = -1;
+        int core = -1;
+        int node = -1;
+        int l2 = -1;
+        int l3 = -1;
+    };
+    std::vector<Entry> cpus;
+    std::vector<std::vector<uint32_t>> packages;
+    std::vector<std::vector<uint32_t>> cores;
+    std::vector<std::vector<uint32_t>> l2;
+    std::vector<std::vector<uint32_t>> l3;
+    std::vector<std::vector<uint32_t>> nodeCpus;
+    std::vector<int> nodeIds;
+    std::vector<double> nodeMemory;
+};
+
+/**
+ * Finds or adds a CPU group
+ * @returns Group index
+ */
+static int InternGroup(std::vector<std::vector<uint32_t>>& groups, std::vector<uint32_t> members) {
+    std::sort(members.begin(), members.end());
+    for (size_t i = 0; i < groups.size(); i++) {
+        if (groups[i] == members) {
+            return static_cast<int>(i);
+        }
+    }
+    groups.push_back(std::move(members));
+    return static_cast<int>(groups.size() - 1);
+}
+
+#ifdef __linux__
+/**
+ * Parses a sysfs CPU list such as "0-3,8,10-11"
+ * @param text - List text
+ * @returns CPU indices
+ */
+static std::vector<uint32_t> ParseCPUList(const std::string& text) {
+    std::vector<uint32_t> cpus;
+    std::stringstream stream(text);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || !std::isdigit(static_cast<unsigned char>(range[0]))) {
+            continue;
+        }
+        size_t dash = range.find('-');
+        unsigned long first = std::stoul(range.substr(0, dash));
+        unsigned long last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+        for (unsigned long cpu = first; cpu <= last && cpu < 65536; cpu++) {
+            cpus.push_back(static_cast<uint32_t>(cpu));
+        }
+    }
+    return cpus;
+}
+
+/**
+ * Reads the first line of a sysfs file
+ * @returns False if the file is missing
+ */
+static bool ReadSysfsLine(const std::string& path, std::string& line) {
+    std::ifstream file(path);
+    return file.is_open() && static_cast<bool>(std::getline(file, line));
+}
+#endif
+
+/**
+ * Gathers the machine topology
+ * @returns Topology; a single package and node of all CPUs when the OS does not say
+ */
+static CPUTopology ReadTopology() {
+    CPUTopology topology;
+    std::map<uint32_t, size_t> byCpu;
+    auto entry = [&](uint32_t cpu) -> CPUTopology::Entry& {
+        auto it = byCpu.find(cpu);
+        if (it == byCpu.end()) {
+            it = byCpu.emplace(cpu, topology.cpus.size()).first;
+            topology.cpus.push_back(CPUTopology::Entry{cpu});
+        }
+        return topology.cpus[it->second];
+    };
     
-    // Convert mask to cpu_set_t
-    for (int i = 0; i < 64; i++) {
-        if (mask & (1ULL << i)) {
-            CPU_SET(i, &cpuset);
+#if defined(__linux__)
+    std::string line;
+    std::vector<uint32_t> online;
+    if (ReadSysfsLine("/sys/devices/system/cpu/online", line)) {
+        online = ParseCPUList(line);
+    }
+    for (uint32_t cpu : online) {
+        std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+        CPUTopology::Entry& current = entry(cpu);
+        std::vector<uint32_t> siblings{cpu};
+        if (ReadSysfsLine(base + "/topology/thread_siblings_list", line)) {
+            siblings = ParseCPUList(line);
+        }
+        current.core = InternGroup(topology.cores, siblings);
+        std::vector<uint32_t> package = online;
+        if (ReadSysfsLine(base + "/topology/core_siblings_list", line)) {
+            package = ParseCPUList(line);
+        }
+        current.package = InternGroup(topology.packages, package);
+        for (int index = 0; index < 16; index++) {
+            std::string cache = base + "/cache/index" + std::to_string(index);
+            std::string level, type, shared;
+            if (!ReadSysfsLine(cache + "/level", level)) {
+                break;
+            }
+            if (!ReadSysfsLine(cache + "/type", type) || type == "Instruction" ||
+                !ReadSysfsLine(cache + "/shared_cpu_list", shared)) {
+                continue;
+            }
+            if (level == "2") {
+                current.l2 = InternGroup(topology.l2, ParseCPUList(shared));
+            } else if (level == "3") {
+                current.l3 = InternGroup(topology.l3, ParseCPUList(shared));
+            }
         }
     }
     
-    int result = sched_setaffinity(0, sizeof(cpuset), &cpuset);
-    return Napi::Boolean::New(env, result == 0);
+    if (DIR* dir = opendir("/sys/devices/system/node")) {
+        std::vector<int> nodes;
+        while (struct dirent* item = readdir(dir)) {
+            if (std::strncmp(item->d_name, "node", 4) == 0 && std::isdigit(static_cast<unsigned char>(item->d_name[4]))) {
+                nodes.push_back(std::atoi(item->d_name + 4));
+            }
+        }
+        closedir(dir);
+        std::sort(nodes.begin(), nodes.end());
+        for (int node : nodes) {
+            std::string base = "/sys/devices/system/node/node" + std::to_string(node);
+            std::vector<uint32_t> cpus;
+            if (ReadSysfsLine(base + "/cpulist", line)) {
+                cpus = ParseCPUList(line);
+            }
+            double memory = 0;
+            std::ifstream meminfo(base + "/meminfo");
+            while (std::getline(meminfo, line)) {
+                size_t at = line.find("MemTotal:");
+                if (at != std::string::npos) {
+                    memory = std::stod(line.substr(at + 9)) * 1024;
+                    break;
+                }
+            }
+            for (uint32_t cpu : cpus) {
+                if (byCpu.count(cpu)) {
+                    entry(cpu).node = static_cast<int>(topology.nodeIds.size());
+                }
+            }
+            topology.nodeIds.push_back(node);
+            topology.nodeCpus.push_back(cpus);
+            topology.nodeMemory.push_back(memory);
+        }
+    }
+#elif defined(_WIN32)
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+    std::vector<uint8_t> buffer(length);
+    auto* records = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data());
+    if (length && GetLogicalProcessorInformationEx(RelationAll, records, &length)) {
+        auto groupCpus = [](const GROUP_AFFINITY* masks, WORD count) {
+            std::vector<uint32_t> cpus;
+            for (WORD i = 0; i < count; i++) {
+                for (uint32_t bit = 0; bit < sizeof(KAFFINITY) * 8; bit++) {
+                    if (masks[i].Mask & (static_cast<KAFFINITY>(1) << bit)) {
+                        cpus.push_back(masks[i].Group * 64u + bit);
+                    }
+                }
+            }
+            return cpus;
+        };
+        for (DWORD offset = 0; offset < length;) {
+            auto* record = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+            switch (record->Relationship) {
+                case RelationProcessorCore: {
+                    std::vector<uint32_t> cpus = groupCpus(record->Processor.GroupMask, record->Processor.GroupCount);
+                    int core = InternGroup(topology.cores, cpus);
+                    for (uint32_t cpu : cpus) entry(cpu).core = core;
+                    break;
+                }
+                case RelationProcessorPackage: {
+                    std::vector<uint32_t> cpus = groupCpus(record->Processor.GroupMask, record->Processor.GroupCount);
+                    int package = InternGroup(topology.packages, cpus);
+                    for (uint32_t cpu : cpus) entry(cpu).package = package;
+                    break;
+                }
+                case RelationCache:
+                    if (record->Cache.Type != CacheInstruction && (record->Cache.Level == 2 || record->Cache.Level == 3)) {
+                        std::vector<uint32_t> cpus = groupCpus(&record->Cache.GroupMask, 1);
+                        auto& groups = record->Cache.Level == 2 ? topology.l2 : topology.l3;
+                        int group = InternGroup(groups, cpus);
+                        for (uint32_t cpu : cpus) {
+                            (record->Cache.Level == 2 ? entry(cpu).l2 : entry(cpu).l3) = group;
+                        }
+                    }
+                    break;
+                case RelationNumaNode: {
+                    std::vector<uint32_t> cpus = groupCpus(&record->NumaNode.GroupMask, 1);
+                    ULONGLONG available = 0;
+                    GetNumaAvailableMemoryNodeEx(static_cast<USHORT>(record->NumaNode.NodeNumber), &available);
+                    for (uint32_t cpu : cpus) entry(cpu).node = static_cast<int>(topology.nodeIds.size());
+                    topology.nodeIds.push_back(static_cast<int>(record->NumaNode.NodeNumber));
+                    topology.nodeCpus.push_back(cpus);
+                    topology.nodeMemory.push_back(static_cast<double>(available));
+                    break;
+                }
+                default:
+                    break;
+            }
+            offset += record->Size;
+        }
+    }
 #endif
+    
+    if (topology.cpus.empty()) {
+        for (uint32_t cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); cpu++) {
+            entry(cpu);
+        }
+    }
+    std::vector<uint32_t> all;
+    for (const CPUTopology::Entry& cpu : topology.cpus) {
+        all.push_back(cpu.cpu);
+    }
+    std::sort(all.begin(), all.end());
+    for (CPUTopology::Entry& cpu : topology.cpus) {
+        if (cpu.package < 0) cpu.package = InternGroup(topology.packages, all);
+        if (cpu.core < 0) cpu.core = InternGroup(topology.cores, {cpu.cpu});
+    }
+    if (topology.nodeIds.empty()) {
+        topology.nodeIds.push_back(0);
+        topology.nodeCpus.push_back(all);
+        topology.nodeMemory.push_back(0);
+        for (CPUTopology::Entry& cpu : topology.cpus) cpu.node = 0;
+    }
+    std::sort(topology.cpus.begin(), topology.cpus.end(),
+              [](const CPUTopology::Entry& a, const CPUTopology::Entry& b) { return a.cpu < b.cpu; });
+    return topology;
+}
+
+/**
+ * Converts CPU groups to a JS array of arrays
+ */
+static Napi::Array ToGroupArray(Napi::Env env, const std::vector<std::vector<uint32_t>>& groups) {
+    Napi::Array result = Napi::Array::New(env, groups.size());
+    for (size_t i = 0; i < groups.size(); i++) {
+        Napi::Array members = Napi::Array::New(env, groups[i].size());
+        for (size_t j = 0; j < groups[i].size(); j++) {
+            members.Set(static_cast<uint32_t>(j), Napi::Number::New(env, groups[i][j]));
+        }
+        result.Set(static_cast<uint32_t>(i), members);
+    }
+    return result;
+}
+
+/**
+ * Gets the processor topology: packages, NUMA nodes, SMT siblings and L2/L3 sharing
+ * @param info - CallbackInfo (no parameters required)
+ * @returns Object with cpus (per-CPU group indices), packages, cores, l2, l3 and nodes
+ */
+Napi::Value GetTopology(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    CPUTopology topology = ReadTopology();
+    
+    Napi::Array cpus = Napi::Array::New(env, topology.cpus.size());
+    for (size_t i = 0; i < topology.cpus.size(); i++) {
+        const CPUTopology::Entry& cpu = topology.cpus[i];
+        Napi::Object item = Napi::Object::New(env);
+        item.Set("cpu", Napi::Number::New(env, cpu.cpu));
+        item.Set("package", Napi::Number::New(env, cpu.package));
+        item.Set("core", Napi::Number::New(env, cpu.core));
+        item.Set("node", Napi::Number::New(env, cpu.node >= 0 ? topology.nodeIds[cpu.node] : -1));
+        item.Set("l2", Napi::Number::New(env, cpu.l2));
+        item.Set("l3", Napi::Number::New(env, cpu.l3));
+        cpus.Set(static_cast<uint32_t>(i), item);
+    }
+    
+    Napi::Array nodes = Napi::Array::New(env, topology.nodeIds.size());
+    Napi::Array nodeCpus = ToGroupArray(env, topology.nodeCpus);
+    for (size_t i = 0; i < topology.nodeIds.size(); i++) {
+        Napi::Object node = Napi::Object::New(env);
+        node.Set("node", Napi::Number::New(env, topology.nodeIds[i]));
+        node.Set("cpus", nodeCpus.Get(static_cast<uint32_t>(i)));
+        node.Set("memory", Napi::Number::New(env, topology.nodeMemory[i]));
+        nodes.Set(static_cast<uint32_t>(i), node);
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("cpus", cpus);
+    result.Set("packages", ToGroupArray(env, topology.packages));
+    result.Set("cores", ToGroupArray(env, topology.cores));
+    result.Set("l2", ToGroupArray(env, topology.l2));
+    result.Set("l3", ToGroupArray(env, topology.l3));
+    result.Set("nodes", nodes);
+    return result;
 }
 
 /**
@@ -411,6 +924,18 @@ Napi::Value GetRegisters(const Napi::CallbackInfo& info) {
     return result;
 }
 
+/**
+ * Reads a non-negative safe integer (an address, offset or length)
+ * @returns False if the value is negative, fractional, NaN or unsafe
+ */
+static bool ToSafeIndex(const Napi::Value& value, double& result) {
+    if (!value.IsNumber()) {
+        return false;
+    }
+    result = value.As<Napi::Number>().DoubleValue();
+    return result >= 0 && result <= 9007199254740991.0 && result == std::floor(result);
+}
+
 /**
  * Prefetches memory into CPU cache
  * @param info - CallbackInfo containing address and locality
@@ -423,8 +948,14 @@ Napi::Value PrefetchMemory(const Napi::CallbackInfo& info) {
         Napi::TypeError::New(env, "Memory address parameter required").ThrowAsJavaScriptException();
         return Napi::Boolean::New(env, false);
     }
+    double value;
+    if (!ToSafeIndex(info[0], value)) {
+        Napi::RangeError::New(env, "Memory address must be a non-negative safe integer").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
     
-    uintptr_t address = info[0].As<Napi::Number>().Uint32Value();
+    // Safe integers hold every user-space address on current 48/57-bit virtual address layouts
+    uintptr_t address = static_cast<uintptr_t>(value);
     int locality = 1; // Default temporal locality
     
     if (info.Length() > 1 && info[1].IsNumber()) {
@@ -455,8 +986,13 @@ Napi::Value PrefetchMemory(const Napi::CallbackInfo& info) {
         }
 #else
         // Use GCC builtin prefetch
-        // Parameters: address, rw (0=read, 1=write), locality (0-3)
-        __builtin_prefetch(ptr, 0, locality);
+        // Parameters: address, rw (0=read, 1=write), locality (0-3, must be a constant)
+        switch (locality) {
+            case 0: __builtin_prefetch(ptr, 0, 0); break;
+            case 1: __builtin_prefetch(ptr, 0, 1); break;
+            case 2: __builtin_prefetch(ptr, 0, 2); break;
+            case 3: __builtin_prefetch(ptr, 0, 3); break;
+        }
 #endif
         
         return Napi::Boolean::New(env, true);
@@ -465,6 +1001,73 @@ Napi::Value PrefetchMemory(const Napi::CallbackInfo& info) {
     }
 }
 
+/**
+ * Issues one prefetch per cache line of a range
+ * @param data - Start of the range
+ * @param length - Byte count
+ */
+template <int Locality>
+static void PrefetchLines(const uint8_t* data, size_t length) {
+    constexpr uintptr_t kLine = 64;
+    // Start at the line holding the first byte so a misaligned tail is covered too
+    uintptr_t line = reinterpret_cast<uintptr_t>(data) & ~(kLine - 1);
+    uintptr_t end = reinterpret_cast<uintptr_t>(data) + length;
+    for (; line < end; line += kLine) {
+#ifdef _WIN32
+        _mm_prefetch(reinterpret_cast<const char*>(line),
+                     Locality == 0 ? _MM_HINT_NTA : Locality == 1 ? _MM_HINT_T2 : Locality == 2 ? _MM_HINT_T1 : _MM_HINT_T0);
+#else
+        __builtin_prefetch(reinterpret_cast<const void*>(line), 0, Locality);
+#endif
+    }
+}
+
+/**
+ * Prefetches every cache line of a buffer range
+ * @param info - CallbackInfo containing buffer (or typed array), offset,
+ *               length and locality (0 non-temporal .. 3 all levels, default 3)
+ * @returns Number of bytes covered
+ */
+Napi::Value PrefetchRange(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsTypedArray()) {
+        Napi::TypeError::New(env, "Buffer or typed array parameter required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::TypedArray view = info[0].As<Napi::TypedArray>();
+    const uint8_t* data = static_cast<const uint8_t*>(view.ArrayBuffer().Data()) + view.ByteOffset();
+    size_t byteLength = view.ByteLength();
+    
+    double offset = 0;
+    double length = 0;
+    bool hasOffset = info.Length() > 1 && info[1].IsNumber();
+    bool hasLength = info.Length() > 2 && info[2].IsNumber();
+    if ((hasOffset && !ToSafeIndex(info[1], offset)) || (hasLength && !ToSafeIndex(info[2], length))) {
+        Napi::RangeError::New(env, "Offset and length must be non-negative safe integers").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (!hasLength) {
+        length = static_cast<double>(byteLength) - offset;
+    }
+    if (!(length >= 0) || offset + length > static_cast<double>(byteLength)) {
+        Napi::RangeError::New(env, "Range exceeds buffer length").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int locality = info.Length() > 3 && info[3].IsNumber() ? info[3].As<Napi::Number>().Int32Value() : 3;
+    const uint8_t* start = data + static_cast<size_t>(offset);
+    size_t count = static_cast<size_t>(length);
+    switch (locality) {
+        case 0: PrefetchLines<0>(start, count); break;
+        case 1: PrefetchLines<1>(start, count); break;
+        case 2: PrefetchLines<2>(start, count); break;
+        default: PrefetchLines<3>(start, count); break;
+    }
+    return Napi::Number::New(env, static_cast<double>(count));
+}
+
 /**
  * Gets CPU temperature (if available)
  * @param info - CallbackInfo (no parameters required)
@@ -557,4 +1160,400 @@ Napi::Value GetCPUFrequency(const Napi::CallbackInfo& info) {
     return result;
 }
 
+
+// Performance counters. The events of one perfOpen call form a perf_event
+// group, so a single read() returns every count for the same window. When
+// the kernel grants user-space rdpmc access (cap_user_rdpmc on the mmap'd
+// control page), reads skip the syscall: each counter is read inside the
+// page's seqlock and added to the kernel's running offset. Counts are raw;
+// asking for more hardware events than the PMU has slots for leaves the
+// group unscheduled.
+
+#ifdef __linux__
+struct PerfEventSpec {
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+};
+
+static constexpr uint64_t PerfCacheEvent(uint64_t cache, uint64_t op, uint64_t result) {
+    return cache | (op << 8) | (result << 16);
+}
+
+static const PerfEventSpec kPerfEvents[] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"cache-references", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+    {"cache-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"branches", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+    {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"bus-cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BUS_CYCLES},
+    {"stalled-cycles-frontend", PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND},
+    {"stalled-cycles-backend", PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND},
+    {"ref-cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_REF_CPU_CYCLES},
+    {"l1d-loads", PERF_TYPE_HW_CACHE, PerfCacheEvent(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_ACCESS)},
+    {"l1d-misses", PERF_TYPE_HW_CACHE, PerfCacheEvent(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"l1i-misses", PERF_TYPE_HW_CACHE, PerfCacheEvent(PERF_COUNT_HW_CACHE_L1I, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"llc-loads", PERF_TYPE_HW_CACHE, PerfCacheEvent(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_ACCESS)},
+    {"llc-misses", PERF_TYPE_HW_CACHE, PerfCacheEvent(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"dtlb-misses", PERF_TYPE_HW_CACHE, PerfCacheEvent(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"task-clock", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK},
+    {"cpu-clock", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CPU_CLOCK},
+    {"page-faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+    {"minor-faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS_MIN},
+    {"major-faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS_MAJ},
+    {"context-switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+    {"cpu-migrations", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CPU_MIGRATIONS},
+};
+#endif
+
+struct PerfCounterGroup {
+    std::vector<int> fds;
+    std::vector<void*> pages; // perf_event_mmap_page per counter, or null
+    std::vector<uint64_t> baseline;
+    bool grouped = true;
+    bool userRead = false;
+    
+    ~PerfCounterGroup() {
+#ifdef __linux__
+        long pageSize = sysconf(_SC_PAGESIZE);
+        for (void* page : pages) {
+            if (page) {
+                munmap(page, static_cast<size_t>(pageSize));
+            }
+        }
+        // Members before the leader so the group is never left without one
+        for (size_t i = fds.size(); i-- > 0;) {
+            close(fds[i]);
+        }
+#endif
+    }
+};
+
+static HandleTable<PerfCounterGroup> perfGroups;
+
+#ifdef __linux__
+/**
+ * Reads one counter through its mmap page with rdpmc
+ * @param page - Control page of the counter
+ * @param value - Receives the count
+ * @returns False if the counter is not on the PMU right now
+ */
+static bool ReadPerfPage(const perf_event_mmap_page* page, uint64_t& value) {
+#if defined(LLJS_ARCH_X86)
+    uint32_t sequence;
+    do {
+        sequence = page->lock;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        uint32_t index = page->index;
+        if (!page->cap_user_rdpmc || index == 0) {
+            return false;
+        }
+        int64_t count = page->offset;
+        uint32_t low, high;
+        __asm__ volatile("rdpmc" : "=a"(low), "=d"(high) : "c"(index - 1));
+        uint16_t width = page->pmc_width;
+        int64_t pmc = static_cast<int64_t>((static_cast<uint64_t>(high) << 32) | low);
+        pmc = static_cast<int64_t>(static_cast<uint64_t>(pmc) << (64 - width)) >> (64 - width);
+        value = static_cast<uint64_t>(count + pmc);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    } while (page->lock != sequence);
+    return true;
+#else
+    (void)page;
+    (void)value;
+    return false;
+#endif
+}
+#endif
+
+/**
+ * Reads every counter of a group
+ * @param group - Counter group
+ * @param values - Receives one count per event
+ * @returns False if the kernel read failed
+ */
+static bool ReadPerfGroup(const PerfCounterGroup& group, std::vector<uint64_t>& values) {
+    values.resize(group.fds.size());
+#ifdef __linux__
+    if (group.userRead) {
+        size_t i = 0;
+        for (; i < group.pages.size(); i++) {
+            if (!ReadPerfPage(static_cast<const perf_event_mmap_page*>(group.pages[i]), values[i])) {
+                break;
+            }
+        }
+        if (i == group.pages.size()) {
+            return true;
+        }
+    }
+    if (group.grouped) {
+        // { nr, value[nr] } with PERF_FORMAT_GROUP
+        std::vector<uint64_t> buffer(group.fds.size() + 1);
+        ssize_t bytes = read(group.fds[0], buffer.data(), buffer.size() * sizeof(uint64_t));
+        if (bytes != static_cast<ssize_t>(buffer.size() * sizeof(uint64_t))) {
+            return false;
+        }
+        std::copy(buffer.begin() + 1, buffer.end(), values.begin());
+        return true;
+    }
+    for (size_t i = 0; i < group.fds.size(); i++) {
+        if (read(group.fds[i], &values[i], sizeof(uint64_t)) != sizeof(uint64_t)) {
+            return false;
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Opens hardware/software performance counters for the calling thread or process
+ * @param info - CallbackInfo containing event names and optional options (perThread, excludeKernel)
+ * @returns Counter group handle object
+ */
+Napi::Value PerfOpen(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsArray() || info[0].As<Napi::Array>().Length() == 0) {
+        Napi::TypeError::New(env, "Array of event names required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+#ifdef __linux__
+    bool perThread = true;
+    bool excludeKernel = true;
+    if (info.Length() > 1 && info[1].IsObject()) {
+        Napi::Object options = info[1].As<Napi::Object>();
+        if (options.Get("perThread").IsBoolean()) {
+            perThread = options.Get("perThread").As<Napi::Boolean>();
+        }
+        if (options.Get("excludeKernel").IsBoolean()) {
+            excludeKernel = options.Get("excludeKernel").As<Napi::Boolean>();
+        }
+    }
+    
+    Napi::Array names = info[0].As<Napi::Array>();
+    auto group = std::make_shared<PerfCounterGroup>();
+    // Inherited counters cannot be read as a group, so process-wide groups read per fd
+    group->grouped = perThread;
+    long pageSize = sysconf(_SC_PAGESIZE);
+    
+    for (uint32_t i = 0; i < names.Length(); i++) {
+        Napi::Value nameValue = names.Get(i);
+        std::string name = nameValue.IsString() ? nameValue.As<Napi::String>().Utf8Value() : std::string();
+        const PerfEventSpec* spec = nullptr;
+        for (const PerfEventSpec& candidate : kPerfEvents) {
+            if (name == candidate.name) {
+                spec = &candidate;
+                break;
+            }
+        }
+        if (!spec) {
+            Napi::TypeError::New(env, "Unknown performance event '" + name + "'").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = spec->type;
+        attr.config = spec->config;
+        attr.exclude_kernel = excludeKernel ? 1 : 0;
+        attr.exclude_hv = 1;
+        attr.inherit = perThread ? 0 : 1;
+        attr.read_format = group->grouped ? PERF_FORMAT_GROUP : 0;
+        
+        int leader = group->grouped && !group->fds.empty() ? group->fds[0] : -1;
+        int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader, PERF_FLAG_FD_CLOEXEC));
+        if (fd < 0) {
+            Napi::Error::New(env, "Failed to open performance event '" + name + "': " + std::strerror(errno)).ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        group->fds.push_back(fd);
+        
+        // rdpmc counts only on the opening thread, so process-wide groups always read()
+        void* page = perThread ? mmap(nullptr, static_cast<size_t>(pageSize), PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+        group->pages.push_back(page == MAP_FAILED ? nullptr : page);
+    }
+    
+    group->userRead = true;
+    for (void* page : group->pages) {
+        if (!page || !static_cast<const perf_event_mmap_page*>(page)->cap_user_rdpmc) {
+            group->userRead = false;
+        }
+    }
+    ReadPerfGroup(*group, group->baseline);
+    
+    uint64_t groupId = perfGroups.Insert(group);
+    if (groupId == 0) {
+        Napi::Error::New(env, "Too many performance counter handles").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object handle = Napi::Object::New(env);
+    handle.Set("id", Napi::Number::New(env, static_cast<double>(groupId)));
+    // Dropping the handle closes the counters
+    handle.Set("handle", Napi::External<void>::New(env, nullptr, [groupId](Napi::Env, void*) {
+        perfGroups.Remove(groupId);
+    }));
+    handle.Set("events", names);
+    handle.Set("rdpmc", Napi::Boolean::New(env, group->userRead));
+    return handle;
+#else
+    Napi::Error::New(env, "Performance counters require Linux perf_event_open").ThrowAsJavaScriptException();
+    return env.Null();
+#endif
+}
+
+/**
+ * Resolves a counter group handle; throws on failure
+ * @returns Counter group, or null
+ */
+static std::shared_ptr<PerfCounterGroup> ToPerfGroup(Napi::Env env, const Napi::Value& value) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "Performance counter handle object required").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    Napi::Value id = value.As<Napi::Object>().Get("id");
+    std::shared_ptr<PerfCounterGroup> group = id.IsNumber()
+        ? perfGroups.Get(static_cast<uint64_t>(id.As<Napi::Number>().DoubleValue()))
+        : nullptr;
+    if (!group) {
+        Napi::Error::New(env, "Invalid performance counter handle").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    return group;
+}
+
+/**
+ * Reads the counters and either stores a new baseline or reports counts against it
+ * @param info - CallbackInfo containing counter handle and optional Float64Array output
+ * @param sinceStart - Report deltas since the last start instead of totals since open
+ * @param restart - Make this read the new baseline
+ * @returns Float64Array of counts in event order, or undefined when only restarting
+ */
+static Napi::Value ReadPerfCounters(const Napi::CallbackInfo& info, bool sinceStart, bool restart) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<PerfCounterGroup> group = ToPerfGroup(env, info[0]);
+    if (!group) {
+        return env.Null();
+    }
+    std::vector<uint64_t> values;
+    if (!ReadPerfGroup(*group, values)) {
+        Napi::Error::New(env, std::string("Failed to read performance counters: ") + std::strerror(errno)).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (restart) {
+        group->baseline = values;
+        return env.Undefined();
+    }
+    
+    Napi::Float64Array output;
+    if (info.Length() > 1 && info[1].IsTypedArray() &&
+        info[1].As<Napi::TypedArray>().TypedArrayType() == napi_float64_array) {
+        output = info[1].As<Napi::Float64Array>();
+        if (output.ElementLength() < values.size()) {
+            Napi::RangeError::New(env, "Output array is too small").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else {
+        output = Napi::Float64Array::New(env, values.size());
+    }
+    double* data = output.Data();
+    for (size_t i = 0; i < values.size(); i++) {
+        data[i] = static_cast<double>(sinceStart ? values[i] - group->baseline[i] : values[i]);
+    }
+    return output;
+}
+
+/**
+ * Marks the start of a measured region
+ * @param info - CallbackInfo containing counter handle
+ * @returns Undefined
+ */
+Napi::Value PerfStart(const Napi::CallbackInfo& info) {
+    return ReadPerfCounters(info, false, true);
+}
+
+/**
+ * Ends a measured region
+ * @param info - CallbackInfo containing counter handle and optional Float64Array output
+ * @returns Counts since the last start, in event order
+ */
+Napi::Value PerfStop(const Napi::CallbackInfo& info) {
+    return ReadPerfCounters(info, true, false);
+}
+
+/**
+ * Reads the counters without touching the region baseline
+ * @param info - CallbackInfo containing counter handle and optional Float64Array output
+ * @returns Counts since the group was opened, in event order
+ */
+Napi::Value PerfRead(const Napi::CallbackInfo& info) {
+    return ReadPerfCounters(info, false, false);
+}
+
+/**
+ * Closes a counter group before garbage collection would
+ * @param info - CallbackInfo containing counter handle
+ * @returns Success status
+ */
+Napi::Value PerfClose(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!ToPerfGroup(env, info[0])) {
+        return Napi::Boolean::New(env, false);
+    }
+    uint64_t id = static_cast<uint64_t>(info[0].As<Napi::Object>().Get("id").As<Napi::Number>().DoubleValue());
+    return Napi::Boolean::New(env, perfGroups.Remove(id) != nullptr);
+}
+
+}
+
+namespace LLJS::SIMD {
+
+/**
+ * Gets the canonical lowercase name of an ISA level
+ * @param isa - ISA level
+ * @returns Name such as "avx2"
+ */
+const char* ISAName(ISA isa) {
+    switch (isa) {
+        case ISA::SSE2: return "sse2";
+        case ISA::AVX2: return "avx2";
+        case ISA::AVX512: return "avx512";
+        case ISA::NEON: return "neon";
+        default: return "scalar";
+    }
+}
+
+/**
+ * Gets the ISA level selected at module initialization
+ * @returns Active ISA level
+ */
+ISA ActiveISA() {
+    return CPU::activeISA;
+}
+
+/**
+ * Whether CRC-32C instructions are usable
+ * @returns True on SSE4.2 x86 CPUs, or AArch64 builds with the CRC extension
+ */
+bool HasCRC32C() {
+    if (CPU::activeISA == ISA::Scalar) {
+        return false;
+    }
+#if defined(LLJS_ARCH_X86)
+    unsigned int regs[4];
+    return CPU::QueryCPUID(1, 0, regs) && (regs[2] & (1u << 20)) != 0;
+#elif defined(LLJS_ARCH_ARM64) && defined(__ARM_FEATURE_CRC32)
+    return true;
+#else
+    return false;
+#endif
+}
+
 }
\ No newline at end of file
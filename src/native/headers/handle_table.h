@@ -0,0 +1,132 @@
+#ifndef LLJS_HANDLE_TABLE_H
+#define LLJS_HANDLE_TABLE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace LLJS {
+    /**
+     * Sharded slot array for native objects handed to JS as numeric ids.
+     *
+     * An id packs the slot index in its low 24 bits and the slot generation
+     * above it: at most 53 bits, so it round-trips through a JS Number. A slot's
+     * generation advances whenever it is freed, so stale ids never alias a
+     * newer object. Slots are spread over independently locked shards.
+     * Lookups hold a shard lock only long enough to copy a shared_ptr, so
+     * callers can block on the object without holding any table lock.
+     */
+    template <typename T>
+    class HandleTable {
+    public:
+        /**
+         * Stores an object in a free slot
+         * @param value - Object to store
+         * @returns Non-zero id, or 0 when the shard is full
+         */
+        uint64_t Insert(std::shared_ptr<T> value) {
+            size_t shardIndex = nextShard.fetch_add(1, std::memory_order_relaxed) % kShardCount;
+            Shard& shard = shards[shardIndex];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            uint32_t local;
+            if (!shard.freeList.empty()) {
+                local = shard.freeList.back();
+                shard.freeList.pop_back();
+            } else {
+                if (shard.slots.size() >= kSlotsPerShard) {
+                    return 0;
+                }
+                local = static_cast<uint32_t>(shard.slots.size());
+                shard.slots.emplace_back();
+            }
+
+            Slot& slot = shard.slots[local];
+            slot.value = std::move(value);
+            uint64_t index = static_cast<uint64_t>(local) * kShardCount + shardIndex;
+            return (static_cast<uint64_t>(slot.generation) << kIndexBits) | index;
+        }
+
+        /**
+         * Looks up a live object
+         * @param id - Id from Insert
+         * @returns Shared owner, or null for unknown or stale ids
+         */
+        std::shared_ptr<T> Get(uint64_t id) const {
+            size_t shardIndex;
+            uint32_t local, generation;
+            if (!Decode(id, shardIndex, local, generation)) {
+                return nullptr;
+            }
+            const Shard& shard = shards[shardIndex];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (local >= shard.slots.size() || shard.slots[local].generation != generation) {
+                return nullptr;
+            }
+            return shard.slots[local].value;
+        }
+
+        /**
+         * Frees a slot and invalidates its id
+         * @param id - Id from Insert
+         * @returns The removed object (destroyed when the last user drops it), or null
+         */
+        std::shared_ptr<T> Remove(uint64_t id) {
+            size_t shardIndex;
+            uint32_t local, generation;
+            if (!Decode(id, shardIndex, local, generation)) {
+                return nullptr;
+            }
+            Shard& shard = shards[shardIndex];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (local >= shard.slots.size() || shard.slots[local].generation != generation ||
+                !shard.slots[local].value) {
+                return nullptr;
+            }
+
+            Slot& slot = shard.slots[local];
+            std::shared_ptr<T> removed = std::move(slot.value);
+            slot.generation = slot.generation == kMaxGeneration ? 1 : slot.generation + 1;
+            shard.freeList.push_back(local);
+            return removed;
+        }
+
+    private:
+        static constexpr size_t kShardCount = 16;
+        static constexpr unsigned kIndexBits = 24;
+        static constexpr uint32_t kMaxGeneration = (1u << 29) - 1;
+        static constexpr size_t kSlotsPerShard = (size_t(1) << kIndexBits) / kShardCount;
+
+        struct Slot {
+            std::shared_ptr<T> value;
+            uint32_t generation = 1;
+        };
+
+        struct Shard {
+            mutable std::mutex mutex;
+            std::vector<Slot> slots;
+            std::vector<uint32_t> freeList;
+        };
+
+        static bool Decode(uint64_t id, size_t& shardIndex, uint32_t& local, uint32_t& generation) {
+            uint64_t index = id & ((1ull << kIndexBits) - 1);
+            uint64_t gen = id >> kIndexBits;
+            if (gen == 0 || gen > kMaxGeneration) {
+                return false;
+            }
+            shardIndex = static_cast<size_t>(index % kShardCount);
+            local = static_cast<uint32_t>(index / kShardCount);
+            generation = static_cast<uint32_t>(gen);
+            return true;
+        }
+
+        std::array<Shard, kShardCount> shards;
+        std::atomic<size_t> nextShard{0};
+    };
+}
+
+#endif // LLJS_HANDLE_TABLE_H
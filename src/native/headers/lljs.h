@@ -10,6 +10,7 @@
 #include <chrono>
 #include <cmath>
 #include <cstring>
+#include "simd.h"
 
 namespace LLJS {
     // Memory management functions
@@ -23,6 +24,18 @@ namespace LLJS {
         Napi::Value AlignedAlloc(const Napi::CallbackInfo& info);
         Napi::Value GetPointerValue(const Napi::CallbackInfo& info);
         Napi::Value SetPointerValue(const Napi::CallbackInfo& info);
+        Napi::Value CreatePool(const Napi::CallbackInfo& info);
+        Napi::Value PoolAlloc(const Napi::CallbackInfo& info);
+        Napi::Value PoolArenaAlloc(const Napi::CallbackInfo& info);
+        Napi::Value PoolRelease(const Napi::CallbackInfo& info);
+        Napi::Value PoolReset(const Napi::CallbackInfo& info);
+        Napi::Value DestroyPool(const Napi::CallbackInfo& info);
+        Napi::Value AllocateOnNode(const Napi::CallbackInfo& info);
+        Napi::Value GetMemoryNode(const Napi::CallbackInfo& info);
+
+        // Internal: SIMD kernel selection and shared byte kernels
+        void InitKernels(SIMD::ISA isa);
+        size_t FindMismatch(const uint8_t* a, const uint8_t* b, size_t length);
     }
 
     // CPU operations
@@ -35,8 +48,28 @@ namespace LLJS {
         Napi::Value SetCPUAffinity(const Napi::CallbackInfo& info);
         Napi::Value GetRegisters(const Napi::CallbackInfo& info);
         Napi::Value PrefetchMemory(const Napi::CallbackInfo& info);
+        Napi::Value PrefetchRange(const Napi::CallbackInfo& info);
         Napi::Value GetCPUTemperature(const Napi::CallbackInfo& info);
         Napi::Value GetCPUFrequency(const Napi::CallbackInfo& info);
+        Napi::Value PerfOpen(const Napi::CallbackInfo& info);
+        Napi::Value PerfStart(const Napi::CallbackInfo& info);
+        Napi::Value PerfStop(const Napi::CallbackInfo& info);
+        Napi::Value PerfRead(const Napi::CallbackInfo& info);
+        Napi::Value PerfClose(const Napi::CallbackInfo& info);
+        Napi::Value GetTopology(const Napi::CallbackInfo& info);
+
+        // Internal: probes CPUID/OS support and fixes the active ISA level
+        SIMD::ISA DetectISA();
+
+        // Internal: TSC capabilities from CPUID; false on non-x86 builds
+        bool HasInvariantTSC();
+        bool HasRDTSCP();
+
+        // Internal: reads an affinity argument (bit mask or CPU index array) as sorted CPU indices
+        bool ToCPUSet(const Napi::Value& value, std::vector<uint32_t>& cpus);
+
+        // Internal: pins a thread (nullptr = calling thread) to sorted CPU indices
+        bool SetThreadAffinity(std::thread* thread, const std::vector<uint32_t>& cpus);
     }
 
     // System calls and operations
@@ -48,7 +81,12 @@ namespace LLJS {
         Napi::Value GetProcessId(const Napi::CallbackInfo& info);
         Napi::Value KillProcess(const Napi::CallbackInfo& info);
         Napi::Value CreateProcess(const Napi::CallbackInfo& info);
+        Napi::Value SpawnProcess(const Napi::CallbackInfo& info);
+        Napi::Value KillSpawnedProcess(const Napi::CallbackInfo& info);
         Napi::Value GetProcessList(const Napi::CallbackInfo& info);
+        Napi::Value CreateProcessSnapshot(const Napi::CallbackInfo& info);
+        Napi::Value ReadProcessSnapshot(const Napi::CallbackInfo& info);
+        Napi::Value DestroyProcessSnapshot(const Napi::CallbackInfo& info);
     }
 
     // I/O operations
@@ -61,6 +99,22 @@ namespace LLJS {
         Napi::Value FlushFile(const Napi::CallbackInfo& info);
         Napi::Value GetFileInfo(const Napi::CallbackInfo& info);
         Napi::Value DirectoryOperations(const Napi::CallbackInfo& info);
+        Napi::Value WalkDirectoryTree(const Napi::CallbackInfo& info);
+        Napi::Value CreateIoRing(const Napi::CallbackInfo& info);
+        Napi::Value IoRingRegisterFile(const Napi::CallbackInfo& info);
+        Napi::Value IoRingRegisterBuffer(const Napi::CallbackInfo& info);
+        Napi::Value IoRingQueue(const Napi::CallbackInfo& info);
+        Napi::Value IoRingSubmit(const Napi::CallbackInfo& info);
+        Napi::Value DestroyIoRing(const Napi::CallbackInfo& info);
+        Napi::Value ReadFileAsync(const Napi::CallbackInfo& info);
+        Napi::Value WriteFileAsync(const Napi::CallbackInfo& info);
+        Napi::Value ReadAt(const Napi::CallbackInfo& info);
+        Napi::Value WriteAt(const Napi::CallbackInfo& info);
+        Napi::Value Preadv(const Napi::CallbackInfo& info);
+        Napi::Value Pwritev(const Napi::CallbackInfo& info);
+        Napi::Value MapFile(const Napi::CallbackInfo& info);
+        Napi::Value Msync(const Napi::CallbackInfo& info);
+        Napi::Value Madvise(const Napi::CallbackInfo& info);
     }
 
     // Threading operations
@@ -72,9 +126,19 @@ namespace LLJS {
         Napi::Value CreateMutex(const Napi::CallbackInfo& info);
         Napi::Value LockMutex(const Napi::CallbackInfo& info);
         Napi::Value UnlockMutex(const Napi::CallbackInfo& info);
+        Napi::Value DestroyMutex(const Napi::CallbackInfo& info);
         Napi::Value CreateSemaphore(const Napi::CallbackInfo& info);
         Napi::Value WaitSemaphore(const Napi::CallbackInfo& info);
         Napi::Value SignalSemaphore(const Napi::CallbackInfo& info);
+        Napi::Value DestroySemaphore(const Napi::CallbackInfo& info);
+        Napi::Value RingByteLength(const Napi::CallbackInfo& info);
+        Napi::Value RingInit(const Napi::CallbackInfo& info);
+        Napi::Value RingPush(const Napi::CallbackInfo& info);
+        Napi::Value RingPop(const Napi::CallbackInfo& info);
+        Napi::Value RingInfo(const Napi::CallbackInfo& info);
+        Napi::Value RunBatch(const Napi::CallbackInfo& info);
+        Napi::Value GetPoolInfo(const Napi::CallbackInfo& info);
+        Napi::Value SetPoolAffinity(const Napi::CallbackInfo& info);
     }
 
     // Time operations
@@ -90,6 +154,21 @@ namespace LLJS {
         Napi::Value GetMonotonicTime(const Napi::CallbackInfo& info);
         Napi::Value MeasureElapsed(const Napi::CallbackInfo& info);
         Napi::Value GetTimeZoneInfo(const Napi::CallbackInfo& info);
+        Napi::Value ReadCycles(const Napi::CallbackInfo& info);
+        Napi::Value WriteCycles(const Napi::CallbackInfo& info);
+        Napi::Value CyclesToNanoseconds(const Napi::CallbackInfo& info);
+        Napi::Value GetCycleClockInfo(const Napi::CallbackInfo& info);
+        Napi::Value CreateHistogram(const Napi::CallbackInfo& info);
+        Napi::Value HistogramRecord(const Napi::CallbackInfo& info);
+        Napi::Value HistogramTime(const Napi::CallbackInfo& info);
+        Napi::Value HistogramAdd(const Napi::CallbackInfo& info);
+        Napi::Value HistogramPercentile(const Napi::CallbackInfo& info);
+        Napi::Value HistogramSnapshot(const Napi::CallbackInfo& info);
+        Napi::Value HistogramReset(const Napi::CallbackInfo& info);
+        Napi::Value DestroyHistogram(const Napi::CallbackInfo& info);
+
+        // Internal: takes the first cycle counter calibration sample
+        void InitCycleClock();
     }
 
     // Math operations
@@ -99,8 +178,22 @@ namespace LLJS {
         Napi::Value VectorOperations(const Napi::CallbackInfo& info);
         Napi::Value MatrixOperations(const Napi::CallbackInfo& info);
         Napi::Value BitwiseOperations(const Napi::CallbackInfo& info);
+        Napi::Value ExecuteCommands(const Napi::CallbackInfo& info);
         Napi::Value RandomNumbers(const Napi::CallbackInfo& info);
+        Napi::Value FillRandom(const Napi::CallbackInfo& info);
         Napi::Value FastFourierTransform(const Napi::CallbackInfo& info);
+        Napi::Value CreateFFTPlan(const Napi::CallbackInfo& info);
+        Napi::Value ExecuteFFTPlan(const Napi::CallbackInfo& info);
+        Napi::Value DestroyFFTPlan(const Napi::CallbackInfo& info);
+
+        // Internal: SIMD kernel selection
+        void InitKernels(SIMD::ISA isa);
+
+        // Internal: dispatched kernels shared with the worker pool
+        double DotProduct(const double* a, const double* b, size_t length);
+        double DotProduct(const float* a, const float* b, size_t length);
+        double SumElements(const double* data, size_t length);
+        double SumElements(const float* data, size_t length);
     }
 
     // String operations
@@ -113,6 +206,31 @@ namespace LLJS {
         Napi::Value StringHash(const Napi::CallbackInfo& info);
         Napi::Value StringValidate(const Napi::CallbackInfo& info);
         Napi::Value StringReplace(const Napi::CallbackInfo& info);
+        Napi::Value FindAll(const Napi::CallbackInfo& info);
+        Napi::Value CreateMatcher(const Napi::CallbackInfo& info);
+        Napi::Value MatcherScan(const Napi::CallbackInfo& info);
+        Napi::Value DestroyMatcher(const Napi::CallbackInfo& info);
+        Napi::Value BufferLength(const Napi::CallbackInfo& info);
+        Napi::Value BufferHash(const Napi::CallbackInfo& info);
+        Napi::Value BufferValidate(const Napi::CallbackInfo& info);
+        Napi::Value BufferCompare(const Napi::CallbackInfo& info);
+        Napi::Value StringBatch(const Napi::CallbackInfo& info);
+        Napi::Value Hash(const Napi::CallbackInfo& info);
+        Napi::Value CreateHasher(const Napi::CallbackInfo& info);
+        Napi::Value HasherUpdate(const Napi::CallbackInfo& info);
+        Napi::Value HasherDigest(const Napi::CallbackInfo& info);
+        Napi::Value DestroyHasher(const Napi::CallbackInfo& info);
+        Napi::Value Transcode(const Napi::CallbackInfo& info);
+        Napi::Value DecodeUtf8(const Napi::CallbackInfo& info);
+
+        // Internal: SIMD kernel selection
+        void InitKernels(SIMD::ISA isa);
+
+        // Internal: byte kernels shared with the worker pool
+        enum class HashAlgorithm { DJB2, FNV1a, Murmur3, CRC32, SDBM, CRC32C, XXH3, XXH3_128, WyHash };
+        bool ParseHashAlgorithm(const std::string& name, HashAlgorithm& algorithm);
+        uint64_t HashBytes(const uint8_t* data, size_t length, HashAlgorithm algorithm, uint64_t seed = 0);
+        size_t FindBytes(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, bool foldCase = false);
     }
 }
 
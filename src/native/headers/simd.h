@@ -0,0 +1,94 @@
+#ifndef LLJS_SIMD_H
+#define LLJS_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Architecture detection
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define LLJS_ARCH_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define LLJS_ARCH_ARM64 1
+#include <arm_neon.h>
+#endif
+
+// Per-function ISA targeting so wider kernels can live next to the baseline
+// ones without compiling the whole addon for the widest instruction set.
+// MSVC accepts intrinsics in any function and needs no annotation.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define LLJS_TARGET(isa)
+#else
+#define LLJS_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+#define LLJS_TARGET_SSE2 LLJS_TARGET("sse2")
+#define LLJS_TARGET_SSE42 LLJS_TARGET("sse4.2")
+#define LLJS_TARGET_AVX2 LLJS_TARGET("avx2,fma")
+#define LLJS_TARGET_AVX512 LLJS_TARGET("avx512f,avx512bw")
+
+namespace LLJS::SIMD {
+    // Instruction set levels, ordered from narrowest to widest
+    enum class ISA {
+        Scalar,
+        SSE2,
+        AVX2,
+        AVX512,
+        NEON
+    };
+
+    /**
+     * Gets the canonical lowercase name of an ISA level
+     * @param isa - ISA level
+     * @returns Name such as "avx2"
+     */
+    const char* ISAName(ISA isa);
+
+    /**
+     * Gets the ISA level selected at module initialization
+     * @returns Active ISA level
+     */
+    ISA ActiveISA();
+
+    /**
+     * Whether CRC-32C instructions (SSE4.2 crc32, ARMv8 CRC) are usable.
+     * Reports false when LLJS_SIMD=scalar forces the portable kernels.
+     * @returns True if hardware CRC-32C may be used
+     */
+    bool HasCRC32C();
+
+    /**
+     * Index of the lowest set bit, for walking movemask results
+     * @param mask - Non-zero bit mask
+     * @returns Bit index
+     */
+    inline unsigned CountTrailingZeros(uint64_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+    }
+
+    /**
+     * Number of zero bits above the highest set bit
+     * @param mask - Non-zero bit mask
+     * @returns Leading zero count
+     */
+    inline unsigned CountLeadingZeros(uint64_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanReverse64(&index, mask);
+        return 63u - static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_clzll(mask));
+#endif
+    }
+}
+
+#endif // LLJS_SIMD_H
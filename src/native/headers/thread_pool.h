@@ -0,0 +1,99 @@
+#ifndef LLJS_THREAD_POOL_H
+#define LLJS_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LLJS::Threading {
+    /**
+     * Process-wide native worker pool, one worker per logical core.
+     * Each worker owns a deque: it pops its own work LIFO and steals the
+     * oldest work of other workers when idle, so uneven batches still keep
+     * every core busy. Tasks run without an N-API environment and must hand
+     * results back through a ThreadSafeFunction.
+     */
+    class WorkerPool {
+    public:
+        using Task = std::function<void()>;
+
+        // Counters reported by getPoolInfo
+        struct Stats {
+            size_t threads;
+            size_t pending;
+            uint64_t executed;
+            uint64_t stolen;
+        };
+
+        /**
+         * Gets the shared pool, starting its workers on first use. The pool
+         * lives until process exit so no static destructor has to join threads.
+         * @returns Pool sized from the logical core count
+         */
+        static WorkerPool& Instance();
+
+        /**
+         * Queues a task; called from a worker it lands on that worker's own deque
+         * @param task - Work to run on a pool thread
+         */
+        void Submit(Task task);
+
+        /**
+         * Runs body(0..count-1) across the pool and returns once all calls finish.
+         * The caller claims indices too, so it is safe to nest from pool threads.
+         * @param count - Number of indices
+         * @param body - Work for one index
+         */
+        void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+        /**
+         * Gets the worker count
+         * @returns Number of pool threads
+         */
+        size_t Size() const { return workers.size(); }
+
+        /**
+         * Gets a snapshot of the pool counters
+         * @returns Thread, queue and execution counts
+         */
+        Stats GetStats() const;
+
+        /**
+         * Pins the workers; worker i gets sets[i % sets.size()]
+         * @param sets - CPU index sets, each non-empty
+         * @returns Number of workers pinned successfully
+         */
+        size_t SetAffinity(const std::vector<std::vector<uint32_t>>& sets);
+
+    private:
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        explicit WorkerPool(size_t threadCount);
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        void WorkerLoop(size_t index);
+        bool TryTake(size_t index, Task& task);
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::vector<std::thread> workers;
+        std::atomic<size_t> pending{0};
+        std::atomic<size_t> nextQueue{0};
+        std::atomic<uint64_t> executed{0};
+        std::atomic<uint64_t> stolen{0};
+        std::mutex sleepMutex;
+        std::condition_variable wake;
+    };
+}
+
+#endif // LLJS_THREAD_POOL_H
@@ -1,9 +1,21 @@
 #include "headers/lljs.h"
+#include "headers/handle_table.h"
+#include "headers/thread_pool.h"
 #include <fstream>
 #include <filesystem>
 #include <map>
 #include <vector>
 #include <cstring>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
 #ifdef _WIN32
 #ifndef WIN32_LEAN_AND_MEAN
 #define WIN32_LEAN_AND_MEAN
@@ -28,6 +40,19 @@
 #include <sys/stat.h>
 #include <dirent.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <climits>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+// io_uring needs IORING_OP_READ/WRITE (5.6 headers) and the raw syscalls
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup)
+#define LLJS_HAVE_IO_URING 1
+#endif
 #endif
 
 namespace LLJS::IO {
@@ -36,9 +61,268 @@ namespace LLJS::IO {
 static std::map<int, std::string> openFiles;
 static int nextFileDescriptor = 1000;
 
+#ifdef _WIN32
+using NativeFile = HANDLE;
+static const NativeFile kInvalidFile = INVALID_HANDLE_VALUE;
+#else
+using NativeFile = int;
+static const NativeFile kInvalidFile = -1;
+#endif
+
+/**
+ * Reads up to length bytes at an absolute position, retrying short reads
+ * @param file - Open file
+ * @param data - Destination
+ * @param length - Bytes wanted
+ * @param position - Absolute file offset
+ * @param transferred - Bytes read before EOF or error
+ * @returns False on I/O error
+ */
+static bool ReadFully(NativeFile file, uint8_t* data, size_t length, uint64_t position, size_t& transferred) {
+    transferred = 0;
+    while (transferred < length) {
+#ifdef _WIN32
+        OVERLAPPED overlapped = {};
+        uint64_t at = position + transferred;
+        overlapped.Offset = static_cast<DWORD>(at);
+        overlapped.OffsetHigh = static_cast<DWORD>(at >> 32);
+        DWORD chunk = static_cast<DWORD>(std::min<size_t>(length - transferred, 0x7FFFFFFF));
+        DWORD bytesRead = 0;
+        if (!::ReadFile(file, data + transferred, chunk, &bytesRead, &overlapped)) {
+            if (GetLastError() == ERROR_HANDLE_EOF) break;
+            return false;
+        }
+#else
+        ssize_t bytesRead = pread(file, data + transferred, length - transferred,
+                                  static_cast<off_t>(position + transferred));
+        if (bytesRead == -1) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+#endif
+        if (bytesRead == 0) break;
+        transferred += static_cast<size_t>(bytesRead);
+    }
+    return true;
+}
+
+/**
+ * Writes length bytes at an absolute position, retrying short writes
+ * @param file - Open file
+ * @param data - Source
+ * @param length - Bytes to write
+ * @param position - Absolute file offset
+ * @param transferred - Bytes written before an error
+ * @returns False on I/O error
+ */
+static bool WriteFully(NativeFile file, const uint8_t* data, size_t length, uint64_t position, size_t& transferred) {
+    transferred = 0;
+    while (transferred < length) {
+#ifdef _WIN32
+        OVERLAPPED overlapped = {};
+        uint64_t at = position + transferred;
+        overlapped.Offset = static_cast<DWORD>(at);
+        overlapped.OffsetHigh = static_cast<DWORD>(at >> 32);
+        DWORD chunk = static_cast<DWORD>(std::min<size_t>(length - transferred, 0x7FFFFFFF));
+        DWORD bytesWritten = 0;
+        if (!::WriteFile(file, data + transferred, chunk, &bytesWritten, &overlapped)) {
+            return false;
+        }
+#else
+        ssize_t bytesWritten = pwrite(file, data + transferred, length - transferred,
+                                      static_cast<off_t>(position + transferred));
+        if (bytesWritten == -1) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+#endif
+        if (bytesWritten == 0) return false;
+        transferred += static_cast<size_t>(bytesWritten);
+    }
+    return true;
+}
+
+// One contiguous piece of a vectored transfer
+struct TransferSegment {
+    uint8_t* data;
+    size_t length;
+};
+
+#ifndef _WIN32
+/**
+ * Runs preadv/pwritev until every segment is transferred, resuming after
+ * partial transfers and splitting at IOV_MAX
+ * @param file - Open file
+ * @param segments - Buffers to fill or drain, in file order
+ * @param position - Absolute file offset of the first segment
+ * @param transferred - Bytes moved before EOF or error
+ * @param write - True for pwritev, false for preadv
+ * @returns False on I/O error
+ */
+static bool TransferVectoredPosix(int file, const std::vector<TransferSegment>& segments, uint64_t position,
+                                  size_t& transferred, bool write) {
+    std::vector<struct iovec> iov;
+    iov.reserve(segments.size());
+    for (const TransferSegment& segment : segments) {
+        if (segment.length > 0) {
+            iov.push_back({ segment.data, segment.length });
+        }
+    }
+    
+#ifdef IOV_MAX
+    const size_t maxBatch = IOV_MAX;
+#else
+    const size_t maxBatch = 1024;
+#endif
+    
+    transferred = 0;
+    size_t index = 0;
+    while (index < iov.size()) {
+        int count = static_cast<int>(std::min(iov.size() - index, maxBatch));
+        off_t at = static_cast<off_t>(position + transferred);
+        ssize_t moved = write ? pwritev(file, iov.data() + index, count, at)
+                              : preadv(file, iov.data() + index, count, at);
+        if (moved == -1) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (moved == 0) {
+            // EOF for reads; a stalled write is an error
+            return !write;
+        }
+        
+        transferred += static_cast<size_t>(moved);
+        
+        // Drop fully transferred segments and trim a partially transferred one
+        size_t remaining = static_cast<size_t>(moved);
+        while (index < iov.size() && remaining >= iov[index].iov_len) {
+            remaining -= iov[index].iov_len;
+            index++;
+        }
+        if (remaining > 0) {
+            iov[index].iov_base = static_cast<uint8_t*>(iov[index].iov_base) + remaining;
+            iov[index].iov_len -= remaining;
+        }
+    }
+    return true;
+}
+#endif
+
+/**
+ * Fills several buffers from consecutive file offsets
+ * @param file - Open file
+ * @param segments - Destination buffers, in file order
+ * @param position - Absolute file offset of the first segment
+ * @param transferred - Bytes read before EOF or error
+ * @returns False on I/O error
+ */
+static bool ReadVectored(NativeFile file, const std::vector<TransferSegment>& segments, uint64_t position, size_t& transferred) {
+#ifdef _WIN32
+    // ReadFileScatter needs unbuffered overlapped handles; issue one positional read per segment
+    transferred = 0;
+    for (const TransferSegment& segment : segments) {
+        size_t bytesRead = 0;
+        if (!ReadFully(file, segment.data, segment.length, position + transferred, bytesRead)) {
+            return false;
+        }
+        transferred += bytesRead;
+        if (bytesRead < segment.length) {
+            break;
+        }
+    }
+    return true;
+#else
+    return TransferVectoredPosix(file, segments, position, transferred, false);
+#endif
+}
+
+/**
+ * Writes several buffers to consecutive file offsets
+ * @param file - Open file
+ * @param segments - Source buffers, in file order
+ * @param position - Absolute file offset of the first segment
+ * @param transferred - Bytes written before an error
+ * @returns False on I/O error
+ */
+static bool WriteVectored(NativeFile file, const std::vector<TransferSegment>& segments, uint64_t position, size_t& transferred) {
+#ifdef _WIN32
+    transferred = 0;
+    for (const TransferSegment& segment : segments) {
+        size_t bytesWritten = 0;
+        bool ok = WriteFully(file, segment.data, segment.length, position + transferred, bytesWritten);
+        transferred += bytesWritten;
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+#else
+    return TransferVectoredPosix(file, segments, position, transferred, true);
+#endif
+}
+
+// Largest integer a JS Number holds exactly (Number.MAX_SAFE_INTEGER)
+static const double kMaxSafeInteger = 9007199254740991.0;
+
+/**
+ * Reads a non-negative 64-bit file offset or length
+ * @param value - Safe-integer Number or BigInt
+ * @param result - Parsed value
+ * @returns False if the value is negative, fractional, unsafe or out of range
+ */
+static bool ToFileOffset(const Napi::Value& value, uint64_t& result) {
+    if (value.IsBigInt()) {
+        bool lossless = false;
+        result = value.As<Napi::BigInt>().Uint64Value(&lossless);
+        return lossless && result <= static_cast<uint64_t>(INT64_MAX);
+    }
+    if (value.IsNumber()) {
+        double number = value.As<Napi::Number>().DoubleValue();
+        if (!(number >= 0) || number > kMaxSafeInteger || number != std::floor(number)) {
+            return false;
+        }
+        result = static_cast<uint64_t>(number);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Reads a signed 64-bit file position (relative seeks may be negative)
+ * @param value - Safe-integer Number or BigInt
+ * @param result - Parsed value
+ * @returns False if the value is fractional, unsafe or out of range
+ */
+static bool ToSignedFileOffset(const Napi::Value& value, int64_t& result) {
+    if (value.IsBigInt()) {
+        bool lossless = false;
+        result = value.As<Napi::BigInt>().Int64Value(&lossless);
+        return lossless;
+    }
+    if (value.IsNumber()) {
+        double number = value.As<Napi::Number>().DoubleValue();
+        if (!(std::fabs(number) <= kMaxSafeInteger) || number != std::floor(number)) {
+            return false;
+        }
+        result = static_cast<int64_t>(number);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Checks whether an optional argument carries an offset or length
+ * @param info - CallbackInfo
+ * @param index - Argument index
+ * @returns True for a Number or BigInt argument
+ */
+static bool HasOffsetArgument(const Napi::CallbackInfo& info, size_t index) {
+    return info.Length() > index && (info[index].IsNumber() || info[index].IsBigInt());
+}
+
 /**
  * Reads file content with low-level system calls
- * @param info - CallbackInfo containing path, offset, length parameters
+ * @param info - CallbackInfo containing path, offset, length parameters (Number or BigInt)
  * @returns File content buffer
  */
 Napi::Value ReadFile(const Napi::CallbackInfo& info) {
@@ -50,92 +334,97 @@ Napi::Value ReadFile(const Napi::CallbackInfo& info) {
     }
     
     std::string path = info[0].As<Napi::String>();
-    size_t offset = 0;
-    size_t length = 0;
+    uint64_t offset = 0;
+    uint64_t length = 0;
     
-    if (info.Length() > 1 && info[1].IsNumber()) {
-        offset = info[1].As<Napi::Number>().Uint32Value();
+    if (HasOffsetArgument(info, 1) && !ToFileOffset(info[1], offset)) {
+        Napi::RangeError::New(env, "Offset must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+        return env.Null();
     }
     
-    if (info.Length() > 2 && info[2].IsNumber()) {
-        length = info[2].As<Napi::Number>().Uint32Value();
+    if (HasOffsetArgument(info, 2) && !ToFileOffset(info[2], length)) {
+        Napi::RangeError::New(env, "Length must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+        return env.Null();
     }
     
 #ifdef _WIN32
-    HANDLE hFile = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 
-                              NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    NativeFile file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 
+                                 NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
     
-    if (hFile == INVALID_HANDLE_VALUE) {
+    if (file == INVALID_HANDLE_VALUE) {
         Napi::Error::New(env, "Failed to open file").ThrowAsJavaScriptException();
         return env.Null();
     }
     
     LARGE_INTEGER fileSize;
-    if (!GetFileSizeEx(hFile, &fileSize)) {
-        CloseHandle(hFile);
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
         Napi::Error::New(env, "Failed to get file size").ThrowAsJavaScriptException();
         return env.Null();
     }
-    
-    if (length == 0) {
-        length = static_cast<size_t>(fileSize.QuadPart) - offset;
-    }
-    
-    auto buffer = Napi::Buffer<uint8_t>::New(env, length);
-    
-    if (offset > 0) {
-        LARGE_INTEGER movePtr;
-        movePtr.QuadPart = offset;
-        SetFilePointerEx(hFile, movePtr, NULL, FILE_BEGIN);
-    }
-    
-    DWORD bytesRead;
-    if (!::ReadFile(hFile, buffer.Data(), static_cast<DWORD>(length), &bytesRead, NULL)) {
-        CloseHandle(hFile);
-        Napi::Error::New(env, "Failed to read file").ThrowAsJavaScriptException();
-        return env.Null();
-    }
-    
-    CloseHandle(hFile);
+    uint64_t size = static_cast<uint64_t>(fileSize.QuadPart);
 #else
-    int fd = open(path.c_str(), O_RDONLY);
-    if (fd == -1) {
+    NativeFile file = open(path.c_str(), O_RDONLY);
+    if (file == -1) {
         Napi::Error::New(env, "Failed to open file").ThrowAsJavaScriptException();
         return env.Null();
     }
     
     struct stat fileStat;
-    if (fstat(fd, &fileStat) == -1) {
-        close(fd);
+    if (fstat(file, &fileStat) == -1) {
+        close(file);
         Napi::Error::New(env, "Failed to get file stats").ThrowAsJavaScriptException();
         return env.Null();
     }
+    uint64_t size = static_cast<uint64_t>(fileStat.st_size);
+#endif
     
-    if (length == 0) {
-        length = fileStat.st_size - offset;
+    // Never read past EOF: default to the rest of the file and clamp explicit lengths
+    uint64_t remaining = offset < size ? size - offset : 0;
+    if (length == 0 || length > remaining) {
+        length = remaining;
     }
     
-    auto buffer = Napi::Buffer<uint8_t>::New(env, length);
-    
-    if (offset > 0) {
-        lseek(fd, offset, SEEK_SET);
+    Napi::Buffer<uint8_t> buffer;
+    if (length <= static_cast<uint64_t>(SIZE_MAX)) {
+        buffer = Napi::Buffer<uint8_t>::New(env, static_cast<size_t>(length));
+    }
+    if (buffer.IsEmpty()) {
+#ifdef _WIN32
+        CloseHandle(file);
+#else
+        close(file);
+#endif
+        if (!env.IsExceptionPending()) {
+            Napi::RangeError::New(env, "Read length exceeds the maximum Buffer size").ThrowAsJavaScriptException();
+        }
+        return env.Null();
     }
     
-    ssize_t bytesRead = read(fd, buffer.Data(), length);
-    close(fd);
+    size_t bytesRead = 0;
+    bool ok = ReadFully(file, buffer.Data(), buffer.Length(), offset, bytesRead);
+#ifdef _WIN32
+    CloseHandle(file);
+#else
+    close(file);
+#endif
     
-    if (bytesRead == -1) {
+    if (!ok) {
         Napi::Error::New(env, "Failed to read file").ThrowAsJavaScriptException();
         return env.Null();
     }
-#endif
+    
+    if (bytesRead < buffer.Length()) {
+        // The file shrank underneath us; hand back only what was read
+        return Napi::Buffer<uint8_t>::Copy(env, buffer.Data(), bytesRead);
+    }
     
     return buffer;
 }
 
 /**
  * Writes data to file with low-level system calls
- * @param info - CallbackInfo containing path, data, offset parameters
+ * @param info - CallbackInfo containing path, data, offset parameters (Number or BigInt)
  * @returns Number of bytes written
  */
 Napi::Value WriteFile(const Napi::CallbackInfo& info) {
@@ -148,52 +437,39 @@ Napi::Value WriteFile(const Napi::CallbackInfo& info) {
     
     std::string path = info[0].As<Napi::String>();
     Napi::Buffer<uint8_t> data = info[1].As<Napi::Buffer<uint8_t>>();
-    size_t offset = 0;
+    uint64_t offset = 0;
     
-    if (info.Length() > 2 && info[2].IsNumber()) {
-        offset = info[2].As<Napi::Number>().Uint32Value();
+    if (HasOffsetArgument(info, 2) && !ToFileOffset(info[2], offset)) {
+        Napi::RangeError::New(env, "Offset must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+        return Napi::Number::New(env, -1);
     }
     
 #ifdef _WIN32
-    HANDLE hFile = CreateFileA(path.c_str(), GENERIC_WRITE, 0, NULL, 
-                              CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    NativeFile file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, NULL, 
+                                 CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+#else
+    NativeFile file = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
     
-    if (hFile == INVALID_HANDLE_VALUE) {
+    if (file == kInvalidFile) {
         Napi::Error::New(env, "Failed to create/open file").ThrowAsJavaScriptException();
         return Napi::Number::New(env, -1);
     }
     
-    if (offset > 0) {
-        LARGE_INTEGER movePtr;
-        movePtr.QuadPart = offset;
-        SetFilePointerEx(hFile, movePtr, NULL, FILE_BEGIN);
-    }
+    size_t bytesWritten = 0;
+    bool ok = WriteFully(file, data.Data(), data.Length(), offset, bytesWritten);
+#ifdef _WIN32
+    CloseHandle(file);
+#else
+    close(file);
+#endif
     
-    DWORD bytesWritten;
-    if (!::WriteFile(hFile, data.Data(), static_cast<DWORD>(data.Length()), &bytesWritten, NULL)) {
-        CloseHandle(hFile);
+    if (!ok) {
         Napi::Error::New(env, "Failed to write file").ThrowAsJavaScriptException();
         return Napi::Number::New(env, -1);
     }
     
-    CloseHandle(hFile);
-    return Napi::Number::New(env, bytesWritten);
-#else
-    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
-    if (fd == -1) {
-        Napi::Error::New(env, "Failed to create/open file").ThrowAsJavaScriptException();
-        return Napi::Number::New(env, -1);
-    }
-    
-    if (offset > 0) {
-        lseek(fd, offset, SEEK_SET);
-    }
-    
-    ssize_t bytesWritten = write(fd, data.Data(), data.Length());
-    close(fd);
-    
-    return Napi::Number::New(env, bytesWritten);
-#endif
+    return Napi::Number::New(env, static_cast<double>(bytesWritten));
 }
 
 /**
@@ -311,13 +587,17 @@ Napi::Value CloseFile(const Napi::CallbackInfo& info) {
 Napi::Value SeekFile(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 2 || !info[0].IsObject() || !info[1].IsNumber()) {
+    if (info.Length() < 2 || !info[0].IsObject() || !HasOffsetArgument(info, 1)) {
         Napi::TypeError::New(env, "File handle and position required").ThrowAsJavaScriptException();
         return Napi::Number::New(env, -1);
     }
     
     Napi::Object handle = info[0].As<Napi::Object>();
-    long position = info[1].As<Napi::Number>().Int64Value();
+    int64_t position = 0;
+    if (!ToSignedFileOffset(info[1], position)) {
+        Napi::RangeError::New(env, "Position must be a safe integer or BigInt").ThrowAsJavaScriptException();
+        return Napi::Number::New(env, -1);
+    }
     int whence = SEEK_SET;
     
     if (info.Length() > 2 && info[2].IsNumber()) {
@@ -340,7 +620,7 @@ Napi::Value SeekFile(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, static_cast<double>(newPtr.QuadPart));
 #else
     int fd = handle.Get("fd").As<Napi::Number>().Int32Value();
-    off_t result = lseek(fd, position, whence);
+    off_t result = lseek(fd, static_cast<off_t>(position), whence);
     return Napi::Number::New(env, static_cast<double>(result));
 #endif
 }
@@ -506,4 +786,2330 @@ Napi::Value DirectoryOperations(const Napi::CallbackInfo& info) {
     return env.Null();
 }
 
-}
\ No newline at end of file
+/**
+ * Gets the native file behind an OpenFile handle object
+ * @param handle - Handle returned by OpenFile
+ * @returns Native file or kInvalidFile
+ */
+static NativeFile HandleToNativeFile(const Napi::Object& handle) {
+#ifdef _WIN32
+    if (!handle.Has("_handle") || !handle.Get("_handle").IsExternal()) {
+        return kInvalidFile;
+    }
+    return static_cast<HANDLE>(handle.Get("_handle").As<Napi::External<void>>().Data());
+#else
+    if (!handle.Has("fd") || !handle.Get("fd").IsNumber()) {
+        return kInvalidFile;
+    }
+    return handle.Get("fd").As<Napi::Number>().Int32Value();
+#endif
+}
+
+/**
+ * Thread-pool file transfer into or out of caller-owned Buffers.
+ * Opens the path itself when given one, otherwise uses the borrowed file.
+ * Several segments are transferred as one vectored call at consecutive offsets.
+ */
+class FileTransferWorker : public Napi::AsyncWorker {
+public:
+    enum class Direction { Read, Write };
+    
+    FileTransferWorker(Napi::Env env, Direction direction, uint64_t position)
+        : Napi::AsyncWorker(env),
+          deferred(Napi::Promise::Deferred::New(env)),
+          direction(direction),
+          position(position) {}
+    
+    void AddSegment(Napi::Buffer<uint8_t> buffer, size_t length) {
+        segments.push_back({ buffer.Data(), length });
+        bufferRefs.push_back(Napi::Persistent(buffer));
+    }
+    void SetPath(const std::string& value) { path = value; }
+    void SetFile(NativeFile value) { file = value; }
+    Napi::Promise GetPromise() const { return deferred.Promise(); }
+    
+protected:
+    void Execute() override {
+        bool ownsFile = !path.empty();
+        if (ownsFile) {
+#ifdef _WIN32
+            file = direction == Direction::Read
+                ? CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)
+                : CreateFileA(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+#else
+            file = direction == Direction::Read
+                ? open(path.c_str(), O_RDONLY)
+                : open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+            if (file == kInvalidFile) {
+                SetError(direction == Direction::Read ? "Failed to open file" : "Failed to create/open file");
+                return;
+            }
+        }
+        
+        bool ok;
+        if (segments.size() == 1) {
+            ok = direction == Direction::Read
+                ? ReadFully(file, segments[0].data, segments[0].length, position, transferred)
+                : WriteFully(file, segments[0].data, segments[0].length, position, transferred);
+        } else {
+            ok = direction == Direction::Read
+                ? ReadVectored(file, segments, position, transferred)
+                : WriteVectored(file, segments, position, transferred);
+        }
+        
+        if (ownsFile) {
+#ifdef _WIN32
+            CloseHandle(file);
+#else
+            close(file);
+#endif
+        }
+        
+        if (!ok) {
+            SetError(direction == Direction::Read ? "Failed to read file" : "Failed to write file");
+        }
+    }
+    
+    void OnOK() override {
+        deferred.Resolve(Napi::Number::New(Env(), static_cast<double>(transferred)));
+    }
+    
+    void OnError(const Napi::Error& error) override {
+        deferred.Reject(error.Value());
+    }
+    
+private:
+    Napi::Promise::Deferred deferred;
+    std::vector<Napi::Reference<Napi::Buffer<uint8_t>>> bufferRefs; // keep the Buffers alive while the pool uses them
+    std::vector<TransferSegment> segments;
+    Direction direction;
+    uint64_t position;
+    std::string path;
+    NativeFile file = kInvalidFile;
+    size_t transferred = 0;
+};
+
+/**
+ * Parses the optional position and length arguments shared by the async transfers
+ * @param info - CallbackInfo
+ * @param index - Index of the position argument; length follows it
+ * @param bufferLength - Length of the target Buffer
+ * @param position - Parsed position (default 0)
+ * @param length - Parsed length (default bufferLength)
+ * @returns False after throwing on invalid arguments
+ */
+static bool ParseTransferRange(const Napi::CallbackInfo& info, size_t index, size_t bufferLength,
+                               uint64_t& position, size_t& length) {
+    Napi::Env env = info.Env();
+    position = 0;
+    length = bufferLength;
+    
+    if (HasOffsetArgument(info, index) && !ToFileOffset(info[index], position)) {
+        Napi::RangeError::New(env, "Position must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    if (HasOffsetArgument(info, index + 1)) {
+        uint64_t value = 0;
+        if (!ToFileOffset(info[index + 1], value) || value > bufferLength) {
+            Napi::RangeError::New(env, "Length exceeds buffer size").ThrowAsJavaScriptException();
+            return false;
+        }
+        length = static_cast<size_t>(value);
+    }
+    
+    return true;
+}
+
+/**
+ * Reads a file into a caller-supplied buffer on the libuv thread pool
+ * @param info - CallbackInfo containing path, buffer, position, length parameters
+ * @returns Promise resolving to the number of bytes read
+ */
+Napi::Value ReadFileAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsBuffer()) {
+        Napi::TypeError::New(env, "File path and destination buffer required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Buffer<uint8_t> buffer = info[1].As<Napi::Buffer<uint8_t>>();
+    uint64_t position;
+    size_t length;
+    if (!ParseTransferRange(info, 2, buffer.Length(), position, length)) {
+        return env.Null();
+    }
+    
+    auto* worker = new FileTransferWorker(env, FileTransferWorker::Direction::Read, position);
+    worker->AddSegment(buffer, length);
+    worker->SetPath(info[0].As<Napi::String>());
+    Napi::Promise promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+}
+
+/**
+ * Writes a buffer to a file on the libuv thread pool
+ * @param info - CallbackInfo containing path, data, position, length parameters
+ * @returns Promise resolving to the number of bytes written
+ */
+Napi::Value WriteFileAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsBuffer()) {
+        Napi::TypeError::New(env, "File path and data buffer required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Buffer<uint8_t> buffer = info[1].As<Napi::Buffer<uint8_t>>();
+    uint64_t position;
+    size_t length;
+    if (!ParseTransferRange(info, 2, buffer.Length(), position, length)) {
+        return env.Null();
+    }
+    
+    auto* worker = new FileTransferWorker(env, FileTransferWorker::Direction::Write, position);
+    worker->AddSegment(buffer, length);
+    worker->SetPath(info[0].As<Napi::String>());
+    Napi::Promise promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+}
+
+/**
+ * Positional read from an open file handle on the libuv thread pool
+ * @param info - CallbackInfo containing handle, buffer, position, length parameters
+ * @returns Promise resolving to the number of bytes read
+ */
+Napi::Value ReadAt(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsObject() || !info[1].IsBuffer()) {
+        Napi::TypeError::New(env, "File handle and destination buffer required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    NativeFile file = HandleToNativeFile(info[0].As<Napi::Object>());
+    if (file == kInvalidFile) {
+        Napi::TypeError::New(env, "Invalid file handle").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Buffer<uint8_t> buffer = info[1].As<Napi::Buffer<uint8_t>>();
+    uint64_t position;
+    size_t length;
+    if (!ParseTransferRange(info, 2, buffer.Length(), position, length)) {
+        return env.Null();
+    }
+    
+    auto* worker = new FileTransferWorker(env, FileTransferWorker::Direction::Read, position);
+    worker->AddSegment(buffer, length);
+    worker->SetFile(file);
+    Napi::Promise promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+}
+
+/**
+ * Positional write to an open file handle on the libuv thread pool
+ * @param info - CallbackInfo containing handle, data, position, length parameters
+ * @returns Promise resolving to the number of bytes written
+ */
+Napi::Value WriteAt(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsObject() || !info[1].IsBuffer()) {
+        Napi::TypeError::New(env, "File handle and data buffer required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    NativeFile file = HandleToNativeFile(info[0].As<Napi::Object>());
+    if (file == kInvalidFile) {
+        Napi::TypeError::New(env, "Invalid file handle").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Buffer<uint8_t> buffer = info[1].As<Napi::Buffer<uint8_t>>();
+    uint64_t position;
+    size_t length;
+    if (!ParseTransferRange(info, 2, buffer.Length(), position, length)) {
+        return env.Null();
+    }
+    
+    auto* worker = new FileTransferWorker(env, FileTransferWorker::Direction::Write, position);
+    worker->AddSegment(buffer, length);
+    worker->SetFile(file);
+    Napi::Promise promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+}
+
+/**
+ * Builds a vectored transfer from a handle, an array of Buffers and a position
+ * @param info - CallbackInfo containing handle, buffers, position parameters
+ * @param direction - Read or write
+ * @returns Promise resolving to the total bytes transferred
+ */
+static Napi::Value QueueVectoredTransfer(const Napi::CallbackInfo& info, FileTransferWorker::Direction direction) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsObject() || !info[1].IsArray()) {
+        Napi::TypeError::New(env, "File handle and array of buffers required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    NativeFile file = HandleToNativeFile(info[0].As<Napi::Object>());
+    if (file == kInvalidFile) {
+        Napi::TypeError::New(env, "Invalid file handle").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    uint64_t position = 0;
+    if (HasOffsetArgument(info, 2) && !ToFileOffset(info[2], position)) {
+        Napi::RangeError::New(env, "Position must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Array buffers = info[1].As<Napi::Array>();
+    for (uint32_t i = 0; i < buffers.Length(); i++) {
+        if (!buffers.Get(i).IsBuffer()) {
+            Napi::TypeError::New(env, "All elements must be Buffers").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    }
+    
+    auto* worker = new FileTransferWorker(env, direction, position);
+    for (uint32_t i = 0; i < buffers.Length(); i++) {
+        Napi::Buffer<uint8_t> buffer = buffers.Get(i).As<Napi::Buffer<uint8_t>>();
+        worker->AddSegment(buffer, buffer.Length());
+    }
+    
+    worker->SetFile(file);
+    Napi::Promise promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+}
+
+/**
+ * Scatter read: fills several buffers from consecutive offsets in as few syscalls as possible
+ * @param info - CallbackInfo containing handle, buffers array, position parameters
+ * @returns Promise resolving to the total bytes read (short at EOF)
+ */
+Napi::Value Preadv(const Napi::CallbackInfo& info) {
+    return QueueVectoredTransfer(info, FileTransferWorker::Direction::Read);
+}
+
+/**
+ * Gather write: writes several buffers to consecutive offsets in as few syscalls as possible
+ * @param info - CallbackInfo containing handle, buffers array, position parameters
+ * @returns Promise resolving to the total bytes written
+ */
+Napi::Value Pwritev(const Napi::CallbackInfo& info) {
+    return QueueVectoredTransfer(info, FileTransferWorker::Direction::Write);
+}
+
+// Live file mappings, keyed by the address handed to JS
+struct MappedRegion {
+    void* base;             // page-aligned start passed to munmap/UnmapViewOfFile
+    size_t mappedLength;    // bytes mapped from base
+    uint8_t* data;          // first byte exposed to JS
+    size_t length;          // bytes exposed to JS
+#ifdef _WIN32
+    HANDLE file;            // kept open for FlushFileBuffers on writable mappings
+#endif
+};
+
+static std::map<uintptr_t, MappedRegion> mappedRegions;
+static std::mutex mappedRegionsMutex;
+
+/**
+ * Finds the mapping that fully contains a byte range
+ * @param data - Range start
+ * @param length - Range length
+ * @param region - Receives the containing mapping
+ * @returns False if the range is not inside a live mapping
+ */
+static bool FindMappedRegion(const uint8_t* data, size_t length, MappedRegion& region) {
+    std::lock_guard<std::mutex> lock(mappedRegionsMutex);
+    auto it = mappedRegions.upper_bound(reinterpret_cast<uintptr_t>(data));
+    if (it == mappedRegions.begin()) {
+        return false;
+    }
+    --it;
+    const MappedRegion& candidate = it->second;
+    if (data < candidate.data || data + length > candidate.data + candidate.length) {
+        return false;
+    }
+    region = candidate;
+    return true;
+}
+
+/**
+ * Releases a mapping when its Buffer is garbage collected
+ * @param data - Buffer data pointer (registry key)
+ */
+static void UnmapRegion(uint8_t* data) {
+    MappedRegion region;
+    {
+        std::lock_guard<std::mutex> lock(mappedRegionsMutex);
+        auto it = mappedRegions.find(reinterpret_cast<uintptr_t>(data));
+        if (it == mappedRegions.end()) {
+            return;
+        }
+        region = it->second;
+        mappedRegions.erase(it);
+    }
+    
+#ifdef _WIN32
+    UnmapViewOfFile(region.base);
+    if (region.file != INVALID_HANDLE_VALUE) {
+        CloseHandle(region.file);
+    }
+#else
+    munmap(region.base, region.mappedLength);
+#endif
+}
+
+/**
+ * Gets the granularity mapping offsets must be aligned to
+ * @returns Page size (allocation granularity on Windows)
+ */
+static size_t MappingGranularity() {
+#ifdef _WIN32
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    return systemInfo.dwAllocationGranularity;
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+/**
+ * Parses an access pattern hint name
+ * @param name - 'normal', 'sequential', 'random', 'willneed' or 'dontneed'
+ * @param advice - Receives the platform advice value (POSIX)
+ * @returns False for unknown names
+ */
+static bool ParseAdvice(const std::string& name, int& advice) {
+#ifdef _WIN32
+    advice = 0;
+    return name == "normal" || name == "sequential" || name == "random" ||
+           name == "willneed" || name == "dontneed";
+#else
+    if (name == "normal") advice = MADV_NORMAL;
+    else if (name == "sequential") advice = MADV_SEQUENTIAL;
+    else if (name == "random") advice = MADV_RANDOM;
+    else if (name == "willneed") advice = MADV_WILLNEED;
+    else if (name == "dontneed") advice = MADV_DONTNEED;
+    else return false;
+    return true;
+#endif
+}
+
+/**
+ * Applies an access pattern hint to a mapped range
+ * @param data - Range start
+ * @param length - Range length
+ * @param name - Advice name (already validated)
+ * @param advice - Platform advice value from ParseAdvice
+ * @returns Success status
+ */
+static bool AdviseRange(uint8_t* data, size_t length, const std::string& name, int advice) {
+    if (length == 0) {
+        return true;
+    }
+#ifdef _WIN32
+    (void)advice;
+    if (name == "willneed") {
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+        WIN32_MEMORY_RANGE_ENTRY range = { data, length };
+        return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != 0;
+#else
+        return false;
+#endif
+    }
+    // The remaining hints have no Windows equivalent for file views
+    return true;
+#else
+    (void)name;
+    // madvise needs a page-aligned start
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t start = reinterpret_cast<uintptr_t>(data) & ~(static_cast<uintptr_t>(pageSize) - 1);
+    size_t span = reinterpret_cast<uintptr_t>(data) + length - start;
+    return madvise(reinterpret_cast<void*>(start), span, advice) == 0;
+#endif
+}
+
+/**
+ * Maps a file into memory and exposes it as an external Buffer
+ * @param info - CallbackInfo containing path and options (offset, length, readonly, populate, advice)
+ * @returns Buffer over the mapped pages, unmapped when collected
+ */
+Napi::Value MapFile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "File path parameter required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string path = info[0].As<Napi::String>();
+    uint64_t offset = 0;
+    uint64_t length = 0;
+    bool readonly = true;
+    bool populate = false;
+    std::string adviceName;
+    int advice = 0;
+    
+    if (info.Length() > 1 && info[1].IsObject()) {
+        Napi::Object options = info[1].As<Napi::Object>();
+        if (options.Has("offset") && !options.Get("offset").IsUndefined() && !ToFileOffset(options.Get("offset"), offset)) {
+            Napi::RangeError::New(env, "Offset must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        if (options.Has("length") && !options.Get("length").IsUndefined() && !ToFileOffset(options.Get("length"), length)) {
+            Napi::RangeError::New(env, "Length must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        if (options.Has("readonly") && options.Get("readonly").IsBoolean()) {
+            readonly = options.Get("readonly").As<Napi::Boolean>();
+        }
+        if (options.Has("populate") && options.Get("populate").IsBoolean()) {
+            populate = options.Get("populate").As<Napi::Boolean>();
+        }
+        if (options.Has("advice") && options.Get("advice").IsString()) {
+            adviceName = options.Get("advice").As<Napi::String>().Utf8Value();
+            if (!ParseAdvice(adviceName, advice)) {
+                Napi::TypeError::New(env, "Invalid advice").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+        }
+    }
+    
+#ifdef _WIN32
+    HANDLE hFile = CreateFileA(path.c_str(), readonly ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE),
+                              FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE) {
+        Napi::Error::New(env, "Failed to open file").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(hFile, &fileSize)) {
+        CloseHandle(hFile);
+        Napi::Error::New(env, "Failed to get file size").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    uint64_t size = static_cast<uint64_t>(fileSize.QuadPart);
+#else
+    int fd = open(path.c_str(), readonly ? O_RDONLY : O_RDWR);
+    if (fd == -1) {
+        Napi::Error::New(env, "Failed to open file").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == -1) {
+        close(fd);
+        Napi::Error::New(env, "Failed to get file stats").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    uint64_t size = static_cast<uint64_t>(fileStat.st_size);
+#endif
+    
+    bool rangeValid = offset <= size && (length == 0 || length <= size - offset);
+    if (rangeValid && length == 0) {
+        length = size - offset;
+    }
+    if (!rangeValid || length > static_cast<uint64_t>(SIZE_MAX)) {
+#ifdef _WIN32
+        CloseHandle(hFile);
+#else
+        close(fd);
+#endif
+        Napi::RangeError::New(env, "Mapping range exceeds file size").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (length == 0) {
+        // Nothing to map; an empty file maps to an empty Buffer
+#ifdef _WIN32
+        CloseHandle(hFile);
+#else
+        close(fd);
+#endif
+        return Napi::Buffer<uint8_t>::New(env, 0);
+    }
+    
+    // Map from the aligned offset below the request and expose the requested slice
+    uint64_t alignedOffset = offset - (offset % MappingGranularity());
+    size_t delta = static_cast<size_t>(offset - alignedOffset);
+    size_t mappedLength = static_cast<size_t>(length) + delta;
+    
+    MappedRegion region;
+#ifdef _WIN32
+    HANDLE hMapping = CreateFileMappingA(hFile, NULL, readonly ? PAGE_READONLY : PAGE_READWRITE, 0, 0, NULL);
+    if (hMapping == NULL) {
+        CloseHandle(hFile);
+        Napi::Error::New(env, "Failed to map file").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    void* base = MapViewOfFile(hMapping, readonly ? FILE_MAP_READ : FILE_MAP_WRITE,
+                               static_cast<DWORD>(alignedOffset >> 32), static_cast<DWORD>(alignedOffset),
+                               mappedLength);
+    // The view keeps the mapping object alive
+    CloseHandle(hMapping);
+    if (base == NULL) {
+        CloseHandle(hFile);
+        Napi::Error::New(env, "Failed to map file").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (readonly) {
+        CloseHandle(hFile);
+        hFile = INVALID_HANDLE_VALUE;
+    }
+    region.file = hFile;
+#else
+    int mapFlags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    if (populate) {
+        mapFlags |= MAP_POPULATE;
+    }
+#endif
+    void* base = mmap(nullptr, mappedLength, readonly ? PROT_READ : (PROT_READ | PROT_WRITE),
+                      mapFlags, fd, static_cast<off_t>(alignedOffset));
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (base == MAP_FAILED) {
+        Napi::Error::New(env, "Failed to map file").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+#endif
+    
+    region.base = base;
+    region.mappedLength = mappedLength;
+    region.data = static_cast<uint8_t*>(base) + delta;
+    region.length = static_cast<size_t>(length);
+    
+    if (!adviceName.empty()) {
+        AdviseRange(region.data, region.length, adviceName, advice);
+    }
+    
+#ifndef MAP_POPULATE
+    if (populate) {
+#ifdef _WIN32
+        AdviseRange(region.data, region.length, "willneed", 0);
+#else
+        AdviseRange(region.data, region.length, "willneed", MADV_WILLNEED);
+#endif
+    }
+#endif
+    
+    {
+        std::lock_guard<std::mutex> lock(mappedRegionsMutex);
+        mappedRegions[reinterpret_cast<uintptr_t>(region.data)] = region;
+    }
+    
+    return Napi::Buffer<uint8_t>::New(env, region.data, region.length, [](Napi::Env, uint8_t* data) {
+        UnmapRegion(data);
+    });
+}
+
+/**
+ * Flushes modified pages of a mapped Buffer (or a subarray of one) to the file
+ * @param info - CallbackInfo containing mapped buffer and optional async flag
+ * @returns Success status
+ */
+Napi::Value Msync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsBuffer()) {
+        Napi::TypeError::New(env, "Mapped buffer required").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+    bool async = info.Length() > 1 && info[1].IsBoolean() && info[1].As<Napi::Boolean>();
+    
+    MappedRegion region;
+    if (!FindMappedRegion(buffer.Data(), buffer.Length(), region)) {
+        Napi::TypeError::New(env, "Buffer is not a mapped file region").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    if (buffer.Length() == 0) {
+        return Napi::Boolean::New(env, true);
+    }
+    
+#ifdef _WIN32
+    if (!FlushViewOfFile(buffer.Data(), buffer.Length())) {
+        return Napi::Boolean::New(env, false);
+    }
+    if (!async && region.file != INVALID_HANDLE_VALUE) {
+        return Napi::Boolean::New(env, FlushFileBuffers(region.file) != 0);
+    }
+    return Napi::Boolean::New(env, true);
+#else
+    // msync needs a page-aligned start
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t start = reinterpret_cast<uintptr_t>(buffer.Data()) & ~(static_cast<uintptr_t>(pageSize) - 1);
+    size_t span = reinterpret_cast<uintptr_t>(buffer.Data()) + buffer.Length() - start;
+    return Napi::Boolean::New(env, msync(reinterpret_cast<void*>(start), span, async ? MS_ASYNC : MS_SYNC) == 0);
+#endif
+}
+
+/**
+ * Gives the kernel an access pattern hint for a mapped Buffer (or a subarray of one)
+ * @param info - CallbackInfo containing mapped buffer and advice name
+ * @returns Success status
+ */
+Napi::Value Madvise(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsBuffer() || !info[1].IsString()) {
+        Napi::TypeError::New(env, "Mapped buffer and advice required").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+    std::string adviceName = info[1].As<Napi::String>();
+    int advice = 0;
+    if (!ParseAdvice(adviceName, advice)) {
+        Napi::TypeError::New(env, "Invalid advice").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    MappedRegion region;
+    if (!FindMappedRegion(buffer.Data(), buffer.Length(), region)) {
+        Napi::TypeError::New(env, "Buffer is not a mapped file region").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    return Napi::Boolean::New(env, AdviseRange(buffer.Data(), buffer.Length(), adviceName, advice));
+}
+
+// Recursive directory walk off the JS thread. Directories go on a shared
+// stack that several walker threads drain. Each directory is opened
+// relative to the root fd and read with getdents64 into a large buffer;
+// entries are stat'ed relative to their directory fd (statx asking only for
+// type, size and mtime where available). On Windows FindFirstFileEx with
+// FIND_FIRST_EX_LARGE_FETCH returns size and mtime with the listing. Filters
+// run on the walker threads, and the entries that pass go to JS in columnar
+// batches. A walk with too many undelivered batches pauses until JS catches
+// up.
+
+static constexpr size_t kWalkDirentBuffer = 256 * 1024;
+static constexpr size_t kWalkMaxPendingBatches = 8;
+
+enum WalkEntryType : uint8_t { WalkOther = 0, WalkFile = 1, WalkDirectory = 2, WalkSymlink = 3 };
+
+struct WalkBatch {
+    std::vector<std::string> paths;
+    std::vector<uint8_t> types;
+    std::vector<double> sizes;
+    std::vector<double> mtimes;
+};
+
+struct DirectoryWalk {
+    explicit DirectoryWalk(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+    ~DirectoryWalk() {
+#ifndef _WIN32
+        if (rootFd >= 0) {
+            close(rootFd);
+        }
+#endif
+    }
+    
+    // Options, fixed before the threads start
+    std::string root;
+    std::vector<std::string> include;
+    std::vector<std::string> exclude;
+    double minSize = 0;
+    double maxSize = -1;
+    uint32_t maxDepth = UINT32_MAX;
+    size_t batchSize = 4096;
+    bool statEntries = true;
+    bool directories = false;
+#ifndef _WIN32
+    int rootFd = -1;
+#endif
+    
+    // Directory stack shared by the walker threads
+    std::mutex stackMutex;
+    std::condition_variable stackChanged;
+    std::vector<std::pair<std::string, uint32_t>> stack; // relative path, depth
+    size_t active = 0;
+    std::atomic<size_t> threads{0};
+    std::atomic<bool> stopped{false};
+    std::atomic<uint64_t> scanned{0};
+    std::atomic<uint64_t> errors{0};
+    
+    // Batches waiting for the JS thread
+    std::mutex readyMutex;
+    std::condition_variable readyDrained;
+    std::vector<WalkBatch> ready;
+    bool posted = false;
+    double entries = 0; // JS thread only
+    Napi::Error failure; // first exception thrown by onBatch; rejects the walk
+    
+    Napi::ThreadSafeFunction tsfn;
+    Napi::FunctionReference onBatch;
+    Napi::Promise::Deferred deferred;
+};
+
+/**
+ * Matches a glob: * and ? stay within a path segment, ** crosses
+ * segments, [abc], [a-z] and [!abc] match one character, \\ escapes
+ * @param pattern - Glob pattern
+ * @param text - Name or relative path
+ * @returns Whether the whole text matches
+ */
+static bool GlobMatch(const char* pattern, const char* text) {
+    while (*pattern) {
+        if (*pattern == '*') {
+            bool crossSegments = pattern[1] == '*';
+            pattern += crossSegments ? 2 : 1;
+            if (crossSegments && *pattern == '/' && GlobMatch(pattern + 1, text)) {
+                return true; // "**/" also matches no directories
+            }
+            for (const char* rest = text;; rest++) {
+                if (GlobMatch(pattern, rest)) {
+                    return true;
+                }
+                if (!*rest || (!crossSegments && *rest == '/')) {
+                    return false;
+                }
+            }
+        }
+        if (!*text) {
+            return false;
+        }
+        if (*pattern == '?') {
+            if (*text == '/') {
+                return false;
+            }
+        } else if (*pattern == '[' && std::strchr(pattern + 1, ']')) {
+            const char* cursor = pattern + 1;
+            bool negate = *cursor == '!' || *cursor == '^';
+            if (negate) {
+                cursor++;
+            }
+            bool matched = false;
+            bool first = true;
+            for (; *cursor && (first || *cursor != ']'); cursor++, first = false) {
+                if (cursor[1] == '-' && cursor[2] && cursor[2] != ']') {
+                    matched |= *text >= cursor[0] && *text <= cursor[2];
+                    cursor += 2;
+                } else {
+                    matched |= *text == *cursor;
+                }
+            }
+            if (matched == negate || *text == '/') {
+                return false;
+            }
+            pattern = cursor;
+        } else {
+            if (*pattern == '\\' && pattern[1]) {
+                pattern++;
+            }
+            if (*pattern != *text) {
+                return false;
+            }
+        }
+        pattern++;
+        text++;
+    }
+    return !*text;
+}
+
+/**
+ * Matches an entry against any of the patterns; patterns containing '/'
+ * are matched against the path relative to the root, others against the name
+ */
+static bool MatchesAny(const std::vector<std::string>& patterns, const std::string& relative, const char* name) {
+    for (const std::string& pattern : patterns) {
+        const char* text = pattern.find('/') != std::string::npos ? relative.c_str() : name;
+        if (GlobMatch(pattern.c_str(), text)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Reads a pattern option given as a string or an array of strings
+ */
+static bool ToPatterns(const Napi::Value& value, std::vector<std::string>& patterns) {
+    if (value.IsUndefined()) {
+        return true;
+    }
+    if (value.IsString()) {
+        patterns.push_back(value.As<Napi::String>());
+        return true;
+    }
+    if (!value.IsArray()) {
+        return false;
+    }
+    Napi::Array array = value.As<Napi::Array>();
+    for (uint32_t i = 0; i < array.Length(); i++) {
+        Napi::Value pattern = array.Get(i);
+        if (!pattern.IsString()) {
+            return false;
+        }
+        patterns.push_back(pattern.As<Napi::String>());
+    }
+    return true;
+}
+
+static void DrainWalk(Napi::Env env, DirectoryWalk* walk);
+
+/**
+ * Hands a full batch to the JS thread, waiting while too many are pending
+ * @param walk - Walk state
+ * @param batch - Batch to deliver; left empty
+ */
+static void FlushWalkBatch(DirectoryWalk* walk, WalkBatch& batch) {
+    if (batch.paths.empty()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(walk->readyMutex);
+    walk->readyDrained.wait(lock, [walk]() {
+        return walk->ready.size() < kWalkMaxPendingBatches || walk->stopped.load();
+    });
+    if (walk->stopped.load()) {
+        batch = WalkBatch();
+        return;
+    }
+    walk->ready.push_back(std::move(batch));
+    batch = WalkBatch();
+    if (!walk->posted) {
+        walk->posted = true;
+        walk->tsfn.NonBlockingCall(walk, [](Napi::Env env, Napi::Function, DirectoryWalk* target) {
+            DrainWalk(env, target);
+        });
+    }
+}
+
+/**
+ * Applies the filters to one entry and adds it to the batch
+ */
+static void EmitWalkEntry(DirectoryWalk* walk, WalkBatch& batch, const std::string& relative, const char* name,
+                          uint8_t type, double size, double mtime) {
+    if (type == WalkDirectory && !walk->directories) {
+        return;
+    }
+    if (type != WalkDirectory) {
+        if (!walk->include.empty() && !MatchesAny(walk->include, relative, name)) {
+            return;
+        }
+        if (size < walk->minSize || (walk->maxSize >= 0 && size > walk->maxSize)) {
+            return;
+        }
+    }
+    batch.paths.push_back(relative);
+    batch.types.push_back(type);
+    if (walk->statEntries) {
+        batch.sizes.push_back(size);
+        batch.mtimes.push_back(mtime);
+    }
+    if (batch.paths.size() >= walk->batchSize) {
+        FlushWalkBatch(walk, batch);
+    }
+}
+
+/**
+ * Lists one directory, emitting its entries and queueing its subdirectories
+ * @param walk - Walk state
+ * @param relative - Directory path relative to the root ("" for the root)
+ * @param depth - Depth of the directory's entries
+ * @param buffer - Thread-local dirent buffer
+ * @param batch - Thread-local batch
+ */
+static void ScanWalkDirectory(DirectoryWalk* walk, const std::string& relative, uint32_t depth,
+                          std::vector<char>& buffer, WalkBatch& batch) {
+    std::vector<std::pair<std::string, uint32_t>> subdirectories;
+    bool needStat = walk->statEntries || walk->minSize > 0 || walk->maxSize >= 0;
+    
+    auto visit = [&](const char* name, uint8_t type, double size, double mtime) {
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+            return;
+        }
+        std::string path = relative.empty() ? std::string(name) : relative + "/" + name;
+        if (!walk->exclude.empty() && MatchesAny(walk->exclude, path, name)) {
+            return;
+        }
+        if (type == WalkDirectory && depth < walk->maxDepth) {
+            subdirectories.emplace_back(path, depth + 1);
+        }
+        EmitWalkEntry(walk, batch, path, name, type, size, mtime);
+    };
+    
+#ifdef _WIN32
+    (void)buffer;
+    (void)needStat;
+    std::string pattern = walk->root + (relative.empty() ? "" : "\\" + relative) + "\\*";
+    std::replace(pattern.begin(), pattern.end(), '/', '\\');
+    WIN32_FIND_DATAA data;
+    HANDLE find = FindFirstFileExA(pattern.c_str(), FindExInfoBasic, &data, FindExSearchNameMatch, NULL,
+                                   FIND_FIRST_EX_LARGE_FETCH);
+    if (find == INVALID_HANDLE_VALUE) {
+        walk->errors.fetch_add(1);
+        return;
+    }
+    do {
+        uint8_t type = WalkFile;
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) {
+            type = WalkSymlink; // never followed, so junction loops are harmless
+        } else if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            type = WalkDirectory;
+        }
+        ULARGE_INTEGER written;
+        written.LowPart = data.ftLastWriteTime.dwLowDateTime;
+        written.HighPart = data.ftLastWriteTime.dwHighDateTime;
+        double size = static_cast<double>((static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow);
+        double mtime = static_cast<double>(written.QuadPart / 10000) - 11644473600000.0;
+        visit(data.cFileName, type, size, mtime);
+    } while (!walk->stopped.load() && FindNextFileA(find, &data));
+    FindClose(find);
+#else
+    int dirFd = openat(walk->rootFd, relative.empty() ? "." : relative.c_str(),
+                       O_RDONLY | O_DIRECTORY | O_CLOEXEC | O_NOFOLLOW);
+    if (dirFd < 0) {
+        walk->errors.fetch_add(1);
+        return;
+    }
+    
+    auto visitEntry = [&](const char* name, unsigned char dtype) {
+        uint8_t type = dtype == DT_REG ? WalkFile : dtype == DT_DIR ? WalkDirectory
+                     : dtype == DT_LNK ? WalkSymlink : WalkOther;
+        double size = 0;
+        double mtime = 0;
+        bool isDot = name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+        if (!isDot && (needStat || dtype == DT_UNKNOWN)) {
+#if defined(__linux__) && defined(STATX_SIZE)
+            struct statx stx;
+            if (statx(dirFd, name, AT_SYMLINK_NOFOLLOW | AT_STATX_DONT_SYNC,
+                      STATX_TYPE | STATX_SIZE | STATX_MTIME, &stx) == 0) {
+                mode_t mode = stx.stx_mode;
+                size = static_cast<double>(stx.stx_size);
+                mtime = static_cast<double>(stx.stx_mtime.tv_sec) * 1000.0 + stx.stx_mtime.tv_nsec / 1e6;
+#else
+            struct stat st;
+            if (fstatat(dirFd, name, &st, AT_SYMLINK_NOFOLLOW) == 0) {
+                mode_t mode = st.st_mode;
+                size = static_cast<double>(st.st_size);
+#ifdef __APPLE__
+                mtime = static_cast<double>(st.st_mtimespec.tv_sec) * 1000.0 + st.st_mtimespec.tv_nsec / 1e6;
+#else
+                mtime = static_cast<double>(st.st_mtim.tv_sec) * 1000.0 + st.st_mtim.tv_nsec / 1e6;
+#endif
+#endif
+                type = S_ISREG(mode) ? WalkFile : S_ISDIR(mode) ? WalkDirectory
+                     : S_ISLNK(mode) ? WalkSymlink : WalkOther;
+            } else if (errno == ENOENT) {
+                return; // removed while listing
+            } else {
+                walk->errors.fetch_add(1);
+            }
+        }
+        visit(name, type, size, mtime);
+    };
+    
+#ifdef __linux__
+    struct LinuxDirent64 {
+        uint64_t d_ino;
+        int64_t d_off;
+        unsigned short d_reclen;
+        unsigned char d_type;
+        char d_name[1];
+    };
+    for (;;) {
+        long length = syscall(SYS_getdents64, dirFd, buffer.data(), buffer.size());
+        if (length <= 0) {
+            if (length < 0) {
+                walk->errors.fetch_add(1);
+            }
+            break;
+        }
+        for (long offset = 0; offset < length && !walk->stopped.load();) {
+            auto* entry = reinterpret_cast<LinuxDirent64*>(buffer.data() + offset);
+            visitEntry(entry->d_name, entry->d_type);
+            offset += entry->d_reclen;
+        }
+        if (walk->stopped.load()) {
+            break;
+        }
+    }
+    close(dirFd);
+#else
+    (void)buffer;
+    DIR* dir = fdopendir(dirFd);
+    if (!dir) {
+        close(dirFd);
+        walk->errors.fetch_add(1);
+        return;
+    }
+    struct dirent* entry;
+    while (!walk->stopped.load() && (entry = readdir(dir)) != nullptr) {
+        visitEntry(entry->d_name, entry->d_type);
+    }
+    closedir(dir);
+#endif
+#endif
+    
+    walk->scanned.fetch_add(1);
+    if (!subdirectories.empty()) {
+        std::lock_guard<std::mutex> lock(walk->stackMutex);
+        for (auto& subdirectory : subdirectories) {
+            walk->stack.push_back(std::move(subdirectory));
+        }
+        walk->stackChanged.notify_all();
+    }
+}
+
+/**
+ * Resolves the walk promise with totals; executes on the JS thread
+ */
+static void SettleWalk(Napi::Env env, DirectoryWalk* walk) {
+    DrainWalk(env, walk);
+    if (!walk->failure.IsEmpty()) {
+        walk->deferred.Reject(walk->failure.Value());
+        delete walk;
+        return;
+    }
+    Napi::Object summary = Napi::Object::New(env);
+    summary.Set("entries", Napi::Number::New(env, walk->entries));
+    summary.Set("directories", Napi::Number::New(env, static_cast<double>(walk->scanned.load())));
+    summary.Set("errors", Napi::Number::New(env, static_cast<double>(walk->errors.load())));
+    summary.Set("stopped", Napi::Boolean::New(env, walk->stopped.load()));
+    walk->deferred.Resolve(summary);
+    delete walk;
+}
+
+/**
+ * Walker thread: takes directories off the shared stack until none are left
+ * and no other thread can add more
+ */
+static void RunWalker(DirectoryWalk* walk) {
+    std::vector<char> buffer(kWalkDirentBuffer);
+    WalkBatch batch;
+    for (;;) {
+        std::pair<std::string, uint32_t> next;
+        {
+            std::unique_lock<std::mutex> lock(walk->stackMutex);
+            walk->stackChanged.wait(lock, [walk]() {
+                return !walk->stack.empty() || walk->active == 0 || walk->stopped.load();
+            });
+            if (walk->stack.empty() || walk->stopped.load()) {
+                walk->stackChanged.notify_all();
+                break;
+            }
+            next = std::move(walk->stack.back());
+            walk->stack.pop_back();
+            walk->active++;
+        }
+        ScanWalkDirectory(walk, next.first, next.second, buffer, batch);
+        {
+            std::lock_guard<std::mutex> lock(walk->stackMutex);
+            walk->active--;
+            if (walk->active == 0 && walk->stack.empty()) {
+                walk->stackChanged.notify_all();
+            }
+        }
+    }
+    FlushWalkBatch(walk, batch);
+    
+    if (walk->threads.fetch_sub(1) == 1) {
+        // The JS side deletes the walk as soon as the call lands
+        Napi::ThreadSafeFunction tsfn = walk->tsfn;
+        tsfn.BlockingCall(walk, [](Napi::Env env, Napi::Function, DirectoryWalk* target) {
+            SettleWalk(env, target);
+        });
+        tsfn.Release();
+    }
+}
+
+/**
+ * Delivers pending batches to onBatch; executes on the JS thread
+ */
+static void DrainWalk(Napi::Env env, DirectoryWalk* walk) {
+    std::vector<WalkBatch> batches;
+    {
+        std::lock_guard<std::mutex> lock(walk->readyMutex);
+        batches.swap(walk->ready);
+        walk->posted = false;
+    }
+    walk->readyDrained.notify_all();
+    
+    for (WalkBatch& batch : batches) {
+        if (walk->stopped.load()) {
+            break;
+        }
+        size_t count = batch.paths.size();
+        Napi::Object result = Napi::Object::New(env);
+        Napi::Array paths = Napi::Array::New(env, count);
+        for (size_t i = 0; i < count; i++) {
+            paths.Set(static_cast<uint32_t>(i), Napi::String::New(env, batch.paths[i]));
+        }
+        Napi::Uint8Array types = Napi::Uint8Array::New(env, count);
+        std::memcpy(types.Data(), batch.types.data(), count);
+        result.Set("count", Napi::Number::New(env, static_cast<double>(count)));
+        result.Set("paths", paths);
+        result.Set("types", types);
+        if (walk->statEntries) {
+            Napi::Float64Array sizes = Napi::Float64Array::New(env, count);
+            Napi::Float64Array mtimes = Napi::Float64Array::New(env, count);
+            std::memcpy(sizes.Data(), batch.sizes.data(), count * sizeof(double));
+            std::memcpy(mtimes.Data(), batch.mtimes.data(), count * sizeof(double));
+            result.Set("sizes", sizes);
+            result.Set("mtimes", mtimes);
+        }
+        walk->entries += static_cast<double>(count);
+        
+        Napi::Value keepGoing = walk->onBatch.Call({result});
+        bool threw = env.IsExceptionPending();
+        if (threw) {
+            // Keep the exception for the walk promise; leaving it pending would break every later N-API call
+            walk->failure = env.GetAndClearPendingException();
+        }
+        if (threw || (keepGoing.IsBoolean() && !keepGoing.As<Napi::Boolean>().Value())) {
+            // A throwing or false-returning callback stops the walk
+            walk->stopped.store(true);
+            {
+                std::lock_guard<std::mutex> lock(walk->readyMutex);
+                walk->ready.clear();
+            }
+            walk->readyDrained.notify_all();
+            std::lock_guard<std::mutex> lock(walk->stackMutex);
+            walk->stackChanged.notify_all();
+        }
+    }
+}
+
+/**
+ * Walks a directory tree on background threads, streaming entries in batches
+ * @param info - CallbackInfo containing root path, options { include, exclude,
+ *               minSize, maxSize, maxDepth, stat, directories, batchSize,
+ *               concurrency } and onBatch callback; onBatch receives
+ *               { count, paths, types, sizes?, mtimes? } and may return false to stop
+ * @returns Promise resolving to { entries, directories, errors, stopped }, or
+ *          rejecting with the exception if onBatch throws
+ */
+Napi::Value WalkDirectoryTree(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 3 || !info[0].IsString() || !info[2].IsFunction()) {
+        Napi::TypeError::New(env, "Root path and batch callback required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    auto walk = std::make_unique<DirectoryWalk>(env);
+    walk->root = info[0].As<Napi::String>();
+    Napi::Object options = info[1].IsObject() ? info[1].As<Napi::Object>() : Napi::Object::New(env);
+    
+    if (!ToPatterns(options.Get("include"), walk->include) || !ToPatterns(options.Get("exclude"), walk->exclude)) {
+        Napi::TypeError::New(env, "include and exclude must be glob strings or arrays of them").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (options.Get("minSize").IsNumber()) {
+        walk->minSize = options.Get("minSize").As<Napi::Number>().DoubleValue();
+    }
+    if (options.Get("maxSize").IsNumber()) {
+        walk->maxSize = options.Get("maxSize").As<Napi::Number>().DoubleValue();
+    }
+    if (options.Get("maxDepth").IsNumber()) {
+        double depth = options.Get("maxDepth").As<Napi::Number>().DoubleValue();
+        walk->maxDepth = depth < 1 ? 1 : depth >= UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(depth);
+    }
+    if (options.Get("stat").IsBoolean()) {
+        walk->statEntries = options.Get("stat").As<Napi::Boolean>().Value();
+    }
+    if (options.Get("directories").IsBoolean()) {
+        walk->directories = options.Get("directories").As<Napi::Boolean>().Value();
+    }
+    if (options.Get("batchSize").IsNumber()) {
+        walk->batchSize = std::max<int64_t>(1, options.Get("batchSize").As<Napi::Number>().Int64Value());
+    }
+    size_t concurrency = std::max(1u, std::min(std::thread::hardware_concurrency(), 4u));
+    if (options.Get("concurrency").IsNumber()) {
+        concurrency = static_cast<size_t>(std::max<int64_t>(1, std::min<int64_t>(64, options.Get("concurrency").As<Napi::Number>().Int64Value())));
+    }
+    
+#ifdef _WIN32
+    DWORD attributes = GetFileAttributesA(walk->root.c_str());
+    if (attributes == INVALID_FILE_ATTRIBUTES || !(attributes & FILE_ATTRIBUTE_DIRECTORY)) {
+        Napi::Error::New(env, "Cannot open directory '" + walk->root + "'").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+#else
+    walk->rootFd = open(walk->root.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (walk->rootFd < 0) {
+        Napi::Error::New(env, "Cannot open directory '" + walk->root + "': " + std::strerror(errno)).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+#endif
+    
+    walk->onBatch = Napi::Persistent(info[2].As<Napi::Function>());
+    walk->stack.emplace_back(std::string(), 1);
+    walk->threads = concurrency;
+    walk->tsfn = Napi::ThreadSafeFunction::New(env, Napi::Function(), "lljsWalkDirectory", 0, 1);
+    Napi::Promise promise = walk->deferred.Promise();
+    
+    // Dedicated threads: a long walk would otherwise hold pool workers for its whole duration
+    DirectoryWalk* shared = walk.release();
+    for (size_t i = 0; i < concurrency; i++) {
+        std::thread(RunWalker, shared).detach();
+    }
+    return promise;
+}
+
+// Batched I/O rings. read/write/fsync operations against registered files
+// and Buffers are queued on the JS thread and handed to the kernel together
+// by submit(). Completions are collected on a reaper thread and delivered to
+// JS in batches through one ThreadSafeFunction call. No backend orders the
+// operations of a batch, so an fsync only covers writes already completed.
+//
+// Backends:
+//   io_uring (Linux 5.6+): one io_uring_enter per submit; registered files and
+//     Buffers become fixed files and fixed buffers when the kernel accepts them.
+//     Operations fall back to plain fds and addresses when registration failed
+//     (e.g. RLIMIT_MEMLOCK) or changed while operations were in flight.
+//   IOCP (Windows): files are reopened overlapped and bound to one completion
+//     port; each operation is still one ReadFile/WriteFile call, but completions
+//     are dequeued in bulk with GetQueuedCompletionStatusEx.
+//   Worker pool (everywhere else, or when io_uring is unavailable): each
+//     operation runs as a pread/pwrite/fsync task on the shared pool.
+
+using Threading::WorkerPool;
+
+enum class IoRingOpcode : uint8_t { Read = 0, Write = 1, Fsync = 2 };
+
+struct IoRingOp {
+    IoRingOpcode opcode;
+    uint32_t file;
+    uint32_t buffer;
+    uint64_t position;
+    uint8_t* data;
+    uint32_t length;
+    double userData;
+};
+
+struct IoRingCompletion {
+    double userData;
+    double result; // bytes transferred, or a negative errno (Windows error code)
+};
+
+struct IoRing;
+
+// JS-side state, shared by the ring and the ThreadSafeFunction finalizer so
+// that either may go first (the environment can be torn down with rings open)
+struct IoRingDispatcher {
+    Napi::ThreadSafeFunction tsfn;
+    std::mutex mutex;
+    std::vector<IoRingCompletion> ready;
+    bool posted = false;
+    bool closed = false; // finalized; nothing may be posted any more
+    
+    // JS thread only
+    Napi::FunctionReference onCompletion;
+    std::vector<Napi::ObjectReference> bufferRefs;
+    uint64_t inflight = 0;
+    IoRing* ring = nullptr;
+};
+
+static void DrainIoRing(Napi::Env env, IoRingDispatcher* dispatcher);
+
+/**
+ * Queues completions and posts a drain unless one is already pending
+ */
+static void PostIoCompletions(IoRingDispatcher* dispatcher, const IoRingCompletion* completions, size_t count) {
+    std::lock_guard<std::mutex> lock(dispatcher->mutex);
+    if (dispatcher->closed) {
+        return;
+    }
+    dispatcher->ready.insert(dispatcher->ready.end(), completions, completions + count);
+    if (dispatcher->posted) {
+        return;
+    }
+    dispatcher->posted = true;
+    dispatcher->tsfn.NonBlockingCall(dispatcher, [](Napi::Env env, Napi::Function, IoRingDispatcher* target) {
+        DrainIoRing(env, target);
+    });
+}
+
+#ifdef LLJS_HAVE_IO_URING
+// Marks the no-op that wakes the reaper for shutdown; JS user data is
+// canonicalised, so no completion can carry this NaN pattern
+static constexpr uint64_t kIoRingShutdownTag = ~0ULL;
+#endif
+
+#ifdef _WIN32
+static const ULONG_PTR kIoRingShutdownKey = 1;
+
+struct IocpOp {
+    OVERLAPPED overlapped; // first, so the OVERLAPPED* from the port is the op
+    HANDLE file;
+    double userData;
+    bool flushed = false;  // fsync run on the pool; result holds its outcome
+    double result = 0;
+};
+#endif
+
+struct IoRing {
+    ~IoRing();
+    
+    std::string backend;
+    std::shared_ptr<IoRingDispatcher> dispatcher;
+    std::vector<IoRingOp> queued;
+    std::vector<NativeFile> files;
+    std::vector<bool> ownedFiles;
+    std::vector<std::pair<uint8_t*, size_t>> buffers; // pinned by dispatcher->bufferRefs
+    
+    // Submitted operations not yet completed, including ones whose
+    // completions were dropped because the ring is closing
+    std::mutex idleMutex;
+    std::condition_variable idle;
+    uint64_t outstanding = 0;
+    int reaperError = 0; // errno that stopped the reaper; outstanding never drains after it
+    std::thread reaper;
+    
+#ifdef LLJS_HAVE_IO_URING
+    int ringFd = -1;
+    uint32_t sqEntries = 0;
+    uint32_t cqEntries = 0;
+    void* sqRing = nullptr;
+    void* cqRing = nullptr;
+    size_t sqRingSize = 0;
+    size_t cqRingSize = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqesSize = 0;
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned* sqMask = nullptr;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned* cqMask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    size_t fixedFiles = 0;   // files[0..fixedFiles) are registered
+    size_t fixedBuffers = 0; // buffers[0..fixedBuffers) are registered
+    bool filesRegistrable = true;
+    bool buffersRegistrable = true;
+#endif
+#ifdef _WIN32
+    HANDLE port = NULL;
+#endif
+};
+
+static HandleTable<IoRing> ioRings;
+
+/**
+ * Records finished operations and wakes a close waiting for them
+ */
+static void FinishIoOps(IoRing* ring, uint64_t count) {
+    std::lock_guard<std::mutex> lock(ring->idleMutex);
+    ring->outstanding -= count;
+    if (ring->outstanding == 0) {
+        ring->idle.notify_all();
+    }
+}
+
+#ifdef LLJS_HAVE_IO_URING
+static inline unsigned LoadAcquire(const unsigned* value) {
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+static inline void StoreRelease(unsigned* value, unsigned next) {
+    __atomic_store_n(value, next, __ATOMIC_RELEASE);
+}
+
+static int IoUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+static int IoUringRegister(int fd, unsigned opcode, const void* arg, unsigned count) {
+    return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, count));
+}
+
+/**
+ * Creates the kernel ring and maps its queues
+ * @param ring - Ring to set up
+ * @param entries - Submission queue size (rounded up to a power of two by the kernel)
+ * @returns False when io_uring is unavailable (old kernel, seccomp, disabled by sysctl)
+ */
+static bool SetupIoUring(IoRing* ring, uint32_t entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+        return false;
+    }
+    if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+        close(fd); // pre-5.6 kernel without IORING_OP_READ/WRITE
+        return false;
+    }
+    
+    ring->ringFd = fd;
+    ring->sqEntries = params.sq_entries;
+    ring->cqEntries = params.cq_entries;
+    ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMap) {
+        ring->sqRingSize = ring->cqRingSize = std::max(ring->sqRingSize, ring->cqRingSize);
+    }
+    
+    ring->sqRing = mmap(nullptr, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (ring->sqRing == MAP_FAILED) {
+        ring->sqRing = nullptr;
+        return false;
+    }
+    if (singleMap) {
+        ring->cqRing = ring->sqRing;
+    } else {
+        ring->cqRing = mmap(nullptr, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (ring->cqRing == MAP_FAILED) {
+            ring->cqRing = nullptr;
+            return false;
+        }
+    }
+    ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        return false;
+    }
+    ring->sqes = static_cast<io_uring_sqe*>(sqes);
+    
+    char* sq = static_cast<char*>(ring->sqRing);
+    ring->sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    ring->sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    ring->sqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    ring->sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    char* cq = static_cast<char*>(ring->cqRing);
+    ring->cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    ring->cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    ring->cqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return true;
+}
+
+/**
+ * Unmaps the queues and closes the kernel ring
+ */
+static void TeardownIoUring(IoRing* ring) {
+    if (ring->sqes) {
+        munmap(ring->sqes, ring->sqesSize);
+    }
+    if (ring->cqRing && ring->cqRing != ring->sqRing) {
+        munmap(ring->cqRing, ring->cqRingSize);
+    }
+    if (ring->sqRing) {
+        munmap(ring->sqRing, ring->sqRingSize);
+    }
+    if (ring->ringFd >= 0) {
+        close(ring->ringFd);
+    }
+    ring->ringFd = -1;
+    ring->sqes = nullptr;
+    ring->sqRing = ring->cqRing = nullptr;
+}
+
+/**
+ * Re-registers files and buffers added since the last registration; only
+ * called with nothing in flight, since registration quiesces the ring
+ */
+static void RegisterIoUringResources(IoRing* ring) {
+    if (ring->filesRegistrable && ring->fixedFiles < ring->files.size()) {
+        if (ring->fixedFiles > 0) {
+            IoUringRegister(ring->ringFd, IORING_UNREGISTER_FILES, nullptr, 0);
+        }
+        std::vector<int> fds(ring->files.begin(), ring->files.end());
+        if (IoUringRegister(ring->ringFd, IORING_REGISTER_FILES, fds.data(), static_cast<unsigned>(fds.size())) == 0) {
+            ring->fixedFiles = fds.size();
+        } else {
+            ring->fixedFiles = 0;
+            ring->filesRegistrable = false;
+        }
+    }
+    if (ring->buffersRegistrable && ring->fixedBuffers < ring->buffers.size()) {
+        if (ring->fixedBuffers > 0) {
+            IoUringRegister(ring->ringFd, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+        }
+        std::vector<iovec> vectors;
+        for (const auto& buffer : ring->buffers) {
+            vectors.push_back({ buffer.first, buffer.second });
+        }
+        if (IoUringRegister(ring->ringFd, IORING_REGISTER_BUFFERS, vectors.data(), static_cast<unsigned>(vectors.size())) == 0) {
+            ring->fixedBuffers = vectors.size();
+        } else {
+            // Usually RLIMIT_MEMLOCK; plain reads and writes still work
+            ring->fixedBuffers = 0;
+            ring->buffersRegistrable = false;
+        }
+    }
+}
+
+/**
+ * Fills a submission queue entry for one operation
+ */
+static void PrepareSqe(IoRing* ring, io_uring_sqe* sqe, const IoRingOp& op) {
+    std::memset(sqe, 0, sizeof(*sqe));
+    bool fixedFile = op.file < ring->fixedFiles;
+    sqe->fd = fixedFile ? static_cast<int>(op.file) : ring->files[op.file];
+    sqe->flags = fixedFile ? IOSQE_FIXED_FILE : 0;
+    std::memcpy(&sqe->user_data, &op.userData, sizeof(op.userData));
+    if (op.opcode == IoRingOpcode::Fsync) {
+        sqe->opcode = IORING_OP_FSYNC;
+        return;
+    }
+    bool fixedBuffer = op.buffer < ring->fixedBuffers;
+    if (fixedBuffer) {
+        sqe->opcode = op.opcode == IoRingOpcode::Read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+        sqe->buf_index = static_cast<uint16_t>(op.buffer);
+    } else {
+        sqe->opcode = op.opcode == IoRingOpcode::Read ? IORING_OP_READ : IORING_OP_WRITE;
+    }
+    sqe->addr = reinterpret_cast<uint64_t>(op.data);
+    sqe->len = op.length;
+    sqe->off = op.position;
+}
+
+/**
+ * Reaper: waits for completions and forwards them in batches; exits once
+ * the ring is closing and every operation has completed, or when waiting
+ * fails (recorded in reaperError so close and submit stop waiting on it)
+ */
+static void RunIoUringReaper(IoRing* ring) {
+    std::vector<IoRingCompletion> batch;
+    bool shuttingDown = false;
+    for (;;) {
+        if (IoUringEnter(ring->ringFd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR && errno != EAGAIN) {
+            std::lock_guard<std::mutex> lock(ring->idleMutex);
+            ring->reaperError = errno;
+            ring->idle.notify_all();
+            break;
+        }
+        unsigned head = *ring->cqHead;
+        unsigned tail = LoadAcquire(ring->cqTail);
+        uint64_t finished = 0;
+        for (; head != tail; head++) {
+            const io_uring_cqe& cqe = ring->cqes[head & *ring->cqMask];
+            finished++;
+            if (cqe.user_data == kIoRingShutdownTag) {
+                shuttingDown = true;
+                continue;
+            }
+            IoRingCompletion completion;
+            std::memcpy(&completion.userData, &cqe.user_data, sizeof(completion.userData));
+            completion.result = static_cast<double>(cqe.res);
+            batch.push_back(completion);
+        }
+        StoreRelease(ring->cqHead, head);
+        
+        if (!batch.empty()) {
+            if (!shuttingDown) {
+                PostIoCompletions(ring->dispatcher.get(), batch.data(), batch.size());
+            }
+            batch.clear();
+        }
+        FinishIoOps(ring, finished);
+        if (shuttingDown) {
+            std::lock_guard<std::mutex> lock(ring->idleMutex);
+            if (ring->outstanding == 0) {
+                break;
+            }
+        }
+    }
+}
+#endif
+
+#ifdef _WIN32
+/**
+ * Reaper: dequeues completions in bulk until the shutdown packet arrives
+ * and every operation has completed
+ */
+static void RunIocpReaper(IoRing* ring) {
+    OVERLAPPED_ENTRY entries[128];
+    std::vector<IoRingCompletion> batch;
+    bool shuttingDown = false;
+    for (;;) {
+        ULONG count = 0;
+        if (!GetQueuedCompletionStatusEx(ring->port, entries, 128, &count, INFINITE, FALSE)) {
+            break;
+        }
+        uint64_t finished = 0;
+        for (ULONG i = 0; i < count; i++) {
+            if (entries[i].lpCompletionKey == kIoRingShutdownKey) {
+                shuttingDown = true;
+                continue;
+            }
+            IocpOp* op = reinterpret_cast<IocpOp*>(entries[i].lpOverlapped);
+            DWORD transferred = 0;
+            double result = op->result;
+            if (!op->flushed) {
+                if (GetOverlappedResult(op->file, &op->overlapped, &transferred, FALSE)) {
+                    result = static_cast<double>(transferred);
+                } else {
+                    DWORD error = GetLastError();
+                    result = error == ERROR_HANDLE_EOF ? 0.0 : -static_cast<double>(error);
+                }
+            }
+            batch.push_back({ op->userData, result });
+            delete op;
+            finished++;
+        }
+        if (!batch.empty()) {
+            if (!shuttingDown) {
+                PostIoCompletions(ring->dispatcher.get(), batch.data(), batch.size());
+            }
+            batch.clear();
+        }
+        FinishIoOps(ring, finished);
+        if (shuttingDown) {
+            std::lock_guard<std::mutex> lock(ring->idleMutex);
+            if (ring->outstanding == 0) {
+                break;
+            }
+        }
+    }
+}
+#endif
+
+/**
+ * Runs one operation synchronously on a pool thread
+ * @returns Bytes transferred or a negative error code
+ */
+static double RunIoOpBlocking(NativeFile file, const IoRingOp& op) {
+    if (op.opcode == IoRingOpcode::Fsync) {
+#ifdef _WIN32
+        return FlushFileBuffers(file) ? 0.0 : -static_cast<double>(GetLastError());
+#else
+        return fsync(file) == 0 ? 0.0 : -static_cast<double>(errno);
+#endif
+    }
+    size_t transferred = 0;
+    bool ok = op.opcode == IoRingOpcode::Read
+        ? ReadFully(file, op.data, op.length, op.position, transferred)
+        : WriteFully(file, op.data, op.length, op.position, transferred);
+#ifdef _WIN32
+    return ok ? static_cast<double>(transferred) : -static_cast<double>(GetLastError());
+#else
+    return ok ? static_cast<double>(transferred) : -static_cast<double>(errno);
+#endif
+}
+
+IoRing::~IoRing() {
+    // Wait for submitted operations: they still point into registered Buffers
+    if (reaper.joinable()) {
+#ifdef LLJS_HAVE_IO_URING
+        if (ringFd >= 0) {
+            {
+                std::lock_guard<std::mutex> lock(idleMutex);
+                outstanding++;
+            }
+            unsigned tail = *sqTail;
+            io_uring_sqe* sqe = &sqes[tail & *sqMask];
+            std::memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = IORING_OP_NOP;
+            sqe->user_data = kIoRingShutdownTag;
+            sqArray[tail & *sqMask] = tail & *sqMask;
+            StoreRelease(sqTail, tail + 1);
+            IoUringEnter(ringFd, 1, 0, 0);
+        }
+#endif
+#ifdef _WIN32
+        PostQueuedCompletionStatus(port, 0, kIoRingShutdownKey, NULL);
+#endif
+        reaper.join();
+    }
+    {
+        std::unique_lock<std::mutex> lock(idleMutex);
+        idle.wait(lock, [this]() { return outstanding == 0 || reaperError != 0; });
+    }
+    
+#ifdef LLJS_HAVE_IO_URING
+    TeardownIoUring(this);
+#endif
+#ifdef _WIN32
+    if (port) {
+        CloseHandle(port);
+    }
+#endif
+    for (size_t i = 0; i < files.size(); i++) {
+        if (ownedFiles[i]) {
+#ifdef _WIN32
+            CloseHandle(files[i]);
+#else
+            close(files[i]);
+#endif
+        }
+    }
+    
+    bool closed;
+    {
+        std::lock_guard<std::mutex> lock(dispatcher->mutex);
+        closed = dispatcher->closed;
+    }
+    if (!closed) {
+        dispatcher->ring = nullptr;
+        dispatcher->bufferRefs.clear();
+        if (dispatcher->inflight > 0) {
+            dispatcher->tsfn.Unref(dispatcher->onCompletion.Env());
+        }
+        dispatcher->tsfn.Release();
+    }
+}
+
+#ifdef _WIN32
+/**
+ * Starts the first count queued operations as overlapped I/O on the port
+ */
+static void SubmitIocp(IoRing* ring, size_t count) {
+    IoRingDispatcher* dispatcher = ring->dispatcher.get();
+    std::vector<IoRingCompletion> failed;
+    for (size_t i = 0; i < count; i++) {
+        const IoRingOp& op = ring->queued[i];
+        IocpOp* pending = new IocpOp();
+        pending->file = ring->files[op.file];
+        pending->userData = op.userData;
+        pending->overlapped.Offset = static_cast<DWORD>(op.position);
+        pending->overlapped.OffsetHigh = static_cast<DWORD>(op.position >> 32);
+        if (op.opcode == IoRingOpcode::Fsync) {
+            // No overlapped flush exists; flush on the pool and post the result to the port
+            HANDLE port = ring->port;
+            WorkerPool::Instance().Submit([port, pending]() {
+                pending->result = FlushFileBuffers(pending->file) ? 0.0 : -static_cast<double>(GetLastError());
+                pending->flushed = true;
+                PostQueuedCompletionStatus(port, 0, 0, &pending->overlapped);
+            });
+            continue;
+        }
+        BOOL started = op.opcode == IoRingOpcode::Read
+            ? ::ReadFile(pending->file, op.data, op.length, NULL, &pending->overlapped)
+            : ::WriteFile(pending->file, op.data, op.length, NULL, &pending->overlapped);
+        if (!started && GetLastError() != ERROR_IO_PENDING) {
+            DWORD error = GetLastError();
+            failed.push_back({ op.userData, error == ERROR_HANDLE_EOF ? 0.0 : -static_cast<double>(error) });
+            delete pending;
+        }
+    }
+    if (!failed.empty()) {
+        PostIoCompletions(dispatcher, failed.data(), failed.size());
+        FinishIoOps(ring, failed.size());
+    }
+}
+#endif
+
+// Bound on consecutive io_uring_enter calls that make no progress
+static constexpr int kIoRingSubmitRetries = 1000;
+
+/**
+ * Hands queued operations to the backend
+ * @param env - N-API environment
+ * @param ring - Ring on the JS thread
+ * @param error - Set to the errno when the kernel refuses the batch, else 0
+ * @returns Number of operations submitted; the rest stay queued while the
+ *          completion queue is full or after an error
+ */
+static size_t SubmitIoRing(Napi::Env env, IoRing* ring, int& error) {
+    IoRingDispatcher* dispatcher = ring->dispatcher.get();
+    error = 0;
+    size_t count = ring->queued.size();
+#ifdef LLJS_HAVE_IO_URING
+    if (ring->ringFd >= 0) {
+        {
+            std::lock_guard<std::mutex> lock(ring->idleMutex);
+            if (ring->reaperError != 0) {
+                error = ring->reaperError;
+                return 0;
+            }
+        }
+        if (dispatcher->inflight == 0) {
+            RegisterIoUringResources(ring);
+        }
+        // Never exceed the completion queue, so no completion is ever dropped
+        uint64_t room = ring->cqEntries > dispatcher->inflight ? ring->cqEntries - dispatcher->inflight : 0;
+        unsigned tail = *ring->sqTail;
+        unsigned head = LoadAcquire(ring->sqHead);
+        room = std::min<uint64_t>(room, ring->sqEntries - (tail - head));
+        count = static_cast<size_t>(std::min<uint64_t>(count, room));
+        for (size_t i = 0; i < count; i++) {
+            unsigned index = (tail + static_cast<unsigned>(i)) & *ring->sqMask;
+            PrepareSqe(ring, &ring->sqes[index], ring->queued[i]);
+            ring->sqArray[index] = index;
+        }
+    }
+#endif
+    if (count == 0) {
+        return 0;
+    }
+    {
+        std::lock_guard<std::mutex> lock(ring->idleMutex);
+        ring->outstanding += count;
+    }
+    if (dispatcher->inflight == 0) {
+        dispatcher->tsfn.Ref(env);
+    }
+    dispatcher->inflight += count;
+    
+#ifdef LLJS_HAVE_IO_URING
+    if (ring->ringFd >= 0) {
+        StoreRelease(ring->sqTail, *ring->sqTail + static_cast<unsigned>(count));
+        unsigned remaining = static_cast<unsigned>(count);
+        int attempts = 0;
+        while (remaining > 0) {
+            int submitted = IoUringEnter(ring->ringFd, remaining, 0, 0);
+            if (submitted > 0) {
+                remaining -= static_cast<unsigned>(submitted);
+                attempts = 0;
+                continue;
+            }
+            if (submitted < 0 && errno == EINTR) {
+                continue;
+            }
+            if (submitted < 0 && errno != EAGAIN && errno != EBUSY) {
+                error = errno;
+                break;
+            }
+            if (++attempts > kIoRingSubmitRetries) {
+                error = submitted < 0 ? errno : EAGAIN;
+                break;
+            }
+            if (submitted < 0 && errno == EBUSY) {
+                // The reaper owns the completion queue; let it drain before retrying
+                unsigned cqHead = LoadAcquire(ring->cqHead);
+                while (LoadAcquire(ring->cqHead) == cqHead && LoadAcquire(ring->cqTail) != cqHead) {
+                    std::this_thread::yield();
+                }
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        if (remaining > 0) {
+            // The kernel never consumed these entries; take them back and leave them queued
+            StoreRelease(ring->sqTail, *ring->sqTail - remaining);
+            FinishIoOps(ring, remaining);
+            dispatcher->inflight -= remaining;
+            if (dispatcher->inflight == 0) {
+                dispatcher->tsfn.Unref(env);
+            }
+            count -= remaining;
+        }
+        ring->queued.erase(ring->queued.begin(), ring->queued.begin() + count);
+        return count;
+    }
+#endif
+    
+#ifdef _WIN32
+    if (ring->port) {
+        SubmitIocp(ring, count);
+        ring->queued.erase(ring->queued.begin(), ring->queued.begin() + count);
+        return count;
+    }
+#endif
+    
+    WorkerPool& pool = WorkerPool::Instance();
+    for (size_t i = 0; i < count; i++) {
+        IoRingOp op = ring->queued[i];
+        NativeFile file = ring->files[op.file];
+        pool.Submit([ring, file, op]() {
+            IoRingCompletion completion = { op.userData, RunIoOpBlocking(file, op) };
+            PostIoCompletions(ring->dispatcher.get(), &completion, 1);
+            FinishIoOps(ring, 1);
+        });
+    }
+    ring->queued.erase(ring->queued.begin(), ring->queued.begin() + count);
+    return count;
+}
+
+/**
+ * Delivers completions to JS and submits anything left queued; executes on the JS thread
+ */
+static void DrainIoRing(Napi::Env env, IoRingDispatcher* dispatcher) {
+    std::vector<IoRingCompletion> ready;
+    {
+        std::lock_guard<std::mutex> lock(dispatcher->mutex);
+        ready.swap(dispatcher->ready);
+        dispatcher->posted = false;
+    }
+    if (ready.empty() || !dispatcher->ring) {
+        return;
+    }
+    
+    dispatcher->inflight -= std::min<uint64_t>(dispatcher->inflight, ready.size());
+    IoRing* ring = dispatcher->ring;
+    if (!ring->queued.empty()) {
+        int error = 0;
+        SubmitIoRing(env, ring, error);
+        if (error != 0) {
+            // No submit() caller to throw to; fail what is left through the callback
+            for (const IoRingOp& op : ring->queued) {
+                ready.push_back({ op.userData, -static_cast<double>(error) });
+            }
+            ring->queued.clear();
+        }
+    }
+    if (dispatcher->inflight == 0) {
+        dispatcher->tsfn.Unref(env);
+    }
+    
+    size_t count = ready.size();
+    Napi::Float64Array userData = Napi::Float64Array::New(env, count);
+    Napi::Float64Array results = Napi::Float64Array::New(env, count);
+    for (size_t i = 0; i < count; i++) {
+        userData[i] = ready[i].userData;
+        results[i] = ready[i].result;
+    }
+    Napi::Object batch = Napi::Object::New(env);
+    batch.Set("count", Napi::Number::New(env, static_cast<double>(count)));
+    batch.Set("userData", userData);
+    batch.Set("results", results);
+    if (!dispatcher->onCompletion.IsEmpty()) {
+        dispatcher->onCompletion.Call({batch});
+    }
+}
+
+/**
+ * Resolves an I/O ring handle; throws on failure
+ * @returns Ring, or null
+ */
+static std::shared_ptr<IoRing> ToIoRing(Napi::Env env, const Napi::Value& value) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "I/O ring handle object required").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    Napi::Value id = value.As<Napi::Object>().Get("id");
+    std::shared_ptr<IoRing> ring = id.IsNumber()
+        ? ioRings.Get(static_cast<uint64_t>(id.As<Napi::Number>().DoubleValue()))
+        : nullptr;
+    if (!ring) {
+        Napi::Error::New(env, "Invalid I/O ring handle").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    return ring;
+}
+
+/**
+ * Creates an I/O ring
+ * @param info - CallbackInfo containing options { entries, backend } and the
+ *               completion callback; entries sizes the submission queue
+ *               (default 256), backend "threadpool" skips io_uring/IOCP
+ * @returns Ring handle object { id, handle, backend }
+ */
+Napi::Value CreateIoRing(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[1].IsFunction()) {
+        Napi::TypeError::New(env, "Completion callback required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    Napi::Object options = info[0].IsObject() ? info[0].As<Napi::Object>() : Napi::Object::New(env);
+    uint32_t entries = 256;
+    if (options.Get("entries").IsNumber()) {
+        double requested = options.Get("entries").As<Napi::Number>().DoubleValue();
+        if (!(requested >= 1 && requested <= 32768)) {
+            Napi::RangeError::New(env, "entries must be between 1 and 32768").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        entries = static_cast<uint32_t>(requested);
+    }
+    bool forcePool = options.Get("backend").IsString() &&
+                     options.Get("backend").As<Napi::String>().Utf8Value() == "threadpool";
+    
+    auto ring = std::make_shared<IoRing>();
+    ring->backend = "threadpool";
+#ifdef LLJS_HAVE_IO_URING
+    if (!forcePool) {
+        if (SetupIoUring(ring.get(), entries)) {
+            ring->backend = "io_uring";
+        } else {
+            TeardownIoUring(ring.get());
+        }
+    }
+#endif
+#ifdef _WIN32
+    if (!forcePool) {
+        ring->port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 1);
+        if (ring->port) {
+            ring->backend = "iocp";
+        }
+    }
+#endif
+    (void)forcePool;
+    
+    auto dispatcher = std::make_shared<IoRingDispatcher>();
+    dispatcher->onCompletion = Napi::Persistent(info[1].As<Napi::Function>());
+    dispatcher->ring = ring.get();
+    dispatcher->tsfn = Napi::ThreadSafeFunction::New(env, Napi::Function(), "lljsIoRing", 0, 1,
+        [dispatcher](Napi::Env) {
+            {
+                std::lock_guard<std::mutex> lock(dispatcher->mutex);
+                dispatcher->closed = true;
+                dispatcher->ready.clear();
+            }
+            dispatcher->onCompletion.Reset();
+            dispatcher->bufferRefs.clear();
+        });
+    // Only operations in flight keep the event loop alive
+    dispatcher->tsfn.Unref(env);
+    ring->dispatcher = dispatcher;
+    
+#ifdef LLJS_HAVE_IO_URING
+    if (ring->ringFd >= 0) {
+        ring->reaper = std::thread(RunIoUringReaper, ring.get());
+    }
+#endif
+#ifdef _WIN32
+    if (ring->port) {
+        ring->reaper = std::thread(RunIocpReaper, ring.get());
+    }
+#endif
+    
+    uint64_t ringId = ioRings.Insert(ring);
+    if (ringId == 0) {
+        Napi::Error::New(env, "Too many I/O ring handles").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object handle = Napi::Object::New(env);
+    handle.Set("id", Napi::Number::New(env, static_cast<double>(ringId)));
+    handle.Set("backend", Napi::String::New(env, ring->backend));
+    // Dropping the handle closes the ring once its operations complete
+    handle.Set("handle", Napi::External<void>::New(env, nullptr, [ringId](Napi::Env, void*) {
+        ioRings.Remove(ringId);
+    }));
+    return handle;
+}
+
+/**
+ * Registers a file with a ring
+ * @param info - CallbackInfo containing ring handle and either an OpenFile
+ *               handle (borrowed) or a path, mode ('r', 'w', 'rw', 'a') and
+ *               direct flag (O_DIRECT / F_NOCACHE / FILE_FLAG_NO_BUFFERING)
+ *               for a file the ring opens and closes itself
+ * @returns File index for read/write/fsync
+ */
+Napi::Value IoRingRegisterFile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::shared_ptr<IoRing> ring = ToIoRing(env, info[0]);
+    if (!ring) {
+        return env.Null();
+    }
+    if (info.Length() < 2 || !(info[1].IsString() || info[1].IsObject())) {
+        Napi::TypeError::New(env, "File handle or path required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    std::string mode = info.Length() > 2 && info[2].IsString() ? info[2].As<Napi::String>().Utf8Value() : std::string("r");
+    bool direct = info.Length() > 3 && info[3].IsBoolean() && info[3].As<Napi::Boolean>().Value();
+    bool reading = mode.find('r') != std::string::npos;
+    bool writing = mode.find('w') != std::string::npos || mode.find('a') != std::string::npos;
+    
+    NativeFile file = kInvalidFile;
+    bool owned = true;
+    if (info[1].IsString()) {
+        std::string path = info[1].As<Napi::String>();
+#ifdef _WIN32
+        DWORD access = (reading ? GENERIC_READ : 0) | (writing ? GENERIC_WRITE : 0);
+        DWORD creation = mode.find('w') != std::string::npos && !reading ? CREATE_ALWAYS
+                       : writing ? OPEN_ALWAYS : OPEN_EXISTING;
+        DWORD flags = FILE_ATTRIBUTE_NORMAL | (ring->port ? FILE_FLAG_OVERLAPPED : 0) | (direct ? FILE_FLAG_NO_BUFFERING : 0);
+        file = CreateFileA(path.c_str(), access, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, creation, flags, NULL);
+#else
+        int flags = reading && writing ? O_RDWR : writing ? O_WRONLY : O_RDONLY;
+        if (mode.find('w') != std::string::npos && !reading) {
+            flags |= O_CREAT | O_TRUNC;
+        } else if (writing) {
+            flags |= O_CREAT;
+        }
+#ifdef O_DIRECT
+        if (direct) {
+            flags |= O_DIRECT;
+        }
+#endif
+        file = open(path.c_str(), flags | O_CLOEXEC, 0644);
+#ifdef F_NOCACHE
+        if (direct && file != kInvalidFile) {
+            fcntl(file, F_NOCACHE, 1);
+        }
+#endif
+#endif
+        if (file == kInvalidFile) {
+            Napi::Error::New(env, "Failed to open file '" + path + "'").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else {
+        NativeFile borrowed = HandleToNativeFile(info[1].As<Napi::Object>());
+        if (borrowed == kInvalidFile) {
+            Napi::TypeError::New(env, "Invalid file handle").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+#ifdef _WIN32
+        // The port needs an overlapped handle; reopen the same file as one
+        if (ring->port) {
+            DWORD access = (reading ? GENERIC_READ : 0) | (writing ? GENERIC_WRITE : 0);
+            file = ReOpenFile(borrowed, access ? access : GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                              FILE_FLAG_OVERLAPPED | (direct ? FILE_FLAG_NO_BUFFERING : 0));
+            if (file == kInvalidFile) {
+                Napi::Error::New(env, "Failed to reopen file for overlapped I/O").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+        } else {
+            file = borrowed;
+            owned = false;
+        }
+#else
+        file = borrowed;
+        owned = false;
+#endif
+    }
+    
+#ifdef _WIN32
+    if (ring->port && CreateIoCompletionPort(file, ring->port, 0, 0) == NULL) {
+        if (owned) {
+            CloseHandle(file);
+        }
+        Napi::Error::New(env, "Failed to bind file to the completion port").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+#endif
+    
+    ring->files.push_back(file);
+    ring->ownedFiles.push_back(owned);
+    return Napi::Number::New(env, static_cast<double>(ring->files.size() - 1));
+}
+
+/**
+ * Registers a Buffer with a ring; the ring keeps it alive until closed
+ * @param info - CallbackInfo containing ring handle and Buffer
+ * @returns Buffer index for read/write
+ */
+Napi::Value IoRingRegisterBuffer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::shared_ptr<IoRing> ring = ToIoRing(env, info[0]);
+    if (!ring) {
+        return env.Null();
+    }
+    if (info.Length() < 2 || !info[1].IsBuffer()) {
+        Napi::TypeError::New(env, "Buffer required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (ring->buffers.size() >= UINT16_MAX) {
+        Napi::RangeError::New(env, "Too many registered buffers").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    Napi::Buffer<uint8_t> buffer = info[1].As<Napi::Buffer<uint8_t>>();
+    ring->buffers.emplace_back(buffer.Data(), buffer.Length());
+    ring->dispatcher->bufferRefs.push_back(Napi::Persistent(buffer.As<Napi::Object>()));
+    return Napi::Number::New(env, static_cast<double>(ring->buffers.size() - 1));
+}
+
+/**
+ * Queues an operation; nothing reaches the kernel until submit
+ * @param info - CallbackInfo containing ring handle, opcode (0 read, 1 write,
+ *               2 fsync), file index, user data, and for reads and writes the
+ *               buffer index, file position (Number or BigInt), length and
+ *               offset within the buffer
+ * @returns Number of queued operations
+ */
+Napi::Value IoRingQueue(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::shared_ptr<IoRing> ring = ToIoRing(env, info[0]);
+    if (!ring) {
+        return env.Null();
+    }
+    if (info.Length() < 4 || !info[1].IsNumber() || !info[2].IsNumber() || !info[3].IsNumber()) {
+        Napi::TypeError::New(env, "Opcode, file index and user data required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    IoRingOp op = {};
+    int32_t opcode = info[1].As<Napi::Number>().Int32Value();
+    if (opcode < 0 || opcode > 2) {
+        Napi::RangeError::New(env, "Invalid I/O ring opcode").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    op.opcode = static_cast<IoRingOpcode>(opcode);
+    double file = info[2].As<Napi::Number>().DoubleValue();
+    if (!(file >= 0 && file < static_cast<double>(ring->files.size()))) {
+        Napi::RangeError::New(env, "Unknown file index").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    op.file = static_cast<uint32_t>(file);
+    op.userData = info[3].As<Napi::Number>().DoubleValue();
+    if (std::isnan(op.userData)) {
+        op.userData = std::numeric_limits<double>::quiet_NaN();
+    }
+    
+    if (op.opcode != IoRingOpcode::Fsync) {
+        if (info.Length() < 6 || !info[4].IsNumber() || !HasOffsetArgument(info, 5)) {
+            Napi::TypeError::New(env, "Buffer index and position required").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        double buffer = info[4].As<Napi::Number>().DoubleValue();
+        if (!(buffer >= 0 && buffer < static_cast<double>(ring->buffers.size()))) {
+            Napi::RangeError::New(env, "Unknown buffer index").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        op.buffer = static_cast<uint32_t>(buffer);
+        if (!ToFileOffset(info[5], op.position)) {
+            Napi::RangeError::New(env, "Position must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        size_t capacity = ring->buffers[op.buffer].second;
+        double offset = info.Length() > 7 && info[7].IsNumber() ? info[7].As<Napi::Number>().DoubleValue() : 0;
+        double length = info.Length() > 6 && info[6].IsNumber() ? info[6].As<Napi::Number>().DoubleValue()
+                                                                : static_cast<double>(capacity) - offset;
+        if (!(offset >= 0 && length >= 0 && offset + length <= static_cast<double>(capacity) && length <= 0x7FFFF000)) {
+            Napi::RangeError::New(env, "Offset and length must lie within the buffer (at most 2 GB per operation)").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        op.data = ring->buffers[op.buffer].first + static_cast<size_t>(offset);
+        op.length = static_cast<uint32_t>(length);
+    }
+    
+    ring->queued.push_back(op);
+    return Napi::Number::New(env, static_cast<double>(ring->queued.size()));
+}
+
+/**
+ * Submits every queued operation in one batch
+ * @param info - CallbackInfo containing ring handle
+ * @returns Number of operations submitted; any left over are submitted as
+ *          completions free up room. Throws if the kernel refuses the batch,
+ *          leaving the unsubmitted operations queued
+ */
+Napi::Value IoRingSubmit(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::shared_ptr<IoRing> ring = ToIoRing(env, info[0]);
+    if (!ring) {
+        return env.Null();
+    }
+    int error = 0;
+    size_t submitted = SubmitIoRing(env, ring.get(), error);
+    if (error != 0) {
+        Napi::Error::New(env, std::string("Failed to submit I/O ring operations: ") + std::strerror(error)).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    return Napi::Number::New(env, static_cast<double>(submitted));
+}
+
+/**
+ * Closes a ring after its submitted operations complete; unsubmitted ones are dropped
+ * @param info - CallbackInfo containing ring handle
+ * @returns Success status
+ */
+Napi::Value DestroyIoRing(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!ToIoRing(env, info[0])) {
+        return Napi::Boolean::New(env, false);
+    }
+    uint64_t id = static_cast<uint64_t>(info[0].As<Napi::Object>().Get("id").As<Napi::Number>().DoubleValue());
+    return Napi::Boolean::New(env, ioRings.Remove(id) != nullptr);
+}
+
+}
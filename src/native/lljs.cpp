@@ -1,4 +1,5 @@
 #include "headers/lljs.h"
+#include <mutex>
 
 /**
  * Initialize the LLJS native module
@@ -7,6 +8,16 @@
  * @returns Initialized module exports
  */
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    // Pick SIMD kernels once per process; worker threads share the selection
+    static std::once_flag kernelsInitialized;
+    std::call_once(kernelsInitialized, []() {
+        LLJS::SIMD::ISA isa = LLJS::CPU::DetectISA();
+        LLJS::Memory::InitKernels(isa);
+        LLJS::Math::InitKernels(isa);
+        LLJS::String::InitKernels(isa);
+        LLJS::Time::InitCycleClock();
+    });
+    
     // Memory operations
     exports.Set("allocateBuffer", Napi::Function::New(env, LLJS::Memory::AllocateBuffer));
     exports.Set("freeBuffer", Napi::Function::New(env, LLJS::Memory::FreeBuffer));
@@ -17,6 +28,14 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("alignedAlloc", Napi::Function::New(env, LLJS::Memory::AlignedAlloc));
     exports.Set("getPointerValue", Napi::Function::New(env, LLJS::Memory::GetPointerValue));
     exports.Set("setPointerValue", Napi::Function::New(env, LLJS::Memory::SetPointerValue));
+    exports.Set("createPool", Napi::Function::New(env, LLJS::Memory::CreatePool));
+    exports.Set("poolAlloc", Napi::Function::New(env, LLJS::Memory::PoolAlloc));
+    exports.Set("poolArenaAlloc", Napi::Function::New(env, LLJS::Memory::PoolArenaAlloc));
+    exports.Set("poolRelease", Napi::Function::New(env, LLJS::Memory::PoolRelease));
+    exports.Set("poolReset", Napi::Function::New(env, LLJS::Memory::PoolReset));
+    exports.Set("destroyPool", Napi::Function::New(env, LLJS::Memory::DestroyPool));
+    exports.Set("allocateOnNode", Napi::Function::New(env, LLJS::Memory::AllocateOnNode));
+    exports.Set("getMemoryNode", Napi::Function::New(env, LLJS::Memory::GetMemoryNode));
 
     // CPU operations
     exports.Set("getCPUInfo", Napi::Function::New(env, LLJS::CPU::GetCPUInfo));
@@ -27,8 +46,15 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("setCPUAffinity", Napi::Function::New(env, LLJS::CPU::SetCPUAffinity));
     exports.Set("getRegisters", Napi::Function::New(env, LLJS::CPU::GetRegisters));
     exports.Set("prefetchMemory", Napi::Function::New(env, LLJS::CPU::PrefetchMemory));
+    exports.Set("prefetchRange", Napi::Function::New(env, LLJS::CPU::PrefetchRange));
     exports.Set("getCPUTemperature", Napi::Function::New(env, LLJS::CPU::GetCPUTemperature));
     exports.Set("getCPUFrequency", Napi::Function::New(env, LLJS::CPU::GetCPUFrequency));
+    exports.Set("perfOpen", Napi::Function::New(env, LLJS::CPU::PerfOpen));
+    exports.Set("perfStart", Napi::Function::New(env, LLJS::CPU::PerfStart));
+    exports.Set("perfStop", Napi::Function::New(env, LLJS::CPU::PerfStop));
+    exports.Set("perfRead", Napi::Function::New(env, LLJS::CPU::PerfRead));
+    exports.Set("perfClose", Napi::Function::New(env, LLJS::CPU::PerfClose));
+    exports.Set("getTopology", Napi::Function::New(env, LLJS::CPU::GetTopology));
 
     // System operations
     exports.Set("getSystemInfo", Napi::Function::New(env, LLJS::System::GetSystemInfo));
@@ -38,7 +64,12 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("getProcessId", Napi::Function::New(env, LLJS::System::GetProcessId));
     exports.Set("killProcess", Napi::Function::New(env, LLJS::System::KillProcess));
     exports.Set("createProcess", Napi::Function::New(env, LLJS::System::CreateProcess));
+    exports.Set("spawnProcess", Napi::Function::New(env, LLJS::System::SpawnProcess));
+    exports.Set("killSpawnedProcess", Napi::Function::New(env, LLJS::System::KillSpawnedProcess));
     exports.Set("getProcessList", Napi::Function::New(env, LLJS::System::GetProcessList));
+    exports.Set("createProcessSnapshot", Napi::Function::New(env, LLJS::System::CreateProcessSnapshot));
+    exports.Set("readProcessSnapshot", Napi::Function::New(env, LLJS::System::ReadProcessSnapshot));
+    exports.Set("destroyProcessSnapshot", Napi::Function::New(env, LLJS::System::DestroyProcessSnapshot));
 
     // I/O operations
     exports.Set("readFile", Napi::Function::New(env, LLJS::IO::ReadFile));
@@ -49,6 +80,22 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("flushFile", Napi::Function::New(env, LLJS::IO::FlushFile));
     exports.Set("getFileInfo", Napi::Function::New(env, LLJS::IO::GetFileInfo));
     exports.Set("directoryOperations", Napi::Function::New(env, LLJS::IO::DirectoryOperations));
+    exports.Set("walkDirectory", Napi::Function::New(env, LLJS::IO::WalkDirectoryTree));
+    exports.Set("createIoRing", Napi::Function::New(env, LLJS::IO::CreateIoRing));
+    exports.Set("ioRingRegisterFile", Napi::Function::New(env, LLJS::IO::IoRingRegisterFile));
+    exports.Set("ioRingRegisterBuffer", Napi::Function::New(env, LLJS::IO::IoRingRegisterBuffer));
+    exports.Set("ioRingQueue", Napi::Function::New(env, LLJS::IO::IoRingQueue));
+    exports.Set("ioRingSubmit", Napi::Function::New(env, LLJS::IO::IoRingSubmit));
+    exports.Set("destroyIoRing", Napi::Function::New(env, LLJS::IO::DestroyIoRing));
+    exports.Set("readFileAsync", Napi::Function::New(env, LLJS::IO::ReadFileAsync));
+    exports.Set("writeFileAsync", Napi::Function::New(env, LLJS::IO::WriteFileAsync));
+    exports.Set("readAt", Napi::Function::New(env, LLJS::IO::ReadAt));
+    exports.Set("writeAt", Napi::Function::New(env, LLJS::IO::WriteAt));
+    exports.Set("preadv", Napi::Function::New(env, LLJS::IO::Preadv));
+    exports.Set("pwritev", Napi::Function::New(env, LLJS::IO::Pwritev));
+    exports.Set("mapFile", Napi::Function::New(env, LLJS::IO::MapFile));
+    exports.Set("msync", Napi::Function::New(env, LLJS::IO::Msync));
+    exports.Set("madvise", Napi::Function::New(env, LLJS::IO::Madvise));
 
     // Threading operations
     exports.Set("createThread", Napi::Function::New(env, LLJS::Threading::CreateThread));
@@ -58,9 +105,19 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("createMutex", Napi::Function::New(env, LLJS::Threading::CreateMutex));
     exports.Set("lockMutex", Napi::Function::New(env, LLJS::Threading::LockMutex));
     exports.Set("unlockMutex", Napi::Function::New(env, LLJS::Threading::UnlockMutex));
+    exports.Set("destroyMutex", Napi::Function::New(env, LLJS::Threading::DestroyMutex));
     exports.Set("createSemaphore", Napi::Function::New(env, LLJS::Threading::CreateSemaphore));
     exports.Set("waitSemaphore", Napi::Function::New(env, LLJS::Threading::WaitSemaphore));
     exports.Set("signalSemaphore", Napi::Function::New(env, LLJS::Threading::SignalSemaphore));
+    exports.Set("destroySemaphore", Napi::Function::New(env, LLJS::Threading::DestroySemaphore));
+    exports.Set("ringByteLength", Napi::Function::New(env, LLJS::Threading::RingByteLength));
+    exports.Set("ringInit", Napi::Function::New(env, LLJS::Threading::RingInit));
+    exports.Set("ringPush", Napi::Function::New(env, LLJS::Threading::RingPush));
+    exports.Set("ringPop", Napi::Function::New(env, LLJS::Threading::RingPop));
+    exports.Set("ringInfo", Napi::Function::New(env, LLJS::Threading::RingInfo));
+    exports.Set("runBatch", Napi::Function::New(env, LLJS::Threading::RunBatch));
+    exports.Set("getPoolInfo", Napi::Function::New(env, LLJS::Threading::GetPoolInfo));
+    exports.Set("setPoolAffinity", Napi::Function::New(env, LLJS::Threading::SetPoolAffinity));
 
     // Time operations
     exports.Set("getHighResTime", Napi::Function::New(env, LLJS::Time::GetHighResTime));
@@ -74,6 +131,18 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("getMonotonicTime", Napi::Function::New(env, LLJS::Time::GetMonotonicTime));
     exports.Set("measureElapsed", Napi::Function::New(env, LLJS::Time::MeasureElapsed));
     exports.Set("getTimeZoneInfo", Napi::Function::New(env, LLJS::Time::GetTimeZoneInfo));
+    exports.Set("readCycles", Napi::Function::New(env, LLJS::Time::ReadCycles));
+    exports.Set("writeCycles", Napi::Function::New(env, LLJS::Time::WriteCycles));
+    exports.Set("cyclesToNanoseconds", Napi::Function::New(env, LLJS::Time::CyclesToNanoseconds));
+    exports.Set("getCycleClockInfo", Napi::Function::New(env, LLJS::Time::GetCycleClockInfo));
+    exports.Set("createHistogram", Napi::Function::New(env, LLJS::Time::CreateHistogram));
+    exports.Set("histogramRecord", Napi::Function::New(env, LLJS::Time::HistogramRecord));
+    exports.Set("histogramTime", Napi::Function::New(env, LLJS::Time::HistogramTime));
+    exports.Set("histogramAdd", Napi::Function::New(env, LLJS::Time::HistogramAdd));
+    exports.Set("histogramPercentile", Napi::Function::New(env, LLJS::Time::HistogramPercentile));
+    exports.Set("histogramSnapshot", Napi::Function::New(env, LLJS::Time::HistogramSnapshot));
+    exports.Set("histogramReset", Napi::Function::New(env, LLJS::Time::HistogramReset));
+    exports.Set("destroyHistogram", Napi::Function::New(env, LLJS::Time::DestroyHistogram));
 
     // Math operations
     exports.Set("fastSqrt", Napi::Function::New(env, LLJS::Math::FastSqrt));
@@ -81,8 +150,13 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("vectorOperations", Napi::Function::New(env, LLJS::Math::VectorOperations));
     exports.Set("matrixOperations", Napi::Function::New(env, LLJS::Math::MatrixOperations));
     exports.Set("bitwiseOperations", Napi::Function::New(env, LLJS::Math::BitwiseOperations));
+    exports.Set("executeCommands", Napi::Function::New(env, LLJS::Math::ExecuteCommands));
     exports.Set("randomNumbers", Napi::Function::New(env, LLJS::Math::RandomNumbers));
+    exports.Set("fillRandom", Napi::Function::New(env, LLJS::Math::FillRandom));
     exports.Set("fastFourierTransform", Napi::Function::New(env, LLJS::Math::FastFourierTransform));
+    exports.Set("createFFTPlan", Napi::Function::New(env, LLJS::Math::CreateFFTPlan));
+    exports.Set("executeFFTPlan", Napi::Function::New(env, LLJS::Math::ExecuteFFTPlan));
+    exports.Set("destroyFFTPlan", Napi::Function::New(env, LLJS::Math::DestroyFFTPlan));
 
     // String operations
     exports.Set("fastStringCompare", Napi::Function::New(env, LLJS::String::FastStringCompare));
@@ -93,6 +167,22 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("stringHash", Napi::Function::New(env, LLJS::String::StringHash));
     exports.Set("stringValidate", Napi::Function::New(env, LLJS::String::StringValidate));
     exports.Set("stringReplace", Napi::Function::New(env, LLJS::String::StringReplace));
+    exports.Set("findAll", Napi::Function::New(env, LLJS::String::FindAll));
+    exports.Set("createMatcher", Napi::Function::New(env, LLJS::String::CreateMatcher));
+    exports.Set("matcherScan", Napi::Function::New(env, LLJS::String::MatcherScan));
+    exports.Set("destroyMatcher", Napi::Function::New(env, LLJS::String::DestroyMatcher));
+    exports.Set("bufferLength", Napi::Function::New(env, LLJS::String::BufferLength));
+    exports.Set("bufferHash", Napi::Function::New(env, LLJS::String::BufferHash));
+    exports.Set("bufferValidate", Napi::Function::New(env, LLJS::String::BufferValidate));
+    exports.Set("bufferCompare", Napi::Function::New(env, LLJS::String::BufferCompare));
+    exports.Set("stringBatch", Napi::Function::New(env, LLJS::String::StringBatch));
+    exports.Set("hash", Napi::Function::New(env, LLJS::String::Hash));
+    exports.Set("createHasher", Napi::Function::New(env, LLJS::String::CreateHasher));
+    exports.Set("hasherUpdate", Napi::Function::New(env, LLJS::String::HasherUpdate));
+    exports.Set("hasherDigest", Napi::Function::New(env, LLJS::String::HasherDigest));
+    exports.Set("destroyHasher", Napi::Function::New(env, LLJS::String::DestroyHasher));
+    exports.Set("transcode", Napi::Function::New(env, LLJS::String::Transcode));
+    exports.Set("decodeUtf8", Napi::Function::New(env, LLJS::String::DecodeUtf8));
 
     return exports;
 }
@@ -1,16 +1,19 @@
 #include "headers/lljs.h"
+#include "headers/thread_pool.h"
+#include "headers/handle_table.h"
 #include <cmath>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
 #include <random>
 #include <algorithm>
 #include <vector>
 #include <complex>
 #include <numeric>
-#include <immintrin.h> // For SIMD operations
-#ifdef _WIN32
-#include <intrin.h>
-#else
-#include <x86intrin.h>
-#endif
 
 // Windows compatibility defines
 #ifndef M_PI
@@ -35,9 +38,9 @@ static inline int __builtin_ctzll_impl(unsigned long long x) {
 
 namespace LLJS::Math {
 
-// Global random number generator
-static std::random_device rd;
-static std::mt19937 gen(rd());
+// Random number generator for randomNumbers; per thread so worker envs never
+// share it, seeded from a device of its own so first use cannot race
+static thread_local std::mt19937 gen(std::random_device{}());
 
 /**
  * Fast square root implementation using hardware acceleration
@@ -63,6 +66,21 @@ Napi::Value FastSqrt(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, result);
 }
 
+/**
+ * Quake III inverse square root with two Newton iterations
+ */
+static inline float InvSqrtApprox(float x) {
+    float x2 = x * 0.5f;
+    float y = x;
+    uint32_t i;
+    std::memcpy(&i, &y, sizeof(i));
+    i = 0x5f3759df - (i >> 1);
+    std::memcpy(&y, &i, sizeof(y));
+    y = y * (1.5f - (x2 * y * y));
+    y = y * (1.5f - (x2 * y * y));
+    return y;
+}
+
 /**
  * Fast inverse square root (Quake III algorithm)
  * @param info - CallbackInfo containing number parameter
@@ -82,214 +100,1580 @@ Napi::Value FastInvSqrt(const Napi::CallbackInfo& info) {
         return Napi::Number::New(env, std::numeric_limits<double>::infinity());
     }
     
-    // Fast inverse square root algorithm
-    float x2 = x * 0.5f;
-    float y = x;
-    uint32_t i = *(uint32_t*)&y;
-    i = 0x5f3759df - (i >> 1);
-    y = *(float*)&i;
-    y = y * (1.5f - (x2 * y * y)); // Newton iteration
-    y = y * (1.5f - (x2 * y * y)); // Second iteration for better precision
-    
-    return Napi::Number::New(env, y);
+    return Napi::Number::New(env, InvSqrtApprox(x));
 }
 
+// Element-wise binary vector operations
+enum class VectorOp {
+    Add,
+    Subtract,
+    Multiply,
+    Divide
+};
+
 /**
- * SIMD-accelerated vector operations
- * @param info - CallbackInfo containing operation configuration
- * @returns Operation result
+ * Maps an operation name to its element-wise kernel
+ * @param op - Operation name
+ * @param out - Parsed operation
+ * @returns False if the name is not an element-wise operation
  */
-Napi::Value VectorOperations(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    
-    if (info.Length() < 1 || !info[0].IsObject()) {
-        Napi::TypeError::New(env, "Operation object required").ThrowAsJavaScriptException();
-        return env.Null();
+static bool ParseVectorOp(const std::string& op, VectorOp& out) {
+    if (op == "add") out = VectorOp::Add;
+    else if (op == "subtract") out = VectorOp::Subtract;
+    else if (op == "multiply") out = VectorOp::Multiply;
+    else if (op == "divide") out = VectorOp::Divide;
+    else return false;
+    return true;
+}
+
+/**
+ * Scalar element-wise loop; also finishes the tails of the SIMD kernels
+ * @param op - Operation to apply
+ * @param a - First operand
+ * @param b - Second operand
+ * @param out - Destination (may alias a or b)
+ * @param i - First element to process
+ * @param n - Element count
+ */
+template <typename T>
+static inline void VectorBinaryTail(VectorOp op, const T* a, const T* b, T* out, size_t i, size_t n) {
+    switch (op) {
+        case VectorOp::Add: for (; i < n; i++) out[i] = a[i] + b[i]; break;
+        case VectorOp::Subtract: for (; i < n; i++) out[i] = a[i] - b[i]; break;
+        case VectorOp::Multiply: for (; i < n; i++) out[i] = a[i] * b[i]; break;
+        case VectorOp::Divide: for (; i < n; i++) out[i] = a[i] / b[i]; break;
     }
-    
-    Napi::Object operation = info[0].As<Napi::Object>();
-    std::string op = operation.Get("operation").As<Napi::String>();
-    Napi::Array vectorA = operation.Get("a").As<Napi::Array>();
-    
-    std::vector<double> a;
-    for (uint32_t i = 0; i < vectorA.Length(); i++) {
-        a.push_back(vectorA.Get(i).As<Napi::Number>().DoubleValue());
+}
+
+/**
+ * Scalar dot product loop with double accumulation
+ * @param a - First operand
+ * @param b - Second operand
+ * @param i - First element to process
+ * @param n - Element count
+ * @param sum - Running sum
+ * @returns Updated sum
+ */
+template <typename T>
+static inline double VectorDotTail(const T* a, const T* b, size_t i, size_t n, double sum) {
+    for (; i < n; i++) {
+        sum += static_cast<double>(a[i]) * b[i];
+    }
+    return sum;
+}
+
+static void BinaryScalarF64(VectorOp op, const double* a, const double* b, double* out, size_t n) {
+    VectorBinaryTail(op, a, b, out, 0, n);
+}
+
+static void BinaryScalarF32(VectorOp op, const float* a, const float* b, float* out, size_t n) {
+    VectorBinaryTail(op, a, b, out, 0, n);
+}
+
+static double DotScalarF64(const double* a, const double* b, size_t n) {
+    return VectorDotTail(a, b, 0, n, 0.0);
+}
+
+static double DotScalarF32(const float* a, const float* b, size_t n) {
+    return VectorDotTail(a, b, 0, n, 0.0);
+}
+
+#ifdef LLJS_ARCH_X86
+LLJS_TARGET_SSE2
+static void BinarySSE2F64(VectorOp op, const double* a, const double* b, double* out, size_t n) {
+    size_t i = 0;
+    switch (op) {
+        case VectorOp::Add:
+            for (; i + 2 <= n; i += 2) _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            break;
+        case VectorOp::Subtract:
+            for (; i + 2 <= n; i += 2) _mm_storeu_pd(out + i, _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            break;
+        case VectorOp::Multiply:
+            for (; i + 2 <= n; i += 2) _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            break;
+        case VectorOp::Divide:
+            for (; i + 2 <= n; i += 2) _mm_storeu_pd(out + i, _mm_div_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+            break;
+    }
+    VectorBinaryTail(op, a, b, out, i, n);
+}
+
+LLJS_TARGET_SSE2
+static void BinarySSE2F32(VectorOp op, const float* a, const float* b, float* out, size_t n) {
+    size_t i = 0;
+    switch (op) {
+        case VectorOp::Add:
+            for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+            break;
+        case VectorOp::Subtract:
+            for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+            break;
+        case VectorOp::Multiply:
+            for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+            break;
+        case VectorOp::Divide:
+            for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_div_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+            break;
+    }
+    VectorBinaryTail(op, a, b, out, i, n);
+}
+
+LLJS_TARGET_SSE2
+static double DotSSE2F64(const double* a, const double* b, size_t n) {
+    __m128d sum = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        sum = _mm_add_pd(sum, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, sum);
+    return VectorDotTail(a, b, i, n, lanes[0] + lanes[1]);
+}
+
+LLJS_TARGET_SSE2
+static double DotSSE2F32(const float* a, const float* b, size_t n) {
+    __m128d sum = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        // Widen two floats at a time so float inputs accumulate in double precision
+        __m128d vecA = _mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(a + i))));
+        __m128d vecB = _mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(b + i))));
+        sum = _mm_add_pd(sum, _mm_mul_pd(vecA, vecB));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, sum);
+    return VectorDotTail(a, b, i, n, lanes[0] + lanes[1]);
+}
+
+LLJS_TARGET_AVX2
+static void BinaryAVX2F64(VectorOp op, const double* a, const double* b, double* out, size_t n) {
+    size_t i = 0;
+    switch (op) {
+        case VectorOp::Add:
+            for (; i + 4 <= n; i += 4) _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            break;
+        case VectorOp::Subtract:
+            for (; i + 4 <= n; i += 4) _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            break;
+        case VectorOp::Multiply:
+            for (; i + 4 <= n; i += 4) _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            break;
+        case VectorOp::Divide:
+            for (; i + 4 <= n; i += 4) _mm256_storeu_pd(out + i, _mm256_div_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            break;
+    }
+    VectorBinaryTail(op, a, b, out, i, n);
+}
+
+LLJS_TARGET_AVX2
+static void BinaryAVX2F32(VectorOp op, const float* a, const float* b, float* out, size_t n) {
+    size_t i = 0;
+    switch (op) {
+        case VectorOp::Add:
+            for (; i + 8 <= n; i += 8) _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+            break;
+        case VectorOp::Subtract:
+            for (; i + 8 <= n; i += 8) _mm256_storeu_ps(out + i, _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+            break;
+        case VectorOp::Multiply:
+            for (; i + 8 <= n; i += 8) _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+            break;
+        case VectorOp::Divide:
+            for (; i + 8 <= n; i += 8) _mm256_storeu_ps(out + i, _mm256_div_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+            break;
+    }
+    VectorBinaryTail(op, a, b, out, i, n);
+}
+
+LLJS_TARGET_AVX2
+static double DotAVX2F64(const double* a, const double* b, size_t n) {
+    __m256d sum = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), sum);
     }
     
-    if (op == "add" || op == "subtract" || op == "multiply" || op == "divide") {
-        if (!operation.Has("b")) {
-            Napi::TypeError::New(env, "Vector b required for binary operations").ThrowAsJavaScriptException();
-            return env.Null();
+    // Extract and sum the 4 doubles
+    double lanes[4];
+    _mm256_storeu_pd(lanes, sum);
+    return VectorDotTail(a, b, i, n, lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+
+LLJS_TARGET_AVX2
+static double DotAVX2F32(const float* a, const float* b, size_t n) {
+    __m256d sum = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d vecA = _mm256_cvtps_pd(_mm_loadu_ps(a + i));
+        __m256d vecB = _mm256_cvtps_pd(_mm_loadu_ps(b + i));
+        sum = _mm256_fmadd_pd(vecA, vecB, sum);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, sum);
+    return VectorDotTail(a, b, i, n, lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+
+LLJS_TARGET_AVX512
+static inline double ReduceAddAVX512(__m512d sum) {
+    double lanes[8];
+    _mm512_storeu_pd(lanes, sum);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + (lanes[4] + lanes[5]) + (lanes[6] + lanes[7]);
+}
+
+LLJS_TARGET_AVX512
+static void BinaryAVX512F64(VectorOp op, const double* a, const double* b, double* out, size_t n) {
+    size_t i = 0;
+    switch (op) {
+        case VectorOp::Add:
+            for (; i + 8 <= n; i += 8) _mm512_storeu_pd(out + i, _mm512_add_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+            break;
+        case VectorOp::Subtract:
+            for (; i + 8 <= n; i += 8) _mm512_storeu_pd(out + i, _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+            break;
+        case VectorOp::Multiply:
+            for (; i + 8 <= n; i += 8) _mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+            break;
+        case VectorOp::Divide:
+            for (; i + 8 <= n; i += 8) _mm512_storeu_pd(out + i, _mm512_div_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+            break;
+    }
+    VectorBinaryTail(op, a, b, out, i, n);
+}
+
+LLJS_TARGET_AVX512
+static void BinaryAVX512F32(VectorOp op, const float* a, const float* b, float* out, size_t n) {
+    size_t i = 0;
+    switch (op) {
+        case VectorOp::Add:
+            for (; i + 16 <= n; i += 16) _mm512_storeu_ps(out + i, _mm512_add_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+            break;
+        case VectorOp::Subtract:
+            for (; i + 16 <= n; i += 16) _mm512_storeu_ps(out + i, _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+            break;
+        case VectorOp::Multiply:
+            for (; i + 16 <= n; i += 16) _mm512_storeu_ps(out + i, _mm512_mul_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+            break;
+        case VectorOp::Divide:
+            for (; i + 16 <= n; i += 16) _mm512_storeu_ps(out + i, _mm512_div_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+            break;
+    }
+    VectorBinaryTail(op, a, b, out, i, n);
+}
+
+LLJS_TARGET_AVX512
+static double DotAVX512F64(const double* a, const double* b, size_t n) {
+    __m512d sum = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        sum = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), sum);
+    }
+    return VectorDotTail(a, b, i, n, ReduceAddAVX512(sum));
+}
+
+LLJS_TARGET_AVX512
+static double DotAVX512F32(const float* a, const float* b, size_t n) {
+    __m512d sum = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d vecA = _mm512_cvtps_pd(_mm256_loadu_ps(a + i));
+        __m512d vecB = _mm512_cvtps_pd(_mm256_loadu_ps(b + i));
+        sum = _mm512_fmadd_pd(vecA, vecB, sum);
+    }
+    return VectorDotTail(a, b, i, n, ReduceAddAVX512(sum));
+}
+#endif // LLJS_ARCH_X86
+
+#ifdef LLJS_ARCH_ARM64
+static void BinaryNEONF64(VectorOp op, const double* a, const double* b, double* out, size_t n) {
+    size_t i = 0;
+    switch (op) {
+        case VectorOp::Add:
+            for (; i + 2 <= n; i += 2) vst1q_f64(out + i, vaddq_f64(vld1q_f64(a + i), vld1q_f64(b + i)));
+            break;
+        case VectorOp::Subtract:
+            for (; i + 2 <= n; i += 2) vst1q_f64(out + i, vsubq_f64(vld1q_f64(a + i), vld1q_f64(b + i)));
+            break;
+        case VectorOp::Multiply:
+            for (; i + 2 <= n; i += 2) vst1q_f64(out + i, vmulq_f64(vld1q_f64(a + i), vld1q_f64(b + i)));
+            break;
+        case VectorOp::Divide:
+            for (; i + 2 <= n; i += 2) vst1q_f64(out + i, vdivq_f64(vld1q_f64(a + i), vld1q_f64(b + i)));
+            break;
+    }
+    VectorBinaryTail(op, a, b, out, i, n);
+}
+
+static void BinaryNEONF32(VectorOp op, const float* a, const float* b, float* out, size_t n) {
+    size_t i = 0;
+    switch (op) {
+        case VectorOp::Add:
+            for (; i + 4 <= n; i += 4) vst1q_f32(out + i, vaddq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+            break;
+        case VectorOp::Subtract:
+            for (; i + 4 <= n; i += 4) vst1q_f32(out + i, vsubq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+            break;
+        case VectorOp::Multiply:
+            for (; i + 4 <= n; i += 4) vst1q_f32(out + i, vmulq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+            break;
+        case VectorOp::Divide:
+            for (; i + 4 <= n; i += 4) vst1q_f32(out + i, vdivq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+            break;
+    }
+    VectorBinaryTail(op, a, b, out, i, n);
+}
+
+static double DotNEONF64(const double* a, const double* b, size_t n) {
+    float64x2_t sum = vdupq_n_f64(0.0);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        sum = vfmaq_f64(sum, vld1q_f64(a + i), vld1q_f64(b + i));
+    }
+    return VectorDotTail(a, b, i, n, vaddvq_f64(sum));
+}
+
+static double DotNEONF32(const float* a, const float* b, size_t n) {
+    float64x2_t sumLow = vdupq_n_f64(0.0);
+    float64x2_t sumHigh = vdupq_n_f64(0.0);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t vecA = vld1q_f32(a + i);
+        float32x4_t vecB = vld1q_f32(b + i);
+        sumLow = vfmaq_f64(sumLow, vcvt_f64_f32(vget_low_f32(vecA)), vcvt_f64_f32(vget_low_f32(vecB)));
+        sumHigh = vfmaq_f64(sumHigh, vcvt_high_f64_f32(vecA), vcvt_high_f64_f32(vecB));
+    }
+    return VectorDotTail(a, b, i, n, vaddvq_f64(vaddq_f64(sumLow, sumHigh)));
+}
+#endif // LLJS_ARCH_ARM64
+
+// GEMM micro-kernels: C[MR x NR] += packed A strip * packed B strip.
+// A strips are stored k-major with MR values per k, B strips with NR values per k.
+static constexpr size_t kGemmMR = 4;
+static constexpr size_t kGemmNR64 = 8;
+static constexpr size_t kGemmNR32 = 16;
+
+template <typename T, size_t NR>
+static void GemmMicroScalar(size_t kc, const T* ap, const T* bp, T* c, size_t ldc) {
+    T acc[kGemmMR][NR] = {};
+    for (size_t k = 0; k < kc; k++, ap += kGemmMR, bp += NR) {
+        for (size_t r = 0; r < kGemmMR; r++) {
+            T a = ap[r];
+            for (size_t j = 0; j < NR; j++) {
+                acc[r][j] += a * bp[j];
+            }
         }
-        
-        Napi::Array vectorB = operation.Get("b").As<Napi::Array>();
-        std::vector<double> b;
-        for (uint32_t i = 0; i < vectorB.Length(); i++) {
-            b.push_back(vectorB.Get(i).As<Napi::Number>().DoubleValue());
+    }
+    for (size_t r = 0; r < kGemmMR; r++) {
+        for (size_t j = 0; j < NR; j++) {
+            c[r * ldc + j] += acc[r][j];
         }
-        
-        size_t minSize = std::min(a.size(), b.size());
-        Napi::Array result = Napi::Array::New(env);
-        
-        // Use SIMD for vectorized operations when possible
-        size_t simdSize = (minSize / 4) * 4; // Process in chunks of 4
-        
-        for (size_t i = 0; i < simdSize; i += 4) {
-            __m256d vecA = _mm256_loadu_pd(&a[i]);
-            __m256d vecB = _mm256_loadu_pd(&b[i]);
-            __m256d vecResult;
-            
-            if (op == "add") {
-                vecResult = _mm256_add_pd(vecA, vecB);
-            } else if (op == "subtract") {
-                vecResult = _mm256_sub_pd(vecA, vecB);
-            } else if (op == "multiply") {
-                vecResult = _mm256_mul_pd(vecA, vecB);
-            } else if (op == "divide") {
-                vecResult = _mm256_div_pd(vecA, vecB);
-            }
-            
-            double resultArray[4];
-            _mm256_storeu_pd(resultArray, vecResult);
-            
-            for (int j = 0; j < 4; j++) {
-                result.Set(static_cast<uint32_t>(i + j), Napi::Number::New(env, resultArray[j]));
-            }
+    }
+}
+
+static void GemmMicroScalarF64(size_t kc, const double* ap, const double* bp, double* c, size_t ldc) {
+    GemmMicroScalar<double, kGemmNR64>(kc, ap, bp, c, ldc);
+}
+
+static void GemmMicroScalarF32(size_t kc, const float* ap, const float* bp, float* c, size_t ldc) {
+    GemmMicroScalar<float, kGemmNR32>(kc, ap, bp, c, ldc);
+}
+
+#ifdef LLJS_ARCH_X86
+LLJS_TARGET_SSE2
+static void GemmMicroSSE2F64(size_t kc, const double* ap, const double* bp, double* c, size_t ldc) {
+    __m128d acc[kGemmMR][4];
+    for (size_t r = 0; r < kGemmMR; r++) {
+        for (size_t j = 0; j < 4; j++) {
+            acc[r][j] = _mm_setzero_pd();
         }
-        
-        // Handle remaining elements
-        for (size_t i = simdSize; i < minSize; i++) {
-            double value = 0;
-            if (op == "add") value = a[i] + b[i];
-            else if (op == "subtract") value = a[i] - b[i];
-            else if (op == "multiply") value = a[i] * b[i];
-            else if (op == "divide") value = a[i] / b[i];
-            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, value));
+    }
+    for (size_t k = 0; k < kc; k++, ap += kGemmMR, bp += kGemmNR64) {
+        __m128d b0 = _mm_loadu_pd(bp), b1 = _mm_loadu_pd(bp + 2);
+        __m128d b2 = _mm_loadu_pd(bp + 4), b3 = _mm_loadu_pd(bp + 6);
+        for (size_t r = 0; r < kGemmMR; r++) {
+            __m128d a = _mm_set1_pd(ap[r]);
+            acc[r][0] = _mm_add_pd(acc[r][0], _mm_mul_pd(a, b0));
+            acc[r][1] = _mm_add_pd(acc[r][1], _mm_mul_pd(a, b1));
+            acc[r][2] = _mm_add_pd(acc[r][2], _mm_mul_pd(a, b2));
+            acc[r][3] = _mm_add_pd(acc[r][3], _mm_mul_pd(a, b3));
         }
-        
-        return result;
-    } else if (op == "dot") {
-        if (!operation.Has("b")) {
-            Napi::TypeError::New(env, "Vector b required for dot product").ThrowAsJavaScriptException();
-            return env.Null();
+    }
+    for (size_t r = 0; r < kGemmMR; r++) {
+        for (size_t j = 0; j < 4; j++) {
+            double* dst = c + r * ldc + j * 2;
+            _mm_storeu_pd(dst, _mm_add_pd(_mm_loadu_pd(dst), acc[r][j]));
         }
-        
-        Napi::Array vectorB = operation.Get("b").As<Napi::Array>();
-        std::vector<double> b;
-        for (uint32_t i = 0; i < vectorB.Length(); i++) {
-            b.push_back(vectorB.Get(i).As<Napi::Number>().DoubleValue());
+    }
+}
+
+LLJS_TARGET_SSE2
+static void GemmMicroSSE2F32(size_t kc, const float* ap, const float* bp, float* c, size_t ldc) {
+    __m128 acc[kGemmMR][4];
+    for (size_t r = 0; r < kGemmMR; r++) {
+        for (size_t j = 0; j < 4; j++) {
+            acc[r][j] = _mm_setzero_ps();
         }
-        
-        double result = 0;
-        size_t minSize = std::min(a.size(), b.size());
-        
-        // SIMD dot product
-        size_t simdSize = (minSize / 4) * 4;
-        __m256d sum = _mm256_setzero_pd();
-        
-        for (size_t i = 0; i < simdSize; i += 4) {
-            __m256d vecA = _mm256_loadu_pd(&a[i]);
-            __m256d vecB = _mm256_loadu_pd(&b[i]);
-            __m256d product = _mm256_mul_pd(vecA, vecB);
-            sum = _mm256_add_pd(sum, product);
+    }
+    for (size_t k = 0; k < kc; k++, ap += kGemmMR, bp += kGemmNR32) {
+        __m128 b0 = _mm_loadu_ps(bp), b1 = _mm_loadu_ps(bp + 4);
+        __m128 b2 = _mm_loadu_ps(bp + 8), b3 = _mm_loadu_ps(bp + 12);
+        for (size_t r = 0; r < kGemmMR; r++) {
+            __m128 a = _mm_set1_ps(ap[r]);
+            acc[r][0] = _mm_add_ps(acc[r][0], _mm_mul_ps(a, b0));
+            acc[r][1] = _mm_add_ps(acc[r][1], _mm_mul_ps(a, b1));
+            acc[r][2] = _mm_add_ps(acc[r][2], _mm_mul_ps(a, b2));
+            acc[r][3] = _mm_add_ps(acc[r][3], _mm_mul_ps(a, b3));
         }
-        
-        // Extract and sum the 4 doubles
-        double sumArray[4];
-        _mm256_storeu_pd(sumArray, sum);
-        result = sumArray[0] + sumArray[1] + sumArray[2] + sumArray[3];
-        
-        // Handle remaining elements
-        for (size_t i = simdSize; i < minSize; i++) {
-            result += a[i] * b[i];
+    }
+    for (size_t r = 0; r < kGemmMR; r++) {
+        for (size_t j = 0; j < 4; j++) {
+            float* dst = c + r * ldc + j * 4;
+            _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), acc[r][j]));
         }
-        
-        return Napi::Number::New(env, result);
-    } else if (op == "cross") {
-        if (!operation.Has("b") || a.size() != 3) {
-            Napi::TypeError::New(env, "Cross product requires two 3D vectors").ThrowAsJavaScriptException();
-            return env.Null();
+    }
+}
+
+LLJS_TARGET_AVX2
+static void GemmMicroAVX2F64(size_t kc, const double* ap, const double* bp, double* c, size_t ldc) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    for (size_t k = 0; k < kc; k++, ap += kGemmMR, bp += kGemmNR64) {
+        __m256d b0 = _mm256_loadu_pd(bp), b1 = _mm256_loadu_pd(bp + 4);
+        __m256d a = _mm256_broadcast_sd(ap);
+        c00 = _mm256_fmadd_pd(a, b0, c00); c01 = _mm256_fmadd_pd(a, b1, c01);
+        a = _mm256_broadcast_sd(ap + 1);
+        c10 = _mm256_fmadd_pd(a, b0, c10); c11 = _mm256_fmadd_pd(a, b1, c11);
+        a = _mm256_broadcast_sd(ap + 2);
+        c20 = _mm256_fmadd_pd(a, b0, c20); c21 = _mm256_fmadd_pd(a, b1, c21);
+        a = _mm256_broadcast_sd(ap + 3);
+        c30 = _mm256_fmadd_pd(a, b0, c30); c31 = _mm256_fmadd_pd(a, b1, c31);
+    }
+    __m256d rows[kGemmMR][2] = { { c00, c01 }, { c10, c11 }, { c20, c21 }, { c30, c31 } };
+    for (size_t r = 0; r < kGemmMR; r++) {
+        double* dst = c + r * ldc;
+        _mm256_storeu_pd(dst, _mm256_add_pd(_mm256_loadu_pd(dst), rows[r][0]));
+        _mm256_storeu_pd(dst + 4, _mm256_add_pd(_mm256_loadu_pd(dst + 4), rows[r][1]));
+    }
+}
+
+LLJS_TARGET_AVX2
+static void GemmMicroAVX2F32(size_t kc, const float* ap, const float* bp, float* c, size_t ldc) {
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    for (size_t k = 0; k < kc; k++, ap += kGemmMR, bp += kGemmNR32) {
+        __m256 b0 = _mm256_loadu_ps(bp), b1 = _mm256_loadu_ps(bp + 8);
+        __m256 a = _mm256_broadcast_ss(ap);
+        c00 = _mm256_fmadd_ps(a, b0, c00); c01 = _mm256_fmadd_ps(a, b1, c01);
+        a = _mm256_broadcast_ss(ap + 1);
+        c10 = _mm256_fmadd_ps(a, b0, c10); c11 = _mm256_fmadd_ps(a, b1, c11);
+        a = _mm256_broadcast_ss(ap + 2);
+        c20 = _mm256_fmadd_ps(a, b0, c20); c21 = _mm256_fmadd_ps(a, b1, c21);
+        a = _mm256_broadcast_ss(ap + 3);
+        c30 = _mm256_fmadd_ps(a, b0, c30); c31 = _mm256_fmadd_ps(a, b1, c31);
+    }
+    __m256 rows[kGemmMR][2] = { { c00, c01 }, { c10, c11 }, { c20, c21 }, { c30, c31 } };
+    for (size_t r = 0; r < kGemmMR; r++) {
+        float* dst = c + r * ldc;
+        _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_loadu_ps(dst), rows[r][0]));
+        _mm256_storeu_ps(dst + 8, _mm256_add_ps(_mm256_loadu_ps(dst + 8), rows[r][1]));
+    }
+}
+
+LLJS_TARGET_AVX512
+static void GemmMicroAVX512F64(size_t kc, const double* ap, const double* bp, double* c, size_t ldc) {
+    __m512d c0 = _mm512_setzero_pd(), c1 = _mm512_setzero_pd();
+    __m512d c2 = _mm512_setzero_pd(), c3 = _mm512_setzero_pd();
+    for (size_t k = 0; k < kc; k++, ap += kGemmMR, bp += kGemmNR64) {
+        __m512d b = _mm512_loadu_pd(bp);
+        c0 = _mm512_fmadd_pd(_mm512_set1_pd(ap[0]), b, c0);
+        c1 = _mm512_fmadd_pd(_mm512_set1_pd(ap[1]), b, c1);
+        c2 = _mm512_fmadd_pd(_mm512_set1_pd(ap[2]), b, c2);
+        c3 = _mm512_fmadd_pd(_mm512_set1_pd(ap[3]), b, c3);
+    }
+    _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), c0));
+    _mm512_storeu_pd(c + ldc, _mm512_add_pd(_mm512_loadu_pd(c + ldc), c1));
+    _mm512_storeu_pd(c + 2 * ldc, _mm512_add_pd(_mm512_loadu_pd(c + 2 * ldc), c2));
+    _mm512_storeu_pd(c + 3 * ldc, _mm512_add_pd(_mm512_loadu_pd(c + 3 * ldc), c3));
+}
+
+LLJS_TARGET_AVX512
+static void GemmMicroAVX512F32(size_t kc, const float* ap, const float* bp, float* c, size_t ldc) {
+    __m512 c0 = _mm512_setzero_ps(), c1 = _mm512_setzero_ps();
+    __m512 c2 = _mm512_setzero_ps(), c3 = _mm512_setzero_ps();
+    for (size_t k = 0; k < kc; k++, ap += kGemmMR, bp += kGemmNR32) {
+        __m512 b = _mm512_loadu_ps(bp);
+        c0 = _mm512_fmadd_ps(_mm512_set1_ps(ap[0]), b, c0);
+        c1 = _mm512_fmadd_ps(_mm512_set1_ps(ap[1]), b, c1);
+        c2 = _mm512_fmadd_ps(_mm512_set1_ps(ap[2]), b, c2);
+        c3 = _mm512_fmadd_ps(_mm512_set1_ps(ap[3]), b, c3);
+    }
+    _mm512_storeu_ps(c, _mm512_add_ps(_mm512_loadu_ps(c), c0));
+    _mm512_storeu_ps(c + ldc, _mm512_add_ps(_mm512_loadu_ps(c + ldc), c1));
+    _mm512_storeu_ps(c + 2 * ldc, _mm512_add_ps(_mm512_loadu_ps(c + 2 * ldc), c2));
+    _mm512_storeu_ps(c + 3 * ldc, _mm512_add_ps(_mm512_loadu_ps(c + 3 * ldc), c3));
+}
+#endif // LLJS_ARCH_X86
+
+#ifdef LLJS_ARCH_ARM64
+static void GemmMicroNEONF64(size_t kc, const double* ap, const double* bp, double* c, size_t ldc) {
+    float64x2_t acc[kGemmMR][4];
+    for (size_t r = 0; r < kGemmMR; r++) {
+        for (size_t j = 0; j < 4; j++) {
+            acc[r][j] = vdupq_n_f64(0.0);
         }
-        
-        Napi::Array vectorB = operation.Get("b").As<Napi::Array>();
-        if (vectorB.Length() != 3) {
-            Napi::TypeError::New(env, "Cross product requires two 3D vectors").ThrowAsJavaScriptException();
-            return env.Null();
+    }
+    for (size_t k = 0; k < kc; k++, ap += kGemmMR, bp += kGemmNR64) {
+        float64x2_t b0 = vld1q_f64(bp), b1 = vld1q_f64(bp + 2);
+        float64x2_t b2 = vld1q_f64(bp + 4), b3 = vld1q_f64(bp + 6);
+        for (size_t r = 0; r < kGemmMR; r++) {
+            float64x2_t a = vdupq_n_f64(ap[r]);
+            acc[r][0] = vfmaq_f64(acc[r][0], a, b0);
+            acc[r][1] = vfmaq_f64(acc[r][1], a, b1);
+            acc[r][2] = vfmaq_f64(acc[r][2], a, b2);
+            acc[r][3] = vfmaq_f64(acc[r][3], a, b3);
         }
-        
-        std::vector<double> b = {
-            vectorB.Get(static_cast<uint32_t>(0)).As<Napi::Number>().DoubleValue(),
-            vectorB.Get(static_cast<uint32_t>(1)).As<Napi::Number>().DoubleValue(),
-            vectorB.Get(static_cast<uint32_t>(2)).As<Napi::Number>().DoubleValue()
-        };
-        
-        Napi::Array result = Napi::Array::New(env);
-        result.Set(static_cast<uint32_t>(0), Napi::Number::New(env, a[1] * b[2] - a[2] * b[1]));
-        result.Set(static_cast<uint32_t>(1), Napi::Number::New(env, a[2] * b[0] - a[0] * b[2]));
-        result.Set(static_cast<uint32_t>(2), Napi::Number::New(env, a[0] * b[1] - a[1] * b[0]));
-        
-        return result;
-    } else if (op == "magnitude") {
-        double sum = 0;
-        for (double val : a) {
-            sum += val * val;
+    }
+    for (size_t r = 0; r < kGemmMR; r++) {
+        for (size_t j = 0; j < 4; j++) {
+            double* dst = c + r * ldc + j * 2;
+            vst1q_f64(dst, vaddq_f64(vld1q_f64(dst), acc[r][j]));
         }
-        return Napi::Number::New(env, std::sqrt(sum));
-    } else if (op == "normalize") {
-        double magnitude = 0;
-        for (double val : a) {
-            magnitude += val * val;
+    }
+}
+
+static void GemmMicroNEONF32(size_t kc, const float* ap, const float* bp, float* c, size_t ldc) {
+    float32x4_t acc[kGemmMR][4];
+    for (size_t r = 0; r < kGemmMR; r++) {
+        for (size_t j = 0; j < 4; j++) {
+            acc[r][j] = vdupq_n_f32(0.0f);
         }
-        magnitude = std::sqrt(magnitude);
-        
-        if (magnitude == 0) {
-            Napi::Error::New(env, "Cannot normalize zero vector").ThrowAsJavaScriptException();
-            return env.Null();
+    }
+    for (size_t k = 0; k < kc; k++, ap += kGemmMR, bp += kGemmNR32) {
+        float32x4_t b0 = vld1q_f32(bp), b1 = vld1q_f32(bp + 4);
+        float32x4_t b2 = vld1q_f32(bp + 8), b3 = vld1q_f32(bp + 12);
+        for (size_t r = 0; r < kGemmMR; r++) {
+            float32x4_t a = vdupq_n_f32(ap[r]);
+            acc[r][0] = vfmaq_f32(acc[r][0], a, b0);
+            acc[r][1] = vfmaq_f32(acc[r][1], a, b1);
+            acc[r][2] = vfmaq_f32(acc[r][2], a, b2);
+            acc[r][3] = vfmaq_f32(acc[r][3], a, b3);
         }
-        
-        Napi::Array result = Napi::Array::New(env);
-        for (size_t i = 0; i < a.size(); i++) {
-            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, a[i] / magnitude));
+    }
+    for (size_t r = 0; r < kGemmMR; r++) {
+        for (size_t j = 0; j < 4; j++) {
+            float* dst = c + r * ldc + j * 4;
+            vst1q_f32(dst, vaddq_f32(vld1q_f32(dst), acc[r][j]));
         }
-        
-        return result;
     }
-    
-    Napi::TypeError::New(env, "Unknown vector operation").ThrowAsJavaScriptException();
-    return env.Null();
 }
+#endif // LLJS_ARCH_ARM64
 
-/**
- * High-performance matrix operations
- * @param info - CallbackInfo containing operation configuration
- * @returns Operation result
- */
-Napi::Value MatrixOperations(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    
-    if (info.Length() < 1 || !info[0].IsObject()) {
-        Napi::TypeError::New(env, "Operation object required").ThrowAsJavaScriptException();
-        return env.Null();
+// xoshiro256++ lane kernels: eight independent generators stepped together,
+// state word w of lane l stored at s[w][l]. Output i*8+l comes from lane l at
+// step i, so every ISA produces the same stream.
+static constexpr size_t kRandomLanes = 8;
+
+struct RandomLanes {
+    alignas(64) uint64_t s[4][kRandomLanes];
+};
+
+static inline uint64_t RotateLeft64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static void RandomBitsScalar(RandomLanes& state, uint64_t* out, size_t steps) {
+    for (size_t i = 0; i < steps; i++, out += kRandomLanes) {
+        for (size_t l = 0; l < kRandomLanes; l++) {
+            uint64_t s0 = state.s[0][l], s1 = state.s[1][l], s2 = state.s[2][l], s3 = state.s[3][l];
+            out[l] = RotateLeft64(s0 + s3, 23) + s0;
+            uint64_t t = s1 << 17;
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            state.s[0][l] = s0;
+            state.s[1][l] = s1;
+            state.s[2][l] = s2;
+            state.s[3][l] = RotateLeft64(s3, 45);
+        }
     }
-    
-    Napi::Object operation = info[0].As<Napi::Object>();
-    std::string op = operation.Get("operation").As<Napi::String>();
-    Napi::Array matrixArray = operation.Get("matrix").As<Napi::Array>();
-    
-    // Convert JavaScript matrix to C++ vector
-    std::vector<std::vector<double>> matrix;
-    for (uint32_t i = 0; i < matrixArray.Length(); i++) {
-        Napi::Array row = matrixArray.Get(i).As<Napi::Array>();
-        std::vector<double> matrixRow;
-        for (uint32_t j = 0; j < row.Length(); j++) {
-            matrixRow.push_back(row.Get(j).As<Napi::Number>().DoubleValue());
+}
+
+#ifdef LLJS_ARCH_X86
+LLJS_TARGET_SSE2
+static void RandomBitsSSE2(RandomLanes& state, uint64_t* out, size_t steps) {
+    for (size_t half = 0; half < kRandomLanes; half += 2) {
+        __m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(state.s[0] + half));
+        __m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(state.s[1] + half));
+        __m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(state.s[2] + half));
+        __m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(state.s[3] + half));
+        for (size_t i = 0; i < steps; i++) {
+            __m128i sum = _mm_add_epi64(s0, s3);
+            __m128i rotated = _mm_or_si128(_mm_slli_epi64(sum, 23), _mm_srli_epi64(sum, 41));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * kRandomLanes + half), _mm_add_epi64(rotated, s0));
+            __m128i t = _mm_slli_epi64(s1, 17);
+            s2 = _mm_xor_si128(s2, s0);
+            s3 = _mm_xor_si128(s3, s1);
+            s1 = _mm_xor_si128(s1, s2);
+            s0 = _mm_xor_si128(s0, s3);
+            s2 = _mm_xor_si128(s2, t);
+            s3 = _mm_or_si128(_mm_slli_epi64(s3, 45), _mm_srli_epi64(s3, 19));
         }
-        matrix.push_back(matrixRow);
+        _mm_store_si128(reinterpret_cast<__m128i*>(state.s[0] + half), s0);
+        _mm_store_si128(reinterpret_cast<__m128i*>(state.s[1] + half), s1);
+        _mm_store_si128(reinterpret_cast<__m128i*>(state.s[2] + half), s2);
+        _mm_store_si128(reinterpret_cast<__m128i*>(state.s[3] + half), s3);
     }
-    
-    if (op == "transpose") {
-        size_t rows = matrix.size();
-        size_t cols = rows > 0 ? matrix[0].size() : 0;
+}
+
+LLJS_TARGET_AVX2
+static void RandomBitsAVX2(RandomLanes& state, uint64_t* out, size_t steps) {
+    for (size_t half = 0; half < kRandomLanes; half += 4) {
+        __m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state.s[0] + half));
+        __m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state.s[1] + half));
+        __m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state.s[2] + half));
+        __m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state.s[3] + half));
+        for (size_t i = 0; i < steps; i++) {
+            __m256i sum = _mm256_add_epi64(s0, s3);
+            __m256i rotated = _mm256_or_si256(_mm256_slli_epi64(sum, 23), _mm256_srli_epi64(sum, 41));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * kRandomLanes + half), _mm256_add_epi64(rotated, s0));
+            __m256i t = _mm256_slli_epi64(s1, 17);
+            s2 = _mm256_xor_si256(s2, s0);
+            s3 = _mm256_xor_si256(s3, s1);
+            s1 = _mm256_xor_si256(s1, s2);
+            s0 = _mm256_xor_si256(s0, s3);
+            s2 = _mm256_xor_si256(s2, t);
+            s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+        }
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state.s[0] + half), s0);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state.s[1] + half), s1);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state.s[2] + half), s2);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state.s[3] + half), s3);
+    }
+}
+
+LLJS_TARGET_AVX512
+static void RandomBitsAVX512(RandomLanes& state, uint64_t* out, size_t steps) {
+    __m512i s0 = _mm512_load_si512(state.s[0]);
+    __m512i s1 = _mm512_load_si512(state.s[1]);
+    __m512i s2 = _mm512_load_si512(state.s[2]);
+    __m512i s3 = _mm512_load_si512(state.s[3]);
+    for (size_t i = 0; i < steps; i++) {
+        __m512i result = _mm512_add_epi64(_mm512_rol_epi64(_mm512_add_epi64(s0, s3), 23), s0);
+        _mm512_storeu_si512(out + i * kRandomLanes, result);
+        __m512i t = _mm512_slli_epi64(s1, 17);
+        s2 = _mm512_xor_si512(s2, s0);
+        s3 = _mm512_xor_si512(s3, s1);
+        s1 = _mm512_xor_si512(s1, s2);
+        s0 = _mm512_xor_si512(s0, s3);
+        s2 = _mm512_xor_si512(s2, t);
+        s3 = _mm512_rol_epi64(s3, 45);
+    }
+    _mm512_store_si512(state.s[0], s0);
+    _mm512_store_si512(state.s[1], s1);
+    _mm512_store_si512(state.s[2], s2);
+    _mm512_store_si512(state.s[3], s3);
+}
+#endif // LLJS_ARCH_X86
+
+#ifdef LLJS_ARCH_ARM64
+static void RandomBitsNEON(RandomLanes& state, uint64_t* out, size_t steps) {
+    for (size_t half = 0; half < kRandomLanes; half += 2) {
+        uint64x2_t s0 = vld1q_u64(state.s[0] + half), s1 = vld1q_u64(state.s[1] + half);
+        uint64x2_t s2 = vld1q_u64(state.s[2] + half), s3 = vld1q_u64(state.s[3] + half);
+        for (size_t i = 0; i < steps; i++) {
+            uint64x2_t sum = vaddq_u64(s0, s3);
+            uint64x2_t rotated = vorrq_u64(vshlq_n_u64(sum, 23), vshrq_n_u64(sum, 41));
+            vst1q_u64(out + i * kRandomLanes + half, vaddq_u64(rotated, s0));
+            uint64x2_t t = vshlq_n_u64(s1, 17);
+            s2 = veorq_u64(s2, s0);
+            s3 = veorq_u64(s3, s1);
+            s1 = veorq_u64(s1, s2);
+            s0 = veorq_u64(s0, s3);
+            s2 = veorq_u64(s2, t);
+            s3 = vorrq_u64(vshlq_n_u64(s3, 45), vshrq_n_u64(s3, 19));
+        }
+        vst1q_u64(state.s[0] + half, s0);
+        vst1q_u64(state.s[1] + half, s1);
+        vst1q_u64(state.s[2] + half, s2);
+        vst1q_u64(state.s[3] + half, s3);
+    }
+}
+#endif // LLJS_ARCH_ARM64
+
+// Vector kernels for the ISA selected at module initialization
+struct VectorKernels {
+    void (*binaryF64)(VectorOp, const double*, const double*, double*, size_t);
+    void (*binaryF32)(VectorOp, const float*, const float*, float*, size_t);
+    double (*dotF64)(const double*, const double*, size_t);
+    double (*dotF32)(const float*, const float*, size_t);
+    void (*gemmF64)(size_t, const double*, const double*, double*, size_t);
+    void (*gemmF32)(size_t, const float*, const float*, float*, size_t);
+    void (*randomBits)(RandomLanes&, uint64_t*, size_t);
+};
+
+static VectorKernels vectorKernels = { BinaryScalarF64, BinaryScalarF32, DotScalarF64, DotScalarF32,
+                                       GemmMicroScalarF64, GemmMicroScalarF32, RandomBitsScalar };
+
+/**
+ * Selects the math kernels for the detected ISA
+ * @param isa - ISA level from CPU::DetectISA
+ */
+void InitKernels(SIMD::ISA isa) {
+    switch (isa) {
+#ifdef LLJS_ARCH_X86
+        case SIMD::ISA::AVX512:
+            vectorKernels = { BinaryAVX512F64, BinaryAVX512F32, DotAVX512F64, DotAVX512F32,
+                              GemmMicroAVX512F64, GemmMicroAVX512F32, RandomBitsAVX512 };
+            break;
+        case SIMD::ISA::AVX2:
+            vectorKernels = { BinaryAVX2F64, BinaryAVX2F32, DotAVX2F64, DotAVX2F32,
+                              GemmMicroAVX2F64, GemmMicroAVX2F32, RandomBitsAVX2 };
+            break;
+        case SIMD::ISA::SSE2:
+            vectorKernels = { BinarySSE2F64, BinarySSE2F32, DotSSE2F64, DotSSE2F32,
+                              GemmMicroSSE2F64, GemmMicroSSE2F32, RandomBitsSSE2 };
+            break;
+#endif
+#ifdef LLJS_ARCH_ARM64
+        case SIMD::ISA::NEON:
+            vectorKernels = { BinaryNEONF64, BinaryNEONF32, DotNEONF64, DotNEONF32,
+                              GemmMicroNEONF64, GemmMicroNEONF32, RandomBitsNEON };
+            break;
+#endif
+        default:
+            vectorKernels = { BinaryScalarF64, BinaryScalarF32, DotScalarF64, DotScalarF32,
+                              GemmMicroScalarF64, GemmMicroScalarF32, RandomBitsScalar };
+            break;
+    }
+}
+
+static inline void VectorBinaryKernel(VectorOp op, const double* a, const double* b, double* out, size_t n) {
+    vectorKernels.binaryF64(op, a, b, out, n);
+}
+
+static inline void VectorBinaryKernel(VectorOp op, const float* a, const float* b, float* out, size_t n) {
+    vectorKernels.binaryF32(op, a, b, out, n);
+}
+
+static inline double VectorDotKernel(const double* a, const double* b, size_t n) {
+    return vectorKernels.dotF64(a, b, n);
+}
+
+static inline double VectorDotKernel(const float* a, const float* b, size_t n) {
+    return vectorKernels.dotF32(a, b, n);
+}
+
+static inline void GemmMicroKernel(size_t kc, const double* ap, const double* bp, double* c, size_t ldc) {
+    vectorKernels.gemmF64(kc, ap, bp, c, ldc);
+}
+
+static inline void GemmMicroKernel(size_t kc, const float* ap, const float* bp, float* c, size_t ldc) {
+    vectorKernels.gemmF32(kc, ap, bp, c, ldc);
+}
+
+static inline void RandomBitsKernel(RandomLanes& state, uint64_t* out, size_t steps) {
+    vectorKernels.randomBits(state, out, steps);
+}
+
+/**
+ * Dot product with the dispatched kernel; safe to call from any thread
+ * @param a - First operand
+ * @param b - Second operand
+ * @param length - Element count
+ * @returns Dot product (accumulated in double)
+ */
+double DotProduct(const double* a, const double* b, size_t length) {
+    return VectorDotKernel(a, b, length);
+}
+
+double DotProduct(const float* a, const float* b, size_t length) {
+    return VectorDotKernel(a, b, length);
+}
+
+/**
+ * Element sum with independent accumulators; safe to call from any thread
+ * @param data - Elements
+ * @param length - Element count
+ * @returns Sum (accumulated in double)
+ */
+template <typename T>
+static double SumKernel(const T* data, size_t length) {
+    double sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        sums[0] += data[i];
+        sums[1] += data[i + 1];
+        sums[2] += data[i + 2];
+        sums[3] += data[i + 3];
+    }
+    for (; i < length; i++) {
+        sums[0] += data[i];
+    }
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+double SumElements(const double* data, size_t length) {
+    return SumKernel(data, length);
+}
+
+double SumElements(const float* data, size_t length) {
+    return SumKernel(data, length);
+}
+
+/**
+ * Vector operations directly on Float64Array/Float32Array backing stores
+ * @param env - N-API environment
+ * @param op - Operation name
+ * @param operation - Operation object (a, optional b, optional out)
+ * @returns Result TypedArray (out when supplied) or scalar
+ */
+template <typename T>
+static Napi::Value TypedVectorOperations(Napi::Env env, const std::string& op, const Napi::Object& operation) {
+    Napi::TypedArray typedA = operation.Get("a").As<Napi::TypedArray>();
+    napi_typedarray_type arrayType = typedA.TypedArrayType();
+    const T* a = typedA.As<Napi::TypedArrayOf<T>>().Data();
+    size_t sizeA = typedA.ElementLength();
+    
+    const T* b = nullptr;
+    size_t sizeB = 0;
+    bool hasB = operation.Has("b");
+    if (hasB) {
+        Napi::Value valueB = operation.Get("b");
+        if (!valueB.IsTypedArray() || valueB.As<Napi::TypedArray>().TypedArrayType() != arrayType) {
+            Napi::TypeError::New(env, "Vector b must be a TypedArray of the same type as a").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        b = valueB.As<Napi::TypedArrayOf<T>>().Data();
+        sizeB = valueB.As<Napi::TypedArray>().ElementLength();
+    }
+    
+    // Resolves the destination: the caller's out array when given, otherwise a fresh one
+    auto resolveOutput = [&](size_t length, T*& data) -> Napi::Value {
+        if (operation.Has("out") && !operation.Get("out").IsUndefined()) {
+            Napi::Value valueOut = operation.Get("out");
+            if (!valueOut.IsTypedArray() || valueOut.As<Napi::TypedArray>().TypedArrayType() != arrayType) {
+                Napi::TypeError::New(env, "Output must be a TypedArray of the same type as a").ThrowAsJavaScriptException();
+                return Napi::Value();
+            }
+            if (valueOut.As<Napi::TypedArray>().ElementLength() < length) {
+                Napi::RangeError::New(env, "Output TypedArray is too small").ThrowAsJavaScriptException();
+                return Napi::Value();
+            }
+            data = valueOut.As<Napi::TypedArrayOf<T>>().Data();
+            return valueOut;
+        }
+        Napi::TypedArrayOf<T> result = Napi::TypedArrayOf<T>::New(env, length, arrayType);
+        data = result.Data();
+        return result;
+    };
+    
+    VectorOp binaryOp;
+    if (ParseVectorOp(op, binaryOp)) {
+        if (!hasB) {
+            Napi::TypeError::New(env, "Vector b required for binary operations").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        size_t minSize = std::min(sizeA, sizeB);
+        T* out = nullptr;
+        Napi::Value result = resolveOutput(minSize, out);
+        if (result.IsEmpty()) {
+            return env.Null();
+        }
+        
+        VectorBinaryKernel(binaryOp, a, b, out, minSize);
+        return result;
+    } else if (op == "dot") {
+        if (!hasB) {
+            Napi::TypeError::New(env, "Vector b required for dot product").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        return Napi::Number::New(env, VectorDotKernel(a, b, std::min(sizeA, sizeB)));
+    } else if (op == "cross") {
+        if (!b || sizeA != 3 || sizeB != 3) {
+            Napi::TypeError::New(env, "Cross product requires two 3D vectors").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        // Compute before writing so out may alias a or b
+        T x = a[1] * b[2] - a[2] * b[1];
+        T y = a[2] * b[0] - a[0] * b[2];
+        T z = a[0] * b[1] - a[1] * b[0];
+        
+        T* out = nullptr;
+        Napi::Value result = resolveOutput(3, out);
+        if (result.IsEmpty()) {
+            return env.Null();
+        }
+        
+        out[0] = x;
+        out[1] = y;
+        out[2] = z;
+        return result;
+    } else if (op == "magnitude") {
+        return Napi::Number::New(env, std::sqrt(VectorDotKernel(a, a, sizeA)));
+    } else if (op == "normalize") {
+        double magnitude = std::sqrt(VectorDotKernel(a, a, sizeA));
+        
+        if (magnitude == 0) {
+            Napi::Error::New(env, "Cannot normalize zero vector").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        T* out = nullptr;
+        Napi::Value result = resolveOutput(sizeA, out);
+        if (result.IsEmpty()) {
+            return env.Null();
+        }
+        
+        for (size_t i = 0; i < sizeA; i++) {
+            out[i] = static_cast<T>(a[i] / magnitude);
+        }
+        return result;
+    }
+    
+    Napi::TypeError::New(env, "Unknown vector operation").ThrowAsJavaScriptException();
+    return env.Null();
+}
+
+/**
+ * SIMD-accelerated vector operations
+ * @param info - CallbackInfo containing operation configuration
+ * @returns Operation result
+ */
+Napi::Value VectorOperations(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Operation object required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object operation = info[0].As<Napi::Object>();
+    std::string op = operation.Get("operation").As<Napi::String>();
+    Napi::Value valueA = operation.Get("a");
+    
+    // Zero-copy path: operate straight on the TypedArray backing store
+    if (valueA.IsTypedArray()) {
+        napi_typedarray_type arrayType = valueA.As<Napi::TypedArray>().TypedArrayType();
+        if (arrayType == napi_float64_array) {
+            return TypedVectorOperations<double>(env, op, operation);
+        } else if (arrayType == napi_float32_array) {
+            return TypedVectorOperations<float>(env, op, operation);
+        }
+        Napi::TypeError::New(env, "Only Float64Array and Float32Array are supported").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Array vectorA = valueA.As<Napi::Array>();
+    
+    std::vector<double> a;
+    a.reserve(vectorA.Length());
+    for (uint32_t i = 0; i < vectorA.Length(); i++) {
+        a.push_back(vectorA.Get(i).As<Napi::Number>().DoubleValue());
+    }
+    
+    VectorOp binaryOp;
+    if (ParseVectorOp(op, binaryOp)) {
+        if (!operation.Has("b")) {
+            Napi::TypeError::New(env, "Vector b required for binary operations").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        Napi::Array vectorB = operation.Get("b").As<Napi::Array>();
+        std::vector<double> b;
+        b.reserve(vectorB.Length());
+        for (uint32_t i = 0; i < vectorB.Length(); i++) {
+            b.push_back(vectorB.Get(i).As<Napi::Number>().DoubleValue());
+        }
+        
+        size_t minSize = std::min(a.size(), b.size());
+        std::vector<double> values(minSize);
+        VectorBinaryKernel(binaryOp, a.data(), b.data(), values.data(), minSize);
+        
+        Napi::Array result = Napi::Array::New(env, minSize);
+        for (size_t i = 0; i < minSize; i++) {
+            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, values[i]));
+        }
+        
+        return result;
+    } else if (op == "dot") {
+        if (!operation.Has("b")) {
+            Napi::TypeError::New(env, "Vector b required for dot product").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        Napi::Array vectorB = operation.Get("b").As<Napi::Array>();
+        std::vector<double> b;
+        b.reserve(vectorB.Length());
+        for (uint32_t i = 0; i < vectorB.Length(); i++) {
+            b.push_back(vectorB.Get(i).As<Napi::Number>().DoubleValue());
+        }
+        
+        return Napi::Number::New(env, VectorDotKernel(a.data(), b.data(), std::min(a.size(), b.size())));
+    } else if (op == "cross") {
+        if (!operation.Has("b") || a.size() != 3) {
+            Napi::TypeError::New(env, "Cross product requires two 3D vectors").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        Napi::Array vectorB = operation.Get("b").As<Napi::Array>();
+        if (vectorB.Length() != 3) {
+            Napi::TypeError::New(env, "Cross product requires two 3D vectors").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        std::vector<double> b = {
+            vectorB.Get(static_cast<uint32_t>(0)).As<Napi::Number>().DoubleValue(),
+            vectorB.Get(static_cast<uint32_t>(1)).As<Napi::Number>().DoubleValue(),
+            vectorB.Get(static_cast<uint32_t>(2)).As<Napi::Number>().DoubleValue()
+        };
+        
+        Napi::Array result = Napi::Array::New(env);
+        result.Set(static_cast<uint32_t>(0), Napi::Number::New(env, a[1] * b[2] - a[2] * b[1]));
+        result.Set(static_cast<uint32_t>(1), Napi::Number::New(env, a[2] * b[0] - a[0] * b[2]));
+        result.Set(static_cast<uint32_t>(2), Napi::Number::New(env, a[0] * b[1] - a[1] * b[0]));
+        
+        return result;
+    } else if (op == "magnitude") {
+        double sum = 0;
+        for (double val : a) {
+            sum += val * val;
+        }
+        return Napi::Number::New(env, std::sqrt(sum));
+    } else if (op == "normalize") {
+        double magnitude = 0;
+        for (double val : a) {
+            magnitude += val * val;
+        }
+        magnitude = std::sqrt(magnitude);
+        
+        if (magnitude == 0) {
+            Napi::Error::New(env, "Cannot normalize zero vector").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        Napi::Array result = Napi::Array::New(env);
+        for (size_t i = 0; i < a.size(); i++) {
+            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, a[i] / magnitude));
+        }
+        
+        return result;
+    }
+    
+    Napi::TypeError::New(env, "Unknown vector operation").ThrowAsJavaScriptException();
+    return env.Null();
+}
+
+// Flat row-major matrix over a Float64Array/Float32Array; stride is in elements
+template <typename T>
+struct MatrixView {
+    T* data;
+    size_t rows;
+    size_t cols;
+    size_t stride;
+};
+
+// GEMM blocking: MC x KC blocks of A stay in L2, KC x NR strips of B in L1
+static constexpr size_t kGemmMC = 64;
+static constexpr size_t kGemmKC = 256;
+static constexpr size_t kGemmNC = 2048;
+
+template <typename T> struct GemmTraits;
+template <> struct GemmTraits<double> { static constexpr size_t NR = kGemmNR64; };
+template <> struct GemmTraits<float> { static constexpr size_t NR = kGemmNR32; };
+
+/**
+ * Computes C = A * B with packed panels, SIMD micro-kernels and the worker pool
+ * @param a - M x K input
+ * @param b - K x N input
+ * @param c - M x N output; must not overlap a or b
+ */
+template <typename T>
+static void GemmBlocked(const MatrixView<T>& a, const MatrixView<T>& b, const MatrixView<T>& c) {
+    constexpr size_t MR = kGemmMR;
+    constexpr size_t NR = GemmTraits<T>::NR;
+    const size_t M = a.rows, N = b.cols, K = a.cols;
+    
+    for (size_t i = 0; i < M; i++) {
+        std::fill(c.data + i * c.stride, c.data + i * c.stride + N, T(0));
+    }
+    if (M == 0 || N == 0 || K == 0) {
+        return;
+    }
+    
+    Threading::WorkerPool& pool = Threading::WorkerPool::Instance();
+    std::vector<T> packedB(kGemmKC * ((std::min(kGemmNC, N) + NR - 1) / NR) * NR);
+    
+    for (size_t jc = 0; jc < N; jc += kGemmNC) {
+        const size_t nc = std::min(kGemmNC, N - jc);
+        const size_t strips = (nc + NR - 1) / NR;
+        
+        for (size_t pc = 0; pc < K; pc += kGemmKC) {
+            const size_t kc = std::min(kGemmKC, K - pc);
+            
+            // Pack B[pc.., jc..] into zero-padded NR-wide strips
+            pool.ParallelFor(strips, [&](size_t s) {
+                T* dst = packedB.data() + s * kc * NR;
+                size_t col0 = jc + s * NR;
+                size_t width = std::min(NR, N - col0);
+                for (size_t k = 0; k < kc; k++) {
+                    const T* src = b.data + (pc + k) * b.stride + col0;
+                    size_t j = 0;
+                    for (; j < width; j++) dst[k * NR + j] = src[j];
+                    for (; j < NR; j++) dst[k * NR + j] = T(0);
+                }
+            });
+            
+            // Tasks are (row block, strip group) pairs so short, wide products still spread out
+            const size_t rowBlocks = (M + kGemmMC - 1) / kGemmMC;
+            const size_t wantTasks = pool.Size() * 2;
+            const size_t groups = std::max<size_t>(1, std::min(strips, (wantTasks + rowBlocks - 1) / rowBlocks));
+            const size_t stripsPerGroup = (strips + groups - 1) / groups;
+            
+            pool.ParallelFor(rowBlocks * groups, [&](size_t task) {
+                const size_t ic = (task / groups) * kGemmMC;
+                const size_t mc = std::min(kGemmMC, M - ic);
+                const size_t s0 = (task % groups) * stripsPerGroup;
+                const size_t s1 = std::min(strips, s0 + stripsPerGroup);
+                if (s0 >= s1) {
+                    return;
+                }
+                
+                // Pack A[ic.., pc..] into zero-padded MR-tall strips
+                static thread_local std::vector<T> packedA;
+                packedA.resize(kGemmMC * kGemmKC);
+                for (size_t r0 = 0; r0 < mc; r0 += MR) {
+                    T* dst = packedA.data() + r0 * kc;
+                    for (size_t r = 0; r < MR; r++) {
+                        if (r0 + r < mc) {
+                            const T* src = a.data + (ic + r0 + r) * a.stride + pc;
+                            for (size_t k = 0; k < kc; k++) dst[k * MR + r] = src[k];
+                        } else {
+                            for (size_t k = 0; k < kc; k++) dst[k * MR + r] = T(0);
+                        }
+                    }
+                }
+                
+                for (size_t s = s0; s < s1; s++) {
+                    const T* bp = packedB.data() + s * kc * NR;
+                    const size_t col0 = jc + s * NR;
+                    const size_t width = std::min(NR, N - col0);
+                    for (size_t r0 = 0; r0 < mc; r0 += MR) {
+                        const T* ap = packedA.data() + r0 * kc;
+                        const size_t height = std::min(MR, mc - r0);
+                        T* tile = c.data + (ic + r0) * c.stride + col0;
+                        if (height == MR && width == NR) {
+                            GemmMicroKernel(kc, ap, bp, tile, c.stride);
+                        } else {
+                            T edge[MR * NR] = {};
+                            GemmMicroKernel(kc, ap, bp, edge, NR);
+                            for (size_t r = 0; r < height; r++) {
+                                for (size_t j = 0; j < width; j++) {
+                                    tile[r * c.stride + j] += edge[r * NR + j];
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+        }
+    }
+}
+
+/**
+ * In-place LU factorization with partial pivoting (PA = LU, unit L below the diagonal)
+ * @param lu - n x n row-major matrix, overwritten with L and U
+ * @param n - Order
+ * @param perm - Receives the row permutation
+ * @param sign - Receives the permutation parity (+1 or -1)
+ * @returns False if the matrix is numerically singular
+ */
+static bool LUDecompose(std::vector<double>& lu, size_t n, std::vector<size_t>& perm, int& sign) {
+    perm.resize(n);
+    std::iota(perm.begin(), perm.end(), size_t(0));
+    sign = 1;
+    
+    double scale = 0.0;
+    for (double v : lu) {
+        scale = std::max(scale, std::abs(v));
+    }
+    const double tolerance = scale * static_cast<double>(n) * std::numeric_limits<double>::epsilon();
+    Threading::WorkerPool& pool = Threading::WorkerPool::Instance();
+    
+    for (size_t i = 0; i < n; i++) {
+        size_t pivot = i;
+        for (size_t k = i + 1; k < n; k++) {
+            if (std::abs(lu[k * n + i]) > std::abs(lu[pivot * n + i])) {
+                pivot = k;
+            }
+        }
+        if (!(std::abs(lu[pivot * n + i]) > tolerance)) {
+            return false;
+        }
+        if (pivot != i) {
+            std::swap_ranges(lu.begin() + i * n, lu.begin() + (i + 1) * n, lu.begin() + pivot * n);
+            std::swap(perm[i], perm[pivot]);
+            sign = -sign;
+        }
+        
+        const double* pivotRow = lu.data() + i * n;
+        const double inverse = 1.0 / pivotRow[i];
+        auto eliminate = [&](size_t k) {
+            double* row = lu.data() + k * n;
+            double factor = row[i] * inverse;
+            row[i] = factor;
+            for (size_t j = i + 1; j < n; j++) {
+                row[j] -= factor * pivotRow[j];
+            }
+        };
+        
+        // Rows of the trailing update are independent; split large ones across the pool
+        const size_t remaining = n - i - 1;
+        if (remaining * remaining >= (1u << 16) && pool.Size() > 1) {
+            const size_t chunks = std::min(remaining, pool.Size() * 4);
+            pool.ParallelFor(chunks, [&](size_t chunk) {
+                size_t begin = i + 1 + remaining * chunk / chunks;
+                size_t end = i + 1 + remaining * (chunk + 1) / chunks;
+                for (size_t k = begin; k < end; k++) eliminate(k);
+            });
+        } else {
+            for (size_t k = i + 1; k < n; k++) eliminate(k);
+        }
+    }
+    return true;
+}
+
+/**
+ * Solves LU X = P B for all right-hand sides at once
+ * @param lu - Factorization from LUDecompose
+ * @param perm - Row permutation from LUDecompose
+ * @param n - Order
+ * @param x - n x width row-major right-hand sides in original order; overwritten with X
+ * @param width - Number of right-hand sides
+ */
+static void LUSolveInPlace(const std::vector<double>& lu, const std::vector<size_t>& perm, size_t n,
+                           std::vector<double>& x, size_t width) {
+    std::vector<double> permuted(x.size());
+    for (size_t i = 0; i < n; i++) {
+        std::copy(x.begin() + perm[i] * width, x.begin() + (perm[i] + 1) * width, permuted.begin() + i * width);
+    }
+    x.swap(permuted);
+    
+    // Columns are independent; each chunk runs both substitutions on its own slice
+    constexpr size_t kColumnChunk = 64;
+    const size_t chunks = (width + kColumnChunk - 1) / kColumnChunk;
+    auto substitute = [&](size_t chunk) {
+        const size_t c0 = chunk * kColumnChunk;
+        const size_t c1 = std::min(width, c0 + kColumnChunk);
+        for (size_t i = 0; i < n; i++) {
+            double* xi = x.data() + i * width;
+            for (size_t j = 0; j < i; j++) {
+                const double l = lu[i * n + j];
+                const double* xj = x.data() + j * width;
+                for (size_t c = c0; c < c1; c++) xi[c] -= l * xj[c];
+            }
+        }
+        for (size_t i = n; i-- > 0;) {
+            double* xi = x.data() + i * width;
+            for (size_t j = i + 1; j < n; j++) {
+                const double u = lu[i * n + j];
+                const double* xj = x.data() + j * width;
+                for (size_t c = c0; c < c1; c++) xi[c] -= u * xj[c];
+            }
+            const double inverse = 1.0 / lu[i * n + i];
+            for (size_t c = c0; c < c1; c++) xi[c] *= inverse;
+        }
+    };
+    if (chunks > 1 && n * n * width >= (1u << 20)) {
+        Threading::WorkerPool::Instance().ParallelFor(chunks, substitute);
+    } else {
+        for (size_t chunk = 0; chunk < chunks; chunk++) substitute(chunk);
+    }
+}
+
+/**
+ * Reads a flat matrix descriptor { data, rows, cols, stride? }; throws on failure
+ * @param env - N-API environment
+ * @param value - Descriptor
+ * @param arrayType - Required element type
+ * @param name - Operand name for error messages
+ * @param view - Receives the matrix view
+ * @returns True when the descriptor is valid
+ */
+template <typename T>
+static bool ToMatrixView(Napi::Env env, const Napi::Value& value, napi_typedarray_type arrayType,
+                         const char* name, MatrixView<T>& view) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, std::string(name) + " must be a matrix { data, rows, cols }").ThrowAsJavaScriptException();
+        return false;
+    }
+    Napi::Object matrix = value.As<Napi::Object>();
+    Napi::Value data = matrix.Get("data");
+    if (!data.IsTypedArray() || data.As<Napi::TypedArray>().TypedArrayType() != arrayType) {
+        Napi::TypeError::New(env, std::string(name) + " data must be a TypedArray of the same type as matrix").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    auto dimension = [&](const char* key, double fallback, double& out) {
+        Napi::Value field = matrix.Get(key);
+        out = field.IsNumber() ? field.As<Napi::Number>().DoubleValue() : fallback;
+        return out >= 0 && out == std::floor(out) && out <= 9007199254740991.0;
+    };
+    double rows, cols, stride;
+    if (!dimension("rows", -1, rows) || !dimension("cols", -1, cols) || !dimension("stride", cols, stride) || stride < cols) {
+        Napi::RangeError::New(env, std::string(name) + " needs integer rows and cols, and stride >= cols").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    size_t length = data.As<Napi::TypedArray>().ElementLength();
+    double required = rows == 0 || cols == 0 ? 0 : (rows - 1) * stride + cols;
+    if (required > static_cast<double>(length)) {
+        Napi::RangeError::New(env, std::string(name) + " data is too small for its shape").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    view = { data.As<Napi::TypedArrayOf<T>>().Data(), static_cast<size_t>(rows), static_cast<size_t>(cols), static_cast<size_t>(stride) };
+    return true;
+}
+
+/**
+ * Resolves the destination matrix: operation.out when given, else a new dense matrix
+ * @param env - N-API environment
+ * @param operation - Operation object
+ * @param arrayType - Element type
+ * @param rows - Result rows
+ * @param cols - Result columns
+ * @param view - Receives the destination view
+ * @returns Matrix descriptor object, or null with an exception pending
+ */
+template <typename T>
+static Napi::Value MatrixResult(Napi::Env env, const Napi::Object& operation, napi_typedarray_type arrayType,
+                                size_t rows, size_t cols, MatrixView<T>& view) {
+    if (operation.Has("out") && !operation.Get("out").IsUndefined()) {
+        Napi::Value out = operation.Get("out");
+        if (!ToMatrixView(env, out, arrayType, "out", view)) {
+            return env.Null();
+        }
+        if (view.rows != rows || view.cols != cols) {
+            Napi::RangeError::New(env, "Output matrix has the wrong shape").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        return out;
+    }
+    
+    Napi::TypedArrayOf<T> data = Napi::TypedArrayOf<T>::New(env, rows * cols, arrayType);
+    view = { data.Data(), rows, cols, cols };
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("data", data);
+    result.Set("rows", Napi::Number::New(env, static_cast<double>(rows)));
+    result.Set("cols", Napi::Number::New(env, static_cast<double>(cols)));
+    result.Set("stride", Napi::Number::New(env, static_cast<double>(cols)));
+    return result;
+}
+
+template <typename T>
+static bool MatricesOverlap(const MatrixView<T>& a, const MatrixView<T>& b) {
+    if (a.rows == 0 || a.cols == 0 || b.rows == 0 || b.cols == 0) {
+        return false;
+    }
+    const T* aEnd = a.data + (a.rows - 1) * a.stride + a.cols;
+    const T* bEnd = b.data + (b.rows - 1) * b.stride + b.cols;
+    return a.data < bEnd && b.data < aEnd;
+}
+
+template <typename T>
+static std::vector<double> DenseCopy(const MatrixView<T>& m) {
+    std::vector<double> dense(m.rows * m.cols);
+    for (size_t i = 0; i < m.rows; i++) {
+        std::copy(m.data + i * m.stride, m.data + i * m.stride + m.cols, dense.begin() + i * m.cols);
+    }
+    return dense;
+}
+
+/**
+ * Matrix operations on flat Float64Array/Float32Array storage
+ * @param env - N-API environment
+ * @param op - Operation name
+ * @param operation - Operation object (matrix, optional matrix2, optional out)
+ * @returns Result matrix descriptor (out when supplied) or determinant
+ */
+template <typename T>
+static Napi::Value TypedMatrixOperations(Napi::Env env, const std::string& op, const Napi::Object& operation) {
+    napi_typedarray_type arrayType = operation.Get("matrix").As<Napi::Object>().Get("data").As<Napi::TypedArray>().TypedArrayType();
+    MatrixView<T> a;
+    if (!ToMatrixView(env, operation.Get("matrix"), arrayType, "matrix", a)) {
+        return env.Null();
+    }
+    
+    if (op == "transpose") {
+        MatrixView<T> out;
+        Napi::Value result = MatrixResult(env, operation, arrayType, a.cols, a.rows, out);
+        if (env.IsExceptionPending()) {
+            return env.Null();
+        }
+        if (MatricesOverlap(a, out)) {
+            Napi::RangeError::New(env, "Output must not overlap the input").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        // 32 x 32 tiles keep both the reads and the writes cache-resident
+        constexpr size_t kTile = 32;
+        for (size_t i0 = 0; i0 < a.rows; i0 += kTile) {
+            for (size_t j0 = 0; j0 < a.cols; j0 += kTile) {
+                size_t i1 = std::min(a.rows, i0 + kTile), j1 = std::min(a.cols, j0 + kTile);
+                for (size_t i = i0; i < i1; i++) {
+                    for (size_t j = j0; j < j1; j++) {
+                        out.data[j * out.stride + i] = a.data[i * a.stride + j];
+                    }
+                }
+            }
+        }
+        return result;
+    }
+    
+    if (op == "multiply") {
+        MatrixView<T> b;
+        if (!ToMatrixView(env, operation.Get("matrix2"), arrayType, "matrix2", b)) {
+            return env.Null();
+        }
+        if (a.cols != b.rows) {
+            Napi::TypeError::New(env, "Matrix dimensions incompatible for multiplication").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        MatrixView<T> out;
+        Napi::Value result = MatrixResult(env, operation, arrayType, a.rows, b.cols, out);
+        if (env.IsExceptionPending()) {
+            return env.Null();
+        }
+        if (MatricesOverlap(a, out) || MatricesOverlap(b, out)) {
+            Napi::RangeError::New(env, "Output must not overlap the inputs").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        GemmBlocked(a, b, out);
+        return result;
+    }
+    
+    if (op != "determinant" && op != "inverse" && op != "solve") {
+        Napi::TypeError::New(env, "Unsupported matrix operation").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    size_t n = a.rows;
+    if (n == 0 || a.cols != n) {
+        Napi::TypeError::New(env, "Operation requires a square matrix").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // Factor in double precision whatever the storage type
+    std::vector<double> lu = DenseCopy(a);
+    std::vector<size_t> perm;
+    int sign;
+    bool regular = LUDecompose(lu, n, perm, sign);
+    
+    if (op == "determinant") {
+        if (!regular) {
+            return Napi::Number::New(env, 0.0);
+        }
+        double det = sign;
+        for (size_t i = 0; i < n; i++) {
+            det *= lu[i * n + i];
+        }
+        return Napi::Number::New(env, det);
+    }
+    
+    MatrixView<T> b{};
+    size_t width = n;
+    std::vector<double> x;
+    if (op == "solve") {
+        Napi::Value rhs = operation.Get("matrix2");
+        if (!ToMatrixView(env, rhs, arrayType, "matrix2", b)) {
+            return env.Null();
+        }
+        if (b.rows != n) {
+            Napi::TypeError::New(env, "Right-hand side must have as many rows as the matrix").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        width = b.cols;
+        x = DenseCopy(b);
+    } else {
+        x.assign(n * n, 0.0);
+        for (size_t i = 0; i < n; i++) {
+            x[i * n + i] = 1.0;
+        }
+    }
+    
+    if (!regular) {
+        Napi::Error::New(env, "Matrix is singular").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    MatrixView<T> out;
+    Napi::Value result = MatrixResult(env, operation, arrayType, n, width, out);
+    if (env.IsExceptionPending()) {
+        return env.Null();
+    }
+    
+    LUSolveInPlace(lu, perm, n, x, width);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < width; j++) {
+            out.data[i * out.stride + j] = static_cast<T>(x[i * width + j]);
+        }
+    }
+    return result;
+}
+
+/**
+ * High-performance matrix operations
+ * @param info - CallbackInfo containing operation configuration
+ * @returns Operation result
+ */
+Napi::Value MatrixOperations(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Operation object required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object operation = info[0].As<Napi::Object>();
+    std::string op = operation.Get("operation").As<Napi::String>();
+    Napi::Value matrixValue = operation.Get("matrix");
+    
+    // Flat path: { data, rows, cols, stride } over a Float64Array/Float32Array
+    if (matrixValue.IsObject() && !matrixValue.IsArray()) {
+        Napi::Value data = matrixValue.As<Napi::Object>().Get("data");
+        napi_typedarray_type arrayType = data.IsTypedArray() ? data.As<Napi::TypedArray>().TypedArrayType() : napi_int8_array;
+        if (arrayType == napi_float64_array) {
+            return TypedMatrixOperations<double>(env, op, operation);
+        } else if (arrayType == napi_float32_array) {
+            return TypedMatrixOperations<float>(env, op, operation);
+        }
+        Napi::TypeError::New(env, "Matrix data must be a Float64Array or Float32Array").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Array matrixArray = matrixValue.As<Napi::Array>();
+    
+    // Convert JavaScript matrix to C++ vector
+    std::vector<std::vector<double>> matrix;
+    for (uint32_t i = 0; i < matrixArray.Length(); i++) {
+        Napi::Array row = matrixArray.Get(i).As<Napi::Array>();
+        std::vector<double> matrixRow;
+        for (uint32_t j = 0; j < row.Length(); j++) {
+            matrixRow.push_back(row.Get(j).As<Napi::Number>().DoubleValue());
+        }
+        matrix.push_back(matrixRow);
+    }
+    
+    if (op == "transpose") {
+        size_t rows = matrix.size();
+        size_t cols = rows > 0 ? matrix[0].size() : 0;
         
         Napi::Array result = Napi::Array::New(env);
         for (size_t j = 0; j < cols; j++) {
@@ -408,171 +1792,924 @@ Napi::Value MatrixOperations(const Napi::CallbackInfo& info) {
                 if (std::abs(augmented[k][i]) > std::abs(augmented[maxRow][i])) {
                     maxRow = k;
                 }
-            }
-            
-            std::swap(augmented[i], augmented[maxRow]);
-            
-            if (std::abs(augmented[i][i]) < 1e-10) {
-                Napi::Error::New(env, "Matrix is singular").ThrowAsJavaScriptException();
-                return env.Null();
-            }
-            
-            // Scale pivot row
-            double pivot = augmented[i][i];
-            for (size_t j = 0; j < 2 * n; j++) {
-                augmented[i][j] /= pivot;
-            }
-            
-            // Eliminate column
-            for (size_t k = 0; k < n; k++) {
-                if (k != i) {
-                    double factor = augmented[k][i];
-                    for (size_t j = 0; j < 2 * n; j++) {
-                        augmented[k][j] -= factor * augmented[i][j];
+            }
+            
+            std::swap(augmented[i], augmented[maxRow]);
+            
+            if (std::abs(augmented[i][i]) < 1e-10) {
+                Napi::Error::New(env, "Matrix is singular").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+            
+            // Scale pivot row
+            double pivot = augmented[i][i];
+            for (size_t j = 0; j < 2 * n; j++) {
+                augmented[i][j] /= pivot;
+            }
+            
+            // Eliminate column
+            for (size_t k = 0; k < n; k++) {
+                if (k != i) {
+                    double factor = augmented[k][i];
+                    for (size_t j = 0; j < 2 * n; j++) {
+                        augmented[k][j] -= factor * augmented[i][j];
+                    }
+                }
+            }
+        }
+        
+        // Extract inverse matrix
+        Napi::Array result = Napi::Array::New(env);
+        for (size_t i = 0; i < n; i++) {
+            Napi::Array resultRow = Napi::Array::New(env);
+            for (size_t j = 0; j < n; j++) {
+                resultRow.Set(static_cast<uint32_t>(j), Napi::Number::New(env, augmented[i][j + n]));
+            }
+            result.Set(static_cast<uint32_t>(i), resultRow);
+        }
+        
+        return result;
+    }
+    
+    Napi::TypeError::New(env, "Unknown matrix operation").ThrowAsJavaScriptException();
+    return env.Null();
+}
+
+// Scalar operations addressable by opcode. The values are shared with
+// MathOpcode in index.ts and must not be renumbered.
+enum class MathOp : int32_t {
+    Sqrt = 0,
+    InvSqrt = 1,
+    Add = 2,
+    Subtract = 3,
+    Multiply = 4,
+    Divide = 5,
+    Min = 6,
+    Max = 7,
+    Abs = 8,
+    And = 16,
+    Or = 17,
+    Xor = 18,
+    Not = 19,
+    Shl = 20,
+    Shr = 21,
+    Rotl = 22,
+    Rotr = 23,
+    Popcount = 24,
+    Clz = 25,
+    Ctz = 26
+};
+
+/**
+ * Maps a bitwise operation name to its opcode
+ * @param op - Operation name
+ * @param out - Parsed opcode
+ * @returns False if the name is not a bitwise operation
+ */
+static bool ParseBitwiseOp(const std::string& op, MathOp& out) {
+    if (op == "and") out = MathOp::And;
+    else if (op == "or") out = MathOp::Or;
+    else if (op == "xor") out = MathOp::Xor;
+    else if (op == "not") out = MathOp::Not;
+    else if (op == "shl") out = MathOp::Shl;
+    else if (op == "shr") out = MathOp::Shr;
+    else if (op == "rotl") out = MathOp::Rotl;
+    else if (op == "rotr") out = MathOp::Rotr;
+    else if (op == "popcount") out = MathOp::Popcount;
+    else if (op == "clz") out = MathOp::Clz;
+    else if (op == "ctz") out = MathOp::Ctz;
+    else return false;
+    return true;
+}
+
+/**
+ * Converts a double the way Napi::Number::Uint32Value does (ECMAScript ToUint32)
+ */
+static inline uint64_t ToUint32(double value) {
+    if (!std::isfinite(value)) return 0;
+    double wrapped = std::fmod(std::trunc(value), 4294967296.0);
+    if (wrapped < 0) wrapped += 4294967296.0;
+    return static_cast<uint64_t>(wrapped);
+}
+
+/**
+ * Applies one bitwise operation; results stay within 32 bits
+ */
+static uint64_t ApplyBitwiseOp(MathOp op, uint64_t a, uint64_t b) {
+    constexpr uint64_t kMask = 0xFFFFFFFFull;
+    switch (op) {
+        case MathOp::And: return a & b;
+        case MathOp::Or: return a | b;
+        case MathOp::Xor: return a ^ b;
+        case MathOp::Not: return ~a & kMask;
+        case MathOp::Shl: return (a << (b & 31)) & kMask;
+        case MathOp::Shr: return a >> (b & 31);
+        case MathOp::Rotl: return ((a << (b & 31)) | (a >> ((32 - b) & 31))) & kMask;
+        case MathOp::Rotr: return ((a >> (b & 31)) | (a << ((32 - b) & 31))) & kMask;
+        case MathOp::Popcount: return __builtin_popcountll(a);
+        case MathOp::Clz: return a == 0 ? 32 : __builtin_clzll(a) - 32;
+        case MathOp::Ctz: return a == 0 ? 32 : __builtin_ctzll(a);
+        default: return 0;
+    }
+}
+
+/**
+ * Applies one scalar operation; bitwise opcodes take 32-bit unsigned operands
+ * like bitwiseOperations
+ * @param op - Opcode
+ * @param x - First operand
+ * @param y - Second operand (ignored by unary operations)
+ * @param result - Operation result
+ * @returns False for an unknown opcode
+ */
+static bool ApplyMathOp(int32_t op, double x, double y, double& result) {
+    switch (static_cast<MathOp>(op)) {
+        case MathOp::Sqrt: result = x < 0 ? std::numeric_limits<double>::quiet_NaN() : std::sqrt(x); break;
+        case MathOp::InvSqrt: {
+            float f = static_cast<float>(x);
+            result = f <= 0 ? std::numeric_limits<double>::infinity() : InvSqrtApprox(f);
+            break;
+        }
+        case MathOp::Add: result = x + y; break;
+        case MathOp::Subtract: result = x - y; break;
+        case MathOp::Multiply: result = x * y; break;
+        case MathOp::Divide: result = x / y; break;
+        case MathOp::Min: result = std::min(x, y); break;
+        case MathOp::Max: result = std::max(x, y); break;
+        case MathOp::Abs: result = std::fabs(x); break;
+        case MathOp::And: case MathOp::Or: case MathOp::Xor: case MathOp::Not:
+        case MathOp::Shl: case MathOp::Shr: case MathOp::Rotl: case MathOp::Rotr:
+        case MathOp::Popcount: case MathOp::Clz: case MathOp::Ctz:
+            result = static_cast<double>(ApplyBitwiseOp(static_cast<MathOp>(op), ToUint32(x), ToUint32(y)));
+            break;
+        default: return false;
+    }
+    return true;
+}
+
+/**
+ * Optimized bitwise operations
+ * @param info - CallbackInfo containing operation (name or opcode), operands
+ * @returns Operation result
+ */
+Napi::Value BitwiseOperations(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !(info[0].IsString() || info[0].IsNumber()) || !info[1].IsNumber()) {
+        Napi::TypeError::New(env, "Operation and first operand required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    MathOp op;
+    if (info[0].IsNumber()) {
+        op = static_cast<MathOp>(info[0].As<Napi::Number>().Int32Value());
+        if (op < MathOp::And || op > MathOp::Ctz) {
+            Napi::TypeError::New(env, "Unknown bitwise operation").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else if (!ParseBitwiseOp(info[0].As<Napi::String>(), op)) {
+        Napi::TypeError::New(env, "Unknown bitwise operation").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    double a = info[1].As<Napi::Number>().DoubleValue();
+    double b = info.Length() > 2 && info[2].IsNumber() ? info[2].As<Napi::Number>().DoubleValue() : 0;
+    
+    double result = 0;
+    ApplyMathOp(static_cast<int32_t>(op), a, b, result);
+    return Napi::Number::New(env, result);
+}
+
+/**
+ * Runs a command buffer of scalar operations in one native call. Each
+ * command is four doubles, [opcode, a, b, result]; results are written into
+ * the fourth slot in place so the buffer can be reused across calls.
+ * @param info - CallbackInfo containing the Float64Array command buffer and
+ *               optional command count (default: every whole command)
+ * @returns Number of commands executed
+ */
+Napi::Value ExecuteCommands(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    constexpr size_t kStride = 4;
+    
+    if (info.Length() < 1 || !info[0].IsTypedArray() ||
+        info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array) {
+        Napi::TypeError::New(env, "Float64Array command buffer required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Float64Array commands = info[0].As<Napi::Float64Array>();
+    size_t capacity = commands.ElementLength() / kStride;
+    size_t count = capacity;
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        double requested = info[1].As<Napi::Number>().DoubleValue();
+        if (!(requested >= 0) || requested > static_cast<double>(capacity)) {
+            Napi::RangeError::New(env, "Command count exceeds buffer length").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        count = static_cast<size_t>(requested);
+    }
+    
+    double* command = commands.Data();
+    for (size_t i = 0; i < count; i++, command += kStride) {
+        // The buffer is writable from JS, so the opcode slot may hold anything; cast only valid values
+        double opcode = command[0];
+        bool valid = std::isfinite(opcode) && opcode >= 0 && opcode <= static_cast<double>(MathOp::Ctz) &&
+                     opcode == std::floor(opcode);
+        if (!valid || !ApplyMathOp(static_cast<int32_t>(opcode), command[1], command[2], command[3])) {
+            Napi::RangeError::New(env, "Unknown opcode in command " + std::to_string(i)).ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    }
+    return Napi::Number::New(env, static_cast<double>(count));
+}
+
+/**
+ * Advanced random number generation with various distributions
+ * @param info - CallbackInfo containing count, min, max, distribution
+ * @returns Array of random numbers
+ */
+Napi::Value RandomNumbers(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        Napi::TypeError::New(env, "Count parameter required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int count = info[0].As<Napi::Number>().Int32Value();
+    double min = 0.0;
+    double max = 1.0;
+    std::string distribution = "uniform";
+    
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        min = info[1].As<Napi::Number>().DoubleValue();
+    }
+    
+    if (info.Length() > 2 && info[2].IsNumber()) {
+        max = info[2].As<Napi::Number>().DoubleValue();
+    }
+    
+    if (info.Length() > 3 && info[3].IsString()) {
+        distribution = info[3].As<Napi::String>();
+    }
+    
+    if (count <= 0) {
+        Napi::TypeError::New(env, "Count must be positive").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Array result = Napi::Array::New(env);
+    
+    if (distribution == "uniform") {
+        std::uniform_real_distribution<double> dist(min, max);
+        for (int i = 0; i < count; i++) {
+            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+        }
+    } else if (distribution == "normal") {
+        // min = mean, max = stddev
+        std::normal_distribution<double> dist(min, max);
+        for (int i = 0; i < count; i++) {
+            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+        }
+    } else if (distribution == "exponential") {
+        std::exponential_distribution<double> dist(min); // min = lambda
+        for (int i = 0; i < count; i++) {
+            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+        }
+    } else if (distribution == "gamma") {
+        std::gamma_distribution<double> dist(min, max); // min = alpha, max = beta
+        for (int i = 0; i < count; i++) {
+            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+        }
+    } else if (distribution == "poisson") {
+        std::poisson_distribution<int> dist(min); // min = mean
+        for (int i = 0; i < count; i++) {
+            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+        }
+    } else {
+        Napi::TypeError::New(env, "Unknown distribution type").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    return result;
+}
+
+// Output is generated in fixed chunks, each from its own stream, so a seed
+// gives the same result for any thread count
+static constexpr size_t kRandomChunk = size_t(1) << 16;
+static constexpr size_t kRandomBufferSteps = 64;
+
+// SplitMix64 finalizer; expands seeds into xoshiro state
+static inline uint64_t MixBits64(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+/**
+ * Buffered eight-lane xoshiro256++ stream for one chunk of output
+ */
+class RandomStream {
+public:
+    RandomStream(uint64_t seed, uint64_t stream) {
+        uint64_t x = seed ^ MixBits64(stream + 1);
+        for (size_t w = 0; w < 4; w++) {
+            for (size_t l = 0; l < kRandomLanes; l++) {
+                x += 0x9E3779B97F4A7C15ull;
+                lanes.s[w][l] = MixBits64(x);
+            }
+        }
+    }
+    
+    uint64_t Next() {
+        if (position == kRandomBufferSteps * kRandomLanes) {
+            Refill();
+        }
+        return buffer[position++];
+    }
+    
+    /**
+     * Takes up to count buffered words without copying
+     * @param bits - Receives the first word; valid until the next Take or Next
+     * @param count - Words wanted
+     * @returns Words available at bits
+     */
+    size_t Take(const uint64_t*& bits, size_t count) {
+        if (position == kRandomBufferSteps * kRandomLanes) {
+            Refill();
+        }
+        size_t available = std::min(count, kRandomBufferSteps * kRandomLanes - position);
+        bits = buffer + position;
+        position += available;
+        return available;
+    }
+    
+    // Uniform double in [0, 1) with 53-bit resolution
+    double NextDouble() {
+        return static_cast<double>(Next() >> 11) * 0x1.0p-53;
+    }
+    
+private:
+    void Refill() {
+        RandomBitsKernel(lanes, buffer, kRandomBufferSteps);
+        position = 0;
+    }
+    
+    RandomLanes lanes;
+    alignas(64) uint64_t buffer[kRandomBufferSteps * kRandomLanes];
+    size_t position = kRandomBufferSteps * kRandomLanes;
+};
+
+// 256-layer Ziggurat tables (Marsaglia & Tsang) for 52/53-bit mantissas
+struct ZigguratTables {
+    double kn[256], wn[256], fn[256];
+    double ke[256], we[256], fe[256];
+};
+
+static constexpr double kZigguratNormalR = 3.6541528853610088;
+static constexpr double kZigguratExpR = 7.69711747013104972;
+
+static const ZigguratTables& Ziggurat() {
+    static const ZigguratTables tables = [] {
+        ZigguratTables t;
+        const double m1 = 0x1.0p52, m2 = 0x1.0p53;
+        
+        double dn = kZigguratNormalR, tn = dn;
+        const double vn = 4.92867323399e-3;
+        double q = vn / std::exp(-0.5 * dn * dn);
+        t.kn[0] = (dn / q) * m1;
+        t.kn[1] = 0;
+        t.wn[0] = q / m1;
+        t.wn[255] = dn / m1;
+        t.fn[0] = 1.0;
+        t.fn[255] = std::exp(-0.5 * dn * dn);
+        for (int i = 254; i >= 1; i--) {
+            dn = std::sqrt(-2.0 * std::log(vn / dn + std::exp(-0.5 * dn * dn)));
+            t.kn[i + 1] = (dn / tn) * m1;
+            tn = dn;
+            t.fn[i] = std::exp(-0.5 * dn * dn);
+            t.wn[i] = dn / m1;
+        }
+        
+        double de = kZigguratExpR, te = de;
+        const double ve = 3.949659822581572e-3;
+        q = ve / std::exp(-de);
+        t.ke[0] = (de / q) * m2;
+        t.ke[1] = 0;
+        t.we[0] = q / m2;
+        t.we[255] = de / m2;
+        t.fe[0] = 1.0;
+        t.fe[255] = std::exp(-de);
+        for (int i = 254; i >= 1; i--) {
+            de = -std::log(ve / de + std::exp(-de));
+            t.ke[i + 1] = (de / te) * m2;
+            te = de;
+            t.fe[i] = std::exp(-de);
+            t.we[i] = de / m2;
+        }
+        return t;
+    }();
+    return tables;
+}
+
+// Ziggurat fast path: accepts about 99% of draws with one table lookup
+static inline bool NormalFast(const ZigguratTables& z, uint64_t r, double& x) {
+    size_t idx = r & 0xff;
+    r >>= 8;
+    uint64_t magnitude = (r >> 1) & 0x000fffffffffffffull;
+    x = static_cast<double>(magnitude) * z.wn[idx];
+    if (r & 1) x = -x;
+    return static_cast<double>(magnitude) < z.kn[idx];
+}
+
+// Ziggurat slow path: tail and wedge tests, redrawing until accepted
+static double NormalSlow(const ZigguratTables& z, RandomStream& stream, uint64_t r) {
+    for (;;) {
+        double x;
+        if (NormalFast(z, r, x)) {
+            return x;
+        }
+        size_t idx = r & 0xff;
+        if (idx == 0) {
+            for (;;) {
+                double xx = -std::log1p(-stream.NextDouble()) / kZigguratNormalR;
+                double yy = -std::log1p(-stream.NextDouble());
+                if (yy + yy > xx * xx) {
+                    return x < 0 ? -(kZigguratNormalR + xx) : kZigguratNormalR + xx;
+                }
+            }
+        }
+        if ((z.fn[idx - 1] - z.fn[idx]) * stream.NextDouble() + z.fn[idx] < std::exp(-0.5 * x * x)) {
+            return x;
+        }
+        r = stream.Next();
+    }
+}
+
+static inline bool ExponentialFast(const ZigguratTables& z, uint64_t r, double& x) {
+    r >>= 3;
+    size_t idx = r & 0xff;
+    r >>= 8;
+    x = static_cast<double>(r) * z.we[idx];
+    return static_cast<double>(r) < z.ke[idx];
+}
+
+static double ExponentialSlow(const ZigguratTables& z, RandomStream& stream, uint64_t r) {
+    for (;;) {
+        double x;
+        if (ExponentialFast(z, r, x)) {
+            return x;
+        }
+        size_t idx = (r >> 3) & 0xff;
+        if (idx == 0) {
+            return kZigguratExpR - std::log1p(-stream.NextDouble());
+        }
+        if ((z.fe[idx - 1] - z.fe[idx]) * stream.NextDouble() + z.fe[idx] < std::exp(-x)) {
+            return x;
+        }
+        r = stream.Next();
+    }
+}
+
+// High and low halves of a 64 x 64-bit product
+static inline uint64_t MulHigh64(uint64_t a, uint64_t b, uint64_t& low) {
+#ifdef _MSC_VER
+    uint64_t high;
+    low = _umul128(a, b, &high);
+    return high;
+#else
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    low = static_cast<uint64_t>(product);
+    return static_cast<uint64_t>(product >> 64);
+#endif
+}
+
+enum class RandomDistribution { Uniform, Normal, Exponential };
+
+struct RandomRequest {
+    RandomDistribution distribution;
+    uint64_t seed;
+    // Floating point: uniform [a, a + b), normal mean a / stddev b, exponential scale a
+    double a;
+    double b;
+    // Integer uniform: [low, low + range), range 0 meaning raw bits
+    uint64_t low;
+    uint64_t range;
+};
+
+/**
+ * Fills one chunk of a floating-point array. Fast paths run over whole
+ * buffered blocks; rare Ziggurat rejections are resolved afterwards so the
+ * block loop stays branch-light.
+ */
+template <typename T>
+static void FillRandomFloatChunk(const RandomRequest& request, RandomStream& stream, T* out, size_t count) {
+    const ZigguratTables& z = Ziggurat();
+    uint32_t rejected[kRandomBufferSteps * kRandomLanes];
+    uint64_t rejectedBits[kRandomBufferSteps * kRandomLanes];
+    
+    // Largest T below max: rounding to T (or the multiply-add) can land on max
+    T upper = std::numeric_limits<T>::infinity();
+    if (request.distribution == RandomDistribution::Uniform && request.b > 0) {
+        double max = request.a + request.b;
+        upper = static_cast<T>(max);
+        while (static_cast<double>(upper) >= max) {
+            upper = std::nextafter(upper, -std::numeric_limits<T>::infinity());
+        }
+        upper = std::max(upper, static_cast<T>(request.a));
+    }
+    
+    while (count > 0) {
+        const uint64_t* bits;
+        size_t n = stream.Take(bits, count);
+        size_t rejects = 0;
+        
+        switch (request.distribution) {
+            case RandomDistribution::Uniform:
+                for (size_t i = 0; i < n; i++) {
+                    // Mantissa fill gives [1, 2); subtract for [0, 1)
+                    uint64_t word = (bits[i] >> 12) | 0x3FF0000000000000ull;
+                    double u;
+                    std::memcpy(&u, &word, sizeof(u));
+                    T value = static_cast<T>(request.a + request.b * (u - 1.0));
+                    out[i] = value < upper ? value : upper;
+                }
+                break;
+            case RandomDistribution::Normal:
+                for (size_t i = 0; i < n; i++) {
+                    double x;
+                    if (!NormalFast(z, bits[i], x)) {
+                        rejected[rejects] = static_cast<uint32_t>(i);
+                        rejectedBits[rejects++] = bits[i];
+                    }
+                    out[i] = static_cast<T>(request.a + request.b * x);
+                }
+                for (size_t j = 0; j < rejects; j++) {
+                    out[rejected[j]] = static_cast<T>(request.a + request.b * NormalSlow(z, stream, rejectedBits[j]));
+                }
+                break;
+            case RandomDistribution::Exponential:
+                for (size_t i = 0; i < n; i++) {
+                    double x;
+                    if (!ExponentialFast(z, bits[i], x)) {
+                        rejected[rejects] = static_cast<uint32_t>(i);
+                        rejectedBits[rejects++] = bits[i];
                     }
+                    out[i] = static_cast<T>(request.a * x);
                 }
-            }
-        }
-        
-        // Extract inverse matrix
-        Napi::Array result = Napi::Array::New(env);
-        for (size_t i = 0; i < n; i++) {
-            Napi::Array resultRow = Napi::Array::New(env);
-            for (size_t j = 0; j < n; j++) {
-                resultRow.Set(static_cast<uint32_t>(j), Napi::Number::New(env, augmented[i][j + n]));
-            }
-            result.Set(static_cast<uint32_t>(i), resultRow);
+                for (size_t j = 0; j < rejects; j++) {
+                    out[rejected[j]] = static_cast<T>(request.a * ExponentialSlow(z, stream, rejectedBits[j]));
+                }
+                break;
         }
-        
-        return result;
+        out += n;
+        count -= n;
     }
-    
-    Napi::TypeError::New(env, "Unknown matrix operation").ThrowAsJavaScriptException();
-    return env.Null();
 }
 
 /**
- * Optimized bitwise operations
- * @param info - CallbackInfo containing operation, operands
- * @returns Operation result
+ * Fills one chunk of an integer array with uniform values (Lemire's unbiased
+ * multiply-shift), or with raw bits when the range is 0
  */
-Napi::Value BitwiseOperations(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    
-    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsNumber()) {
-        Napi::TypeError::New(env, "Operation and first operand required").ThrowAsJavaScriptException();
-        return env.Null();
+template <typename T>
+static void FillRandomIntegerChunk(const RandomRequest& request, RandomStream& stream, T* out, size_t count) {
+    if (request.range == 0) {
+        uint8_t* bytes = reinterpret_cast<uint8_t*>(out);
+        size_t remaining = count * sizeof(T);
+        while (remaining > 0) {
+            const uint64_t* bits;
+            size_t words = stream.Take(bits, (remaining + 7) / 8);
+            size_t length = std::min(remaining, words * 8);
+            std::memcpy(bytes, bits, length);
+            bytes += length;
+            remaining -= length;
+        }
+        return;
     }
     
-    std::string operation = info[0].As<Napi::String>();
-    uint64_t a = info[1].As<Napi::Number>().Uint32Value();
-    uint64_t b = 0;
+    const uint64_t range = request.range;
+    const uint64_t threshold = (0 - range) % range;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t low;
+        uint64_t high = MulHigh64(stream.Next(), range, low);
+        while (low < threshold) {
+            high = MulHigh64(stream.Next(), range, low);
+        }
+        out[i] = static_cast<T>(request.low + high);
+    }
+}
+
+template <typename T>
+static void FillRandomChunks(const RandomRequest& request, T* data, size_t length) {
+    const size_t chunks = (length + kRandomChunk - 1) / kRandomChunk;
+    auto fill = [&](size_t chunk) {
+        RandomStream stream(request.seed, chunk);
+        size_t begin = chunk * kRandomChunk;
+        size_t count = std::min(kRandomChunk, length - begin);
+        if constexpr (std::is_floating_point_v<T>) {
+            FillRandomFloatChunk(request, stream, data + begin, count);
+        } else {
+            FillRandomIntegerChunk(request, stream, data + begin, count);
+        }
+    };
     
-    if (info.Length() > 2 && info[2].IsNumber()) {
-        b = info[2].As<Napi::Number>().Uint32Value();
-    }
-    
-    uint64_t result = 0;
-    
-    if (operation == "and") {
-        result = a & b;
-    } else if (operation == "or") {
-        result = a | b;
-    } else if (operation == "xor") {
-        result = a ^ b;
-    } else if (operation == "not") {
-        result = ~a;
-    } else if (operation == "shl") {
-        result = a << b;
-    } else if (operation == "shr") {
-        result = a >> b;
-    } else if (operation == "rotl") {
-        result = (a << b) | (a >> (32 - b));
-    } else if (operation == "rotr") {
-        result = (a >> b) | (a << (32 - b));
-    } else if (operation == "popcount") {
-        result = __builtin_popcountll(a);
-    } else if (operation == "clz") {
-        result = a == 0 ? 64 : __builtin_clzll(a);
-    } else if (operation == "ctz") {
-        result = a == 0 ? 64 : __builtin_ctzll(a);
+    Threading::WorkerPool& pool = Threading::WorkerPool::Instance();
+    if (chunks > 1 && pool.Size() > 1) {
+        pool.ParallelFor(chunks, fill);
     } else {
-        Napi::TypeError::New(env, "Unknown bitwise operation").ThrowAsJavaScriptException();
-        return env.Null();
+        for (size_t chunk = 0; chunk < chunks; chunk++) fill(chunk);
     }
-    
-    return Napi::Number::New(env, static_cast<double>(result));
 }
 
 /**
- * Advanced random number generation with various distributions
- * @param info - CallbackInfo containing count, min, max, distribution
- * @returns Array of random numbers
+ * Reads an optional numeric option
+ * @returns The option value, or fallback when absent
  */
-Napi::Value RandomNumbers(const Napi::CallbackInfo& info) {
+static double RandomOption(const Napi::Object& options, const char* key, double fallback) {
+    Napi::Value value = options.Get(key);
+    return value.IsNumber() ? value.As<Napi::Number>().DoubleValue() : fallback;
+}
+
+/**
+ * Derives an unseeded fill's seed; distinct per call and per process
+ */
+static uint64_t FreshRandomSeed() {
+    static std::atomic<uint64_t> counter{ []() {
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) ^ device();
+    }() };
+    return MixBits64(counter.fetch_add(0x9E3779B97F4A7C15ull, std::memory_order_relaxed));
+}
+
+/**
+ * Fills a TypedArray in place from a vectorized xoshiro256++ generator.
+ * Float arrays take uniform (min, max), normal (mean, stddev) or exponential
+ * (lambda) samples via Ziggurat; integer arrays take uniform integers in
+ * [min, max], or raw random bits when no bounds are given. A seed makes the
+ * output reproducible regardless of thread count.
+ * @param info - CallbackInfo containing TypedArray and optional { distribution, seed, min, max, mean, stddev, lambda }
+ * @returns The filled array
+ */
+Napi::Value FillRandom(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 1 || !info[0].IsNumber()) {
-        Napi::TypeError::New(env, "Count parameter required").ThrowAsJavaScriptException();
+    if (info.Length() < 1 || !info[0].IsTypedArray()) {
+        Napi::TypeError::New(env, "TypedArray required").ThrowAsJavaScriptException();
         return env.Null();
     }
+    Napi::TypedArray array = info[0].As<Napi::TypedArray>();
+    napi_typedarray_type type = array.TypedArrayType();
+    bool floating = type == napi_float64_array || type == napi_float32_array;
     
-    int count = info[0].As<Napi::Number>().Int32Value();
-    double min = 0.0;
-    double max = 1.0;
-    std::string distribution = "uniform";
+    Napi::Object options = info.Length() > 1 && info[1].IsObject() ? info[1].As<Napi::Object>() : Napi::Object::New(env);
+    std::string distribution = options.Get("distribution").IsString()
+        ? options.Get("distribution").As<Napi::String>().Utf8Value() : "uniform";
     
-    if (info.Length() > 1 && info[1].IsNumber()) {
-        min = info[1].As<Napi::Number>().DoubleValue();
+    RandomRequest request{};
+    if (distribution == "uniform") {
+        request.distribution = RandomDistribution::Uniform;
+    } else if (distribution == "normal") {
+        request.distribution = RandomDistribution::Normal;
+    } else if (distribution == "exponential") {
+        request.distribution = RandomDistribution::Exponential;
+    } else {
+        Napi::TypeError::New(env, "Unknown distribution type").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (!floating && request.distribution != RandomDistribution::Uniform) {
+        Napi::TypeError::New(env, "Integer arrays only support the uniform distribution").ThrowAsJavaScriptException();
+        return env.Null();
     }
     
-    if (info.Length() > 2 && info[2].IsNumber()) {
-        max = info[2].As<Napi::Number>().DoubleValue();
+    Napi::Value seed = options.Get("seed");
+    if (seed.IsBigInt()) {
+        bool lossless = false;
+        request.seed = seed.As<Napi::BigInt>().Uint64Value(&lossless);
+        if (!lossless) {
+            Napi::RangeError::New(env, "Seed must be a non-negative safe integer or a BigInt").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else if (seed.IsNumber()) {
+        double value = seed.As<Napi::Number>().DoubleValue();
+        if (!(value >= 0) || value > 9007199254740991.0 || value != std::floor(value)) {
+            Napi::RangeError::New(env, "Seed must be a non-negative safe integer or a BigInt").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        request.seed = static_cast<uint64_t>(value);
+    } else {
+        request.seed = FreshRandomSeed();
     }
     
-    if (info.Length() > 3 && info[3].IsString()) {
-        distribution = info[3].As<Napi::String>();
+    if (floating) {
+        if (request.distribution == RandomDistribution::Uniform) {
+            request.a = RandomOption(options, "min", 0.0);
+            request.b = RandomOption(options, "max", 1.0) - request.a;
+        } else if (request.distribution == RandomDistribution::Normal) {
+            request.a = RandomOption(options, "mean", 0.0);
+            request.b = RandomOption(options, "stddev", 1.0);
+        } else {
+            double lambda = RandomOption(options, "lambda", 1.0);
+            if (!(lambda > 0)) {
+                Napi::RangeError::New(env, "Lambda must be positive").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+            request.a = 1.0 / lambda;
+        }
+    } else if (options.Get("min").IsNumber() || options.Get("max").IsNumber()) {
+        // Bounds are inclusive and must fit the element type
+        double lowest, highest;
+        switch (type) {
+            case napi_int8_array: lowest = INT8_MIN; highest = INT8_MAX; break;
+            case napi_uint8_array: case napi_uint8_clamped_array: lowest = 0; highest = UINT8_MAX; break;
+            case napi_int16_array: lowest = INT16_MIN; highest = INT16_MAX; break;
+            case napi_uint16_array: lowest = 0; highest = UINT16_MAX; break;
+            case napi_int32_array: lowest = INT32_MIN; highest = INT32_MAX; break;
+            case napi_uint32_array: lowest = 0; highest = UINT32_MAX; break;
+            case napi_bigint64_array: lowest = -9007199254740991.0; highest = 9007199254740991.0; break;
+            default: lowest = 0; highest = 9007199254740991.0; break;
+        }
+        double min = RandomOption(options, "min", lowest);
+        double max = RandomOption(options, "max", highest);
+        if (min != std::floor(min) || max != std::floor(max) || min < lowest || max > highest || min > max) {
+            Napi::RangeError::New(env, "min and max must be integers within the element range with min <= max").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        request.low = static_cast<uint64_t>(static_cast<int64_t>(min));
+        request.range = static_cast<uint64_t>(static_cast<int64_t>(max) - static_cast<int64_t>(min)) + 1;
     }
     
-    if (count <= 0) {
-        Napi::TypeError::New(env, "Count must be positive").ThrowAsJavaScriptException();
-        return env.Null();
+    void* data = static_cast<uint8_t*>(array.ArrayBuffer().Data()) + array.ByteOffset();
+    size_t length = array.ElementLength();
+    switch (type) {
+        case napi_float64_array: FillRandomChunks(request, static_cast<double*>(data), length); break;
+        case napi_float32_array: FillRandomChunks(request, static_cast<float*>(data), length); break;
+        case napi_int8_array: FillRandomChunks(request, static_cast<int8_t*>(data), length); break;
+        case napi_uint8_array: case napi_uint8_clamped_array: FillRandomChunks(request, static_cast<uint8_t*>(data), length); break;
+        case napi_int16_array: FillRandomChunks(request, static_cast<int16_t*>(data), length); break;
+        case napi_uint16_array: FillRandomChunks(request, static_cast<uint16_t*>(data), length); break;
+        case napi_int32_array: FillRandomChunks(request, static_cast<int32_t*>(data), length); break;
+        case napi_uint32_array: FillRandomChunks(request, static_cast<uint32_t*>(data), length); break;
+        case napi_bigint64_array: FillRandomChunks(request, static_cast<int64_t*>(data), length); break;
+        default: FillRandomChunks(request, static_cast<uint64_t*>(data), length); break;
+    }
+    return array;
+}
+
+// Complex samples are interleaved (re, im) doubles; std::complex is layout-compatible
+using Complex = std::complex<double>;
+
+// Plain complex product; avoids the NaN/Inf recovery path of operator*
+static inline Complex ComplexMul(Complex a, Complex b) {
+    return Complex(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+
+/**
+ * Unnormalized complex DFT of one fixed size and direction. Powers of two run
+ * an iterative radix-4 (plus one radix-2 stage for odd log2 n) transform in
+ * place over precomputed bit-reversal and twiddle tables; other sizes use
+ * Bluestein's chirp-z algorithm over a power-of-two convolution.
+ */
+class FFTEngine {
+public:
+    FFTEngine(size_t size, bool inverseDirection) : n(size), inverse(inverseDirection) {
+        if (n <= 1) {
+            return;
+        }
+        const double sign = inverse ? 1.0 : -1.0;
+        if ((n & (n - 1)) == 0) {
+            unsigned bits = 0;
+            while ((size_t(1) << bits) < n) bits++;
+            bitReverse.resize(n);
+            for (size_t i = 0; i < n; i++) {
+                size_t r = 0;
+                for (unsigned b = 0; b < bits; b++) r |= ((i >> b) & 1) << (bits - 1 - b);
+                bitReverse[i] = static_cast<uint32_t>(r);
+            }
+            // Radix-4 butterflies read W^k, W^2k and W^3k, all below 3n/4
+            twiddles.resize(n);
+            for (size_t k = 0; k < n; k++) {
+                twiddles[k] = std::polar(1.0, sign * 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(n));
+            }
+            return;
+        }
+        
+        m = 1;
+        while (m < 2 * n - 1) m <<= 1;
+        inner = std::make_unique<FFTEngine>(m, false);
+        chirp.resize(n);
+        for (size_t k = 0; k < n; k++) {
+            // k^2 mod 2n keeps the angle argument small for large k
+            uint64_t k2 = (static_cast<uint64_t>(k) * k) % (2 * static_cast<uint64_t>(n));
+            chirp[k] = std::polar(1.0, sign * M_PI * static_cast<double>(k2) / static_cast<double>(n));
+        }
+        kernelSpectrum.assign(m, Complex(0, 0));
+        kernelSpectrum[0] = std::conj(chirp[0]);
+        for (size_t k = 1; k < n; k++) {
+            kernelSpectrum[k] = kernelSpectrum[m - k] = std::conj(chirp[k]);
+        }
+        inner->Transform(kernelSpectrum.data());
+        // Fold the inverse-transform scale of the convolution into the kernel
+        for (Complex& v : kernelSpectrum) v /= static_cast<double>(m);
     }
     
-    Napi::Array result = Napi::Array::New(env);
+    size_t Size() const { return n; }
     
-    if (distribution == "uniform") {
-        std::uniform_real_distribution<double> dist(min, max);
-        for (int i = 0; i < count; i++) {
-            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+    /**
+     * Transforms n samples in place
+     * @param data - n interleaved complex samples
+     */
+    void Transform(Complex* data) const {
+        if (n <= 1) {
+            return;
         }
-    } else if (distribution == "normal") {
-        // min = mean, max = stddev
-        std::normal_distribution<double> dist(min, max);
-        for (int i = 0; i < count; i++) {
-            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+        if (!inner) {
+            Radix4(data);
+            return;
         }
-    } else if (distribution == "exponential") {
-        std::exponential_distribution<double> dist(min); // min = lambda
-        for (int i = 0; i < count; i++) {
-            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+        
+        static thread_local std::vector<Complex> scratch;
+        scratch.resize(m);
+        for (size_t k = 0; k < n; k++) scratch[k] = ComplexMul(data[k], chirp[k]);
+        std::fill(scratch.begin() + n, scratch.end(), Complex(0, 0));
+        inner->Transform(scratch.data());
+        // Inverse FFT via conj(FFT(conj(x))) so one forward inner engine suffices
+        for (size_t k = 0; k < m; k++) scratch[k] = std::conj(ComplexMul(scratch[k], kernelSpectrum[k]));
+        inner->Transform(scratch.data());
+        for (size_t k = 0; k < n; k++) data[k] = ComplexMul(std::conj(scratch[k]), chirp[k]);
+    }
+    
+private:
+    void Radix4(Complex* data) const {
+        for (size_t i = 0; i < n; i++) {
+            if (i < bitReverse[i]) std::swap(data[i], data[bitReverse[i]]);
         }
-    } else if (distribution == "gamma") {
-        std::gamma_distribution<double> dist(min, max); // min = alpha, max = beta
-        for (int i = 0; i < count; i++) {
-            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+        
+        size_t quarter = 1;
+        if ((n & 0x5555555555555555ull) == 0) {
+            // Odd log2 n: one radix-2 stage first, then radix-4 from size 8
+            for (size_t i = 0; i < n; i += 2) {
+                Complex t = data[i + 1];
+                data[i + 1] = data[i] - t;
+                data[i] += t;
+            }
+            quarter = 2;
         }
-    } else if (distribution == "poisson") {
-        std::poisson_distribution<int> dist(min); // min = mean
-        for (int i = 0; i < count; i++) {
-            result.Set(static_cast<uint32_t>(i), Napi::Number::New(env, dist(gen)));
+        
+        for (; quarter * 4 <= n; quarter *= 4) {
+            const size_t span = quarter * 4;
+            const size_t step = n / span;
+            for (size_t base = 0; base < n; base += span) {
+                Complex* x = data + base;
+                for (size_t k = 0; k < quarter; k++) {
+                    // Bit reversal leaves the residue-1 and residue-2 sub-transforms swapped
+                    Complex t0 = x[k];
+                    Complex t2 = ComplexMul(x[k + quarter], twiddles[2 * k * step]);
+                    Complex t1 = ComplexMul(x[k + 2 * quarter], twiddles[k * step]);
+                    Complex t3 = ComplexMul(x[k + 3 * quarter], twiddles[3 * k * step]);
+                    Complex s02 = t0 + t2, d02 = t0 - t2;
+                    Complex s13 = t1 + t3, d13 = t1 - t3;
+                    // Multiply by -i (forward) or +i (inverse)
+                    Complex r13 = inverse ? Complex(-d13.imag(), d13.real()) : Complex(d13.imag(), -d13.real());
+                    x[k] = s02 + s13;
+                    x[k + quarter] = d02 + r13;
+                    x[k + 2 * quarter] = s02 - s13;
+                    x[k + 3 * quarter] = d02 - r13;
+                }
+            }
         }
-    } else {
-        Napi::TypeError::New(env, "Unknown distribution type").ThrowAsJavaScriptException();
-        return env.Null();
     }
     
-    return result;
+    size_t n;
+    bool inverse;
+    std::vector<uint32_t> bitReverse;
+    std::vector<Complex> twiddles;
+    // Bluestein state
+    size_t m = 0;
+    std::unique_ptr<FFTEngine> inner;
+    std::vector<Complex> chirp;
+    std::vector<Complex> kernelSpectrum;
+};
+
+/**
+ * Gets a shared engine for repeated one-shot transforms of the same size
+ * @param n - Transform size
+ * @returns Cached forward engine
+ */
+static std::shared_ptr<const FFTEngine> CachedForwardEngine(size_t n) {
+    static std::mutex cacheMutex;
+    static std::unordered_map<size_t, std::shared_ptr<const FFTEngine>> cache;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(n);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    if (cache.size() >= 32) {
+        cache.clear();
+    }
+    auto engine = std::make_shared<const FFTEngine>(n, false);
+    cache.emplace(n, engine);
+    return engine;
 }
 
 /**
@@ -609,32 +2746,7 @@ Napi::Value FastFourierTransform(const Napi::CallbackInfo& info) {
     while (powerOf2 < n) powerOf2 <<= 1;
     data.resize(powerOf2, std::complex<double>(0, 0));
     
-    // Cooley-Tukey FFT algorithm
-    std::function<void(std::vector<std::complex<double>>&)> fft = 
-        [&](std::vector<std::complex<double>>& x) {
-            size_t N = x.size();
-            if (N <= 1) return;
-            
-            // Divide
-            std::vector<std::complex<double>> even, odd;
-            for (size_t i = 0; i < N; i += 2) {
-                even.push_back(x[i]);
-                if (i + 1 < N) odd.push_back(x[i + 1]);
-            }
-            
-            // Conquer
-            fft(even);
-            fft(odd);
-            
-            // Combine
-            for (size_t k = 0; k < N / 2; k++) {
-                std::complex<double> t = std::polar(1.0, -2 * M_PI * k / N) * odd[k];
-                x[k] = even[k] + t;
-                x[k + N / 2] = even[k] - t;
-            }
-        };
-    
-    fft(data);
+    CachedForwardEngine(powerOf2)->Transform(data.data());
     
     // Convert result back to JavaScript array
     Napi::Array result = Napi::Array::New(env);
@@ -648,4 +2760,278 @@ Napi::Value FastFourierTransform(const Napi::CallbackInfo& info) {
     return result;
 }
 
-}
\ No newline at end of file
+// Per-frame layouts in doubles: complex frames are n (re, im) pairs, real
+// frames n samples, and half spectra n/2 + 1 pairs
+struct FFTPlan {
+    size_t n;
+    bool real;
+    bool inverse;
+    size_t inputLength;
+    size_t outputLength;
+    // Complex transform of n, or of n/2 for even real plans
+    std::shared_ptr<const FFTEngine> engine;
+    // W_n^k for k <= n/2 (even real plans)
+    std::vector<Complex> realTwiddles;
+};
+
+static HandleTable<FFTPlan> fftPlans;
+
+static constexpr size_t kMaxFFTSize = size_t(1) << 26;
+
+/**
+ * Runs one complex frame; in may equal out
+ */
+static void FFTComplexFrame(const FFTPlan& plan, const double* in, double* out) {
+    if (in != out) {
+        std::memcpy(out, in, plan.n * 2 * sizeof(double));
+    }
+    Complex* z = reinterpret_cast<Complex*>(out);
+    plan.engine->Transform(z);
+    if (plan.inverse) {
+        const double scale = 1.0 / static_cast<double>(plan.n);
+        for (size_t k = 0; k < plan.n; k++) z[k] *= scale;
+    }
+}
+
+/**
+ * Runs one real-to-complex frame; in and out must not overlap
+ */
+static void FFTRealForwardFrame(const FFTPlan& plan, const double* in, double* out) {
+    const size_t n = plan.n;
+    Complex* x = reinterpret_cast<Complex*>(out);
+    
+    if (n % 2 != 0) {
+        static thread_local std::vector<Complex> scratch;
+        scratch.resize(n);
+        for (size_t k = 0; k < n; k++) scratch[k] = Complex(in[k], 0.0);
+        plan.engine->Transform(scratch.data());
+        std::copy(scratch.begin(), scratch.begin() + n / 2 + 1, x);
+        return;
+    }
+    
+    // Pack even/odd samples as one half-length complex signal, transform it in
+    // the output buffer, then split the spectra: X[k] = E[k] + W^k O[k]
+    const size_t h = n / 2;
+    std::memcpy(out, in, n * sizeof(double));
+    plan.engine->Transform(x);
+    
+    Complex z0 = x[0];
+    x[0] = Complex(z0.real() + z0.imag(), 0.0);
+    x[h] = Complex(z0.real() - z0.imag(), 0.0);
+    for (size_t k = 1; k <= h / 2; k++) {
+        Complex a = x[k], b = std::conj(x[h - k]);
+        Complex even = (a + b) * 0.5;
+        Complex diff = a - b;
+        Complex odd(diff.imag() * 0.5, -diff.real() * 0.5);
+        x[k] = even + ComplexMul(plan.realTwiddles[k], odd);
+        x[h - k] = std::conj(even) + ComplexMul(plan.realTwiddles[h - k], std::conj(odd));
+    }
+}
+
+/**
+ * Runs one complex-to-real frame from a half spectrum; in and out must not overlap
+ */
+static void FFTRealInverseFrame(const FFTPlan& plan, const double* in, double* out) {
+    const size_t n = plan.n;
+    const Complex* x = reinterpret_cast<const Complex*>(in);
+    
+    if (n % 2 != 0) {
+        static thread_local std::vector<Complex> scratch;
+        scratch.resize(n);
+        for (size_t k = 0; k <= n / 2; k++) scratch[k] = x[k];
+        for (size_t k = n / 2 + 1; k < n; k++) scratch[k] = std::conj(x[n - k]);
+        plan.engine->Transform(scratch.data());
+        const double scale = 1.0 / static_cast<double>(n);
+        for (size_t k = 0; k < n; k++) out[k] = scratch[k].real() * scale;
+        return;
+    }
+    
+    // Rebuild the half-length spectrum E[k] + i O[k]; its inverse interleaves
+    // the even and odd samples directly into out
+    const size_t h = n / 2;
+    Complex* z = reinterpret_cast<Complex*>(out);
+    for (size_t k = 0; k < h; k++) {
+        Complex a = x[k], b = std::conj(x[h - k]);
+        Complex even = (a + b) * 0.5;
+        Complex odd = ComplexMul((a - b) * 0.5, std::conj(plan.realTwiddles[k]));
+        z[k] = even + Complex(-odd.imag(), odd.real());
+    }
+    plan.engine->Transform(z);
+    const double scale = 1.0 / static_cast<double>(h);
+    for (size_t k = 0; k < h; k++) z[k] *= scale;
+}
+
+/**
+ * Resolves an FFT plan handle; throws on failure
+ * @param env - Environment
+ * @param value - Plan handle object
+ * @returns Plan, or null
+ */
+static std::shared_ptr<FFTPlan> ToFFTPlan(Napi::Env env, const Napi::Value& value) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "FFT plan handle object required").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    Napi::Value id = value.As<Napi::Object>().Get("id");
+    std::shared_ptr<FFTPlan> plan = id.IsNumber()
+        ? fftPlans.Get(static_cast<uint64_t>(id.As<Napi::Number>().DoubleValue()))
+        : nullptr;
+    if (!plan) {
+        Napi::Error::New(env, "Invalid FFT plan handle").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    return plan;
+}
+
+/**
+ * Creates a reusable FFT plan with precomputed bit-reversal and twiddle tables
+ * @param info - CallbackInfo containing size and optional { real, inverse }
+ * @returns Plan handle object with per-frame input and output lengths
+ */
+Napi::Value CreateFFTPlan(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        Napi::TypeError::New(env, "Transform size required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    double requested = info[0].As<Napi::Number>().DoubleValue();
+    if (!(requested >= 1) || requested > static_cast<double>(kMaxFFTSize) || requested != std::floor(requested)) {
+        Napi::RangeError::New(env, "Transform size must be an integer between 1 and 2^26").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    auto plan = std::make_shared<FFTPlan>();
+    plan->n = static_cast<size_t>(requested);
+    plan->real = false;
+    plan->inverse = false;
+    if (info.Length() > 1 && info[1].IsObject()) {
+        Napi::Object options = info[1].As<Napi::Object>();
+        plan->real = options.Get("real").IsBoolean() && options.Get("real").As<Napi::Boolean>();
+        plan->inverse = options.Get("inverse").IsBoolean() && options.Get("inverse").As<Napi::Boolean>();
+    }
+    
+    const size_t n = plan->n;
+    const size_t halfSpectrum = 2 * (n / 2 + 1);
+    if (!plan->real) {
+        plan->inputLength = plan->outputLength = 2 * n;
+        plan->engine = std::make_shared<const FFTEngine>(n, plan->inverse);
+    } else {
+        plan->inputLength = plan->inverse ? halfSpectrum : n;
+        plan->outputLength = plan->inverse ? n : halfSpectrum;
+        if (n % 2 == 0) {
+            plan->engine = std::make_shared<const FFTEngine>(n / 2, plan->inverse);
+            plan->realTwiddles.resize(n / 2 + 1);
+            for (size_t k = 0; k <= n / 2; k++) {
+                plan->realTwiddles[k] = std::polar(1.0, -2.0 * M_PI * static_cast<double>(k) / static_cast<double>(n));
+            }
+        } else {
+            plan->engine = std::make_shared<const FFTEngine>(n, plan->inverse);
+        }
+    }
+    
+    uint64_t planId = fftPlans.Insert(plan);
+    if (planId == 0) {
+        Napi::Error::New(env, "Too many FFT plan handles").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object handle = Napi::Object::New(env);
+    handle.Set("id", Napi::Number::New(env, static_cast<double>(planId)));
+    // Dropping the handle releases the plan tables
+    handle.Set("handle", Napi::External<void>::New(env, nullptr, [planId](Napi::Env, void*) {
+        fftPlans.Remove(planId);
+    }));
+    handle.Set("n", Napi::Number::New(env, static_cast<double>(n)));
+    handle.Set("real", Napi::Boolean::New(env, plan->real));
+    handle.Set("inverse", Napi::Boolean::New(env, plan->inverse));
+    handle.Set("inputLength", Napi::Number::New(env, static_cast<double>(plan->inputLength)));
+    handle.Set("outputLength", Napi::Number::New(env, static_cast<double>(plan->outputLength)));
+    return handle;
+}
+
+/**
+ * Executes a plan over one or more contiguous frames. Complex plans run in
+ * place unless an output is given; inverse transforms are scaled by 1/n.
+ * @param info - CallbackInfo containing plan handle, Float64Array input and optional Float64Array output
+ * @returns Output array
+ */
+Napi::Value ExecuteFFTPlan(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<FFTPlan> plan = ToFFTPlan(env, info[0]);
+    if (!plan) {
+        return env.Null();
+    }
+    if (info.Length() < 2 || !info[1].IsTypedArray() ||
+        info[1].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array) {
+        Napi::TypeError::New(env, "Float64Array input required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Float64Array input = info[1].As<Napi::Float64Array>();
+    size_t inputLength = input.ElementLength();
+    if (inputLength == 0 || inputLength % plan->inputLength != 0) {
+        Napi::RangeError::New(env, "Input length must be a positive multiple of the plan input length").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const size_t batch = inputLength / plan->inputLength;
+    
+    Napi::Float64Array output;
+    if (info.Length() > 2 && !info[2].IsUndefined()) {
+        if (!info[2].IsTypedArray() || info[2].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array) {
+            Napi::TypeError::New(env, "Output must be a Float64Array").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        output = info[2].As<Napi::Float64Array>();
+        if (output.ElementLength() != batch * plan->outputLength) {
+            Napi::RangeError::New(env, "Output length must match the batch output length").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else if (!plan->real) {
+        output = input;
+    } else {
+        output = Napi::Float64Array::New(env, batch * plan->outputLength);
+    }
+    
+    const double* in = input.Data();
+    double* out = output.Data();
+    bool overlap = in < out + output.ElementLength() && out < in + inputLength;
+    if (overlap && (plan->real || in != out)) {
+        Napi::RangeError::New(env, plan->real ? "Real transforms cannot run in place"
+                                              : "Output must be the input or not overlap it").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    void (*frame)(const FFTPlan&, const double*, double*) = !plan->real ? FFTComplexFrame
+        : plan->inverse ? FFTRealInverseFrame : FFTRealForwardFrame;
+    auto run = [&](size_t i) {
+        frame(*plan, in + i * plan->inputLength, out + i * plan->outputLength);
+    };
+    
+    // Spread large batches across the pool; frames are independent
+    Threading::WorkerPool& pool = Threading::WorkerPool::Instance();
+    if (batch > 1 && batch * plan->n >= (1u << 14) && pool.Size() > 1) {
+        pool.ParallelFor(batch, run);
+    } else {
+        for (size_t i = 0; i < batch; i++) run(i);
+    }
+    return output;
+}
+
+/**
+ * Destroys an FFT plan
+ * @param info - CallbackInfo containing plan handle
+ * @returns Success status
+ */
+Napi::Value DestroyFFTPlan(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!ToFFTPlan(env, info[0])) {
+        return Napi::Boolean::New(env, false);
+    }
+    uint64_t id = static_cast<uint64_t>(info[0].As<Napi::Object>().Get("id").As<Napi::Number>().DoubleValue());
+    return Napi::Boolean::New(env, fftPlans.Remove(id) != nullptr);
+}
+
+}
@@ -1,6 +1,19 @@
 #include "headers/lljs.h"
+#include "headers/handle_table.h"
+#include "headers/thread_pool.h"
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
+#include <cmath>
+#include <atomic>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <string>
+#include <vector>
 #ifdef _WIN32
 #ifndef WIN32_LEAN_AND_MEAN
 #define WIN32_LEAN_AND_MEAN
@@ -10,6 +23,7 @@
 #endif
 #include <windows.h>
 #include <psapi.h>
+#include <intrin.h>
 // Undefine problematic Windows macros
 #ifdef CopyMemory
 #undef CopyMemory
@@ -19,11 +33,433 @@
 #endif
 #else
 #include <sys/resource.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
 
 namespace LLJS::Memory {
 
+/**
+ * Index of the lowest set bit of a non-zero mask
+ * @param mask - Non-zero bit mask
+ * @returns Bit index
+ */
+static inline unsigned LowestSetBit(uint64_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+}
+
+/**
+ * Scalar mismatch search, eight bytes per step
+ * @param a - First region
+ * @param b - Second region
+ * @param length - Byte count
+ * @returns Index of the first differing byte, or length if equal
+ */
+static size_t FindMismatchScalar(const uint8_t* a, const uint8_t* b, size_t length) {
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t wordA, wordB;
+        std::memcpy(&wordA, a + i, sizeof(wordA));
+        std::memcpy(&wordB, b + i, sizeof(wordB));
+        if (wordA != wordB) {
+            break;
+        }
+    }
+    for (; i < length; i++) {
+        if (a[i] != b[i]) {
+            return i;
+        }
+    }
+    return length;
+}
+
+#ifdef LLJS_ARCH_X86
+LLJS_TARGET_SSE2
+static size_t FindMismatchSSE2(const uint8_t* a, const uint8_t* b, size_t length) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i vecA = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vecB = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(vecA, vecB))) ^ 0xFFFFu;
+        if (mask != 0) {
+            return i + LowestSetBit(mask);
+        }
+    }
+    return i + FindMismatchScalar(a + i, b + i, length - i);
+}
+
+LLJS_TARGET_AVX2
+static size_t FindMismatchAVX2(const uint8_t* a, const uint8_t* b, size_t length) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i vecA = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vecB = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vecA, vecB)));
+        if (mask != 0) {
+            return i + LowestSetBit(mask);
+        }
+    }
+    return i + FindMismatchScalar(a + i, b + i, length - i);
+}
+
+LLJS_TARGET_AVX512
+static size_t FindMismatchAVX512(const uint8_t* a, const uint8_t* b, size_t length) {
+    size_t i = 0;
+    for (; i + 64 <= length; i += 64) {
+        __mmask64 mask = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+        if (mask != 0) {
+            return i + LowestSetBit(mask);
+        }
+    }
+    return i + FindMismatchScalar(a + i, b + i, length - i);
+}
+#endif // LLJS_ARCH_X86
+
+#ifdef LLJS_ARCH_ARM64
+static size_t FindMismatchNEON(const uint8_t* a, const uint8_t* b, size_t length) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t equal = vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+        if (vminvq_u8(equal) != 0xFF) {
+            break;
+        }
+    }
+    return i + FindMismatchScalar(a + i, b + i, length - i);
+}
+#endif // LLJS_ARCH_ARM64
+
+// Mismatch search for the ISA selected at module initialization
+static size_t (*mismatchKernel)(const uint8_t*, const uint8_t*, size_t) = FindMismatchScalar;
+
+// Streaming (non-temporal) copy and fill. Stores bypass the cache so bulk
+// moves do not evict the working set; the head is copied normally until the
+// destination is vector aligned and an sfence orders the stores afterwards.
+// Copies and fills above streamingThreshold take this path automatically.
+
+static void StreamCopyScalar(uint8_t* dest, const uint8_t* src, size_t length) {
+    std::memcpy(dest, src, length);
+}
+
+static void StreamFillScalar(uint8_t* dest, uint8_t value, size_t length) {
+    std::memset(dest, value, length);
+}
+
+#ifdef LLJS_ARCH_X86
+/**
+ * Bytes to copy normally before dest reaches a width-byte boundary
+ */
+static inline size_t AlignmentHead(const uint8_t* dest, size_t width, size_t length) {
+    size_t head = (width - (reinterpret_cast<uintptr_t>(dest) & (width - 1))) & (width - 1);
+    return std::min(head, length);
+}
+
+LLJS_TARGET_SSE2
+static void StreamCopySSE2(uint8_t* dest, const uint8_t* src, size_t length) {
+    size_t i = AlignmentHead(dest, 16, length);
+    std::memcpy(dest, src, i);
+    for (; i + 64 <= length; i += 64) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + 48), d);
+    }
+    _mm_sfence();
+    std::memcpy(dest + i, src + i, length - i);
+}
+
+LLJS_TARGET_SSE2
+static void StreamFillSSE2(uint8_t* dest, uint8_t value, size_t length) {
+    size_t i = AlignmentHead(dest, 16, length);
+    std::memset(dest, value, i);
+    __m128i fill = _mm_set1_epi8(static_cast<char>(value));
+    for (; i + 64 <= length; i += 64) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i), fill);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + 16), fill);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + 32), fill);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + 48), fill);
+    }
+    _mm_sfence();
+    std::memset(dest + i, value, length - i);
+}
+
+LLJS_TARGET_AVX2
+static void StreamCopyAVX2(uint8_t* dest, const uint8_t* src, size_t length) {
+    size_t i = AlignmentHead(dest, 32, length);
+    std::memcpy(dest, src, i);
+    for (; i + 128 <= length; i += 128) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 64));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i), a);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i + 32), b);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i + 64), c);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i + 96), d);
+    }
+    _mm_sfence();
+    std::memcpy(dest + i, src + i, length - i);
+}
+
+LLJS_TARGET_AVX2
+static void StreamFillAVX2(uint8_t* dest, uint8_t value, size_t length) {
+    size_t i = AlignmentHead(dest, 32, length);
+    std::memset(dest, value, i);
+    __m256i fill = _mm256_set1_epi8(static_cast<char>(value));
+    for (; i + 128 <= length; i += 128) {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i), fill);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i + 32), fill);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i + 64), fill);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i + 96), fill);
+    }
+    _mm_sfence();
+    std::memset(dest + i, value, length - i);
+}
+
+LLJS_TARGET_AVX512
+static void StreamCopyAVX512(uint8_t* dest, const uint8_t* src, size_t length) {
+    size_t i = AlignmentHead(dest, 64, length);
+    std::memcpy(dest, src, i);
+    for (; i + 256 <= length; i += 256) {
+        __m512i a = _mm512_loadu_si512(src + i);
+        __m512i b = _mm512_loadu_si512(src + i + 64);
+        __m512i c = _mm512_loadu_si512(src + i + 128);
+        __m512i d = _mm512_loadu_si512(src + i + 192);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dest + i), a);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dest + i + 64), b);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dest + i + 128), c);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dest + i + 192), d);
+    }
+    _mm_sfence();
+    std::memcpy(dest + i, src + i, length - i);
+}
+
+LLJS_TARGET_AVX512
+static void StreamFillAVX512(uint8_t* dest, uint8_t value, size_t length) {
+    size_t i = AlignmentHead(dest, 64, length);
+    std::memset(dest, value, i);
+    __m512i fill = _mm512_set1_epi8(static_cast<char>(value));
+    for (; i + 256 <= length; i += 256) {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dest + i), fill);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dest + i + 64), fill);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dest + i + 128), fill);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dest + i + 192), fill);
+    }
+    _mm_sfence();
+    std::memset(dest + i, value, length - i);
+}
+#endif // LLJS_ARCH_X86
+
+#ifdef LLJS_ARCH_ARM64
+// stnp is a non-temporal hint on AArch64; libc copies with ldp/stp
+static void StreamCopyNEON(uint8_t* dest, const uint8_t* src, size_t length) {
+    size_t i = 0;
+#if !defined(_MSC_VER)
+    for (; i + 64 <= length; i += 64) {
+        uint8x16_t a = vld1q_u8(src + i);
+        uint8x16_t b = vld1q_u8(src + i + 16);
+        uint8x16_t c = vld1q_u8(src + i + 32);
+        uint8x16_t d = vld1q_u8(src + i + 48);
+        __asm__ volatile("stnp %q0, %q1, [%2]\n\tstnp %q3, %q4, [%2, #32]"
+                         :: "w"(a), "w"(b), "r"(dest + i), "w"(c), "w"(d) : "memory");
+    }
+#endif
+    std::memcpy(dest + i, src + i, length - i);
+}
+
+static void StreamFillNEON(uint8_t* dest, uint8_t value, size_t length) {
+    size_t i = 0;
+#if !defined(_MSC_VER)
+    uint8x16_t fill = vdupq_n_u8(value);
+    for (; i + 64 <= length; i += 64) {
+        __asm__ volatile("stnp %q0, %q0, [%1]\n\tstnp %q0, %q0, [%1, #32]" :: "w"(fill), "r"(dest + i) : "memory");
+    }
+#endif
+    std::memset(dest + i, value, length - i);
+}
+#endif // LLJS_ARCH_ARM64
+
+// Streaming kernels for the ISA selected at module initialization
+static void (*streamCopyKernel)(uint8_t*, const uint8_t*, size_t) = StreamCopyScalar;
+static void (*streamFillKernel)(uint8_t*, uint8_t, size_t) = StreamFillScalar;
+
+// Sizes above which copies stream past the cache and split across the pool.
+// The streaming threshold is half the last-level cache, so a copy that
+// would evict most of it anyway does not evict the rest. glibc memcpy
+// already switches to non-temporal stores near that size and its large-copy
+// loop is faster than ours, so automatic streaming there is fill-only.
+static size_t streamingThreshold = size_t(4) << 20;
+#ifdef __GLIBC__
+static constexpr bool kAutoStreamCopies = false;
+#else
+static constexpr bool kAutoStreamCopies = true;
+#endif
+static constexpr size_t kParallelCopyThreshold = size_t(64) << 20;
+static constexpr size_t kParallelCopyMinChunk = size_t(1) << 20;
+
+/**
+ * Selects the memory kernels for the detected ISA. Cached copy and fill stay
+ * on libc memcpy/memset, which already dispatch on the running CPU; only the
+ * streaming kernels are ours.
+ * @param isa - ISA level from CPU::DetectISA
+ */
+void InitKernels(SIMD::ISA isa) {
+    switch (isa) {
+#ifdef LLJS_ARCH_X86
+        case SIMD::ISA::AVX512:
+            mismatchKernel = FindMismatchAVX512;
+            streamCopyKernel = StreamCopyAVX512;
+            streamFillKernel = StreamFillAVX512;
+            break;
+        case SIMD::ISA::AVX2:
+            mismatchKernel = FindMismatchAVX2;
+            streamCopyKernel = StreamCopyAVX2;
+            streamFillKernel = StreamFillAVX2;
+            break;
+        case SIMD::ISA::SSE2:
+            mismatchKernel = FindMismatchSSE2;
+            streamCopyKernel = StreamCopySSE2;
+            streamFillKernel = StreamFillSSE2;
+            break;
+#endif
+#ifdef LLJS_ARCH_ARM64
+        case SIMD::ISA::NEON:
+            mismatchKernel = FindMismatchNEON;
+            streamCopyKernel = StreamCopyNEON;
+            streamFillKernel = StreamFillNEON;
+            break;
+#endif
+        default:
+            mismatchKernel = FindMismatchScalar;
+            streamCopyKernel = StreamCopyScalar;
+            streamFillKernel = StreamFillScalar;
+            break;
+    }
+    
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+    long lastLevel = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (lastLevel > 0) {
+        streamingThreshold = std::max<size_t>(static_cast<size_t>(lastLevel) / 2, size_t(1) << 20);
+    }
+#endif
+}
+
+/**
+ * Finds the first differing byte of two regions
+ * @param a - First region
+ * @param b - Second region
+ * @param length - Byte count
+ * @returns Index of the first differing byte, or length if equal
+ */
+size_t FindMismatch(const uint8_t* a, const uint8_t* b, size_t length) {
+    return mismatchKernel(a, b, length);
+}
+
+// Process-wide pool counters reported by getMemoryUsage
+static std::atomic<uint64_t> poolCount{0};
+static std::atomic<uint64_t> poolReservedBytes{0};
+static std::atomic<uint64_t> poolUsedBytes{0};
+static std::atomic<uint64_t> poolAllocations{0};
+static std::atomic<uint64_t> poolReleases{0};
+static std::atomic<uint64_t> poolResets{0};
+
+// Which allocator a tracked buffer came from, so it is freed by the same one
+enum class AllocationKind { Malloc, Aligned, Mapped };
+
+// Live buffers from allocateBuffer/alignedAlloc/allocateOnNode, keyed by data
+// pointer so freeBuffer can release them before the GC gets to their finalizers
+struct NativeAllocation {
+    uint8_t* data;
+    size_t size;
+    AllocationKind kind;
+    size_t mappedLength; // page-rounded length for Mapped
+    std::atomic<bool> released{false};
+};
+
+static std::mutex allocationMutex;
+static std::unordered_map<uintptr_t, std::shared_ptr<NativeAllocation>> liveAllocations;
+static std::atomic<uint64_t> nativeBufferCount{0};
+static std::atomic<uint64_t> nativeBufferBytes{0};
+
+/**
+ * Frees a tracked allocation exactly once and reports it to V8
+ * @param env - Environment
+ * @param allocation - Allocation to free
+ * @returns True if this call freed it
+ */
+static bool ReleaseAllocation(Napi::Env env, const std::shared_ptr<NativeAllocation>& allocation) {
+    if (allocation->released.exchange(true)) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(allocationMutex);
+        auto it = liveAllocations.find(reinterpret_cast<uintptr_t>(allocation->data));
+        if (it != liveAllocations.end() && it->second == allocation) {
+            liveAllocations.erase(it);
+        }
+    }
+#ifdef _WIN32
+    if (allocation->kind == AllocationKind::Mapped) {
+        VirtualFree(allocation->data, 0, MEM_RELEASE);
+    } else if (allocation->kind == AllocationKind::Aligned) {
+        _aligned_free(allocation->data);
+    } else {
+        free(allocation->data);
+    }
+#else
+    if (allocation->kind == AllocationKind::Mapped) {
+        munmap(allocation->data, allocation->mappedLength);
+    } else {
+        free(allocation->data);
+    }
+#endif
+    nativeBufferCount--;
+    nativeBufferBytes -= allocation->size;
+    Napi::MemoryManagement::AdjustExternalMemory(env, -static_cast<int64_t>(allocation->size));
+    return true;
+}
+
+/**
+ * Wraps native memory in a tracked Buffer whose size V8 counts toward GC pressure
+ * @param env - Environment
+ * @param data - Memory from malloc, the aligned allocator or a page mapping
+ * @param size - Size in bytes
+ * @param kind - Allocator that produced data
+ * @param mappedLength - Mapping length for Mapped allocations
+ * @returns Buffer owning data
+ */
+static Napi::Value WrapAllocation(Napi::Env env, uint8_t* data, size_t size, AllocationKind kind, size_t mappedLength = 0) {
+    auto allocation = std::make_shared<NativeAllocation>();
+    allocation->data = data;
+    allocation->size = size;
+    allocation->kind = kind;
+    allocation->mappedLength = mappedLength;
+    {
+        std::lock_guard<std::mutex> lock(allocationMutex);
+        liveAllocations[reinterpret_cast<uintptr_t>(data)] = allocation;
+    }
+    nativeBufferCount++;
+    nativeBufferBytes += size;
+    Napi::MemoryManagement::AdjustExternalMemory(env, static_cast<int64_t>(size));
+    
+    return Napi::Buffer<uint8_t>::New(env, data, size, [allocation](Napi::Env env, uint8_t*) {
+        ReleaseAllocation(env, allocation);
+    });
+}
+
 /**
  * Allocates a raw memory buffer
  * @param info - CallbackInfo containing size parameter
@@ -45,10 +481,7 @@ Napi::Value AllocateBuffer(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
-    return Napi::Buffer<uint8_t>::New(env, static_cast<uint8_t*>(ptr), size,
-        [](Napi::Env env, uint8_t* data) {
-            free(data);
-        });
+    return WrapAllocation(env, static_cast<uint8_t*>(ptr), size, AllocationKind::Malloc);
 }
 
 /**
@@ -64,14 +497,84 @@ Napi::Value FreeBuffer(const Napi::CallbackInfo& info) {
         return Napi::Boolean::New(env, false);
     }
     
-    // Note: Node.js manages buffer memory automatically
-    // This function exists for API completeness
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+    std::shared_ptr<NativeAllocation> allocation;
+    {
+        std::lock_guard<std::mutex> lock(allocationMutex);
+        auto it = liveAllocations.find(reinterpret_cast<uintptr_t>(buffer.Data()));
+        if (it != liveAllocations.end()) {
+            allocation = it->second;
+        }
+    }
+    // Only memory from allocateBuffer/alignedAlloc is ours to free
+    if (!allocation) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    // Detach first so no view can reach the memory once it is freed.
+    // The finalizer may run during the detach; ReleaseAllocation is idempotent.
+    if (napi_detach_arraybuffer(env, buffer.ArrayBuffer()) != napi_ok) {
+        return Napi::Boolean::New(env, false);
+    }
+    ReleaseAllocation(env, allocation);
     return Napi::Boolean::New(env, true);
 }
 
+// How a bulk copy or fill is carried out; Auto picks by size
+struct BulkOptions {
+    int streaming = -1; // -1 auto, 0 cached, 1 non-temporal
+    int parallel = -1;  // -1 auto, 0 calling thread only, 1 split across the pool
+};
+
+/**
+ * Reads {streaming, parallel} booleans for copyMemory/setMemory
+ * @param value - Options object or undefined
+ * @returns Options with unset fields left on auto
+ */
+static BulkOptions ToBulkOptions(const Napi::Value& value) {
+    BulkOptions options;
+    if (value.IsObject()) {
+        Napi::Object object = value.As<Napi::Object>();
+        Napi::Value streaming = object.Get("streaming");
+        Napi::Value parallel = object.Get("parallel");
+        if (streaming.IsBoolean()) options.streaming = streaming.As<Napi::Boolean>() ? 1 : 0;
+        if (parallel.IsBoolean()) options.parallel = parallel.As<Napi::Boolean>() ? 1 : 0;
+    }
+    return options;
+}
+
+/**
+ * Runs a bulk byte operation over [0, size), split into page-aligned chunks
+ * on the worker pool when parallel
+ * @param size - Byte count
+ * @param options - Streaming/parallel choice
+ * @param autoStream - Whether sizes above streamingThreshold stream when options leave it on auto
+ * @param body - Operation over (offset, length, streaming)
+ */
+template <typename Body>
+static void RunBulk(size_t size, const BulkOptions& options, bool autoStream, const Body& body) {
+    bool streaming = options.streaming < 0 ? autoStream && size >= streamingThreshold : options.streaming == 1;
+    bool parallel = options.parallel < 0 ? size >= kParallelCopyThreshold : options.parallel == 1;
+    
+    Threading::WorkerPool& pool = Threading::WorkerPool::Instance();
+    if (!parallel || pool.Size() <= 1 || size <= kParallelCopyMinChunk) {
+        body(0, size, streaming);
+        return;
+    }
+    // A few chunks per thread so stragglers are absorbed by stealing
+    size_t chunk = (size / (4 * (pool.Size() + 1)) + 4095) & ~size_t(4095);
+    chunk = std::max(chunk, kParallelCopyMinChunk);
+    const size_t chunks = (size + chunk - 1) / chunk;
+    pool.ParallelFor(chunks, [&](size_t index) {
+        size_t begin = index * chunk;
+        body(begin, std::min(chunk, size - begin), streaming);
+    });
+}
+
 /**
  * Copies memory from source to destination
- * @param info - CallbackInfo containing dest, src, size parameters
+ * @param info - CallbackInfo containing dest, src, size and optional
+ *               {streaming, parallel}; both default to size thresholds
  * @returns Boolean indicating success
  */
 Napi::Value CopyMemory(const Napi::CallbackInfo& info) {
@@ -84,20 +587,37 @@ Napi::Value CopyMemory(const Napi::CallbackInfo& info) {
     
     Napi::Buffer<uint8_t> dest = info[0].As<Napi::Buffer<uint8_t>>();
     Napi::Buffer<uint8_t> src = info[1].As<Napi::Buffer<uint8_t>>();
-    size_t size = info[2].As<Napi::Number>().Uint32Value();
+    double requested = info[2].As<Napi::Number>().DoubleValue();
     
-    if (size > dest.Length() || size > src.Length()) {
+    if (!(requested >= 0) || requested > static_cast<double>(dest.Length()) || requested > static_cast<double>(src.Length())) {
         Napi::RangeError::New(env, "Size exceeds buffer length").ThrowAsJavaScriptException();
         return Napi::Boolean::New(env, false);
     }
+    size_t size = static_cast<size_t>(requested);
+    
+    uint8_t* to = dest.Data();
+    const uint8_t* from = src.Data();
+    if (to < from + size && from < to + size) {
+        // Overlapping regions cannot be split or streamed safely
+        std::memmove(to, from, size);
+        return Napi::Boolean::New(env, true);
+    }
     
-    std::memcpy(dest.Data(), src.Data(), size);
+    RunBulk(size, ToBulkOptions(info.Length() > 3 ? info[3] : env.Undefined()), kAutoStreamCopies,
+            [&](size_t offset, size_t length, bool streaming) {
+        if (streaming) {
+            streamCopyKernel(to + offset, from + offset, length);
+        } else {
+            std::memcpy(to + offset, from + offset, length);
+        }
+    });
     return Napi::Boolean::New(env, true);
 }
 
 /**
  * Sets memory to a specific value
- * @param info - CallbackInfo containing buffer, value, size parameters
+ * @param info - CallbackInfo containing buffer, value, size and optional
+ *               {streaming, parallel}; both default to size thresholds
  * @returns Boolean indicating success
  */
 Napi::Value SetMemory(const Napi::CallbackInfo& info) {
@@ -109,15 +629,24 @@ Napi::Value SetMemory(const Napi::CallbackInfo& info) {
     }
     
     Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
-    int value = info[1].As<Napi::Number>().Int32Value();
-    size_t size = info[2].As<Napi::Number>().Uint32Value();
+    uint8_t value = static_cast<uint8_t>(info[1].As<Napi::Number>().Int32Value());
+    double requested = info[2].As<Napi::Number>().DoubleValue();
     
-    if (size > buffer.Length()) {
+    if (!(requested >= 0) || requested > static_cast<double>(buffer.Length())) {
         Napi::RangeError::New(env, "Size exceeds buffer length").ThrowAsJavaScriptException();
         return Napi::Boolean::New(env, false);
     }
+    size_t size = static_cast<size_t>(requested);
     
-    std::memset(buffer.Data(), value, size);
+    uint8_t* data = buffer.Data();
+    RunBulk(size, ToBulkOptions(info.Length() > 3 ? info[3] : env.Undefined()), true,
+            [&](size_t offset, size_t length, bool streaming) {
+        if (streaming) {
+            streamFillKernel(data + offset, value, length);
+        } else {
+            std::memset(data + offset, value, length);
+        }
+    });
     return Napi::Boolean::New(env, true);
 }
 
@@ -143,8 +672,11 @@ Napi::Value CompareMemory(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
-    int result = std::memcmp(buffer1.Data(), buffer2.Data(), size);
-    return Napi::Number::New(env, result);
+    size_t mismatch = FindMismatch(buffer1.Data(), buffer2.Data(), size);
+    if (mismatch == size) {
+        return Napi::Number::New(env, 0);
+    }
+    return Napi::Number::New(env, buffer1.Data()[mismatch] < buffer2.Data()[mismatch] ? -1 : 1);
 }
 
 /**
@@ -173,13 +705,189 @@ Napi::Value GetMemoryUsage(const Napi::CallbackInfo& info) {
     }
 #endif
     
+    Napi::Object poolStats = Napi::Object::New(env);
+    poolStats.Set("count", Napi::Number::New(env, static_cast<double>(poolCount.load())));
+    poolStats.Set("reservedBytes", Napi::Number::New(env, static_cast<double>(poolReservedBytes.load())));
+    poolStats.Set("usedBytes", Napi::Number::New(env, static_cast<double>(poolUsedBytes.load())));
+    poolStats.Set("allocations", Napi::Number::New(env, static_cast<double>(poolAllocations.load())));
+    poolStats.Set("releases", Napi::Number::New(env, static_cast<double>(poolReleases.load())));
+    poolStats.Set("resets", Napi::Number::New(env, static_cast<double>(poolResets.load())));
+    result.Set("pools", poolStats);
+    
+    Napi::Object bufferStats = Napi::Object::New(env);
+    bufferStats.Set("count", Napi::Number::New(env, static_cast<double>(nativeBufferCount.load())));
+    bufferStats.Set("bytes", Napi::Number::New(env, static_cast<double>(nativeBufferBytes.load())));
+    result.Set("buffers", bufferStats);
+    
     return result;
 }
 
+/**
+ * Gets the system page size
+ * @returns Page size in bytes
+ */
+static size_t PageSize() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// Page-mapped alignedAlloc request and what the OS actually granted
+struct PageRequest {
+    size_t hugePageSize = 0;  // 2M or 1G explicit huge pages, 0 for none
+    bool transparent = false; // ask for transparent huge pages
+    bool lock = false;
+    bool prefault = false;
+    size_t grantedPageSize = 0;
+    bool grantedTransparent = false;
+    bool grantedLock = false;
+};
+
+#ifdef _WIN32
+/**
+ * Enables SeLockMemoryPrivilege for the process token, which large pages require
+ * @returns True if the privilege is held
+ */
+static bool EnableLockMemoryPrivilege() {
+    static const bool enabled = []() {
+        HANDLE token;
+        if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token)) {
+            return false;
+        }
+        TOKEN_PRIVILEGES privileges = {};
+        privileges.PrivilegeCount = 1;
+        privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+        bool ok = LookupPrivilegeValueA(nullptr, "SeLockMemoryPrivilege", &privileges.Privileges[0].Luid) &&
+                  AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) &&
+                  GetLastError() == ERROR_SUCCESS;
+        CloseHandle(token);
+        return ok;
+    }();
+    return enabled;
+}
+#endif
+
+/**
+ * Maps page-backed memory with the requested page size, locking and prefaulting.
+ * Explicit huge pages fall back to transparent ones, then to base pages, when
+ * none are reserved; request records what was granted.
+ * @param length - Bytes to map
+ * @param alignment - Power-of-two alignment of the returned address
+ * @param request - Requested modes; granted fields are filled in
+ * @param mappedLength - Receives the length to unmap
+ * @returns Mapping or nullptr
+ */
+static uint8_t* MapPages(size_t length, size_t alignment, PageRequest& request, size_t& mappedLength) {
+    size_t page = PageSize();
+    uint8_t* data = nullptr;
+    
+#ifdef _WIN32
+    // Large pages are always locked; the minimum large page (2M on x64) is the only size offered
+    size_t largePage = GetLargePageMinimum();
+    if (request.hugePageSize && largePage && alignment <= largePage && EnableLockMemoryPrivilege()) {
+        mappedLength = (length + largePage - 1) / largePage * largePage;
+        data = static_cast<uint8_t*>(VirtualAlloc(nullptr, mappedLength, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                                                  PAGE_READWRITE));
+        if (data) {
+            request.grantedPageSize = largePage;
+            request.grantedLock = true;
+            return data;
+        }
+    }
+    // VirtualAlloc returns allocation-granularity (64K) aligned memory
+    SYSTEM_INFO system;
+    GetSystemInfo(&system);
+    if (alignment > system.dwAllocationGranularity) {
+        return nullptr;
+    }
+    mappedLength = (length + page - 1) / page * page;
+    data = static_cast<uint8_t*>(VirtualAlloc(nullptr, mappedLength, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+    if (!data) {
+        return nullptr;
+    }
+    request.grantedPageSize = page;
+    if (request.lock) {
+        SIZE_T minimum, maximum;
+        if (GetProcessWorkingSetSize(GetCurrentProcess(), &minimum, &maximum)) {
+            SetProcessWorkingSetSize(GetCurrentProcess(), minimum + mappedLength, maximum + mappedLength);
+        }
+        request.grantedLock = VirtualLock(data, mappedLength) != 0;
+    }
+#else
+    auto mapAligned = [&](size_t granule, int flags) -> uint8_t* {
+        size_t rounded = (length + granule - 1) / granule * granule;
+        size_t slack = alignment > granule ? alignment - granule : 0;
+        void* base = mmap(nullptr, rounded + slack, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+        if (base == MAP_FAILED) {
+            return nullptr;
+        }
+        // Trim the over-mapped head and tail so the kept range starts aligned
+        uintptr_t start = reinterpret_cast<uintptr_t>(base);
+        uintptr_t aligned = (start + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        if (aligned > start) {
+            munmap(base, aligned - start);
+        }
+        size_t tail = slack - (aligned - start);
+        if (tail) {
+            munmap(reinterpret_cast<void*>(aligned + rounded), tail);
+        }
+        mappedLength = rounded;
+        return reinterpret_cast<uint8_t*>(aligned);
+    };
+    
+#ifdef MAP_HUGETLB
+    if (request.hugePageSize) {
+        int encoded = (request.hugePageSize == (size_t(1) << 30) ? 30 : 21) << MAP_HUGE_SHIFT;
+        data = mapAligned(request.hugePageSize, MAP_HUGETLB | encoded);
+        if (data) {
+            request.grantedPageSize = request.hugePageSize;
+        }
+    }
+#endif
+    if (!data) {
+        bool transparent = false;
+#ifdef MADV_HUGEPAGE
+        transparent = request.transparent || request.hugePageSize;
+#endif
+        // Transparent huge pages only back 2M-aligned extents
+        size_t transparentAlignment = size_t(2) << 20;
+        if (transparent && alignment < transparentAlignment) {
+            alignment = transparentAlignment;
+        }
+        data = mapAligned(page, 0);
+        if (!data) {
+            return nullptr;
+        }
+        request.grantedPageSize = page;
+#ifdef MADV_HUGEPAGE
+        request.grantedTransparent = transparent && madvise(data, mappedLength, MADV_HUGEPAGE) == 0;
+#endif
+    }
+    if (request.lock) {
+        // mlock also faults every page in
+        request.grantedLock = mlock(data, mappedLength) == 0;
+    }
+#endif
+    
+    if (request.prefault && !request.grantedLock) {
+        size_t stride = request.grantedPageSize ? request.grantedPageSize : page;
+        for (size_t offset = 0; offset < mappedLength; offset += stride) {
+            data[offset] = 0;
+        }
+    }
+    return data;
+}
+
 /**
  * Allocates aligned memory
- * @param info - CallbackInfo containing size and alignment parameters
- * @returns Buffer object or null on failure
+ * @param info - CallbackInfo containing size and alignment parameters, and
+ *               optional {hugePages: '2M' | '1G' | 'transparent', lock, prefault}
+ * @returns Buffer object or null on failure; with options it carries pageSize,
+ *          transparentHugePages and locked describing what the OS granted
  */
 Napi::Value AlignedAlloc(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
@@ -189,28 +897,238 @@ Napi::Value AlignedAlloc(const Napi::CallbackInfo& info) {
         return env.Null();
     }
     
-    size_t size = info[0].As<Napi::Number>().Uint32Value();
-    size_t alignment = info[1].As<Napi::Number>().Uint32Value();
-    
+    if (info.Length() < 3 || !info[2].IsObject()) {
+        size_t size = info[0].As<Napi::Number>().Uint32Value();
+        size_t alignment = info[1].As<Napi::Number>().Uint32Value();
+        
 #ifdef _WIN32
-    void* ptr = _aligned_malloc(size, alignment);
+        void* ptr = _aligned_malloc(size, alignment);
 #else
-    void* ptr = aligned_alloc(alignment, size);
+        void* ptr = aligned_alloc(alignment, size);
 #endif
+        
+        if (!ptr) {
+            Napi::Error::New(env, "Aligned memory allocation failed").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        return WrapAllocation(env, static_cast<uint8_t*>(ptr), size, AllocationKind::Aligned);
+    }
     
-    if (!ptr) {
+    double requested = info[0].As<Napi::Number>().DoubleValue();
+    double alignmentValue = info[1].As<Napi::Number>().DoubleValue();
+    if (!(requested > 0) || requested > 9007199254740991.0) {
+        Napi::RangeError::New(env, "Size must be greater than 0").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    size_t alignment = alignmentValue >= 1 && alignmentValue <= 1073741824.0 ? static_cast<size_t>(alignmentValue) : 0;
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        Napi::RangeError::New(env, "Alignment must be a power of 2 up to 1G").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    size_t size = static_cast<size_t>(requested);
+    
+    Napi::Object options = info[2].As<Napi::Object>();
+    PageRequest request;
+    Napi::Value hugePages = options.Get("hugePages");
+    if (hugePages.IsString()) {
+        std::string mode = hugePages.As<Napi::String>().Utf8Value();
+        if (mode == "2M") {
+            request.hugePageSize = size_t(2) << 20;
+        } else if (mode == "1G") {
+            request.hugePageSize = size_t(1) << 30;
+        } else if (mode == "transparent") {
+            request.transparent = true;
+        } else {
+            Napi::TypeError::New(env, "hugePages must be '2M', '1G' or 'transparent'").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else if (!hugePages.IsUndefined()) {
+        Napi::TypeError::New(env, "hugePages must be '2M', '1G' or 'transparent'").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    Napi::Value lock = options.Get("lock");
+    Napi::Value prefault = options.Get("prefault");
+    request.lock = lock.IsBoolean() && lock.As<Napi::Boolean>();
+    request.prefault = prefault.IsBoolean() && prefault.As<Napi::Boolean>();
+    
+    size_t mappedLength = 0;
+    uint8_t* data = MapPages(size, alignment, request, mappedLength);
+    if (!data) {
         Napi::Error::New(env, "Aligned memory allocation failed").ThrowAsJavaScriptException();
         return env.Null();
     }
     
-    return Napi::Buffer<uint8_t>::New(env, static_cast<uint8_t*>(ptr), size,
-        [](Napi::Env env, uint8_t* data) {
+    Napi::Value buffer = WrapAllocation(env, data, size, AllocationKind::Mapped, mappedLength);
+    if (buffer.IsObject()) {
+        Napi::Object result = buffer.As<Napi::Object>();
+        result.Set("pageSize", Napi::Number::New(env, static_cast<double>(request.grantedPageSize)));
+        result.Set("transparentHugePages", Napi::Boolean::New(env, request.grantedTransparent));
+        result.Set("locked", Napi::Boolean::New(env, request.grantedLock));
+    }
+    return buffer;
+}
+
+/**
+ * Allocates page-backed memory placed on specific NUMA nodes
+ * @param info - CallbackInfo containing size, a node index or array of nodes,
+ *               and policy ('bind' | 'preferred' | 'interleave', default 'bind')
+ * @returns Buffer object or null on failure
+ */
+Napi::Value AllocateOnNode(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsNumber() || !(info[1].IsNumber() || info[1].IsArray())) {
+        Napi::TypeError::New(env, "Size and NUMA node (or array of nodes) required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    double requested = info[0].As<Napi::Number>().DoubleValue();
+    if (!(requested > 0) || requested > 9007199254740991.0) {
+        Napi::RangeError::New(env, "Size must be greater than 0").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    size_t size = static_cast<size_t>(requested);
+    
+    std::vector<uint32_t> nodes;
+    Napi::Array list = info[1].IsArray() ? info[1].As<Napi::Array>() : Napi::Array::New(env, 1);
+    if (info[1].IsNumber()) {
+        list.Set(0u, info[1]);
+    }
+    for (uint32_t i = 0; i < list.Length(); i++) {
+        Napi::Value entry = list.Get(i);
+        double node = entry.IsNumber() ? entry.As<Napi::Number>().DoubleValue() : -1;
+        if (!(node >= 0 && node < 1024) || node != std::floor(node)) {
+            Napi::RangeError::New(env, "NUMA node must be an integer between 0 and 1023").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        nodes.push_back(static_cast<uint32_t>(node));
+    }
+    if (nodes.empty()) {
+        Napi::RangeError::New(env, "At least one NUMA node required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string policy = info.Length() >= 3 && info[2].IsString() ? info[2].As<Napi::String>().Utf8Value() : "bind";
+    if (policy != "bind" && policy != "preferred" && policy != "interleave") {
+        Napi::TypeError::New(env, "Policy must be 'bind', 'preferred' or 'interleave'").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    size_t page = PageSize();
+    size_t length = (size + page - 1) / page * page;
+    
 #ifdef _WIN32
-            _aligned_free(data);
+    // VirtualAllocExNuma takes a single preferred node; the pages come from it when it has memory
+    if (nodes.size() != 1) {
+        Napi::Error::New(env, "Windows NUMA allocation supports a single node").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    void* ptr = VirtualAllocExNuma(GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT,
+                                   PAGE_READWRITE, nodes[0]);
+    if (!ptr) {
+        Napi::Error::New(env, "NUMA memory allocation failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+#else
+    void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        Napi::Error::New(env, "NUMA memory allocation failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    bool placed = true;
+    int error = ENOSYS;
+#ifdef __linux__
+    // The policy applies at first touch, so nothing is faulted in yet
+    std::vector<unsigned long> mask(1024 / (8 * sizeof(unsigned long)), 0);
+    for (uint32_t node : nodes) {
+        mask[node / (8 * sizeof(unsigned long))] |= 1UL << (node % (8 * sizeof(unsigned long)));
+    }
+    int mode = policy == "interleave" ? MPOL_INTERLEAVE : policy == "preferred" ? MPOL_PREFERRED : MPOL_BIND;
+    if (syscall(SYS_mbind, ptr, length, mode, mask.data(), mask.size() * 8 * sizeof(unsigned long) + 1, 0) != 0) {
+        // Kernels without NUMA support only have node 0, which is already where the pages land
+        error = errno;
+        placed = error == ENOSYS && nodes.size() == 1 && nodes[0] == 0;
+    }
+#else
+    placed = nodes.size() == 1 && nodes[0] == 0;
+#endif
+    if (!placed) {
+        munmap(ptr, length);
+        Napi::Error::New(env, std::string("Failed to apply NUMA policy: ") + std::strerror(error)).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+#endif
+    
+    return WrapAllocation(env, static_cast<uint8_t*>(ptr), size, AllocationKind::Mapped, length);
+}
+
+/**
+ * Gets the NUMA node backing a byte of a buffer without touching its page
+ * @param info - CallbackInfo containing buffer and optional byte offset (safe integer or BigInt)
+ * @returns Node index, or -1 if the page is not resident or the OS cannot report it
+ */
+Napi::Value GetMemoryNode(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsBuffer()) {
+        Napi::TypeError::New(env, "Buffer parameter required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+    uint64_t offset = 0;
+    if (info.Length() >= 2 && info[1].IsBigInt()) {
+        bool lossless = false;
+        offset = info[1].As<Napi::BigInt>().Uint64Value(&lossless);
+        if (!lossless) {
+            Napi::RangeError::New(env, "Offset must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else if (info.Length() >= 2 && info[1].IsNumber()) {
+        double requested = info[1].As<Napi::Number>().DoubleValue();
+        if (!(requested >= 0) || requested > 9007199254740991.0 || requested != std::floor(requested)) {
+            Napi::RangeError::New(env, "Offset must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        offset = static_cast<uint64_t>(requested);
+    }
+    if (offset >= buffer.Length()) {
+        Napi::RangeError::New(env, "Offset out of range").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // Never write to the page: the Buffer may be a read-only mapping or shared with other threads
+    uint8_t* byte = buffer.Data() + offset;
+    
+#if defined(__linux__) && defined(SYS_move_pages)
+    // move_pages with no target nodes only reports where each page lives
+    uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    void* page = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(byte) & ~(pageSize - 1));
+    int status = -1;
+    if (syscall(SYS_move_pages, 0, 1UL, &page, nullptr, &status, 0) != 0) {
+        return Napi::Number::New(env, errno == ENOSYS ? 0 : -1);
+    }
+    return Napi::Number::New(env, status >= 0 ? status : -1); // -ENOENT: not resident
+#elif defined(__linux__)
+    (void)*reinterpret_cast<volatile uint8_t*>(byte);
+    int node = -1;
+    if (syscall(SYS_get_mempolicy, &node, nullptr, 0, byte, MPOL_F_NODE | MPOL_F_ADDR) != 0) {
+        return Napi::Number::New(env, errno == ENOSYS ? 0 : -1);
+    }
+    return Napi::Number::New(env, node);
+#elif defined(_WIN32)
+    PSAPI_WORKING_SET_EX_INFORMATION query = {};
+    query.VirtualAddress = byte;
+    if (!QueryWorkingSetEx(GetCurrentProcess(), &query, sizeof(query)) || !query.VirtualAttributes.Valid) {
+        return Napi::Number::New(env, -1);
+    }
+    return Napi::Number::New(env, static_cast<double>(query.VirtualAttributes.Node));
 #else
-            free(data);
+    (void)byte;
+    return Napi::Number::New(env, -1);
 #endif
-        });
 }
 
 /**
@@ -281,4 +1199,497 @@ Napi::Value SetPointerValue(const Napi::CallbackInfo& info) {
     }
 }
 
-}
\ No newline at end of file
+// Buffer pools. Slabs are exposed to JS as external ArrayBuffers and every
+// allocation is a Uint8Array view into one, so the hot path needs neither
+// malloc nor a per-buffer finalizer. A slab's memory is shared between its
+// pool and its ArrayBuffer and is freed when both are gone, so a stale view
+// can alias a reused block but never dangles.
+
+static constexpr size_t kDefaultSlabSize = 1 << 20;
+static constexpr size_t kDefaultAlignment = 64;
+static constexpr size_t kMaxPoolAllocation = static_cast<size_t>(1) << 31;
+static const size_t kDefaultSizeClasses[] = { 256, 1024, 4096, 16384, 65536 };
+
+struct PoolMemory {
+    uint8_t* data;
+    size_t size;
+
+    ~PoolMemory() {
+#ifdef _WIN32
+        _aligned_free(data);
+#else
+        free(data);
+#endif
+        poolReservedBytes -= size;
+    }
+};
+
+enum class SlabKind {
+    Class,      // Fixed-size blocks of one size class
+    Arena,      // Bump-pointer region, reclaimed by reset
+    Large,      // One allocation above the largest class
+    ArenaLarge  // One arena allocation above the slab size
+};
+
+struct PoolSlab {
+    std::shared_ptr<PoolMemory> memory;
+    SlabKind kind;
+    size_t classIndex;
+    size_t blockSize;
+    uint32_t jsIndex;
+    std::vector<bool> used;
+    size_t bump = 0;
+};
+
+struct FreeBlock {
+    PoolSlab* slab;
+    uint32_t index;
+};
+
+struct BufferPool {
+    napi_env env;
+    size_t slabSize;
+    size_t alignment;
+    std::vector<size_t> classes;
+    std::vector<std::vector<FreeBlock>> freeLists;
+    std::map<uintptr_t, PoolSlab> slabs; // Keyed by base address
+    std::vector<PoolSlab*> arenaSlabs;
+    size_t arenaCursor = 0;
+    size_t used = 0;
+
+    ~BufferPool() {
+        poolUsedBytes -= used;
+        poolCount--;
+    }
+};
+
+static HandleTable<BufferPool> pools;
+
+static size_t RoundUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * Resolves a pool handle for the calling environment; throws on failure
+ * @param env - Environment
+ * @param value - Pool handle object
+ * @param handle - Receives the handle object
+ * @returns Pool, or null
+ */
+static std::shared_ptr<BufferPool> ToPool(Napi::Env env, const Napi::Value& value, Napi::Object& handle) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "Pool handle object required").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    handle = value.As<Napi::Object>();
+    Napi::Value id = handle.Get("id");
+    std::shared_ptr<BufferPool> pool = id.IsNumber()
+        ? pools.Get(static_cast<uint64_t>(id.As<Napi::Number>().DoubleValue()))
+        : nullptr;
+    if (!pool || pool->env != static_cast<napi_env>(env)) {
+        Napi::Error::New(env, "Invalid pool handle").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    return pool;
+}
+
+/**
+ * Reads an allocation size argument; throws on failure
+ * @param env - Environment
+ * @param value - Size value
+ * @param size - Receives the size
+ * @returns True when size is a valid byte count
+ */
+static bool ToPoolSize(Napi::Env env, const Napi::Value& value, size_t& size) {
+    if (!value.IsNumber()) {
+        Napi::TypeError::New(env, "Size parameter required").ThrowAsJavaScriptException();
+        return false;
+    }
+    double requested = value.As<Napi::Number>().DoubleValue();
+    if (!(requested >= 0) || requested > static_cast<double>(kMaxPoolAllocation) || requested != std::floor(requested)) {
+        Napi::RangeError::New(env, "Size must be a non-negative integer up to 2 GiB").ThrowAsJavaScriptException();
+        return false;
+    }
+    size = static_cast<size_t>(requested);
+    return true;
+}
+
+/**
+ * Allocates a slab and exposes it as an ArrayBuffer
+ * @param env - Environment
+ * @param handle - Pool handle; Class and Arena slabs are kept in its slabs array
+ * @param pool - Pool
+ * @param kind - Slab kind
+ * @param bytes - Slab size
+ * @param blockSize - Block size for Class slabs
+ * @param classIndex - Size class for Class slabs
+ * @param buffer - Receives the slab ArrayBuffer
+ * @returns Slab, or null on allocation failure (exception pending)
+ */
+static PoolSlab* AddSlab(Napi::Env env, Napi::Object& handle, BufferPool& pool, SlabKind kind,
+                         size_t bytes, size_t blockSize, size_t classIndex, Napi::ArrayBuffer& buffer) {
+    bytes = RoundUp(bytes > 0 ? bytes : pool.alignment, pool.alignment);
+#ifdef _WIN32
+    void* data = _aligned_malloc(bytes, pool.alignment);
+#else
+    void* data = aligned_alloc(pool.alignment, bytes);
+#endif
+    if (!data) {
+        Napi::Error::New(env, "Memory allocation failed").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    poolReservedBytes += bytes;
+    auto memory = std::shared_ptr<PoolMemory>(new PoolMemory{ static_cast<uint8_t*>(data), bytes });
+
+    // The ArrayBuffer co-owns the memory so views outlive release, reset and destroy.
+    // V8 is charged for the slab while the ArrayBuffer is reachable.
+    Napi::MemoryManagement::AdjustExternalMemory(env, static_cast<int64_t>(bytes));
+    buffer = Napi::ArrayBuffer::New(env, data, bytes, [memory](Napi::Env env, void*) {
+        Napi::MemoryManagement::AdjustExternalMemory(env, -static_cast<int64_t>(memory->size));
+    });
+
+    PoolSlab& slab = pool.slabs[reinterpret_cast<uintptr_t>(data)];
+    slab.memory = memory;
+    slab.kind = kind;
+    slab.classIndex = classIndex;
+    slab.blockSize = blockSize;
+    slab.jsIndex = 0;
+    if (kind == SlabKind::Class || kind == SlabKind::Arena) {
+        Napi::Array slabs = handle.Get("slabs").As<Napi::Array>();
+        slab.jsIndex = slabs.Length();
+        slabs.Set(slab.jsIndex, buffer);
+    }
+    if (kind == SlabKind::Class) {
+        size_t blocks = bytes / blockSize;
+        slab.used.assign(blocks, false);
+        // Reverse order so the lowest addresses are handed out first
+        for (size_t i = blocks; i-- > 0;) {
+            pool.freeLists[classIndex].push_back({ &slab, static_cast<uint32_t>(i) });
+        }
+    }
+    return &slab;
+}
+
+/**
+ * Finds the slab containing an address
+ * @param pool - Pool
+ * @param address - Address inside a pool allocation
+ * @returns Slab iterator, or slabs.end()
+ */
+static std::map<uintptr_t, PoolSlab>::iterator FindSlab(BufferPool& pool, uintptr_t address) {
+    auto it = pool.slabs.upper_bound(address);
+    if (it == pool.slabs.begin()) {
+        return pool.slabs.end();
+    }
+    --it;
+    if (address >= it->first + it->second.memory->size) {
+        return pool.slabs.end();
+    }
+    return it;
+}
+
+/**
+ * Drops a single-allocation slab from the pool's bookkeeping
+ * @param pool - Pool
+ * @param it - Slab to drop
+ */
+static void DropSlab(BufferPool& pool, std::map<uintptr_t, PoolSlab>::iterator it) {
+    size_t bytes = it->second.memory->size;
+    pool.used -= bytes;
+    poolUsedBytes -= bytes;
+    pool.slabs.erase(it);
+}
+
+/**
+ * Creates a buffer pool with size-class slabs and a bump-pointer arena
+ * @param info - CallbackInfo with optional { slabSize, classes, alignment }
+ * @returns Pool handle object
+ */
+Napi::Value CreatePool(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    size_t slabSize = kDefaultSlabSize;
+    size_t alignment = kDefaultAlignment;
+    std::vector<size_t> classes(std::begin(kDefaultSizeClasses), std::end(kDefaultSizeClasses));
+    
+    if (info.Length() > 0 && info[0].IsObject()) {
+        Napi::Object options = info[0].As<Napi::Object>();
+        
+        Napi::Value alignmentValue = options.Get("alignment");
+        if (alignmentValue.IsNumber()) {
+            double requested = alignmentValue.As<Napi::Number>().DoubleValue();
+            alignment = requested >= 8 && requested <= 65536 ? static_cast<size_t>(requested) : 0;
+            if (alignment == 0 || (alignment & (alignment - 1)) != 0 || requested != static_cast<double>(alignment)) {
+                Napi::RangeError::New(env, "Alignment must be a power of two between 8 and 65536").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+        }
+        
+        Napi::Value slabValue = options.Get("slabSize");
+        if (slabValue.IsNumber()) {
+            double requested = slabValue.As<Napi::Number>().DoubleValue();
+            if (!(requested >= 1) || requested > static_cast<double>(kMaxPoolAllocation)) {
+                Napi::RangeError::New(env, "Slab size must be between 1 byte and 2 GiB").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+            slabSize = static_cast<size_t>(requested);
+        }
+        
+        Napi::Value classesValue = options.Get("classes");
+        if (classesValue.IsArray()) {
+            Napi::Array list = classesValue.As<Napi::Array>();
+            classes.clear();
+            for (uint32_t i = 0; i < list.Length(); i++) {
+                Napi::Value entry = list.Get(i);
+                double requested = entry.IsNumber() ? entry.As<Napi::Number>().DoubleValue() : 0;
+                if (!(requested >= 1) || requested > static_cast<double>(kMaxPoolAllocation)) {
+                    Napi::RangeError::New(env, "Size classes must be positive byte counts up to 2 GiB").ThrowAsJavaScriptException();
+                    return env.Null();
+                }
+                classes.push_back(static_cast<size_t>(requested));
+            }
+        }
+    }
+    
+    slabSize = RoundUp(slabSize, alignment);
+    for (size_t& size : classes) {
+        size = RoundUp(size, alignment);
+    }
+    std::sort(classes.begin(), classes.end());
+    classes.erase(std::unique(classes.begin(), classes.end()), classes.end());
+    
+    auto pool = std::make_shared<BufferPool>();
+    pool->env = env;
+    pool->slabSize = slabSize;
+    pool->alignment = alignment;
+    pool->classes = classes;
+    pool->freeLists.resize(classes.size());
+    poolCount++;
+    
+    uint64_t poolId = pools.Insert(pool);
+    if (poolId == 0) {
+        Napi::Error::New(env, "Too many pool handles").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object handle = Napi::Object::New(env);
+    handle.Set("id", Napi::Number::New(env, static_cast<double>(poolId)));
+    // Dropping the handle releases the pool; views keep their slabs alive
+    handle.Set("handle", Napi::External<void>::New(env, nullptr, [poolId](Napi::Env, void*) {
+        pools.Remove(poolId);
+    }));
+    handle.Set("slabs", Napi::Array::New(env));
+    return handle;
+}
+
+/**
+ * Allocates a block from the smallest fitting size class; larger requests
+ * get a dedicated slab. Contents are uninitialized.
+ * @param info - CallbackInfo containing pool handle and size
+ * @returns Uint8Array view into pool memory
+ */
+Napi::Value PoolAlloc(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    Napi::Object handle;
+    std::shared_ptr<BufferPool> pool = ToPool(env, info[0], handle);
+    size_t size;
+    if (!pool || !ToPoolSize(env, info[1], size)) {
+        return env.Null();
+    }
+    
+    auto cls = std::lower_bound(pool->classes.begin(), pool->classes.end(), size);
+    Napi::ArrayBuffer buffer;
+    
+    if (cls == pool->classes.end()) {
+        PoolSlab* slab = AddSlab(env, handle, *pool, SlabKind::Large, size, 0, 0, buffer);
+        if (!slab) {
+            return env.Null();
+        }
+        pool->used += slab->memory->size;
+        poolUsedBytes += slab->memory->size;
+        poolAllocations++;
+        return Napi::Uint8Array::New(env, size, buffer, 0);
+    }
+    
+    size_t classIndex = static_cast<size_t>(cls - pool->classes.begin());
+    size_t blockSize = *cls;
+    std::vector<FreeBlock>& freeList = pool->freeLists[classIndex];
+    if (freeList.empty()) {
+        size_t slabBytes = std::max(pool->slabSize, blockSize) / blockSize * blockSize;
+        if (!AddSlab(env, handle, *pool, SlabKind::Class, slabBytes, blockSize, classIndex, buffer)) {
+            return env.Null();
+        }
+    }
+    
+    FreeBlock block = freeList.back();
+    freeList.pop_back();
+    block.slab->used[block.index] = true;
+    pool->used += blockSize;
+    poolUsedBytes += blockSize;
+    poolAllocations++;
+    
+    buffer = handle.Get("slabs").As<Napi::Array>().Get(block.slab->jsIndex).As<Napi::ArrayBuffer>();
+    return Napi::Uint8Array::New(env, size, buffer, static_cast<size_t>(block.index) * blockSize);
+}
+
+/**
+ * Bump-allocates from the pool arena; arena memory is reclaimed only by poolReset.
+ * Contents are uninitialized.
+ * @param info - CallbackInfo containing pool handle and size
+ * @returns Uint8Array view into pool memory
+ */
+Napi::Value PoolArenaAlloc(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    Napi::Object handle;
+    std::shared_ptr<BufferPool> pool = ToPool(env, info[0], handle);
+    size_t size;
+    if (!pool || !ToPoolSize(env, info[1], size)) {
+        return env.Null();
+    }
+    
+    size_t bytes = RoundUp(size, pool->alignment);
+    Napi::ArrayBuffer buffer;
+    
+    if (bytes > pool->slabSize) {
+        PoolSlab* slab = AddSlab(env, handle, *pool, SlabKind::ArenaLarge, bytes, 0, 0, buffer);
+        if (!slab) {
+            return env.Null();
+        }
+        pool->used += slab->memory->size;
+        poolUsedBytes += slab->memory->size;
+        poolAllocations++;
+        return Napi::Uint8Array::New(env, size, buffer, 0);
+    }
+    
+    while (pool->arenaCursor < pool->arenaSlabs.size() &&
+           pool->arenaSlabs[pool->arenaCursor]->bump + bytes > pool->arenaSlabs[pool->arenaCursor]->memory->size) {
+        pool->arenaCursor++;
+    }
+    if (pool->arenaCursor == pool->arenaSlabs.size()) {
+        PoolSlab* slab = AddSlab(env, handle, *pool, SlabKind::Arena, pool->slabSize, 0, 0, buffer);
+        if (!slab) {
+            return env.Null();
+        }
+        pool->arenaSlabs.push_back(slab);
+    }
+    
+    PoolSlab* slab = pool->arenaSlabs[pool->arenaCursor];
+    size_t offset = slab->bump;
+    slab->bump += bytes;
+    pool->used += bytes;
+    poolUsedBytes += bytes;
+    poolAllocations++;
+    
+    buffer = handle.Get("slabs").As<Napi::Array>().Get(slab->jsIndex).As<Napi::ArrayBuffer>();
+    return Napi::Uint8Array::New(env, size, buffer, offset);
+}
+
+/**
+ * Returns a block to its pool immediately; the view must not be used afterwards
+ * @param info - CallbackInfo containing pool handle and a buffer from poolAlloc
+ * @returns True if the block was released; false for arena, foreign or already released buffers
+ */
+Napi::Value PoolRelease(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    Napi::Object handle;
+    std::shared_ptr<BufferPool> pool = ToPool(env, info[0], handle);
+    if (!pool) {
+        return Napi::Boolean::New(env, false);
+    }
+    if (info.Length() < 2 || !info[1].IsTypedArray() ||
+        info[1].As<Napi::TypedArray>().TypedArrayType() != napi_uint8_array) {
+        Napi::TypeError::New(env, "Buffer or Uint8Array parameter required").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    uintptr_t address = reinterpret_cast<uintptr_t>(info[1].As<Napi::Uint8Array>().Data());
+    auto it = FindSlab(*pool, address);
+    if (it == pool->slabs.end()) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    PoolSlab& slab = it->second;
+    size_t offset = address - it->first;
+    if (slab.kind == SlabKind::Large) {
+        if (offset != 0) {
+            return Napi::Boolean::New(env, false);
+        }
+        DropSlab(*pool, it);
+        poolReleases++;
+        return Napi::Boolean::New(env, true);
+    }
+    if (slab.kind != SlabKind::Class || offset % slab.blockSize != 0 || !slab.used[offset / slab.blockSize]) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    uint32_t index = static_cast<uint32_t>(offset / slab.blockSize);
+    slab.used[index] = false;
+    pool->freeLists[slab.classIndex].push_back({ &slab, index });
+    pool->used -= slab.blockSize;
+    poolUsedBytes -= slab.blockSize;
+    poolReleases++;
+    return Napi::Boolean::New(env, true);
+}
+
+/**
+ * Releases every allocation of a pool at once, keeping its slabs for reuse
+ * @param info - CallbackInfo containing pool handle
+ * @returns Success status
+ */
+Napi::Value PoolReset(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    Napi::Object handle;
+    std::shared_ptr<BufferPool> pool = ToPool(env, info[0], handle);
+    if (!pool) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    for (auto& freeList : pool->freeLists) {
+        freeList.clear();
+    }
+    for (auto it = pool->slabs.begin(); it != pool->slabs.end();) {
+        PoolSlab& slab = it->second;
+        if (slab.kind == SlabKind::Large || slab.kind == SlabKind::ArenaLarge) {
+            it = pool->slabs.erase(it);
+            continue;
+        }
+        if (slab.kind == SlabKind::Class) {
+            slab.used.assign(slab.used.size(), false);
+            for (size_t i = slab.used.size(); i-- > 0;) {
+                pool->freeLists[slab.classIndex].push_back({ &slab, static_cast<uint32_t>(i) });
+            }
+        }
+        slab.bump = 0;
+        ++it;
+    }
+    pool->arenaCursor = 0;
+    
+    poolUsedBytes -= pool->used;
+    pool->used = 0;
+    poolResets++;
+    return Napi::Boolean::New(env, true);
+}
+
+/**
+ * Destroys a pool; its memory is freed once no views reference it
+ * @param info - CallbackInfo containing pool handle
+ * @returns Success status
+ */
+Napi::Value DestroyPool(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    Napi::Object handle;
+    std::shared_ptr<BufferPool> pool = ToPool(env, info[0], handle);
+    if (!pool) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    handle.Set("slabs", Napi::Array::New(env));
+    return Napi::Boolean::New(env, pools.Remove(static_cast<uint64_t>(handle.Get("id").As<Napi::Number>().DoubleValue())) != nullptr);
+}
+
+}
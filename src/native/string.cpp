@@ -1,488 +1,3953 @@
 #include "headers/lljs.h"
+#include "headers/handle_table.h"
+#include "headers/thread_pool.h"
 #include <cstring>
 #include <algorithm>
+#include <cmath>
+#include <memory>
 #include <string>
 #include <vector>
-#include <codecvt>
-#include <locale>
-#include <immintrin.h>
-#ifdef _WIN32
-#include <windows.h>
+#if defined(LLJS_ARCH_ARM64) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+namespace LLJS::String {
+
+/**
+ * Scalar ASCII check, eight bytes per step
+ * @param data - Bytes to check
+ * @param length - Byte count
+ * @returns True if no byte has the high bit set
+ */
+static bool IsAsciiScalar(const uint8_t* data, size_t length) {
+    size_t i = 0;
+    uint64_t accumulated = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        accumulated |= word;
+    }
+    for (; i < length; i++) {
+        accumulated |= data[i];
+    }
+    return (accumulated & 0x8080808080808080ULL) == 0;
+}
+
+#ifdef LLJS_ARCH_X86
+LLJS_TARGET_SSE2
+static bool IsAsciiSSE2(const uint8_t* data, size_t length) {
+    size_t i = 0;
+    __m128i accumulated = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16) {
+        accumulated = _mm_or_si128(accumulated, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+    }
+    return _mm_movemask_epi8(accumulated) == 0 && IsAsciiScalar(data + i, length - i);
+}
+
+LLJS_TARGET_AVX2
+static bool IsAsciiAVX2(const uint8_t* data, size_t length) {
+    size_t i = 0;
+    __m256i accumulated = _mm256_setzero_si256();
+    for (; i + 32 <= length; i += 32) {
+        accumulated = _mm256_or_si256(accumulated, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    }
+    return _mm256_movemask_epi8(accumulated) == 0 && IsAsciiScalar(data + i, length - i);
+}
+
+LLJS_TARGET_AVX512
+static bool IsAsciiAVX512(const uint8_t* data, size_t length) {
+    size_t i = 0;
+    __m512i accumulated = _mm512_setzero_si512();
+    for (; i + 64 <= length; i += 64) {
+        accumulated = _mm512_or_si512(accumulated, _mm512_loadu_si512(data + i));
+    }
+    return _mm512_movepi8_mask(accumulated) == 0 && IsAsciiScalar(data + i, length - i);
+}
+#endif // LLJS_ARCH_X86
+
+#ifdef LLJS_ARCH_ARM64
+static bool IsAsciiNEON(const uint8_t* data, size_t length) {
+    size_t i = 0;
+    uint8x16_t accumulated = vdupq_n_u8(0);
+    for (; i + 16 <= length; i += 16) {
+        accumulated = vorrq_u8(accumulated, vld1q_u8(data + i));
+    }
+    return vmaxvq_u8(accumulated) < 0x80 && IsAsciiScalar(data + i, length - i);
+}
+#endif // LLJS_ARCH_ARM64
+
+// ASCII case folding for case-insensitive search; other bytes are unchanged
+static inline uint8_t FoldLower(uint8_t c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<uint8_t>(c + 32) : c;
+}
+
+static inline uint8_t FoldUpper(uint8_t c) {
+    return c >= 'a' && c <= 'z' ? static_cast<uint8_t>(c - 32) : c;
+}
+
+static bool EqualBytes(const uint8_t* a, const uint8_t* b, size_t length, bool foldCase) {
+    if (!foldCase) {
+        return std::memcmp(a, b, length) == 0;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (FoldLower(a[i]) != FoldLower(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Scalar substring search (Boyer-Moore-Horspool over folded bytes when foldCase)
+ * @param haystack - Bytes to search
+ * @param haystackLength - Haystack length
+ * @param needle - Pattern of at least two bytes, no longer than the haystack
+ * @param needleLength - Pattern length
+ * @param foldCase - ASCII case-insensitive
+ * @returns Offset of the first match, or SIZE_MAX if absent
+ */
+static size_t FindScalar(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, bool foldCase) {
+    // Bad character table
+    size_t skip[256];
+    for (size_t i = 0; i < 256; i++) {
+        skip[i] = needleLength;
+    }
+    for (size_t i = 0; i + 1 < needleLength; i++) {
+        uint8_t c = needle[i];
+        skip[c] = needleLength - 1 - i;
+        if (foldCase) {
+            skip[FoldLower(c)] = skip[FoldUpper(c)] = needleLength - 1 - i;
+        }
+    }
+    
+    const uint8_t last = foldCase ? FoldLower(needle[needleLength - 1]) : needle[needleLength - 1];
+    for (size_t shift = 0; shift <= haystackLength - needleLength; ) {
+        uint8_t tail = haystack[shift + needleLength - 1];
+        if ((foldCase ? FoldLower(tail) : tail) == last && EqualBytes(haystack + shift, needle, needleLength - 1, foldCase)) {
+            return shift;
+        }
+        shift += skip[tail];
+    }
+    return SIZE_MAX;
+}
+
+// The SIMD searches compare the needle's first and last bytes against two
+// shifted haystack windows at once and only verify positions where both hit,
+// so they rarely touch the middle of the pattern. Both cases of a letter are
+// accepted when folding.
+struct FindFilter {
+    uint8_t firstLower, firstUpper, lastLower, lastUpper;
+};
+
+static FindFilter MakeFindFilter(const uint8_t* needle, size_t needleLength, bool foldCase) {
+    uint8_t first = needle[0], last = needle[needleLength - 1];
+    if (!foldCase) {
+        return { first, first, last, last };
+    }
+    return { FoldLower(first), FoldUpper(first), FoldLower(last), FoldUpper(last) };
+}
+
+static size_t FindFinish(const uint8_t* haystack, size_t haystackLength, size_t from, const uint8_t* needle, size_t needleLength, bool foldCase) {
+    for (size_t i = from; i + needleLength <= haystackLength; i++) {
+        if (EqualBytes(haystack + i, needle, needleLength, foldCase)) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+#ifdef LLJS_ARCH_X86
+LLJS_TARGET_SSE2
+static size_t FindSSE2(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, bool foldCase) {
+    FindFilter filter = MakeFindFilter(needle, needleLength, foldCase);
+    const __m128i f0 = _mm_set1_epi8(static_cast<char>(filter.firstLower)), f1 = _mm_set1_epi8(static_cast<char>(filter.firstUpper));
+    const __m128i l0 = _mm_set1_epi8(static_cast<char>(filter.lastLower)), l1 = _mm_set1_epi8(static_cast<char>(filter.lastUpper));
+    size_t i = 0;
+    for (; i + needleLength - 1 + 16 <= haystackLength; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i + needleLength - 1));
+        __m128i hits = _mm_and_si128(_mm_or_si128(_mm_cmpeq_epi8(a, f0), _mm_cmpeq_epi8(a, f1)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(b, l0), _mm_cmpeq_epi8(b, l1)));
+        for (uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hits)); mask != 0; mask &= mask - 1) {
+            size_t candidate = i + SIMD::CountTrailingZeros(mask);
+            if (EqualBytes(haystack + candidate + 1, needle + 1, needleLength - 2, foldCase)) {
+                return candidate;
+            }
+        }
+    }
+    return FindFinish(haystack, haystackLength, i, needle, needleLength, foldCase);
+}
+
+LLJS_TARGET_AVX2
+static size_t FindAVX2(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, bool foldCase) {
+    FindFilter filter = MakeFindFilter(needle, needleLength, foldCase);
+    const __m256i f0 = _mm256_set1_epi8(static_cast<char>(filter.firstLower)), f1 = _mm256_set1_epi8(static_cast<char>(filter.firstUpper));
+    const __m256i l0 = _mm256_set1_epi8(static_cast<char>(filter.lastLower)), l1 = _mm256_set1_epi8(static_cast<char>(filter.lastUpper));
+    size_t i = 0;
+    for (; i + needleLength - 1 + 32 <= haystackLength; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i + needleLength - 1));
+        __m256i hits = _mm256_and_si256(_mm256_or_si256(_mm256_cmpeq_epi8(a, f0), _mm256_cmpeq_epi8(a, f1)),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(b, l0), _mm256_cmpeq_epi8(b, l1)));
+        for (uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(hits)); mask != 0; mask &= mask - 1) {
+            size_t candidate = i + SIMD::CountTrailingZeros(mask);
+            if (EqualBytes(haystack + candidate + 1, needle + 1, needleLength - 2, foldCase)) {
+                return candidate;
+            }
+        }
+    }
+    return FindFinish(haystack, haystackLength, i, needle, needleLength, foldCase);
+}
+
+LLJS_TARGET_AVX512
+static size_t FindAVX512(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, bool foldCase) {
+    FindFilter filter = MakeFindFilter(needle, needleLength, foldCase);
+    const __m512i f0 = _mm512_set1_epi8(static_cast<char>(filter.firstLower)), f1 = _mm512_set1_epi8(static_cast<char>(filter.firstUpper));
+    const __m512i l0 = _mm512_set1_epi8(static_cast<char>(filter.lastLower)), l1 = _mm512_set1_epi8(static_cast<char>(filter.lastUpper));
+    size_t i = 0;
+    for (; i + needleLength - 1 + 64 <= haystackLength; i += 64) {
+        __m512i a = _mm512_loadu_si512(haystack + i);
+        __m512i b = _mm512_loadu_si512(haystack + i + needleLength - 1);
+        __mmask64 first = _mm512_cmpeq_epi8_mask(a, f0) | _mm512_cmpeq_epi8_mask(a, f1);
+        __mmask64 last = _mm512_cmpeq_epi8_mask(b, l0) | _mm512_cmpeq_epi8_mask(b, l1);
+        for (uint64_t mask = first & last; mask != 0; mask &= mask - 1) {
+            size_t candidate = i + SIMD::CountTrailingZeros(mask);
+            if (EqualBytes(haystack + candidate + 1, needle + 1, needleLength - 2, foldCase)) {
+                return candidate;
+            }
+        }
+    }
+    return FindFinish(haystack, haystackLength, i, needle, needleLength, foldCase);
+}
+#endif // LLJS_ARCH_X86
+
+#ifdef LLJS_ARCH_ARM64
+static size_t FindNEON(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, bool foldCase) {
+    FindFilter filter = MakeFindFilter(needle, needleLength, foldCase);
+    const uint8x16_t f0 = vdupq_n_u8(filter.firstLower), f1 = vdupq_n_u8(filter.firstUpper);
+    const uint8x16_t l0 = vdupq_n_u8(filter.lastLower), l1 = vdupq_n_u8(filter.lastUpper);
+    size_t i = 0;
+    for (; i + needleLength - 1 + 16 <= haystackLength; i += 16) {
+        uint8x16_t a = vld1q_u8(haystack + i);
+        uint8x16_t b = vld1q_u8(haystack + i + needleLength - 1);
+        uint8x16_t hits = vandq_u8(vorrq_u8(vceqq_u8(a, f0), vceqq_u8(a, f1)), vorrq_u8(vceqq_u8(b, l0), vceqq_u8(b, l1)));
+        // Narrow to four mask bits per byte
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hits), 4)), 0);
+        while (mask != 0) {
+            unsigned lane = SIMD::CountTrailingZeros(mask) / 4;
+            size_t candidate = i + lane;
+            if (EqualBytes(haystack + candidate + 1, needle + 1, needleLength - 2, foldCase)) {
+                return candidate;
+            }
+            mask &= ~(0xFull << (lane * 4));
+        }
+    }
+    return FindFinish(haystack, haystackLength, i, needle, needleLength, foldCase);
+}
+#endif // LLJS_ARCH_ARM64
+
+/**
+ * Set of bytes a multi-pattern scan can stop at. The nibble tables give exact
+ * membership with two shuffles per half: byte c is present when
+ * (lowA[c & 15] & highA[c >> 4]) | (lowB[c & 15] & highB[c >> 4]) is non-zero.
+ */
+struct SkipSet {
+    bool member[256];
+    size_t count;
+    uint8_t bytes[4];
+    alignas(16) uint8_t lowA[16];
+    alignas(16) uint8_t lowB[16];
+    alignas(16) uint8_t highA[16];
+    alignas(16) uint8_t highB[16];
+};
+
+static void BuildSkipSet(SkipSet& set, const std::vector<uint8_t>& bytes) {
+    std::memset(&set, 0, sizeof(set));
+    set.count = bytes.size();
+    for (size_t i = 0; i < bytes.size(); i++) {
+        uint8_t c = bytes[i];
+        set.member[c] = true;
+        set.bytes[std::min<size_t>(i, 3)] = c;
+        if ((c >> 4) < 8) {
+            set.lowA[c & 15] |= static_cast<uint8_t>(1u << (c >> 4));
+        } else {
+            set.lowB[c & 15] |= static_cast<uint8_t>(1u << ((c >> 4) - 8));
+        }
+    }
+    for (size_t i = bytes.size(); i < 4; i++) {
+        set.bytes[i] = bytes.empty() ? 0 : bytes.back();
+    }
+    for (unsigned h = 0; h < 16; h++) {
+        set.highA[h] = h < 8 ? static_cast<uint8_t>(1u << h) : 0;
+        set.highB[h] = h >= 8 ? static_cast<uint8_t>(1u << (h - 8)) : 0;
+    }
+}
+
+/**
+ * Scalar scan for the first byte in a skip set
+ * @param data - Bytes to scan
+ * @param length - Byte count
+ * @param set - Stop bytes
+ * @returns Offset of the first stop byte, or length
+ */
+static size_t SkipToAnyScalar(const uint8_t* data, size_t length, const SkipSet& set) {
+    for (size_t i = 0; i < length; i++) {
+        if (set.member[data[i]]) {
+            return i;
+        }
+    }
+    return length;
+}
+
+#ifdef LLJS_ARCH_X86
+// SSE2 has no byte shuffle; it compares against up to four bytes directly
+LLJS_TARGET_SSE2
+static size_t SkipToAnySSE2(const uint8_t* data, size_t length, const SkipSet& set) {
+    if (set.count > 4) {
+        return SkipToAnyScalar(data, length, set);
+    }
+    const __m128i s0 = _mm_set1_epi8(static_cast<char>(set.bytes[0])), s1 = _mm_set1_epi8(static_cast<char>(set.bytes[1]));
+    const __m128i s2 = _mm_set1_epi8(static_cast<char>(set.bytes[2])), s3 = _mm_set1_epi8(static_cast<char>(set.bytes[3]));
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, s0), _mm_cmpeq_epi8(v, s1)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(v, s2), _mm_cmpeq_epi8(v, s3)));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hits));
+        if (mask != 0) {
+            return i + SIMD::CountTrailingZeros(mask);
+        }
+    }
+    return i + SkipToAnyScalar(data + i, length - i, set);
+}
+
+LLJS_TARGET_AVX2
+static size_t SkipToAnyAVX2(const uint8_t* data, size_t length, const SkipSet& set) {
+    const __m256i lowA = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.lowA)));
+    const __m256i lowB = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.lowB)));
+    const __m256i highA = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.highA)));
+    const __m256i highB = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.highB)));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i low = _mm256_and_si256(v, nibble);
+        __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+        __m256i found = _mm256_or_si256(_mm256_and_si256(_mm256_shuffle_epi8(lowA, low), _mm256_shuffle_epi8(highA, high)),
+                                        _mm256_and_si256(_mm256_shuffle_epi8(lowB, low), _mm256_shuffle_epi8(highB, high)));
+        uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(found, _mm256_setzero_si256())));
+        if (mask != 0) {
+            return i + SIMD::CountTrailingZeros(mask);
+        }
+    }
+    return i + SkipToAnyScalar(data + i, length - i, set);
+}
+
+LLJS_TARGET_AVX512
+static size_t SkipToAnyAVX512(const uint8_t* data, size_t length, const SkipSet& set) {
+    const __m512i lowA = _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(set.lowA)));
+    const __m512i lowB = _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(set.lowB)));
+    const __m512i highA = _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(set.highA)));
+    const __m512i highB = _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(set.highB)));
+    const __m512i nibble = _mm512_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 64 <= length; i += 64) {
+        __m512i v = _mm512_loadu_si512(data + i);
+        __m512i low = _mm512_and_si512(v, nibble);
+        __m512i high = _mm512_and_si512(_mm512_srli_epi16(v, 4), nibble);
+        __m512i found = _mm512_or_si512(_mm512_and_si512(_mm512_shuffle_epi8(lowA, low), _mm512_shuffle_epi8(highA, high)),
+                                        _mm512_and_si512(_mm512_shuffle_epi8(lowB, low), _mm512_shuffle_epi8(highB, high)));
+        uint64_t mask = _mm512_test_epi8_mask(found, found);
+        if (mask != 0) {
+            return i + SIMD::CountTrailingZeros(mask);
+        }
+    }
+    return i + SkipToAnyScalar(data + i, length - i, set);
+}
+#endif // LLJS_ARCH_X86
+
+#ifdef LLJS_ARCH_ARM64
+static size_t SkipToAnyNEON(const uint8_t* data, size_t length, const SkipSet& set) {
+    const uint8x16_t lowA = vld1q_u8(set.lowA), lowB = vld1q_u8(set.lowB);
+    const uint8x16_t highA = vld1q_u8(set.highA), highB = vld1q_u8(set.highB);
+    const uint8x16_t nibble = vdupq_n_u8(0x0F);
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t v = vld1q_u8(data + i);
+        uint8x16_t low = vandq_u8(v, nibble);
+        uint8x16_t high = vshrq_n_u8(v, 4);
+        uint8x16_t found = vorrq_u8(vandq_u8(vqtbl1q_u8(lowA, low), vqtbl1q_u8(highA, high)),
+                                    vandq_u8(vqtbl1q_u8(lowB, low), vqtbl1q_u8(highB, high)));
+        uint8x16_t hits = vtstq_u8(found, found);
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hits), 4)), 0);
+        if (mask != 0) {
+            return i + SIMD::CountTrailingZeros(mask) / 4;
+        }
+    }
+    return i + SkipToAnyScalar(data + i, length - i, set);
+}
+#endif // LLJS_ARCH_ARM64
+
+// High and low halves of a 64 x 64-bit product
+static inline uint64_t MulHigh64(uint64_t a, uint64_t b, uint64_t& low) {
+#ifdef _MSC_VER
+    uint64_t high;
+    low = _umul128(a, b, &high);
+    return high;
+#else
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    low = static_cast<uint64_t>(product);
+    return static_cast<uint64_t>(product >> 64);
+#endif
+}
+
+static inline uint64_t Read64(const uint8_t* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint64_t Rotl64(uint64_t value, unsigned shift) {
+    return (value << shift) | (value >> (64 - shift));
+}
+
+static inline uint64_t Swap64(uint64_t value) {
+#ifdef _MSC_VER
+    return _byteswap_uint64(value);
 #else
-#include <iconv.h>
+    return __builtin_bswap64(value);
+#endif
+}
+
+static inline uint32_t Swap32(uint32_t value) {
+#ifdef _MSC_VER
+    return _byteswap_ulong(value);
+#else
+    return __builtin_bswap32(value);
+#endif
+}
+
+// Slicing-by-8 tables: table[k][b] is the CRC of byte b followed by k zero bytes
+struct CrcTables {
+    uint32_t table[8][256];
+};
+
+static CrcTables MakeCrcTables(uint32_t polynomial) {
+    CrcTables tables;
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (polynomial & (0u - (crc & 1)));
+        }
+        tables.table[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int k = 1; k < 8; k++) {
+            uint32_t previous = tables.table[k - 1][i];
+            tables.table[k][i] = (previous >> 8) ^ tables.table[0][previous & 0xFF];
+        }
+    }
+    return tables;
+}
+
+static constexpr uint32_t kCrc32Polynomial = 0xEDB88320u;  // IEEE 802.3, reflected
+static constexpr uint32_t kCrc32cPolynomial = 0x82F63B78u; // Castagnoli, reflected
+static const CrcTables crc32Tables = MakeCrcTables(kCrc32Polynomial);
+static const CrcTables crc32cTables = MakeCrcTables(kCrc32cPolynomial);
+
+/**
+ * Advances a raw (pre-inverted) CRC state over a byte range, eight bytes per step
+ * @param tables - Slicing tables for the polynomial
+ * @param crc - Running state
+ * @param data - Bytes to add
+ * @param length - Byte count
+ * @returns New state
+ */
+static uint32_t CrcUpdateScalar(const CrcTables& tables, uint32_t crc, const uint8_t* data, size_t length) {
+    const auto& t = tables.table;
+    for (; length >= 8; data += 8, length -= 8) {
+        uint32_t low = Read32(data) ^ crc;
+        uint32_t high = Read32(data + 4);
+        crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+              t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+    }
+    for (; length > 0; data++, length--) {
+        crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static uint32_t Crc32cScalar(uint32_t crc, const uint8_t* data, size_t length) {
+    return CrcUpdateScalar(crc32cTables, crc, data, length);
+}
+
+/**
+ * Multiplies two reflected polynomials modulo the CRC-32C polynomial
+ * @returns Product a * b mod P
+ */
+static uint32_t CrcMultiply(uint32_t a, uint32_t b) {
+    uint32_t product = 0;
+    for (uint32_t mask = 1u << 31; mask != 0; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+        }
+        b = (b & 1) ? (b >> 1) ^ kCrc32cPolynomial : b >> 1;
+    }
+    return product;
+}
+
+// Shifting a CRC-32C state past a fixed run of zero bytes is linear in the
+// state, so it is four byte-indexed table lookups
+struct CrcShiftTable {
+    uint32_t table[4][256];
+};
+
+static CrcShiftTable MakeCrcShiftTable(size_t bytes) {
+    // x^(8 * bytes) mod P by square-and-multiply; x^0 is the top bit when reflected
+    uint32_t factor = 1u << 31;
+    uint32_t power = 1u << 23; // x^8
+    for (size_t n = bytes; n != 0; n >>= 1) {
+        if (n & 1) {
+            factor = CrcMultiply(factor, power);
+        }
+        power = CrcMultiply(power, power);
+    }
+    CrcShiftTable shift;
+    for (uint32_t k = 0; k < 4; k++) {
+        for (uint32_t i = 0; i < 256; i++) {
+            shift.table[k][i] = CrcMultiply(factor, i << (8 * k));
+        }
+    }
+    return shift;
+}
+
+static inline uint32_t CrcShift(const CrcShiftTable& shift, uint32_t crc) {
+    return shift.table[0][crc & 0xFF] ^ shift.table[1][(crc >> 8) & 0xFF] ^
+           shift.table[2][(crc >> 16) & 0xFF] ^ shift.table[3][crc >> 24];
+}
+
+// Bytes per lane of the three-way interleaved hardware CRC
+static constexpr size_t kCrcLaneBytes = 4096;
+static const CrcShiftTable crcShiftOneLane = MakeCrcShiftTable(kCrcLaneBytes);
+static const CrcShiftTable crcShiftTwoLanes = MakeCrcShiftTable(2 * kCrcLaneBytes);
+
+#if defined(LLJS_ARCH_X86) && (defined(__x86_64__) || defined(_M_X64))
+/**
+ * SSE4.2 CRC-32C. The crc32 instruction has a three-cycle latency but issues
+ * every cycle, so large inputs run three independent lanes that are merged
+ * with the shift tables.
+ */
+LLJS_TARGET_SSE42
+static uint32_t Crc32cSSE42(uint32_t crc, const uint8_t* data, size_t length) {
+    for (; length >= 3 * kCrcLaneBytes; data += 3 * kCrcLaneBytes, length -= 3 * kCrcLaneBytes) {
+        uint64_t lane0 = crc, lane1 = 0, lane2 = 0;
+        for (size_t i = 0; i < kCrcLaneBytes; i += 8) {
+            lane0 = _mm_crc32_u64(lane0, Read64(data + i));
+            lane1 = _mm_crc32_u64(lane1, Read64(data + kCrcLaneBytes + i));
+            lane2 = _mm_crc32_u64(lane2, Read64(data + 2 * kCrcLaneBytes + i));
+        }
+        crc = CrcShift(crcShiftTwoLanes, static_cast<uint32_t>(lane0)) ^
+              CrcShift(crcShiftOneLane, static_cast<uint32_t>(lane1)) ^ static_cast<uint32_t>(lane2);
+    }
+    uint64_t wide = crc;
+    for (; length >= 8; data += 8, length -= 8) {
+        wide = _mm_crc32_u64(wide, Read64(data));
+    }
+    crc = static_cast<uint32_t>(wide);
+    for (; length > 0; data++, length--) {
+        crc = _mm_crc32_u8(crc, *data);
+    }
+    return crc;
+}
+#endif
+
+#if defined(LLJS_ARCH_ARM64) && defined(__ARM_FEATURE_CRC32)
+// ARMv8 CRC-32C, same three-lane layout as the SSE4.2 kernel
+static uint32_t Crc32cARM(uint32_t crc, const uint8_t* data, size_t length) {
+    for (; length >= 3 * kCrcLaneBytes; data += 3 * kCrcLaneBytes, length -= 3 * kCrcLaneBytes) {
+        uint32_t lane0 = crc, lane1 = 0, lane2 = 0;
+        for (size_t i = 0; i < kCrcLaneBytes; i += 8) {
+            lane0 = __crc32cd(lane0, Read64(data + i));
+            lane1 = __crc32cd(lane1, Read64(data + kCrcLaneBytes + i));
+            lane2 = __crc32cd(lane2, Read64(data + 2 * kCrcLaneBytes + i));
+        }
+        crc = CrcShift(crcShiftTwoLanes, lane0) ^ CrcShift(crcShiftOneLane, lane1) ^ lane2;
+    }
+    for (; length >= 8; data += 8, length -= 8) {
+        crc = __crc32cd(crc, Read64(data));
+    }
+    for (; length > 0; data++, length--) {
+        crc = __crc32cb(crc, *data);
+    }
+    return crc;
+}
+#endif
+
+// XXH3 (xxHash 0.8) constants and default secret
+static constexpr uint32_t kPrime32_1 = 0x9E3779B1u;
+static constexpr uint32_t kPrime32_2 = 0x85EBCA77u;
+static constexpr uint32_t kPrime32_3 = 0xC2B2AE3Du;
+static constexpr uint64_t kPrime64_1 = 0x9E3779B185EBCA87ull;
+static constexpr uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4Full;
+static constexpr uint64_t kPrime64_3 = 0x165667B19E3779F9ull;
+static constexpr uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ull;
+static constexpr uint64_t kPrime64_5 = 0x27D4EB2F165667C5ull;
+static constexpr uint64_t kPrimeMx1 = 0x165667919E3779F9ull;
+static constexpr uint64_t kPrimeMx2 = 0x9FB21C651E98DF25ull;
+
+static constexpr size_t kXXH3SecretSize = 192;
+static constexpr size_t kXXH3SecretSizeMin = 136;
+static constexpr size_t kXXH3StripeLength = 64;
+static constexpr size_t kXXH3SecretConsumeRate = 8;
+static constexpr size_t kXXH3MidSizeMax = 240;
+static constexpr size_t kXXH3StripesPerBlock = (kXXH3SecretSize - kXXH3StripeLength) / kXXH3SecretConsumeRate;
+static constexpr size_t kXXH3BlockLength = kXXH3StripeLength * kXXH3StripesPerBlock;
+static constexpr size_t kXXH3SecretLastAccStart = 7;
+static constexpr size_t kXXH3SecretMergeAccsStart = 11;
+
+alignas(64) static const uint8_t kXXH3Secret[kXXH3SecretSize] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+struct Hash128 {
+    uint64_t low;
+    uint64_t high;
+};
+
+static inline uint64_t Mul128Fold64(uint64_t a, uint64_t b) {
+    uint64_t low;
+    uint64_t high = MulHigh64(a, b, low);
+    return low ^ high;
+}
+
+static inline uint64_t XXH64Avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= kPrime64_2;
+    h ^= h >> 29;
+    h *= kPrime64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline uint64_t XXH3Avalanche(uint64_t h) {
+    h ^= h >> 37;
+    h *= kPrimeMx1;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline uint64_t XXH3Rrmxmx(uint64_t h, uint64_t length) {
+    h ^= Rotl64(h, 49) ^ Rotl64(h, 24);
+    h *= kPrimeMx2;
+    h ^= (h >> 35) + length;
+    h *= kPrimeMx2;
+    return h ^ (h >> 28);
+}
+
+static inline uint64_t XXH3Mix16(const uint8_t* input, const uint8_t* secret, uint64_t seed) {
+    return Mul128Fold64(Read64(input) ^ (Read64(secret) + seed), Read64(input + 8) ^ (Read64(secret + 8) - seed));
+}
+
+static uint64_t XXH3Short64(const uint8_t* input, size_t length, const uint8_t* secret, uint64_t seed) {
+    if (length > 8) {
+        uint64_t bitflip1 = (Read64(secret + 24) ^ Read64(secret + 32)) + seed;
+        uint64_t bitflip2 = (Read64(secret + 40) ^ Read64(secret + 48)) - seed;
+        uint64_t low = Read64(input) ^ bitflip1;
+        uint64_t high = Read64(input + length - 8) ^ bitflip2;
+        return XXH3Avalanche(length + Swap64(low) + high + Mul128Fold64(low, high));
+    }
+    if (length >= 4) {
+        seed ^= static_cast<uint64_t>(Swap32(static_cast<uint32_t>(seed))) << 32;
+        uint64_t bitflip = (Read64(secret + 8) ^ Read64(secret + 16)) - seed;
+        uint64_t combined = Read32(input + length - 4) + (static_cast<uint64_t>(Read32(input)) << 32);
+        return XXH3Rrmxmx(combined ^ bitflip, length);
+    }
+    if (length > 0) {
+        uint32_t combined = (static_cast<uint32_t>(input[0]) << 16) | (static_cast<uint32_t>(input[length >> 1]) << 24) |
+                            input[length - 1] | (static_cast<uint32_t>(length) << 8);
+        uint64_t bitflip = (Read32(secret) ^ Read32(secret + 4)) + seed;
+        return XXH64Avalanche(combined ^ bitflip);
+    }
+    return XXH64Avalanche(seed ^ Read64(secret + 56) ^ Read64(secret + 64));
+}
+
+static uint64_t XXH3Mid64(const uint8_t* input, size_t length, const uint8_t* secret, uint64_t seed) {
+    uint64_t acc = length * kPrime64_1;
+    if (length <= 128) {
+        if (length > 32) {
+            if (length > 64) {
+                if (length > 96) {
+                    acc += XXH3Mix16(input + 48, secret + 96, seed);
+                    acc += XXH3Mix16(input + length - 64, secret + 112, seed);
+                }
+                acc += XXH3Mix16(input + 32, secret + 64, seed);
+                acc += XXH3Mix16(input + length - 48, secret + 80, seed);
+            }
+            acc += XXH3Mix16(input + 16, secret + 32, seed);
+            acc += XXH3Mix16(input + length - 32, secret + 48, seed);
+        }
+        acc += XXH3Mix16(input, secret, seed);
+        acc += XXH3Mix16(input + length - 16, secret + 16, seed);
+        return XXH3Avalanche(acc);
+    }
+    
+    for (size_t i = 0; i < 8; i++) {
+        acc += XXH3Mix16(input + 16 * i, secret + 16 * i, seed);
+    }
+    acc = XXH3Avalanche(acc);
+    uint64_t accEnd = XXH3Mix16(input + length - 16, secret + kXXH3SecretSizeMin - 17, seed);
+    for (size_t i = 8; i < length / 16; i++) {
+        accEnd += XXH3Mix16(input + 16 * i, secret + 16 * (i - 8) + 3, seed);
+    }
+    return XXH3Avalanche(acc + accEnd);
+}
+
+static inline Hash128 XXH3Mix32(Hash128 acc, const uint8_t* input1, const uint8_t* input2, const uint8_t* secret, uint64_t seed) {
+    acc.low += XXH3Mix16(input1, secret, seed);
+    acc.low ^= Read64(input2) + Read64(input2 + 8);
+    acc.high += XXH3Mix16(input2, secret + 16, seed);
+    acc.high ^= Read64(input1) + Read64(input1 + 8);
+    return acc;
+}
+
+static Hash128 XXH3Short128(const uint8_t* input, size_t length, const uint8_t* secret, uint64_t seed) {
+    Hash128 result;
+    if (length > 8) {
+        uint64_t bitflipLow = (Read64(secret + 32) ^ Read64(secret + 40)) - seed;
+        uint64_t bitflipHigh = (Read64(secret + 48) ^ Read64(secret + 56)) + seed;
+        uint64_t inputLow = Read64(input);
+        uint64_t inputHigh = Read64(input + length - 8);
+        uint64_t mLow;
+        uint64_t mHigh = MulHigh64(inputLow ^ inputHigh ^ bitflipLow, kPrime64_1, mLow);
+        mLow += static_cast<uint64_t>(length - 1) << 54;
+        inputHigh ^= bitflipHigh;
+        mHigh += inputHigh + static_cast<uint64_t>(static_cast<uint32_t>(inputHigh)) * (kPrime32_2 - 1);
+        mLow ^= Swap64(mHigh);
+        uint64_t hLow;
+        uint64_t hHigh = MulHigh64(mLow, kPrime64_2, hLow);
+        hHigh += mHigh * kPrime64_2;
+        result.low = XXH3Avalanche(hLow);
+        result.high = XXH3Avalanche(hHigh);
+        return result;
+    }
+    if (length >= 4) {
+        seed ^= static_cast<uint64_t>(Swap32(static_cast<uint32_t>(seed))) << 32;
+        uint64_t combined = Read32(input) + (static_cast<uint64_t>(Read32(input + length - 4)) << 32);
+        uint64_t bitflip = (Read64(secret + 16) ^ Read64(secret + 24)) + seed;
+        uint64_t mLow;
+        uint64_t mHigh = MulHigh64(combined ^ bitflip, kPrime64_1 + (length << 2), mLow);
+        mHigh += mLow << 1;
+        mLow ^= mHigh >> 3;
+        mLow ^= mLow >> 35;
+        mLow *= kPrimeMx2;
+        mLow ^= mLow >> 28;
+        result.low = mLow;
+        result.high = XXH3Avalanche(mHigh);
+        return result;
+    }
+    if (length > 0) {
+        uint32_t combinedLow = (static_cast<uint32_t>(input[0]) << 16) | (static_cast<uint32_t>(input[length >> 1]) << 24) |
+                               input[length - 1] | (static_cast<uint32_t>(length) << 8);
+        uint32_t swapped = Swap32(combinedLow);
+        uint32_t combinedHigh = (swapped << 13) | (swapped >> 19);
+        uint64_t bitflipLow = (Read32(secret) ^ Read32(secret + 4)) + seed;
+        uint64_t bitflipHigh = (Read32(secret + 8) ^ Read32(secret + 12)) - seed;
+        result.low = XXH64Avalanche(combinedLow ^ bitflipLow);
+        result.high = XXH64Avalanche(combinedHigh ^ bitflipHigh);
+        return result;
+    }
+    result.low = XXH64Avalanche(seed ^ Read64(secret + 64) ^ Read64(secret + 72));
+    result.high = XXH64Avalanche(seed ^ Read64(secret + 80) ^ Read64(secret + 88));
+    return result;
+}
+
+static Hash128 XXH3Mid128(const uint8_t* input, size_t length, const uint8_t* secret, uint64_t seed) {
+    Hash128 acc = {length * kPrime64_1, 0};
+    if (length <= 128) {
+        if (length > 32) {
+            if (length > 64) {
+                if (length > 96) {
+                    acc = XXH3Mix32(acc, input + 48, input + length - 64, secret + 96, seed);
+                }
+                acc = XXH3Mix32(acc, input + 32, input + length - 48, secret + 64, seed);
+            }
+            acc = XXH3Mix32(acc, input + 16, input + length - 32, secret + 32, seed);
+        }
+        acc = XXH3Mix32(acc, input, input + length - 16, secret, seed);
+    } else {
+        for (size_t i = 32; i < 160; i += 32) {
+            acc = XXH3Mix32(acc, input + i - 32, input + i - 16, secret + i - 32, seed);
+        }
+        acc.low = XXH3Avalanche(acc.low);
+        acc.high = XXH3Avalanche(acc.high);
+        for (size_t i = 160; i <= length; i += 32) {
+            acc = XXH3Mix32(acc, input + i - 32, input + i - 16, secret + 3 + i - 160, seed);
+        }
+        acc = XXH3Mix32(acc, input + length - 16, input + length - 32, secret + kXXH3SecretSizeMin - 17 - 16, 0 - seed);
+    }
+    Hash128 result;
+    result.low = XXH3Avalanche(acc.low + acc.high);
+    result.high = 0 - XXH3Avalanche(acc.low * kPrime64_1 + acc.high * kPrime64_4 + (length - seed) * kPrime64_2);
+    return result;
+}
+
+/**
+ * Scalar XXH3 stripe accumulation
+ * @param acc - Eight 64-bit accumulators
+ * @param input - nbStripes consecutive 64-byte stripes
+ * @param secret - Secret for the first stripe; each further stripe advances it by 8 bytes
+ * @param nbStripes - Stripe count
+ */
+static void XXH3AccumulateScalar(uint64_t* acc, const uint8_t* input, const uint8_t* secret, size_t nbStripes) {
+    for (size_t n = 0; n < nbStripes; n++) {
+        const uint8_t* stripe = input + n * kXXH3StripeLength;
+        const uint8_t* key = secret + n * kXXH3SecretConsumeRate;
+        for (size_t lane = 0; lane < 8; lane++) {
+            uint64_t value = Read64(stripe + lane * 8);
+            uint64_t keyed = value ^ Read64(key + lane * 8);
+            acc[lane ^ 1] += value;
+            acc[lane] += static_cast<uint64_t>(static_cast<uint32_t>(keyed)) * (keyed >> 32);
+        }
+    }
+}
+
+static void XXH3ScrambleScalar(uint64_t* acc, const uint8_t* secret) {
+    for (size_t lane = 0; lane < 8; lane++) {
+        uint64_t value = acc[lane];
+        value ^= value >> 47;
+        value ^= Read64(secret + lane * 8);
+        acc[lane] = value * kPrime32_1;
+    }
+}
+
+#ifdef LLJS_ARCH_X86
+LLJS_TARGET_SSE2
+static void XXH3AccumulateSSE2(uint64_t* acc, const uint8_t* input, const uint8_t* secret, size_t nbStripes) {
+    __m128i* vacc = reinterpret_cast<__m128i*>(acc);
+    for (size_t n = 0; n < nbStripes; n++) {
+        const uint8_t* stripe = input + n * kXXH3StripeLength;
+        const uint8_t* key = secret + n * kXXH3SecretConsumeRate;
+        for (size_t i = 0; i < 4; i++) {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripe) + i);
+            __m128i keyed = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(key) + i));
+            __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+            __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            vacc[i] = _mm_add_epi64(_mm_add_epi64(vacc[i], swapped), product);
+        }
+    }
+}
+
+LLJS_TARGET_SSE2
+static void XXH3ScrambleSSE2(uint64_t* acc, const uint8_t* secret) {
+    __m128i* vacc = reinterpret_cast<__m128i*>(acc);
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(kPrime32_1));
+    for (size_t i = 0; i < 4; i++) {
+        __m128i value = _mm_xor_si128(vacc[i], _mm_srli_epi64(vacc[i], 47));
+        value = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i));
+        __m128i high = _mm_shuffle_epi32(value, _MM_SHUFFLE(0, 3, 0, 1));
+        vacc[i] = _mm_add_epi64(_mm_mul_epu32(value, prime), _mm_slli_epi64(_mm_mul_epu32(high, prime), 32));
+    }
+}
+
+LLJS_TARGET_AVX2
+static void XXH3AccumulateAVX2(uint64_t* acc, const uint8_t* input, const uint8_t* secret, size_t nbStripes) {
+    __m256i acc0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc));
+    __m256i acc1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(acc) + 1);
+    for (size_t n = 0; n < nbStripes; n++) {
+        const __m256i* stripe = reinterpret_cast<const __m256i*>(input + n * kXXH3StripeLength);
+        const __m256i* key = reinterpret_cast<const __m256i*>(secret + n * kXXH3SecretConsumeRate);
+        __m256i data0 = _mm256_loadu_si256(stripe);
+        __m256i data1 = _mm256_loadu_si256(stripe + 1);
+        __m256i keyed0 = _mm256_xor_si256(data0, _mm256_loadu_si256(key));
+        __m256i keyed1 = _mm256_xor_si256(data1, _mm256_loadu_si256(key + 1));
+        acc0 = _mm256_add_epi64(acc0, _mm256_shuffle_epi32(data0, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_shuffle_epi32(data1, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc0 = _mm256_add_epi64(acc0, _mm256_mul_epu32(keyed0, _mm256_srli_epi64(keyed0, 32)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_mul_epu32(keyed1, _mm256_srli_epi64(keyed1, 32)));
+    }
+    _mm256_store_si256(reinterpret_cast<__m256i*>(acc), acc0);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(acc) + 1, acc1);
+}
+
+LLJS_TARGET_AVX2
+static void XXH3ScrambleAVX2(uint64_t* acc, const uint8_t* secret) {
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(kPrime32_1));
+    for (size_t i = 0; i < 2; i++) {
+        __m256i* slot = reinterpret_cast<__m256i*>(acc) + i;
+        __m256i value = _mm256_load_si256(slot);
+        value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+        value = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i));
+        __m256i high = _mm256_shuffle_epi32(value, _MM_SHUFFLE(0, 3, 0, 1));
+        _mm256_store_si256(slot, _mm256_add_epi64(_mm256_mul_epu32(value, prime),
+                                                  _mm256_slli_epi64(_mm256_mul_epu32(high, prime), 32)));
+    }
+}
+
+LLJS_TARGET_AVX512
+static void XXH3AccumulateAVX512(uint64_t* acc, const uint8_t* input, const uint8_t* secret, size_t nbStripes) {
+    __m512i vacc = _mm512_load_si512(acc);
+    for (size_t n = 0; n < nbStripes; n++) {
+        __m512i data = _mm512_loadu_si512(input + n * kXXH3StripeLength);
+        __m512i keyed = _mm512_xor_si512(data, _mm512_loadu_si512(secret + n * kXXH3SecretConsumeRate));
+        vacc = _mm512_add_epi64(vacc, _mm512_shuffle_epi32(data, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(1, 0, 3, 2))));
+        vacc = _mm512_add_epi64(vacc, _mm512_mul_epu32(keyed, _mm512_srli_epi64(keyed, 32)));
+    }
+    _mm512_store_si512(acc, vacc);
+}
+
+LLJS_TARGET_AVX512
+static void XXH3ScrambleAVX512(uint64_t* acc, const uint8_t* secret) {
+    const __m512i prime = _mm512_set1_epi32(static_cast<int>(kPrime32_1));
+    __m512i value = _mm512_load_si512(acc);
+    value = _mm512_xor_si512(value, _mm512_srli_epi64(value, 47));
+    value = _mm512_xor_si512(value, _mm512_loadu_si512(secret));
+    __m512i high = _mm512_shuffle_epi32(value, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(0, 3, 0, 1)));
+    _mm512_store_si512(acc, _mm512_add_epi64(_mm512_mul_epu32(value, prime),
+                                             _mm512_slli_epi64(_mm512_mul_epu32(high, prime), 32)));
+}
+#endif
+
+#ifdef LLJS_ARCH_ARM64
+static void XXH3AccumulateNEON(uint64_t* acc, const uint8_t* input, const uint8_t* secret, size_t nbStripes) {
+    uint64x2_t vacc[4];
+    for (size_t i = 0; i < 4; i++) {
+        vacc[i] = vld1q_u64(acc + 2 * i);
+    }
+    for (size_t n = 0; n < nbStripes; n++) {
+        const uint8_t* stripe = input + n * kXXH3StripeLength;
+        const uint8_t* key = secret + n * kXXH3SecretConsumeRate;
+        for (size_t i = 0; i < 4; i++) {
+            uint64x2_t data = vreinterpretq_u64_u8(vld1q_u8(stripe + 16 * i));
+            uint64x2_t keyed = veorq_u64(data, vreinterpretq_u64_u8(vld1q_u8(key + 16 * i)));
+            vacc[i] = vaddq_u64(vacc[i], vextq_u64(data, data, 1));
+            vacc[i] = vmlal_u32(vacc[i], vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+        }
+    }
+    for (size_t i = 0; i < 4; i++) {
+        vst1q_u64(acc + 2 * i, vacc[i]);
+    }
+}
 #endif
 
-namespace LLJS::String {
+// Stripe accumulation is the XXH3 long-input hot loop; scrambling runs once per kXXH3BlockLength bytes
+static void (*xxh3Accumulate)(uint64_t*, const uint8_t*, const uint8_t*, size_t) = XXH3AccumulateScalar;
+static void (*xxh3Scramble)(uint64_t*, const uint8_t*) = XXH3ScrambleScalar;
+static uint32_t (*crc32cKernel)(uint32_t, const uint8_t*, size_t) = Crc32cScalar;
+
+static void XXH3InitSecret(uint8_t* secret, uint64_t seed) {
+    for (size_t i = 0; i < kXXH3SecretSize; i += 16) {
+        uint64_t low = Read64(kXXH3Secret + i) + seed;
+        uint64_t high = Read64(kXXH3Secret + i + 8) - seed;
+        std::memcpy(secret + i, &low, sizeof(low));
+        std::memcpy(secret + i + 8, &high, sizeof(high));
+    }
+}
+
+static inline void XXH3InitAcc(uint64_t* acc) {
+    acc[0] = kPrime32_3;
+    acc[1] = kPrime64_1;
+    acc[2] = kPrime64_2;
+    acc[3] = kPrime64_3;
+    acc[4] = kPrime64_4;
+    acc[5] = kPrime32_2;
+    acc[6] = kPrime64_5;
+    acc[7] = kPrime32_1;
+}
+
+static uint64_t XXH3MergeAccs(const uint64_t* acc, const uint8_t* secret, uint64_t start) {
+    uint64_t result = start;
+    for (size_t i = 0; i < 4; i++) {
+        result += Mul128Fold64(acc[2 * i] ^ Read64(secret + 16 * i), acc[2 * i + 1] ^ Read64(secret + 16 * i + 8));
+    }
+    return XXH3Avalanche(result);
+}
+
+// Accumulates every stripe of an input longer than kXXH3MidSizeMax, including the overlapping last one
+static void XXH3HashLong(uint64_t* acc, const uint8_t* input, size_t length, const uint8_t* secret) {
+    XXH3InitAcc(acc);
+    const size_t blocks = (length - 1) / kXXH3BlockLength;
+    for (size_t n = 0; n < blocks; n++) {
+        xxh3Accumulate(acc, input + n * kXXH3BlockLength, secret, kXXH3StripesPerBlock);
+        xxh3Scramble(acc, secret + kXXH3SecretSize - kXXH3StripeLength);
+    }
+    const size_t stripes = ((length - 1) - kXXH3BlockLength * blocks) / kXXH3StripeLength;
+    xxh3Accumulate(acc, input + blocks * kXXH3BlockLength, secret, stripes);
+    xxh3Accumulate(acc, input + length - kXXH3StripeLength,
+                   secret + kXXH3SecretSize - kXXH3StripeLength - kXXH3SecretLastAccStart, 1);
+}
+
+/**
+ * XXH3 64-bit hash, bit-compatible with XXH3_64bits_withSeed
+ * @param data - Bytes to hash
+ * @param length - Byte count
+ * @param seed - Seed
+ * @returns Hash value
+ */
+static uint64_t XXH3Hash64(const uint8_t* data, size_t length, uint64_t seed) {
+    if (length <= 16) {
+        return XXH3Short64(data, length, kXXH3Secret, seed);
+    }
+    if (length <= kXXH3MidSizeMax) {
+        return XXH3Mid64(data, length, kXXH3Secret, seed);
+    }
+    alignas(64) uint8_t customSecret[kXXH3SecretSize];
+    const uint8_t* secret = kXXH3Secret;
+    if (seed != 0) {
+        XXH3InitSecret(customSecret, seed);
+        secret = customSecret;
+    }
+    alignas(64) uint64_t acc[8];
+    XXH3HashLong(acc, data, length, secret);
+    return XXH3MergeAccs(acc, secret + kXXH3SecretMergeAccsStart, static_cast<uint64_t>(length) * kPrime64_1);
+}
+
+/**
+ * XXH3 128-bit hash, bit-compatible with XXH3_128bits_withSeed
+ * @param data - Bytes to hash
+ * @param length - Byte count
+ * @param seed - Seed
+ * @returns Low and high halves
+ */
+static Hash128 XXH3Hash128(const uint8_t* data, size_t length, uint64_t seed) {
+    if (length <= 16) {
+        return XXH3Short128(data, length, kXXH3Secret, seed);
+    }
+    if (length <= kXXH3MidSizeMax) {
+        return XXH3Mid128(data, length, kXXH3Secret, seed);
+    }
+    alignas(64) uint8_t customSecret[kXXH3SecretSize];
+    const uint8_t* secret = kXXH3Secret;
+    if (seed != 0) {
+        XXH3InitSecret(customSecret, seed);
+        secret = customSecret;
+    }
+    alignas(64) uint64_t acc[8];
+    XXH3HashLong(acc, data, length, secret);
+    Hash128 result;
+    result.low = XXH3MergeAccs(acc, secret + kXXH3SecretMergeAccsStart, static_cast<uint64_t>(length) * kPrime64_1);
+    result.high = XXH3MergeAccs(acc, secret + kXXH3SecretSize - 64 - kXXH3SecretMergeAccsStart,
+                                ~(static_cast<uint64_t>(length) * kPrime64_2));
+    return result;
+}
+
+// wyhash (final version 4) default secret
+static constexpr uint64_t kWyhashSecret[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+};
+
+static inline void WyMultiply(uint64_t& a, uint64_t& b) {
+    uint64_t low;
+    uint64_t high = MulHigh64(a, b, low);
+    a = low;
+    b = high;
+}
+
+static inline uint64_t WyMix(uint64_t a, uint64_t b) {
+    WyMultiply(a, b);
+    return a ^ b;
+}
+
+/**
+ * wyhash final version 4 with the default secret
+ * @param data - Bytes to hash
+ * @param length - Byte count
+ * @param seed - Seed
+ * @returns Hash value
+ */
+static uint64_t WyHash(const uint8_t* data, size_t length, uint64_t seed) {
+    const uint64_t* secret = kWyhashSecret;
+    seed ^= WyMix(seed ^ secret[0], secret[1]);
+    uint64_t a, b;
+    if (length <= 16) {
+        if (length >= 4) {
+            size_t middle = (length >> 3) << 2;
+            a = (static_cast<uint64_t>(Read32(data)) << 32) | Read32(data + middle);
+            b = (static_cast<uint64_t>(Read32(data + length - 4)) << 32) | Read32(data + length - 4 - middle);
+        } else if (length > 0) {
+            a = (static_cast<uint64_t>(data[0]) << 16) | (static_cast<uint64_t>(data[length >> 1]) << 8) | data[length - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        const uint8_t* p = data;
+        size_t i = length;
+        if (i >= 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = WyMix(Read64(p) ^ secret[1], Read64(p + 8) ^ seed);
+                see1 = WyMix(Read64(p + 16) ^ secret[2], Read64(p + 24) ^ see1);
+                see2 = WyMix(Read64(p + 32) ^ secret[3], Read64(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = WyMix(Read64(p) ^ secret[1], Read64(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = Read64(p + i - 16);
+        b = Read64(p + i - 8);
+    }
+    a ^= secret[1];
+    b ^= seed;
+    WyMultiply(a, b);
+    return WyMix(a ^ secret[0] ^ length, b ^ secret[1]);
+}
+
+static constexpr size_t kXXH3BufferSize = 256;
+
+// Incremental XXH3 state, digest-compatible with XXH3_64bits/128bits_update.
+// Input is buffered until more than kXXH3BufferSize bytes arrive, so short
+// totals are finished with the one-shot short-input paths.
+struct XXH3Stream {
+    alignas(64) uint64_t acc[8];
+    alignas(64) uint8_t secret[kXXH3SecretSize];
+    uint8_t buffer[kXXH3BufferSize];
+    size_t bufferedSize;
+    size_t stripesSoFar;
+    uint64_t totalLength;
+    uint64_t seed;
+};
+
+static void XXH3StreamReset(XXH3Stream& stream, uint64_t seed) {
+    XXH3InitAcc(stream.acc);
+    XXH3InitSecret(stream.secret, seed);
+    stream.bufferedSize = 0;
+    stream.stripesSoFar = 0;
+    stream.totalLength = 0;
+    stream.seed = seed;
+}
+
+// Accumulates whole stripes, scrambling at each block boundary
+static const uint8_t* XXH3ConsumeStripes(uint64_t* acc, size_t& stripesSoFar, const uint8_t* input,
+                                         size_t stripes, const uint8_t* secret) {
+    const uint8_t* stripeSecret = secret + stripesSoFar * kXXH3SecretConsumeRate;
+    if (stripes >= kXXH3StripesPerBlock - stripesSoFar) {
+        size_t stripesThisBlock = kXXH3StripesPerBlock - stripesSoFar;
+        do {
+            xxh3Accumulate(acc, input, stripeSecret, stripesThisBlock);
+            xxh3Scramble(acc, secret + kXXH3SecretSize - kXXH3StripeLength);
+            input += stripesThisBlock * kXXH3StripeLength;
+            stripes -= stripesThisBlock;
+            stripesThisBlock = kXXH3StripesPerBlock;
+            stripeSecret = secret;
+        } while (stripes >= kXXH3StripesPerBlock);
+        stripesSoFar = 0;
+    }
+    if (stripes > 0) {
+        xxh3Accumulate(acc, input, stripeSecret, stripes);
+        input += stripes * kXXH3StripeLength;
+        stripesSoFar += stripes;
+    }
+    return input;
+}
+
+static void XXH3StreamUpdate(XXH3Stream& stream, const uint8_t* input, size_t length) {
+    const uint8_t* end = input + length;
+    stream.totalLength += length;
+    if (length <= kXXH3BufferSize - stream.bufferedSize) {
+        std::memcpy(stream.buffer + stream.bufferedSize, input, length);
+        stream.bufferedSize += length;
+        return;
+    }
+    
+    // Always keep at least one byte buffered: the last stripe is accumulated at digest time
+    constexpr size_t bufferStripes = kXXH3BufferSize / kXXH3StripeLength;
+    if (stream.bufferedSize) {
+        size_t fill = kXXH3BufferSize - stream.bufferedSize;
+        std::memcpy(stream.buffer + stream.bufferedSize, input, fill);
+        input += fill;
+        XXH3ConsumeStripes(stream.acc, stream.stripesSoFar, stream.buffer, bufferStripes, stream.secret);
+        stream.bufferedSize = 0;
+    }
+    if (static_cast<size_t>(end - input) > kXXH3BufferSize) {
+        size_t stripes = static_cast<size_t>(end - 1 - input) / kXXH3StripeLength;
+        input = XXH3ConsumeStripes(stream.acc, stream.stripesSoFar, input, stripes, stream.secret);
+        // Keep the previous stripe for a short tail's overlapping last stripe
+        std::memcpy(stream.buffer + kXXH3BufferSize - kXXH3StripeLength, input - kXXH3StripeLength, kXXH3StripeLength);
+    }
+    std::memcpy(stream.buffer, input, static_cast<size_t>(end - input));
+    stream.bufferedSize = static_cast<size_t>(end - input);
+}
+
+// Finishes the accumulators of a long stream without modifying it
+static void XXH3StreamDigestLong(const XXH3Stream& stream, uint64_t* acc) {
+    std::memcpy(acc, stream.acc, sizeof(stream.acc));
+    uint8_t lastStripe[kXXH3StripeLength];
+    const uint8_t* lastStripePointer;
+    if (stream.bufferedSize >= kXXH3StripeLength) {
+        size_t stripes = (stream.bufferedSize - 1) / kXXH3StripeLength;
+        size_t stripesSoFar = stream.stripesSoFar;
+        XXH3ConsumeStripes(acc, stripesSoFar, stream.buffer, stripes, stream.secret);
+        lastStripePointer = stream.buffer + stream.bufferedSize - kXXH3StripeLength;
+    } else {
+        size_t catchUp = kXXH3StripeLength - stream.bufferedSize;
+        std::memcpy(lastStripe, stream.buffer + kXXH3BufferSize - catchUp, catchUp);
+        std::memcpy(lastStripe + catchUp, stream.buffer, stream.bufferedSize);
+        lastStripePointer = lastStripe;
+    }
+    xxh3Accumulate(acc, lastStripePointer, stream.secret + kXXH3SecretSize - kXXH3StripeLength - kXXH3SecretLastAccStart, 1);
+}
+
+static uint64_t XXH3StreamDigest64(const XXH3Stream& stream) {
+    if (stream.totalLength <= kXXH3MidSizeMax) {
+        return XXH3Hash64(stream.buffer, static_cast<size_t>(stream.totalLength), stream.seed);
+    }
+    alignas(64) uint64_t acc[8];
+    XXH3StreamDigestLong(stream, acc);
+    return XXH3MergeAccs(acc, stream.secret + kXXH3SecretMergeAccsStart, stream.totalLength * kPrime64_1);
+}
+
+static Hash128 XXH3StreamDigest128(const XXH3Stream& stream) {
+    if (stream.totalLength <= kXXH3MidSizeMax) {
+        return XXH3Hash128(stream.buffer, static_cast<size_t>(stream.totalLength), stream.seed);
+    }
+    alignas(64) uint64_t acc[8];
+    XXH3StreamDigestLong(stream, acc);
+    Hash128 result;
+    result.low = XXH3MergeAccs(acc, stream.secret + kXXH3SecretMergeAccsStart, stream.totalLength * kPrime64_1);
+    result.high = XXH3MergeAccs(acc, stream.secret + kXXH3SecretSize - 64 - kXXH3SecretMergeAccsStart,
+                                ~(stream.totalLength * kPrime64_2));
+    return result;
+}
+
+// Transcoder result for malformed or unrepresentable input
+static constexpr size_t kTranscodeError = SIZE_MAX;
+
+/**
+ * Decodes one UTF-8 sequence, rejecting overlong forms, surrogates and code points above U+10FFFF
+ * @param data - First byte of the sequence
+ * @param remaining - Bytes available from data
+ * @param codePoint - Receives the decoded code point
+ * @returns Sequence length, or 0 when invalid or truncated
+ */
+static inline size_t DecodeUtf8(const uint8_t* data, size_t remaining, uint32_t& codePoint) {
+    uint8_t lead = data[0];
+    if (lead < 0x80) {
+        codePoint = lead;
+        return 1;
+    }
+    if (lead < 0xC2) {
+        // Continuation byte or overlong two-byte lead
+        return 0;
+    }
+    if (lead < 0xE0) {
+        if (remaining < 2 || (data[1] & 0xC0) != 0x80) {
+            return 0;
+        }
+        codePoint = (static_cast<uint32_t>(lead & 0x1F) << 6) | (data[1] & 0x3F);
+        return 2;
+    }
+    if (lead < 0xF0) {
+        if (remaining < 3 || (data[1] & 0xC0) != 0x80 || (data[2] & 0xC0) != 0x80) {
+            return 0;
+        }
+        codePoint = (static_cast<uint32_t>(lead & 0x0F) << 12) | (static_cast<uint32_t>(data[1] & 0x3F) << 6) |
+                    (data[2] & 0x3F);
+        return codePoint < 0x800 || (codePoint >= 0xD800 && codePoint <= 0xDFFF) ? 0 : 3;
+    }
+    if (lead < 0xF5) {
+        if (remaining < 4 || (data[1] & 0xC0) != 0x80 || (data[2] & 0xC0) != 0x80 || (data[3] & 0xC0) != 0x80) {
+            return 0;
+        }
+        codePoint = (static_cast<uint32_t>(lead & 0x07) << 18) | (static_cast<uint32_t>(data[1] & 0x3F) << 12) |
+                    (static_cast<uint32_t>(data[2] & 0x3F) << 6) | (data[3] & 0x3F);
+        return codePoint < 0x10000 || codePoint > 0x10FFFF ? 0 : 4;
+    }
+    return 0;
+}
+
+/**
+ * Scalar UTF-8 validation; ASCII is skipped eight bytes at a time
+ * @param data - Bytes to check
+ * @param length - Byte count
+ * @returns True if the bytes are well-formed UTF-8
+ */
+static bool ValidateUtf8Scalar(const uint8_t* data, size_t length) {
+    size_t i = 0;
+    while (i < length) {
+        if (i + 8 <= length) {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            if ((word & 0x8080808080808080ULL) == 0) {
+                i += 8;
+                continue;
+            }
+        }
+        uint32_t codePoint;
+        size_t sequence = DecodeUtf8(data + i, length - i, codePoint);
+        if (sequence == 0) {
+            return false;
+        }
+        i += sequence;
+    }
+    return true;
+}
+
+/*
+ * Vector validation classifies every byte pair (previous byte, current byte)
+ * with three 16-entry nibble lookups; each table entry is a bit set of the
+ * errors that nibble can take part in, so their AND is non-zero only for an
+ * actual error (Keiser and Lemire, "Validating UTF-8 In Less Than One
+ * Instruction Per Byte"). Continuations required by three- and four-byte
+ * leads two and three bytes back are checked separately.
+ */
+static constexpr uint8_t kUtf8TooShort = 1 << 0;     // Lead byte or ASCII where a continuation is due
+static constexpr uint8_t kUtf8TooLong = 1 << 1;      // Continuation after ASCII
+static constexpr uint8_t kUtf8Overlong3 = 1 << 2;    // E0 followed by 80..9F
+static constexpr uint8_t kUtf8TooLarge = 1 << 3;     // F4 followed by 90..BF
+static constexpr uint8_t kUtf8Surrogate = 1 << 4;    // ED followed by A0..BF
+static constexpr uint8_t kUtf8Overlong2 = 1 << 5;    // C0 or C1
+static constexpr uint8_t kUtf8TooLarge1000 = 1 << 6; // F5..FF followed by 80..8F
+static constexpr uint8_t kUtf8Overlong4 = 1 << 6;    // F0 followed by 80..8F
+static constexpr uint8_t kUtf8TwoConts = 1 << 7;     // Continuation after continuation
+static constexpr uint8_t kUtf8Carry = kUtf8TooShort | kUtf8TooLong | kUtf8TwoConts;
+
+// Indexed by the high nibble of the previous byte
+alignas(16) static const uint8_t kUtf8Byte1High[16] = {
+    kUtf8TooLong, kUtf8TooLong, kUtf8TooLong, kUtf8TooLong,
+    kUtf8TooLong, kUtf8TooLong, kUtf8TooLong, kUtf8TooLong,
+    kUtf8TwoConts, kUtf8TwoConts, kUtf8TwoConts, kUtf8TwoConts,
+    kUtf8TooShort | kUtf8Overlong2,
+    kUtf8TooShort,
+    kUtf8TooShort | kUtf8Overlong3 | kUtf8Surrogate,
+    kUtf8TooShort | kUtf8TooLarge | kUtf8TooLarge1000 | kUtf8Overlong4
+};
+
+// Indexed by the low nibble of the previous byte
+alignas(16) static const uint8_t kUtf8Byte1Low[16] = {
+    kUtf8Carry | kUtf8Overlong3 | kUtf8Overlong2 | kUtf8Overlong4,
+    kUtf8Carry | kUtf8Overlong2,
+    kUtf8Carry,
+    kUtf8Carry,
+    kUtf8Carry | kUtf8TooLarge,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000 | kUtf8Surrogate,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000,
+    kUtf8Carry | kUtf8TooLarge | kUtf8TooLarge1000
+};
+
+// Indexed by the high nibble of the current byte
+alignas(16) static const uint8_t kUtf8Byte2High[16] = {
+    kUtf8TooShort, kUtf8TooShort, kUtf8TooShort, kUtf8TooShort,
+    kUtf8TooShort, kUtf8TooShort, kUtf8TooShort, kUtf8TooShort,
+    kUtf8TooLong | kUtf8Overlong2 | kUtf8TwoConts | kUtf8Overlong3 | kUtf8TooLarge1000 | kUtf8Overlong4,
+    kUtf8TooLong | kUtf8Overlong2 | kUtf8TwoConts | kUtf8Overlong3 | kUtf8TooLarge,
+    kUtf8TooLong | kUtf8Overlong2 | kUtf8TwoConts | kUtf8Surrogate | kUtf8TooLarge,
+    kUtf8TooLong | kUtf8Overlong2 | kUtf8TwoConts | kUtf8Surrogate | kUtf8TooLarge,
+    kUtf8TooShort, kUtf8TooShort, kUtf8TooShort, kUtf8TooShort
+};
+
+/**
+ * Scalar code point count: every byte that is not a continuation byte starts
+ * a character. Exact for valid UTF-8; for malformed input each stray
+ * continuation byte goes uncounted.
+ * @param data - Bytes to count
+ * @param length - Byte count
+ * @param fourByteLeads - Receives the number of four-byte leads (surrogate pairs in UTF-16)
+ * @returns Code point count
+ */
+static size_t CountUtf8Scalar(const uint8_t* data, size_t length, size_t& fourByteLeads) {
+    constexpr uint64_t highBits = 0x8080808080808080ULL;
+    constexpr uint64_t byteSum = 0x0101010101010101ULL;
+    size_t characters = 0;
+    size_t fours = 0;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        // 10xxxxxx marks a continuation byte, 1111xxxx a four-byte lead; summed per byte lane
+        uint64_t continuations = (word & ~(word << 1) & highBits) >> 7;
+        uint64_t leads = (word & (word << 1) & (word << 2) & (word << 3) & highBits) >> 7;
+        characters += 8 - static_cast<size_t>((continuations * byteSum) >> 56);
+        fours += static_cast<size_t>((leads * byteSum) >> 56);
+    }
+    for (; i < length; i++) {
+        characters += static_cast<int8_t>(data[i]) > -65;
+        fours += data[i] >= 0xF0;
+    }
+    fourByteLeads = fours;
+    return characters;
+}
+
+/**
+ * Scalar ASCII run kernels for the transcoders. Each converts whole blocks
+ * while they are pure ASCII and stops at the first block that is not,
+ * leaving the rest to the scalar decoder; falling back to narrower blocks
+ * would only add work to text with short ASCII runs.
+ * @returns Units converted
+ */
+static size_t WidenAsciiScalar(const uint8_t* input, size_t length, char16_t* output) {
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, input + i, sizeof(word));
+        if (word & 0x8080808080808080ULL) {
+            break;
+        }
+        for (size_t k = 0; k < 8; k++) {
+            output[i + k] = input[i + k];
+        }
+    }
+    return i;
+}
+
+static size_t NarrowAsciiScalar(const char16_t* input, size_t length, uint8_t* output) {
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        if ((input[i] | input[i + 1] | input[i + 2] | input[i + 3]) >= 0x80) {
+            break;
+        }
+        for (size_t k = 0; k < 4; k++) {
+            output[i + k] = static_cast<uint8_t>(input[i + k]);
+        }
+    }
+    return i;
+}
+
+static size_t CopyAsciiScalar(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, input + i, sizeof(word));
+        if (word & 0x8080808080808080ULL) {
+            break;
+        }
+        std::memcpy(output + i, &word, sizeof(word));
+    }
+    return i;
+}
+
+// pshufb patterns that pack the 16-bit lanes selected by an 8-bit mask to the front
+struct Utf16CompressTable {
+    alignas(16) uint8_t shuffle[256][16];
+    uint8_t count[256];
+};
+
+static Utf16CompressTable MakeUtf16CompressTable() {
+    Utf16CompressTable table;
+    for (int mask = 0; mask < 256; mask++) {
+        int lanes = 0;
+        for (int lane = 0; lane < 8; lane++) {
+            if (mask & (1 << lane)) {
+                table.shuffle[mask][lanes * 2] = static_cast<uint8_t>(lane * 2);
+                table.shuffle[mask][lanes * 2 + 1] = static_cast<uint8_t>(lane * 2 + 1);
+                lanes++;
+            }
+        }
+        for (int k = lanes * 2; k < 16; k++) {
+            table.shuffle[mask][k] = 0x80;
+        }
+        table.count[mask] = static_cast<uint8_t>(lanes);
+    }
+    return table;
+}
+
+static const Utf16CompressTable utf16Compress = MakeUtf16CompressTable();
+
+#ifdef LLJS_ARCH_X86
+LLJS_TARGET_SSE2
+static size_t CountUtf8SSE2(const uint8_t* data, size_t length, size_t& fourByteLeads) {
+    const __m128i continuationLimit = _mm_set1_epi8(-65);
+    const __m128i fourByteMin = _mm_set1_epi8(static_cast<char>(0xF0));
+    size_t i = 0;
+    size_t characters = 0;
+    size_t fours = 0;
+    while (i + 16 <= length) {
+        // Byte lane counters are flushed before they can wrap
+        __m128i characterLanes = _mm_setzero_si128();
+        __m128i fourLanes = _mm_setzero_si128();
+        for (size_t blocks = 0; blocks < 255 && i + 16 <= length; blocks++, i += 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            characterLanes = _mm_sub_epi8(characterLanes, _mm_cmpgt_epi8(bytes, continuationLimit));
+            fourLanes = _mm_sub_epi8(fourLanes, _mm_cmpeq_epi8(_mm_max_epu8(bytes, fourByteMin), bytes));
+        }
+        __m128i characterSums = _mm_sad_epu8(characterLanes, _mm_setzero_si128());
+        __m128i fourSums = _mm_sad_epu8(fourLanes, _mm_setzero_si128());
+        characters += static_cast<size_t>(_mm_cvtsi128_si32(characterSums)) + _mm_extract_epi16(characterSums, 4);
+        fours += static_cast<size_t>(_mm_cvtsi128_si32(fourSums)) + _mm_extract_epi16(fourSums, 4);
+    }
+    size_t tailFours;
+    characters += CountUtf8Scalar(data + i, length - i, tailFours);
+    fourByteLeads = fours + tailFours;
+    return characters;
+}
+
+LLJS_TARGET_SSE2
+static size_t WidenAsciiSSE2(const uint8_t* input, size_t length, char16_t* output) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        if (_mm_movemask_epi8(bytes)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8), _mm_unpackhi_epi8(bytes, zero));
+    }
+    return i;
+}
+
+LLJS_TARGET_SSE2
+static size_t NarrowAsciiSSE2(const char16_t* input, size_t length, uint8_t* output) {
+    const __m128i highBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8));
+        __m128i outside = _mm_and_si128(_mm_or_si128(low, high), highBits);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(outside, _mm_setzero_si128())) != 0xFFFF) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(low, high));
+    }
+    return i;
+}
+
+LLJS_TARGET_SSE2
+static size_t CopyAsciiSSE2(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        if (_mm_movemask_epi8(bytes)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), bytes);
+    }
+    return i;
+}
+
+// Error bits for one 32-byte block given the block before it
+LLJS_TARGET_AVX2
+static inline __m256i Utf8BlockErrorsAVX2(__m256i input, __m256i previous) {
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i byte1High = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte1High)));
+    const __m256i byte1Low = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte1Low)));
+    const __m256i byte2High = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte2High)));
+    
+    // Bytes 1, 2 and 3 positions back, reaching into the previous block
+    __m256i carried = _mm256_permute2x128_si256(previous, input, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(input, carried, 15);
+    __m256i prev2 = _mm256_alignr_epi8(input, carried, 14);
+    __m256i prev3 = _mm256_alignr_epi8(input, carried, 13);
+    
+    __m256i special = _mm256_and_si256(
+        _mm256_and_si256(_mm256_shuffle_epi8(byte1High, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                         _mm256_shuffle_epi8(byte1Low, _mm256_and_si256(prev1, nibble))),
+        _mm256_shuffle_epi8(byte2High, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+    __m256i thirdByte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m256i fourthByte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m256i mustContinue = _mm256_and_si256(_mm256_or_si256(thirdByte, fourthByte), _mm256_set1_epi8(static_cast<char>(0x80)));
+    return _mm256_xor_si256(mustContinue, special);
+}
+
+// Validates one block; ASCII blocks only check that the previous block did not end mid-sequence
+LLJS_TARGET_AVX2
+static inline void Utf8StepAVX2(__m256i input, __m256i incompleteLimit, __m256i& error, __m256i& previous, __m256i& incomplete) {
+    if (_mm256_movemask_epi8(input) == 0) {
+        error = _mm256_or_si256(error, incomplete);
+        incomplete = _mm256_setzero_si256();
+    } else {
+        error = _mm256_or_si256(error, Utf8BlockErrorsAVX2(input, previous));
+        incomplete = _mm256_subs_epu8(input, incompleteLimit);
+    }
+    previous = input;
+}
+
+LLJS_TARGET_AVX2
+static bool ValidateUtf8AVX2(const uint8_t* data, size_t length) {
+    // Non-zero where a block ends inside a sequence
+    const __m256i incompleteLimit = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+    __m256i error = _mm256_setzero_si256();
+    __m256i previous = _mm256_setzero_si256();
+    __m256i incomplete = _mm256_setzero_si256();
+    
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        Utf8StepAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), incompleteLimit, error, previous, incomplete);
+        if ((i & 4095) == 4064 && !_mm256_testz_si256(error, error)) {
+            return false;
+        }
+    }
+    // The zero padding also flushes a sequence left open by the last full block
+    alignas(32) uint8_t tail[32] = {};
+    std::memcpy(tail, data + i, length - i);
+    Utf8StepAVX2(_mm256_load_si256(reinterpret_cast<const __m256i*>(tail)), incompleteLimit, error, previous, incomplete);
+    return _mm256_testz_si256(error, error) != 0;
+}
+
+LLJS_TARGET_AVX2
+static size_t CountUtf8AVX2(const uint8_t* data, size_t length, size_t& fourByteLeads) {
+    const __m256i continuationLimit = _mm256_set1_epi8(-65);
+    const __m256i fourByteMin = _mm256_set1_epi8(static_cast<char>(0xF0));
+    size_t i = 0;
+    __m256i characterSums = _mm256_setzero_si256();
+    __m256i fourSums = _mm256_setzero_si256();
+    while (i + 32 <= length) {
+        __m256i characterLanes = _mm256_setzero_si256();
+        __m256i fourLanes = _mm256_setzero_si256();
+        for (size_t blocks = 0; blocks < 255 && i + 32 <= length; blocks++, i += 32) {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            characterLanes = _mm256_sub_epi8(characterLanes, _mm256_cmpgt_epi8(bytes, continuationLimit));
+            fourLanes = _mm256_sub_epi8(fourLanes, _mm256_cmpeq_epi8(_mm256_max_epu8(bytes, fourByteMin), bytes));
+        }
+        characterSums = _mm256_add_epi64(characterSums, _mm256_sad_epu8(characterLanes, _mm256_setzero_si256()));
+        fourSums = _mm256_add_epi64(fourSums, _mm256_sad_epu8(fourLanes, _mm256_setzero_si256()));
+    }
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), characterSums);
+    size_t characters = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), fourSums);
+    size_t fours = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    size_t tailFours;
+    characters += CountUtf8Scalar(data + i, length - i, tailFours);
+    fourByteLeads = fours + tailFours;
+    return characters;
+}
+
+LLJS_TARGET_AVX2
+static size_t WidenAsciiAVX2(const uint8_t* input, size_t length, char16_t* output) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        if (_mm256_movemask_epi8(bytes)) {
+            break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+    }
+    return i;
+}
+
+/**
+ * Converts leading blocks of valid UTF-8 to UTF-16 while they hold only one-
+ * and two-byte characters: ASCII 32 bytes at a time, mixed blocks 16 bytes
+ * at a time by decoding every position as a potential lead and packing out
+ * the continuation positions
+ * @param input - Valid UTF-8 bytes, starting at a character boundary
+ * @param length - Byte count
+ * @param output - Destination units
+ * @param units - Receives the units written
+ * @returns Bytes consumed, always at a character boundary
+ */
+LLJS_TARGET_AVX2
+static size_t Utf8BlocksAVX2(const uint8_t* input, size_t length, char16_t* output, size_t& units) {
+    const __m128i continuationBits = _mm_set1_epi8(static_cast<char>(0xC0));
+    const __m128i continuationTag = _mm_set1_epi8(static_cast<char>(0x80));
+    const __m128i twoByteMax = _mm_set1_epi8(static_cast<char>(0xDF));
+    size_t i = 0, o = 0;
+    // 48 bytes of lookahead guarantee that many units still to come, so the
+    // full-width stores below never pass the end of an exactly sized output
+    while (i + 48 <= length) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        if (_mm256_movemask_epi8(block) == 0) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + o), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(block)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + o + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(block, 1)));
+            i += 32;
+            o += 32;
+            continue;
+        }
+        
+        __m128i bytes = _mm256_castsi256_si128(block);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(bytes, twoByteMax), _mm_setzero_si128())) != 0xFFFF) {
+            // Three- and four-byte sequences go to the scalar decoder
+            break;
+        }
+        __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 1));
+        int continuations = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, continuationBits), continuationTag));
+        int keep = ~continuations & 0xFFFF;
+        size_t consumed = 16;
+        if (input[i + 15] >= 0xC0) {
+            // The last lead's continuation belongs to the next block
+            keep &= 0x7FFF;
+            consumed = 15;
+        }
+        
+        __m256i current = _mm256_cvtepu8_epi16(bytes);
+        __m256i following = _mm256_cvtepu8_epi16(next);
+        __m256i twoByte = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(current, _mm256_set1_epi16(0x1F)), 6),
+                                          _mm256_and_si256(following, _mm256_set1_epi16(0x3F)));
+        __m256i isLead = _mm256_cmpgt_epi16(current, _mm256_set1_epi16(0xBF));
+        __m256i values = _mm256_blendv_epi8(current, twoByte, isLead);
+        
+        int keepLow = keep & 0xFF;
+        int keepHigh = keep >> 8;
+        __m128i packedLow = _mm_shuffle_epi8(_mm256_castsi256_si128(values),
+                                             _mm_load_si128(reinterpret_cast<const __m128i*>(utf16Compress.shuffle[keepLow])));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + o), packedLow);
+        o += utf16Compress.count[keepLow];
+        __m128i packedHigh = _mm_shuffle_epi8(_mm256_extracti128_si256(values, 1),
+                                              _mm_load_si128(reinterpret_cast<const __m128i*>(utf16Compress.shuffle[keepHigh])));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + o), packedHigh);
+        o += utf16Compress.count[keepHigh];
+        i += consumed;
+    }
+    units = o;
+    return i;
+}
+
+LLJS_TARGET_AVX2
+static size_t NarrowAsciiAVX2(const char16_t* input, size_t length, uint8_t* output) {
+    const __m256i highBits = _mm256_set1_epi16(static_cast<short>(0xFF80));
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i + 16));
+        if (!_mm256_testz_si256(_mm256_or_si256(low, high), highBits)) {
+            break;
+        }
+        // packus interleaves 128-bit lanes; restore their order
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), packed);
+    }
+    return i;
+}
+
+LLJS_TARGET_AVX2
+static size_t CopyAsciiAVX2(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        if (_mm256_movemask_epi8(bytes)) {
+            break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), bytes);
+    }
+    return i;
+}
+
+LLJS_TARGET_AVX512
+static inline __m512i Utf8BlockErrorsAVX512(__m512i input, __m512i previous) {
+    const __m512i nibble = _mm512_set1_epi8(0x0F);
+    const __m512i byte1High = _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte1High)));
+    const __m512i byte1Low = _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte1Low)));
+    const __m512i byte2High = _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte2High)));
+    
+    // Lane 3 of the previous block followed by lanes 0-2 of this one
+    __m512i carried = _mm512_permutex2var_epi64(previous, _mm512_setr_epi64(6, 7, 8, 9, 10, 11, 12, 13), input);
+    __m512i prev1 = _mm512_alignr_epi8(input, carried, 15);
+    __m512i prev2 = _mm512_alignr_epi8(input, carried, 14);
+    __m512i prev3 = _mm512_alignr_epi8(input, carried, 13);
+    
+    __m512i special = _mm512_and_si512(
+        _mm512_and_si512(_mm512_shuffle_epi8(byte1High, _mm512_and_si512(_mm512_srli_epi16(prev1, 4), nibble)),
+                         _mm512_shuffle_epi8(byte1Low, _mm512_and_si512(prev1, nibble))),
+        _mm512_shuffle_epi8(byte2High, _mm512_and_si512(_mm512_srli_epi16(input, 4), nibble)));
+    __m512i thirdByte = _mm512_subs_epu8(prev2, _mm512_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m512i fourthByte = _mm512_subs_epu8(prev3, _mm512_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m512i mustContinue = _mm512_and_si512(_mm512_or_si512(thirdByte, fourthByte), _mm512_set1_epi8(static_cast<char>(0x80)));
+    return _mm512_xor_si512(mustContinue, special);
+}
+
+LLJS_TARGET_AVX512
+static inline void Utf8StepAVX512(__m512i input, __m512i incompleteLimit, __m512i& error, __m512i& previous, __m512i& incomplete) {
+    if (_mm512_movepi8_mask(input) == 0) {
+        error = _mm512_or_si512(error, incomplete);
+        incomplete = _mm512_setzero_si512();
+    } else {
+        error = _mm512_or_si512(error, Utf8BlockErrorsAVX512(input, previous));
+        incomplete = _mm512_subs_epu8(input, incompleteLimit);
+    }
+    previous = input;
+}
+
+LLJS_TARGET_AVX512
+static bool ValidateUtf8AVX512(const uint8_t* data, size_t length) {
+    alignas(64) static const uint8_t incompleteBytes[64] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+    };
+    const __m512i incompleteLimit = _mm512_load_si512(incompleteBytes);
+    __m512i error = _mm512_setzero_si512();
+    __m512i previous = _mm512_setzero_si512();
+    __m512i incomplete = _mm512_setzero_si512();
+    
+    size_t i = 0;
+    for (; i + 64 <= length; i += 64) {
+        Utf8StepAVX512(_mm512_loadu_si512(data + i), incompleteLimit, error, previous, incomplete);
+        if ((i & 4095) == 4032 && _mm512_test_epi8_mask(error, error)) {
+            return false;
+        }
+    }
+    // Masked tail load; the zeroed bytes also flush a sequence left open by the last full block
+    __mmask64 tailMask = length == i ? 0 : (~0ULL >> (64 - (length - i)));
+    Utf8StepAVX512(_mm512_maskz_loadu_epi8(tailMask, data + i), incompleteLimit, error, previous, incomplete);
+    return _mm512_test_epi8_mask(error, error) == 0;
+}
+
+LLJS_TARGET_AVX512
+static size_t CountUtf8AVX512(const uint8_t* data, size_t length, size_t& fourByteLeads) {
+    const __m512i continuationLimit = _mm512_set1_epi8(-65);
+    const __m512i fourByteMin = _mm512_set1_epi8(static_cast<char>(0xF0));
+    size_t i = 0;
+    __m512i characterSums = _mm512_setzero_si512();
+    __m512i fourSums = _mm512_setzero_si512();
+    while (i + 64 <= length) {
+        __m512i characterLanes = _mm512_setzero_si512();
+        __m512i fourLanes = _mm512_setzero_si512();
+        for (size_t blocks = 0; blocks < 255 && i + 64 <= length; blocks++, i += 64) {
+            __m512i bytes = _mm512_loadu_si512(data + i);
+            characterLanes = _mm512_sub_epi8(characterLanes, _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(bytes, continuationLimit)));
+            fourLanes = _mm512_sub_epi8(fourLanes, _mm512_movm_epi8(_mm512_cmpge_epu8_mask(bytes, fourByteMin)));
+        }
+        characterSums = _mm512_add_epi64(characterSums, _mm512_sad_epu8(characterLanes, _mm512_setzero_si512()));
+        fourSums = _mm512_add_epi64(fourSums, _mm512_sad_epu8(fourLanes, _mm512_setzero_si512()));
+    }
+    size_t characters = static_cast<size_t>(_mm512_reduce_add_epi64(characterSums));
+    size_t fours = static_cast<size_t>(_mm512_reduce_add_epi64(fourSums));
+    size_t tailFours;
+    characters += CountUtf8AVX2(data + i, length - i, tailFours);
+    fourByteLeads = fours + tailFours;
+    return characters;
+}
+#endif // LLJS_ARCH_X86
+
+#ifdef LLJS_ARCH_ARM64
+static inline uint8x16_t Utf8BlockErrorsNEON(uint8x16_t input, uint8x16_t previous) {
+    const uint8x16_t nibble = vdupq_n_u8(0x0F);
+    uint8x16_t prev1 = vextq_u8(previous, input, 15);
+    uint8x16_t prev2 = vextq_u8(previous, input, 14);
+    uint8x16_t prev3 = vextq_u8(previous, input, 13);
+    
+    uint8x16_t special = vandq_u8(
+        vandq_u8(vqtbl1q_u8(vld1q_u8(kUtf8Byte1High), vshrq_n_u8(prev1, 4)),
+                 vqtbl1q_u8(vld1q_u8(kUtf8Byte1Low), vandq_u8(prev1, nibble))),
+        vqtbl1q_u8(vld1q_u8(kUtf8Byte2High), vshrq_n_u8(input, 4)));
+    uint8x16_t thirdByte = vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80));
+    uint8x16_t fourthByte = vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80));
+    uint8x16_t mustContinue = vandq_u8(vorrq_u8(thirdByte, fourthByte), vdupq_n_u8(0x80));
+    return veorq_u8(mustContinue, special);
+}
+
+static inline void Utf8StepNEON(uint8x16_t input, uint8x16_t incompleteLimit, uint8x16_t& error, uint8x16_t& previous, uint8x16_t& incomplete) {
+    if (vmaxvq_u8(input) < 0x80) {
+        error = vorrq_u8(error, incomplete);
+        incomplete = vdupq_n_u8(0);
+    } else {
+        error = vorrq_u8(error, Utf8BlockErrorsNEON(input, previous));
+        incomplete = vqsubq_u8(input, incompleteLimit);
+    }
+    previous = input;
+}
+
+static bool ValidateUtf8NEON(const uint8_t* data, size_t length) {
+    static const uint8_t incompleteBytes[16] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+    };
+    const uint8x16_t incompleteLimit = vld1q_u8(incompleteBytes);
+    uint8x16_t error = vdupq_n_u8(0);
+    uint8x16_t previous = vdupq_n_u8(0);
+    uint8x16_t incomplete = vdupq_n_u8(0);
+    
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        Utf8StepNEON(vld1q_u8(data + i), incompleteLimit, error, previous, incomplete);
+        if ((i & 4095) == 4080 && vmaxvq_u8(error) != 0) {
+            return false;
+        }
+    }
+    uint8_t tail[16] = {};
+    std::memcpy(tail, data + i, length - i);
+    Utf8StepNEON(vld1q_u8(tail), incompleteLimit, error, previous, incomplete);
+    return vmaxvq_u8(error) == 0;
+}
+
+static size_t CountUtf8NEON(const uint8_t* data, size_t length, size_t& fourByteLeads) {
+    const int8x16_t continuationLimit = vdupq_n_s8(-65);
+    const uint8x16_t fourByteMin = vdupq_n_u8(0xF0);
+    size_t i = 0;
+    size_t characters = 0;
+    size_t fours = 0;
+    while (i + 16 <= length) {
+        uint8x16_t characterLanes = vdupq_n_u8(0);
+        uint8x16_t fourLanes = vdupq_n_u8(0);
+        for (size_t blocks = 0; blocks < 255 && i + 16 <= length; blocks++, i += 16) {
+            uint8x16_t bytes = vld1q_u8(data + i);
+            characterLanes = vsubq_u8(characterLanes, vcgtq_s8(vreinterpretq_s8_u8(bytes), continuationLimit));
+            fourLanes = vsubq_u8(fourLanes, vcgeq_u8(bytes, fourByteMin));
+        }
+        characters += vaddlvq_u8(characterLanes);
+        fours += vaddlvq_u8(fourLanes);
+    }
+    size_t tailFours;
+    characters += CountUtf8Scalar(data + i, length - i, tailFours);
+    fourByteLeads = fours + tailFours;
+    return characters;
+}
+
+static size_t WidenAsciiNEON(const uint8_t* input, size_t length, char16_t* output) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t bytes = vld1q_u8(input + i);
+        if (vmaxvq_u8(bytes) >= 0x80) {
+            break;
+        }
+        vst1q_u16(reinterpret_cast<uint16_t*>(output + i), vmovl_u8(vget_low_u8(bytes)));
+        vst1q_u16(reinterpret_cast<uint16_t*>(output + i + 8), vmovl_high_u8(bytes));
+    }
+    return i;
+}
+
+static size_t NarrowAsciiNEON(const char16_t* input, size_t length, uint8_t* output) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        uint16x8_t low = vld1q_u16(reinterpret_cast<const uint16_t*>(input + i));
+        uint16x8_t high = vld1q_u16(reinterpret_cast<const uint16_t*>(input + i + 8));
+        if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80) {
+            break;
+        }
+        vst1q_u8(output + i, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+    return i;
+}
+
+static size_t CopyAsciiNEON(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t bytes = vld1q_u8(input + i);
+        if (vmaxvq_u8(bytes) >= 0x80) {
+            break;
+        }
+        vst1q_u8(output + i, bytes);
+    }
+    return i;
+}
+#endif // LLJS_ARCH_ARM64
+
+// UTF-8 validation, counting and transcoding kernels for the ISA selected at module initialization
+static bool (*utf8ValidateKernel)(const uint8_t*, size_t) = ValidateUtf8Scalar;
+static size_t (*utf8CountKernel)(const uint8_t*, size_t, size_t&) = CountUtf8Scalar;
+static size_t (*widenAsciiKernel)(const uint8_t*, size_t, char16_t*) = WidenAsciiScalar;
+static size_t (*narrowAsciiKernel)(const char16_t*, size_t, uint8_t*) = NarrowAsciiScalar;
+static size_t (*copyAsciiKernel)(const uint8_t*, size_t, uint8_t*) = CopyAsciiScalar;
+
+// Block kernel for ISAs without a byte shuffle to pack two-byte characters: ASCII runs only
+static size_t Utf8BlocksAscii(const uint8_t* input, size_t length, char16_t* output, size_t& units) {
+    units = widenAsciiKernel(input, length, output);
+    return units;
+}
+
+static size_t (*utf8BlockKernel)(const uint8_t*, size_t, char16_t*, size_t&) = Utf8BlocksAscii;
+
+// Bytes the scalar decoders handle before handing back to the ASCII kernels
+static constexpr size_t kTranscodeScalarRun = 16;
+
+/**
+ * UTF-8 to UTF-16. The input must already have passed IsValidUtf8, so the
+ * decoder only dispatches on the lead byte.
+ * @param input - Valid UTF-8 bytes
+ * @param length - Byte count
+ * @param output - Room for one unit per code point plus one per four-byte sequence
+ * @returns Units written
+ */
+static size_t Utf8ToUtf16(const uint8_t* input, size_t length, char16_t* output) {
+    size_t i = 0, o = 0;
+    while (i < length) {
+        size_t units;
+        i += utf8BlockKernel(input + i, length - i, output + o, units);
+        o += units;
+        for (size_t stop = std::min(length, i + kTranscodeScalarRun); i < stop; ) {
+            uint32_t lead = input[i];
+            if (lead < 0x80) {
+                output[o++] = static_cast<char16_t>(lead);
+                i += 1;
+            } else if (lead < 0xE0) {
+                output[o++] = static_cast<char16_t>(((lead & 0x1F) << 6) | (input[i + 1] & 0x3F));
+                i += 2;
+            } else if (lead < 0xF0) {
+                output[o++] = static_cast<char16_t>(((lead & 0x0F) << 12) | ((input[i + 1] & 0x3F) << 6) | (input[i + 2] & 0x3F));
+                i += 3;
+            } else {
+                uint32_t codePoint = ((lead & 0x07) << 18) | ((input[i + 1] & 0x3F) << 12) |
+                                     ((input[i + 2] & 0x3F) << 6) | (input[i + 3] & 0x3F);
+                codePoint -= 0x10000;
+                output[o++] = static_cast<char16_t>(0xD800 | (codePoint >> 10));
+                output[o++] = static_cast<char16_t>(0xDC00 | (codePoint & 0x3FF));
+                i += 4;
+            }
+        }
+    }
+    return o;
+}
+
+/**
+ * UTF-8 to Latin-1; the input must already have passed IsValidUtf8
+ * @returns Bytes written, or kTranscodeError for code points above U+00FF
+ */
+static size_t Utf8ToLatin1(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t i = 0, o = 0;
+    while (i < length) {
+        size_t run = copyAsciiKernel(input + i, length - i, output + o);
+        i += run;
+        o += run;
+        for (size_t stop = std::min(length, i + kTranscodeScalarRun); i < stop; ) {
+            uint8_t lead = input[i];
+            if (lead < 0x80) {
+                output[o++] = lead;
+                i += 1;
+            } else if (lead <= 0xC3) {
+                output[o++] = static_cast<uint8_t>(((lead & 0x1F) << 6) | (input[i + 1] & 0x3F));
+                i += 2;
+            } else {
+                return kTranscodeError;
+            }
+        }
+    }
+    return o;
+}
+
+/**
+ * UTF-16 to UTF-8, rejecting unpaired surrogates
+ * @returns Bytes written, or kTranscodeError for malformed input
+ */
+static size_t Utf16ToUtf8(const char16_t* input, size_t length, uint8_t* output) {
+    size_t i = 0, o = 0;
+    while (i < length) {
+        size_t run = narrowAsciiKernel(input + i, length - i, output + o);
+        i += run;
+        o += run;
+        for (size_t stop = std::min(length, i + kTranscodeScalarRun); i < stop; i++) {
+            uint32_t unit = input[i];
+            if (unit < 0x80) {
+                output[o++] = static_cast<uint8_t>(unit);
+            } else if (unit < 0x800) {
+                output[o++] = static_cast<uint8_t>(0xC0 | (unit >> 6));
+                output[o++] = static_cast<uint8_t>(0x80 | (unit & 0x3F));
+            } else if (unit < 0xD800 || unit > 0xDFFF) {
+                output[o++] = static_cast<uint8_t>(0xE0 | (unit >> 12));
+                output[o++] = static_cast<uint8_t>(0x80 | ((unit >> 6) & 0x3F));
+                output[o++] = static_cast<uint8_t>(0x80 | (unit & 0x3F));
+            } else {
+                if (unit > 0xDBFF || i + 1 >= length || input[i + 1] < 0xDC00 || input[i + 1] > 0xDFFF) {
+                    return kTranscodeError;
+                }
+                uint32_t codePoint = 0x10000 + ((unit - 0xD800) << 10) + (input[++i] - 0xDC00);
+                output[o++] = static_cast<uint8_t>(0xF0 | (codePoint >> 18));
+                output[o++] = static_cast<uint8_t>(0x80 | ((codePoint >> 12) & 0x3F));
+                output[o++] = static_cast<uint8_t>(0x80 | ((codePoint >> 6) & 0x3F));
+                output[o++] = static_cast<uint8_t>(0x80 | (codePoint & 0x3F));
+            }
+        }
+    }
+    return o;
+}
+
+/**
+ * UTF-16 to Latin-1
+ * @returns Bytes written, or kTranscodeError for units above U+00FF
+ */
+static size_t Utf16ToLatin1(const char16_t* input, size_t length, uint8_t* output) {
+    size_t i = 0;
+    while (i < length) {
+        i += narrowAsciiKernel(input + i, length - i, output + i);
+        for (size_t stop = std::min(length, i + kTranscodeScalarRun); i < stop; i++) {
+            if (input[i] > 0xFF) {
+                return kTranscodeError;
+            }
+            output[i] = static_cast<uint8_t>(input[i]);
+        }
+    }
+    return length;
+}
+
+/**
+ * Latin-1 to UTF-8; every byte is a valid code point
+ * @returns Bytes written
+ */
+static size_t Latin1ToUtf8(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t i = 0, o = 0;
+    while (i < length) {
+        size_t run = copyAsciiKernel(input + i, length - i, output + o);
+        i += run;
+        o += run;
+        for (size_t stop = std::min(length, i + kTranscodeScalarRun); i < stop; i++) {
+            uint8_t c = input[i];
+            if (c < 0x80) {
+                output[o++] = c;
+            } else {
+                output[o++] = static_cast<uint8_t>(0xC0 | (c >> 6));
+                output[o++] = static_cast<uint8_t>(0x80 | (c & 0x3F));
+            }
+        }
+    }
+    return o;
+}
+
+/**
+ * Latin-1 to UTF-16; every byte widens to one unit
+ * @returns Units written
+ */
+static size_t Latin1ToUtf16(const uint8_t* input, size_t length, char16_t* output) {
+    size_t i = 0;
+    while (i < length) {
+        i += widenAsciiKernel(input + i, length - i, output + i);
+        for (size_t stop = std::min(length, i + kTranscodeScalarRun); i < stop; i++) {
+            output[i] = input[i];
+        }
+    }
+    return length;
+}
+
+// ASCII check and substring search for the ISA selected at module initialization
+static bool (*asciiKernel)(const uint8_t*, size_t) = IsAsciiScalar;
+static size_t (*findKernel)(const uint8_t*, size_t, const uint8_t*, size_t, bool) = FindScalar;
+static size_t (*skipKernel)(const uint8_t*, size_t, const SkipSet&) = SkipToAnyScalar;
+
+/**
+ * Selects the string kernels for the detected ISA
+ * @param isa - ISA level from CPU::DetectISA
+ */
+void InitKernels(SIMD::ISA isa) {
+    switch (isa) {
+#ifdef LLJS_ARCH_X86
+        case SIMD::ISA::AVX512:
+            asciiKernel = IsAsciiAVX512;
+            findKernel = FindAVX512;
+            skipKernel = SkipToAnyAVX512;
+            utf8ValidateKernel = ValidateUtf8AVX512;
+            utf8CountKernel = CountUtf8AVX512;
+            widenAsciiKernel = WidenAsciiAVX2;
+            narrowAsciiKernel = NarrowAsciiAVX2;
+            copyAsciiKernel = CopyAsciiAVX2;
+            utf8BlockKernel = Utf8BlocksAVX2;
+            xxh3Accumulate = XXH3AccumulateAVX512;
+            xxh3Scramble = XXH3ScrambleAVX512;
+            break;
+        case SIMD::ISA::AVX2:
+            asciiKernel = IsAsciiAVX2;
+            findKernel = FindAVX2;
+            skipKernel = SkipToAnyAVX2;
+            utf8ValidateKernel = ValidateUtf8AVX2;
+            utf8CountKernel = CountUtf8AVX2;
+            widenAsciiKernel = WidenAsciiAVX2;
+            narrowAsciiKernel = NarrowAsciiAVX2;
+            copyAsciiKernel = CopyAsciiAVX2;
+            utf8BlockKernel = Utf8BlocksAVX2;
+            xxh3Accumulate = XXH3AccumulateAVX2;
+            xxh3Scramble = XXH3ScrambleAVX2;
+            break;
+        case SIMD::ISA::SSE2:
+            asciiKernel = IsAsciiSSE2;
+            findKernel = FindSSE2;
+            skipKernel = SkipToAnySSE2;
+            // The nibble lookups need pshufb (SSSE3), so SSE2 validates with the scalar decoder
+            utf8ValidateKernel = ValidateUtf8Scalar;
+            utf8CountKernel = CountUtf8SSE2;
+            widenAsciiKernel = WidenAsciiSSE2;
+            narrowAsciiKernel = NarrowAsciiSSE2;
+            copyAsciiKernel = CopyAsciiSSE2;
+            utf8BlockKernel = Utf8BlocksAscii;
+            xxh3Accumulate = XXH3AccumulateSSE2;
+            xxh3Scramble = XXH3ScrambleSSE2;
+            break;
+#endif
+#ifdef LLJS_ARCH_ARM64
+        case SIMD::ISA::NEON:
+            asciiKernel = IsAsciiNEON;
+            findKernel = FindNEON;
+            skipKernel = SkipToAnyNEON;
+            utf8ValidateKernel = ValidateUtf8NEON;
+            utf8CountKernel = CountUtf8NEON;
+            widenAsciiKernel = WidenAsciiNEON;
+            narrowAsciiKernel = NarrowAsciiNEON;
+            copyAsciiKernel = CopyAsciiNEON;
+            utf8BlockKernel = Utf8BlocksAscii;
+            xxh3Accumulate = XXH3AccumulateNEON;
+            xxh3Scramble = XXH3ScrambleScalar;
+            break;
+#endif
+        default:
+            asciiKernel = IsAsciiScalar;
+            findKernel = FindScalar;
+            skipKernel = SkipToAnyScalar;
+            utf8ValidateKernel = ValidateUtf8Scalar;
+            utf8CountKernel = CountUtf8Scalar;
+            widenAsciiKernel = WidenAsciiScalar;
+            narrowAsciiKernel = NarrowAsciiScalar;
+            copyAsciiKernel = CopyAsciiScalar;
+            utf8BlockKernel = Utf8BlocksAscii;
+            xxh3Accumulate = XXH3AccumulateScalar;
+            xxh3Scramble = XXH3ScrambleScalar;
+            break;
+    }
+    
+    crc32cKernel = Crc32cScalar;
+    if (SIMD::HasCRC32C()) {
+#if defined(LLJS_ARCH_X86) && (defined(__x86_64__) || defined(_M_X64))
+        crc32cKernel = Crc32cSSE42;
+#elif defined(LLJS_ARCH_ARM64) && defined(__ARM_FEATURE_CRC32)
+        crc32cKernel = Crc32cARM;
+#endif
+    }
+}
+
+/**
+ * Parses a hash algorithm name
+ * @param name - Algorithm name ('djb2', 'fnv1a', 'murmur3', 'crc32', 'sdbm', 'crc32c', 'xxh3', 'xxh3-128', 'wyhash')
+ * @param algorithm - Parsed algorithm
+ * @returns False for unknown names
+ */
+bool ParseHashAlgorithm(const std::string& name, HashAlgorithm& algorithm) {
+    if (name == "djb2") algorithm = HashAlgorithm::DJB2;
+    else if (name == "fnv1a") algorithm = HashAlgorithm::FNV1a;
+    else if (name == "murmur3") algorithm = HashAlgorithm::Murmur3;
+    else if (name == "crc32") algorithm = HashAlgorithm::CRC32;
+    else if (name == "sdbm") algorithm = HashAlgorithm::SDBM;
+    else if (name == "crc32c") algorithm = HashAlgorithm::CRC32C;
+    else if (name == "xxh3" || name == "xxh3-64") algorithm = HashAlgorithm::XXH3;
+    else if (name == "xxh3-128") algorithm = HashAlgorithm::XXH3_128;
+    else if (name == "wyhash") algorithm = HashAlgorithm::WyHash;
+    else return false;
+    return true;
+}
+
+static uint64_t Djb2Update(uint64_t hash, const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash = ((hash << 5) + hash) + data[i];
+    }
+    return hash;
+}
+
+static uint64_t Fnv1aUpdate(uint64_t hash, const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL; // FNV prime
+    }
+    return hash;
+}
+
+static uint64_t SdbmUpdate(uint64_t hash, const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash = data[i] + (hash << 6) + (hash << 16) - hash;
+    }
+    return hash;
+}
+
+// MurmurHash3 x86_32 constants
+static constexpr uint32_t kMurmurC1 = 0xcc9e2d51;
+static constexpr uint32_t kMurmurC2 = 0x1b873593;
+
+static inline uint32_t MurmurScramble(uint32_t k1) {
+    k1 *= kMurmurC1;
+    k1 = (k1 << 15) | (k1 >> 17);
+    return k1 * kMurmurC2;
+}
+
+static uint32_t MurmurBlocks(uint32_t h1, const uint8_t* data, size_t blocks) {
+    for (size_t i = 0; i < blocks; i++) {
+        h1 ^= MurmurScramble(Read32(data + i * 4));
+        h1 = ((h1 << 13) | (h1 >> 19)) * 5 + 0xe6546b64;
+    }
+    return h1;
+}
+
+static uint32_t MurmurFinish(uint32_t h1, const uint8_t* tail, size_t tailLength, uint64_t totalLength) {
+    uint32_t k1 = 0;
+    switch (tailLength) {
+        case 3: k1 ^= tail[2] << 16; [[fallthrough]];
+        case 2: k1 ^= tail[1] << 8; [[fallthrough]];
+        case 1: k1 ^= tail[0];
+            h1 ^= MurmurScramble(k1);
+    }
+    
+    h1 ^= static_cast<uint32_t>(totalLength);
+    h1 ^= h1 >> 16;
+    h1 *= 0x85ebca6b;
+    h1 ^= h1 >> 13;
+    h1 *= 0xc2b2ae35;
+    h1 ^= h1 >> 16;
+    return h1;
+}
+
+/**
+ * Hashes a byte range; safe to call from any thread.
+ * xxh3-128 contributes its low 64 bits; use Hash128Bytes for both halves.
+ * @param data - Bytes to hash
+ * @param length - Byte count
+ * @param algorithm - Hash algorithm
+ * @param seed - Seed for xxh3, xxh3-128 and wyhash; ignored by the others
+ * @returns Hash value
+ */
+uint64_t HashBytes(const uint8_t* data, size_t length, HashAlgorithm algorithm, uint64_t seed) {
+    switch (algorithm) {
+        case HashAlgorithm::DJB2:
+            return Djb2Update(5381, data, length);
+        case HashAlgorithm::FNV1a:
+            return Fnv1aUpdate(14695981039346656037ULL, data, length); // FNV offset basis
+        case HashAlgorithm::Murmur3:
+            return MurmurFinish(MurmurBlocks(0, data, length / 4), data + (length & ~size_t(3)), length & 3, length);
+        case HashAlgorithm::CRC32:
+            return ~CrcUpdateScalar(crc32Tables, 0xFFFFFFFFu, data, length) & 0xFFFFFFFFu;
+        case HashAlgorithm::SDBM:
+            return SdbmUpdate(0, data, length);
+        case HashAlgorithm::CRC32C:
+            return ~crc32cKernel(0xFFFFFFFFu, data, length) & 0xFFFFFFFFu;
+        case HashAlgorithm::XXH3:
+            return XXH3Hash64(data, length, seed);
+        case HashAlgorithm::XXH3_128:
+            return XXH3Hash128(data, length, seed).low;
+        case HashAlgorithm::WyHash:
+            return WyHash(data, length, seed);
+    }
+    return 0;
+}
+
+/**
+ * Hashes a byte range into 128 bits; 64-bit and narrower algorithms leave high at 0
+ * @param data - Bytes to hash
+ * @param length - Byte count
+ * @param algorithm - Hash algorithm
+ * @param seed - Seed
+ * @param high - Receives the high 64 bits
+ * @returns Low 64 bits
+ */
+static uint64_t Hash128Bytes(const uint8_t* data, size_t length, HashAlgorithm algorithm, uint64_t seed, uint64_t& high) {
+    if (algorithm == HashAlgorithm::XXH3_128) {
+        Hash128 hash = XXH3Hash128(data, length, seed);
+        high = hash.high;
+        return hash.low;
+    }
+    high = 0;
+    return HashBytes(data, length, algorithm, seed);
+}
+
+/**
+ * Finds the first occurrence of a byte pattern with the SIMD first/last-byte
+ * filter; safe to call from any thread
+ * @param haystack - Bytes to search
+ * @param haystackLength - Haystack length
+ * @param needle - Pattern
+ * @param needleLength - Pattern length
+ * @param foldCase - ASCII case-insensitive
+ * @returns Offset of the first match, or SIZE_MAX if absent
+ */
+size_t FindBytes(const uint8_t* haystack, size_t haystackLength, const uint8_t* needle, size_t needleLength, bool foldCase) {
+    if (needleLength == 0) {
+        return 0;
+    }
+    if (needleLength > haystackLength) {
+        return SIZE_MAX;
+    }
+    if (needleLength == 1 && (!foldCase || FoldLower(needle[0]) == FoldUpper(needle[0]))) {
+        const void* found = std::memchr(haystack, needle[0], haystackLength);
+        return found ? static_cast<size_t>(static_cast<const uint8_t*>(found) - haystack) : SIZE_MAX;
+    }
+    if (needleLength == 1) {
+        return FindFinish(haystack, haystackLength, 0, needle, 1, true);
+    }
+    return findKernel(haystack, haystackLength, needle, needleLength, foldCase);
+}
+
+/**
+ * Counts UTF-8 code points; a stray continuation byte does not start a character
+ * @param data - Bytes to count
+ * @param length - Byte count
+ * @returns Character count
+ */
+static size_t CountUtf8Chars(const uint8_t* data, size_t length) {
+    size_t fourByteLeads;
+    return utf8CountKernel(data, length, fourByteLeads);
+}
+
+/**
+ * Checks that bytes are well-formed UTF-8: complete sequences, no overlong
+ * forms, no surrogates and nothing above U+10FFFF
+ * @param data - Bytes to check
+ * @param length - Byte count
+ * @returns True if valid
+ */
+static bool IsValidUtf8(const uint8_t* data, size_t length) {
+    return utf8ValidateKernel(data, length);
+}
+
+/**
+ * Orders two byte ranges; the SIMD mismatch kernel skips equal prefixes and
+ * case folding is only applied at the bytes that differ
+ * @param a - First range
+ * @param aLength - First range length
+ * @param b - Second range
+ * @param bLength - Second range length
+ * @param foldCase - ASCII case-insensitive
+ * @returns -1, 0 or 1
+ */
+static int CompareBytes(const uint8_t* a, size_t aLength, const uint8_t* b, size_t bLength, bool foldCase) {
+    size_t minLength = std::min(aLength, bLength);
+    size_t i = 0;
+    while (i < minLength) {
+        i += Memory::FindMismatch(a + i, b + i, minLength - i);
+        if (i >= minLength) {
+            break;
+        }
+        uint8_t c1 = foldCase ? FoldLower(a[i]) : a[i];
+        uint8_t c2 = foldCase ? FoldLower(b[i]) : b[i];
+        if (c1 != c2) {
+            return c1 < c2 ? -1 : 1;
+        }
+        i++;
+    }
+    if (aLength == bLength) {
+        return 0;
+    }
+    return aLength < bLength ? -1 : 1;
+}
+
+/**
+ * SIMD-accelerated string comparison
+ * @param info - CallbackInfo containing two strings and case sensitivity flag
+ * @returns Comparison result (-1, 0, 1)
+ */
+Napi::Value FastStringCompare(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsString()) {
+        Napi::TypeError::New(env, "Two string parameters required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string str1 = info[0].As<Napi::String>();
+    std::string str2 = info[1].As<Napi::String>();
+    bool caseSensitive = true;
+    
+    if (info.Length() > 2 && info[2].IsBoolean()) {
+        caseSensitive = info[2].As<Napi::Boolean>();
+    }
+    
+    return Napi::Number::New(env, CompareBytes(reinterpret_cast<const uint8_t*>(str1.data()), str1.length(),
+                                               reinterpret_cast<const uint8_t*>(str2.data()), str2.length(),
+                                               !caseSensitive));
+}
+
+/**
+ * UTF-8 aware string length calculation
+ * @param info - CallbackInfo containing string parameter
+ * @returns String length in characters (not bytes)
+ */
+Napi::Value StringLength(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "String parameter required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string str = info[0].As<Napi::String>();
+    
+    size_t length = CountUtf8Chars(reinterpret_cast<const uint8_t*>(str.data()), str.length());
+    
+    return Napi::Number::New(env, static_cast<double>(length));
+}
+
+/**
+ * High-performance string copy with bounds checking
+ * @param info - CallbackInfo containing source string, destination buffer, max length
+ * @returns Number of bytes copied
+ */
+Napi::Value StringCopy(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 3 || !info[0].IsString() || !info[1].IsBuffer() || !info[2].IsNumber()) {
+        Napi::TypeError::New(env, "Source string, destination buffer, and max length required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string src = info[0].As<Napi::String>();
+    Napi::Buffer<uint8_t> dest = info[1].As<Napi::Buffer<uint8_t>>();
+    size_t maxLength = info[2].As<Napi::Number>().Uint32Value();
+    
+    size_t copyLength = std::min(src.length(), std::min(maxLength, dest.Length()));
+    
+    if (copyLength > 0) {
+        // libc memcpy already selects the widest copy loop for this CPU
+        std::memcpy(dest.Data(), src.data(), copyLength);
+    }
+    
+    return Napi::Number::New(env, static_cast<double>(copyLength));
+}
+
+/**
+ * Optimized string concatenation
+ * @param info - CallbackInfo containing array of strings
+ * @returns Concatenated string
+ */
+Napi::Value StringConcat(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsArray()) {
+        Napi::TypeError::New(env, "Array of strings required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Array stringArray = info[0].As<Napi::Array>();
+    std::vector<std::string> strings;
+    size_t totalLength = 0;
+    
+    // First pass: collect strings and calculate total length
+    for (uint32_t i = 0; i < stringArray.Length(); i++) {
+        if (stringArray.Get(i).IsString()) {
+            std::string str = stringArray.Get(i).As<Napi::String>();
+            strings.push_back(str);
+            totalLength += str.length();
+        }
+    }
+    
+    // Allocate result string with exact size
+    std::string result;
+    result.reserve(totalLength);
+    
+    // Second pass: concatenate strings
+    for (const auto& str : strings) {
+        result.append(str);
+    }
+    
+    return Napi::String::New(env, result);
+}
+
+/**
+ * SIMD substring search
+ * @param info - CallbackInfo containing haystack, needle, case sensitivity
+ * @returns Index of first occurrence or -1
+ */
+Napi::Value StringSearch(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsString()) {
+        Napi::TypeError::New(env, "Haystack and needle strings required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string haystack = info[0].As<Napi::String>();
+    std::string needle = info[1].As<Napi::String>();
+    bool caseSensitive = true;
+    
+    if (info.Length() > 2 && info[2].IsBoolean()) {
+        caseSensitive = info[2].As<Napi::Boolean>();
+    }
+    
+    if (needle.empty()) {
+        return Napi::Number::New(env, 0);
+    }
+    
+    size_t found = FindBytes(reinterpret_cast<const uint8_t*>(haystack.data()), haystack.length(),
+                             reinterpret_cast<const uint8_t*>(needle.data()), needle.length(), !caseSensitive);
+    if (found != SIZE_MAX) {
+        return Napi::Number::New(env, static_cast<double>(found));
+    }
+    
+    return Napi::Number::New(env, -1);
+}
+
+/**
+ * Multiple string hashing algorithms
+ * @param info - CallbackInfo containing string and algorithm parameters
+ * @returns Hash value
+ */
+Napi::Value StringHash(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "String parameter required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string str = info[0].As<Napi::String>();
+    std::string algorithm = "djb2";
+    
+    if (info.Length() > 1 && info[1].IsString()) {
+        algorithm = info[1].As<Napi::String>();
+    }
+    
+    HashAlgorithm hashAlgorithm;
+    if (!ParseHashAlgorithm(algorithm, hashAlgorithm)) {
+        Napi::TypeError::New(env, "Unknown hash algorithm").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    uint64_t hash = HashBytes(reinterpret_cast<const uint8_t*>(str.data()), str.length(), hashAlgorithm);
+    
+    return Napi::Number::New(env, static_cast<double>(hash));
+}
+
+/**
+ * String validation and sanitization
+ * @param info - CallbackInfo containing string and validation type
+ * @returns Validation result or sanitized string
+ */
+Napi::Value StringValidate(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsString()) {
+        Napi::TypeError::New(env, "String and validation type required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string str = info[0].As<Napi::String>();
+    std::string validationType = info[1].As<Napi::String>();
+    
+    if (validationType == "utf8") {
+        bool isValid = IsValidUtf8(reinterpret_cast<const uint8_t*>(str.data()), str.length());
+        return Napi::Boolean::New(env, isValid);
+    } else if (validationType == "ascii") {
+        bool isAscii = asciiKernel(reinterpret_cast<const uint8_t*>(str.data()), str.length());
+        return Napi::Boolean::New(env, isAscii);
+    } else if (validationType == "sanitize_html") {
+        // Basic HTML sanitization
+        std::string result = str;
+        
+        // Replace dangerous characters
+        size_t pos = 0;
+        while ((pos = result.find('<', pos)) != std::string::npos) {
+            result.replace(pos, 1, "&lt;");
+            pos += 4;
+        }
+        
+        pos = 0;
+        while ((pos = result.find('>', pos)) != std::string::npos) {
+            result.replace(pos, 1, "&gt;");
+            pos += 4;
+        }
+        
+        pos = 0;
+        while ((pos = result.find('&', pos)) != std::string::npos) {
+            if (result.substr(pos, 4) != "&lt;" && 
+                result.substr(pos, 4) != "&gt;" && 
+                result.substr(pos, 5) != "&amp;") {
+                result.replace(pos, 1, "&amp;");
+                pos += 5;
+            } else {
+                pos++;
+            }
+        }
+        
+        return Napi::String::New(env, result);
+    }
+    
+    Napi::TypeError::New(env, "Unknown validation type").ThrowAsJavaScriptException();
+    return env.Null();
+}
+
+/**
+ * Advanced string manipulation with regular expressions
+ * @param info - CallbackInfo containing string, pattern, replacement
+ * @returns Modified string
+ */
+Napi::Value StringReplace(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 3 || !info[0].IsString() || !info[1].IsString() || !info[2].IsString()) {
+        Napi::TypeError::New(env, "String, pattern, and replacement required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string str = info[0].As<Napi::String>();
+    std::string pattern = info[1].As<Napi::String>();
+    std::string replacement = info[2].As<Napi::String>();
+    
+    // Simple string replacement (not regex for performance)
+    std::string result = str;
+    size_t pos = 0;
+    
+    while ((pos = result.find(pattern, pos)) != std::string::npos) {
+        result.replace(pos, pattern.length(), replacement);
+        pos += replacement.length();
+    }
+    
+    return Napi::String::New(env, result);
+}
+
+// Haystacks at least this large are split across the worker pool
+static constexpr size_t kParallelSearchBytes = size_t(1) << 20;
 
 /**
- * SIMD-accelerated string comparison
- * @param info - CallbackInfo containing two strings and case sensitivity flag
- * @returns Comparison result (-1, 0, 1)
+ * Views a string, Buffer, TypedArray, DataView or ArrayBuffer as bytes; throws on failure.
+ * Strings are encoded to UTF-8 into storage; binary inputs are not copied.
+ * @param env - Environment
+ * @param value - Input value
+ * @param data - Receives the first byte
+ * @param length - Receives the byte count
+ * @param storage - Backing store for string input
+ * @returns True on success
  */
-Napi::Value FastStringCompare(const Napi::CallbackInfo& info) {
+static bool ToByteInput(Napi::Env env, const Napi::Value& value, const uint8_t*& data, size_t& length, std::string& storage) {
+    if (value.IsString()) {
+        storage = value.As<Napi::String>().Utf8Value();
+        data = reinterpret_cast<const uint8_t*>(storage.data());
+        length = storage.size();
+        return true;
+    }
+    if (value.IsTypedArray()) {
+        Napi::TypedArray array = value.As<Napi::TypedArray>();
+        data = static_cast<const uint8_t*>(array.ArrayBuffer().Data()) + array.ByteOffset();
+        length = array.ByteLength();
+        return true;
+    }
+    if (value.IsDataView()) {
+        Napi::DataView view = value.As<Napi::DataView>();
+        data = static_cast<const uint8_t*>(view.ArrayBuffer().Data()) + view.ByteOffset();
+        length = view.ByteLength();
+        return true;
+    }
+    if (value.IsArrayBuffer()) {
+        Napi::ArrayBuffer buffer = value.As<Napi::ArrayBuffer>();
+        data = static_cast<const uint8_t*>(buffer.Data());
+        length = buffer.ByteLength();
+        return true;
+    }
+    Napi::TypeError::New(env, "String, Buffer or TypedArray required").ThrowAsJavaScriptException();
+    return false;
+}
+
+/**
+ * Reads the optional match limit; throws on failure
+ * @returns False when the option is invalid
+ */
+static bool ToMatchLimit(Napi::Env env, const Napi::Object& options, size_t& limit) {
+    limit = SIZE_MAX;
+    Napi::Value value = options.Get("limit");
+    if (value.IsUndefined()) {
+        return true;
+    }
+    double requested = value.IsNumber() ? value.As<Napi::Number>().DoubleValue() : -1;
+    if (!(requested >= 0) || requested != std::floor(requested)) {
+        Napi::RangeError::New(env, "Limit must be a non-negative integer").ThrowAsJavaScriptException();
+        return false;
+    }
+    limit = requested >= 4294967295.0 ? SIZE_MAX : static_cast<size_t>(requested);
+    return true;
+}
+
+static Napi::Uint32Array ToUint32Array(Napi::Env env, const std::vector<uint32_t>& values) {
+    Napi::Uint32Array result = Napi::Uint32Array::New(env, values.size());
+    if (!values.empty()) {
+        std::memcpy(result.Data(), values.data(), values.size() * sizeof(uint32_t));
+    }
+    return result;
+}
+
+/**
+ * Collects match offsets of a pattern in one haystack range
+ * @param haystack - Bytes to search
+ * @param from - First start position to consider
+ * @param to - End of the start positions to consider
+ * @param haystackLength - Haystack length
+ * @param needle - Pattern
+ * @param needleLength - Pattern length
+ * @param foldCase - ASCII case-insensitive
+ * @param step - Advance after a match: 1 for overlapping matches, needleLength otherwise
+ * @param limit - Stop after this many offsets
+ * @param offsets - Receives offsets
+ */
+static void FindAllRange(const uint8_t* haystack, size_t from, size_t to, size_t haystackLength,
+                         const uint8_t* needle, size_t needleLength, bool foldCase, size_t step,
+                         size_t limit, std::vector<uint32_t>& offsets) {
+    size_t window = std::min(haystackLength, to + needleLength - 1);
+    for (size_t position = from; position < to && offsets.size() < limit; ) {
+        size_t found = FindBytes(haystack + position, window - position, needle, needleLength, foldCase);
+        if (found == SIZE_MAX || position + found >= to) {
+            break;
+        }
+        offsets.push_back(static_cast<uint32_t>(position + found));
+        position += found + step;
+    }
+}
+
+/**
+ * Finds every occurrence of a pattern
+ * @param info - CallbackInfo containing haystack, needle and optional { caseSensitive, overlapping, limit }
+ * @returns Uint32Array of byte offsets in ascending order
+ */
+Napi::Value FindAll(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsString()) {
-        Napi::TypeError::New(env, "Two string parameters required").ThrowAsJavaScriptException();
+    const uint8_t* haystack;
+    const uint8_t* needle;
+    size_t haystackLength, needleLength;
+    std::string haystackStorage, needleStorage;
+    if (info.Length() < 2 || !ToByteInput(env, info[0], haystack, haystackLength, haystackStorage) ||
+        !ToByteInput(env, info[1], needle, needleLength, needleStorage)) {
+        if (!env.IsExceptionPending()) {
+            Napi::TypeError::New(env, "Haystack and needle required").ThrowAsJavaScriptException();
+        }
+        return env.Null();
+    }
+    if (needleLength == 0) {
+        Napi::TypeError::New(env, "Needle must not be empty").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (haystackLength > UINT32_MAX) {
+        Napi::RangeError::New(env, "Haystack must be smaller than 4 GiB").ThrowAsJavaScriptException();
         return env.Null();
     }
     
-    std::string str1 = info[0].As<Napi::String>();
-    std::string str2 = info[1].As<Napi::String>();
-    bool caseSensitive = true;
+    Napi::Object options = info.Length() > 2 && info[2].IsObject() ? info[2].As<Napi::Object>() : Napi::Object::New(env);
+    bool caseSensitive = !options.Get("caseSensitive").IsBoolean() || options.Get("caseSensitive").As<Napi::Boolean>();
+    bool overlapping = options.Get("overlapping").IsBoolean() && options.Get("overlapping").As<Napi::Boolean>();
+    size_t limit;
+    if (!ToMatchLimit(env, options, limit)) {
+        return env.Null();
+    }
     
-    if (info.Length() > 2 && info[2].IsBoolean()) {
-        caseSensitive = info[2].As<Napi::Boolean>();
+    std::vector<uint32_t> offsets;
+    Threading::WorkerPool& pool = Threading::WorkerPool::Instance();
+    if (haystackLength < kParallelSearchBytes || pool.Size() < 2 || limit != SIZE_MAX) {
+        FindAllRange(haystack, 0, haystackLength, haystackLength, needle, needleLength, !caseSensitive,
+                     overlapping ? 1 : needleLength, limit, offsets);
+        return ToUint32Array(env, offsets);
     }
     
-    if (!caseSensitive) {
-        // Convert to lowercase for case-insensitive comparison
-        std::transform(str1.begin(), str1.end(), str1.begin(), ::tolower);
-        std::transform(str2.begin(), str2.end(), str2.begin(), ::tolower);
+    // Segments own the matches that start inside them; matches may run into the next one
+    const size_t segments = pool.Size() * 4;
+    std::vector<std::vector<uint32_t>> found(segments);
+    pool.ParallelFor(segments, [&](size_t segment) {
+        size_t from = haystackLength * segment / segments;
+        size_t to = haystackLength * (segment + 1) / segments;
+        FindAllRange(haystack, from, to, haystackLength, needle, needleLength, !caseSensitive, 1, SIZE_MAX, found[segment]);
+    });
+    
+    // Rebuilding the non-overlapping set greedily matches a sequential scan
+    size_t nextFree = 0;
+    for (const std::vector<uint32_t>& segment : found) {
+        for (uint32_t offset : segment) {
+            if (overlapping || offset >= nextFree) {
+                offsets.push_back(offset);
+                nextFree = offset + needleLength;
+            }
+        }
     }
+    return ToUint32Array(env, offsets);
+}
+
+/**
+ * Aho-Corasick automaton compiled to a dense DFA over byte equivalence
+ * classes. Rows are stored premultiplied by the class count, and the top
+ * bit of a transition marks target states that end at least one pattern.
+ */
+struct PatternMatcher {
+    static constexpr uint32_t kOutputFlag = 0x80000000u;
     
-    // Use SIMD for large string comparisons
-    size_t minLen = std::min(str1.length(), str2.length());
-    size_t simdLen = (minLen / 32) * 32; // Process 32 bytes at a time
+    uint16_t classMap[256];
+    size_t classCount;
+    std::vector<uint32_t> delta;
+    // Patterns ending in each state: ownBegin[s]..ownBegin[s + 1] in ownPatterns
+    std::vector<uint32_t> ownBegin;
+    std::vector<uint32_t> ownPatterns;
+    // Nearest suffix state with patterns of its own, or UINT32_MAX
+    std::vector<uint32_t> dictionaryLink;
+    std::vector<uint32_t> patternLengths;
+    size_t maxLength;
+    // Bytes that leave the root, when few enough to be worth skipping to
+    SkipSet startBytes;
+    bool rootSkip;
+};
+
+static HandleTable<PatternMatcher> matchers;
+
+static constexpr size_t kMaxMatcherStates = size_t(1) << 16;
+
+// With most bytes able to start a match, skipping cannot pay off
+static constexpr size_t kMaxSkipBytes = 128;
+
+/**
+ * Walks the automaton over one range and reports matches ending in [reportFrom, end)
+ */
+static void MatcherScanRange(const PatternMatcher& matcher, const uint8_t* haystack, size_t begin, size_t end,
+                             size_t reportFrom, size_t limit, std::vector<uint32_t>& offsets, std::vector<uint32_t>& patterns) {
+    const uint32_t* delta = matcher.delta.data();
+    const size_t classes = matcher.classCount;
+    uint32_t row = 0;
+    // Skipping stops paying off when start bytes are dense; back off for a while
+    size_t shortSkips = 0, skipResume = begin;
     
-    for (size_t i = 0; i < simdLen; i += 32) {
-        __m256i vec1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str1.data() + i));
-        __m256i vec2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str2.data() + i));
-        
-        __m256i cmp = _mm256_cmpeq_epi8(vec1, vec2);
-        int mask = _mm256_movemask_epi8(cmp);
+    for (size_t i = begin; i < end; i++) {
+        if (row == 0 && matcher.rootSkip && i >= skipResume) {
+            size_t skipped = skipKernel(haystack + i, end - i, matcher.startBytes);
+            i += skipped;
+            if (i >= end) {
+                break;
+            }
+            shortSkips = skipped < 16 ? shortSkips + 1 : 0;
+            if (shortSkips > 8) {
+                skipResume = i + 4096;
+                shortSkips = 0;
+            }
+        }
+        uint32_t next = delta[row + matcher.classMap[haystack[i]]];
+        row = next & ~PatternMatcher::kOutputFlag;
+        if (!(next & PatternMatcher::kOutputFlag) || i < reportFrom) {
+            continue;
+        }
         
-        if (mask != 0xFFFFFFFF) {
-            // Find first differing byte
-            for (size_t j = 0; j < 32; j++) {
-                if (str1[i + j] != str2[i + j]) {
-                    return Napi::Number::New(env, str1[i + j] < str2[i + j] ? -1 : 1);
+        for (uint32_t state = static_cast<uint32_t>(row / classes); state != UINT32_MAX; state = matcher.dictionaryLink[state]) {
+            for (uint32_t k = matcher.ownBegin[state]; k < matcher.ownBegin[state + 1]; k++) {
+                uint32_t pattern = matcher.ownPatterns[k];
+                offsets.push_back(static_cast<uint32_t>(i + 1 - matcher.patternLengths[pattern]));
+                patterns.push_back(pattern);
+                if (offsets.size() >= limit) {
+                    return;
                 }
             }
         }
     }
+}
+
+/**
+ * Compiles a multi-pattern matcher for reuse across haystacks
+ * @param info - CallbackInfo containing pattern array (strings or Buffers) and optional { caseSensitive }
+ * @returns Matcher handle object
+ */
+Napi::Value CreateMatcher(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsArray() || info[0].As<Napi::Array>().Length() == 0) {
+        Napi::TypeError::New(env, "Non-empty pattern array required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    bool foldCase = info.Length() > 1 && info[1].IsObject() &&
+        info[1].As<Napi::Object>().Get("caseSensitive").IsBoolean() &&
+        !info[1].As<Napi::Object>().Get("caseSensitive").As<Napi::Boolean>();
+    
+    Napi::Array list = info[0].As<Napi::Array>();
+    std::vector<std::string> patterns(list.Length());
+    for (uint32_t i = 0; i < list.Length(); i++) {
+        const uint8_t* data;
+        size_t length;
+        if (!ToByteInput(env, list.Get(i), data, length, patterns[i])) {
+            return env.Null();
+        }
+        if (length == 0) {
+            Napi::TypeError::New(env, "Patterns must not be empty").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        patterns[i].assign(reinterpret_cast<const char*>(data), length);
+        if (foldCase) {
+            for (char& c : patterns[i]) c = static_cast<char>(FoldLower(static_cast<uint8_t>(c)));
+        }
+    }
+    
+    auto matcher = std::make_shared<PatternMatcher>();
+    std::fill(std::begin(matcher->classMap), std::end(matcher->classMap), uint16_t(0));
+    
+    // Class 0 stands for every byte no pattern uses
+    size_t classCount = 1;
+    size_t totalLength = 0;
+    matcher->maxLength = 0;
+    for (const std::string& pattern : patterns) {
+        for (char c : pattern) {
+            uint8_t byte = static_cast<uint8_t>(c);
+            if (matcher->classMap[byte] == 0) {
+                matcher->classMap[byte] = static_cast<uint16_t>(classCount);
+                if (foldCase) matcher->classMap[FoldUpper(byte)] = static_cast<uint16_t>(classCount);
+                classCount++;
+            }
+        }
+        totalLength += pattern.size();
+        matcher->maxLength = std::max(matcher->maxLength, pattern.size());
+        matcher->patternLengths.push_back(static_cast<uint32_t>(pattern.size()));
+    }
+    if (totalLength + 1 > kMaxMatcherStates) {
+        Napi::RangeError::New(env, "Patterns are too long (at most 65535 bytes in total)").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    matcher->classCount = classCount;
+    
+    // Trie: UINT32_MAX marks a missing edge, states are row indexes
+    std::vector<uint32_t>& delta = matcher->delta;
+    delta.assign(classCount, UINT32_MAX);
+    std::vector<std::vector<uint32_t>> own(1);
+    for (uint32_t p = 0; p < patterns.size(); p++) {
+        uint32_t state = 0;
+        for (char c : patterns[p]) {
+            uint32_t& edge = delta[state * classCount + matcher->classMap[static_cast<uint8_t>(c)]];
+            if (edge == UINT32_MAX) {
+                edge = static_cast<uint32_t>(own.size());
+                own.emplace_back();
+                delta.resize(own.size() * classCount, UINT32_MAX);
+            }
+            state = delta[state * classCount + matcher->classMap[static_cast<uint8_t>(c)]];
+        }
+        own[state].push_back(p);
+    }
+    
+    // Breadth-first failure links turn the trie into a complete DFA
+    const size_t stateCount = own.size();
+    std::vector<uint32_t> fail(stateCount, 0);
+    matcher->dictionaryLink.assign(stateCount, UINT32_MAX);
+    std::vector<uint32_t> queue;
+    queue.reserve(stateCount);
+    for (size_t c = 0; c < classCount; c++) {
+        uint32_t& edge = delta[c];
+        if (edge == UINT32_MAX) {
+            edge = 0;
+        } else {
+            queue.push_back(edge);
+        }
+    }
+    for (size_t head = 0; head < queue.size(); head++) {
+        uint32_t state = queue[head];
+        uint32_t link = fail[state];
+        matcher->dictionaryLink[state] = !own[link].empty() ? link : matcher->dictionaryLink[link];
+        for (size_t c = 0; c < classCount; c++) {
+            uint32_t& edge = delta[state * classCount + c];
+            uint32_t fallback = delta[link * classCount + c];
+            if (edge == UINT32_MAX) {
+                edge = fallback;
+            } else {
+                fail[edge] = fallback;
+                queue.push_back(edge);
+            }
+        }
+    }
+    
+    matcher->ownBegin.assign(stateCount + 1, 0);
+    for (size_t s = 0; s < stateCount; s++) {
+        matcher->ownBegin[s + 1] = matcher->ownBegin[s] + static_cast<uint32_t>(own[s].size());
+        matcher->ownPatterns.insert(matcher->ownPatterns.end(), own[s].begin(), own[s].end());
+    }
+    for (uint32_t& edge : delta) {
+        bool output = !own[edge].empty() || matcher->dictionaryLink[edge] != UINT32_MAX;
+        edge = static_cast<uint32_t>(edge * classCount) | (output ? PatternMatcher::kOutputFlag : 0);
+    }
+    
+    // Let the scan jump over runs of bytes that cannot start a pattern
+    std::vector<uint8_t> starts;
+    for (size_t byte = 0; byte < 256; byte++) {
+        if ((delta[matcher->classMap[byte]] & ~PatternMatcher::kOutputFlag) != 0) {
+            starts.push_back(static_cast<uint8_t>(byte));
+        }
+    }
+    matcher->rootSkip = !starts.empty() && starts.size() <= kMaxSkipBytes;
+    BuildSkipSet(matcher->startBytes, starts);
+    
+    uint64_t matcherId = matchers.Insert(matcher);
+    if (matcherId == 0) {
+        Napi::Error::New(env, "Too many matcher handles").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object handle = Napi::Object::New(env);
+    handle.Set("id", Napi::Number::New(env, static_cast<double>(matcherId)));
+    // Dropping the handle releases the automaton
+    handle.Set("handle", Napi::External<void>::New(env, nullptr, [matcherId](Napi::Env, void*) {
+        matchers.Remove(matcherId);
+    }));
+    handle.Set("patternCount", Napi::Number::New(env, static_cast<double>(patterns.size())));
+    handle.Set("states", Napi::Number::New(env, static_cast<double>(stateCount)));
+    return handle;
+}
+
+/**
+ * Resolves a matcher handle; throws on failure
+ * @returns Matcher, or null
+ */
+static std::shared_ptr<PatternMatcher> ToMatcher(Napi::Env env, const Napi::Value& value) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "Matcher handle object required").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    Napi::Value id = value.As<Napi::Object>().Get("id");
+    std::shared_ptr<PatternMatcher> matcher = id.IsNumber()
+        ? matchers.Get(static_cast<uint64_t>(id.As<Napi::Number>().DoubleValue()))
+        : nullptr;
+    if (!matcher) {
+        Napi::Error::New(env, "Invalid matcher handle").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    return matcher;
+}
+
+/**
+ * Reports every pattern occurrence in a haystack, ordered by end offset
+ * @param info - CallbackInfo containing matcher handle, haystack and optional { limit }
+ * @returns Object with offsets (match starts) and patterns (pattern indexes) as Uint32Arrays
+ */
+Napi::Value MatcherScan(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<PatternMatcher> matcher = ToMatcher(env, info[0]);
+    if (!matcher) {
+        return env.Null();
+    }
+    const uint8_t* haystack;
+    size_t haystackLength;
+    std::string storage;
+    if (info.Length() < 2 || !ToByteInput(env, info[1], haystack, haystackLength, storage)) {
+        if (!env.IsExceptionPending()) {
+            Napi::TypeError::New(env, "Haystack required").ThrowAsJavaScriptException();
+        }
+        return env.Null();
+    }
+    if (haystackLength > UINT32_MAX) {
+        Napi::RangeError::New(env, "Haystack must be smaller than 4 GiB").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    size_t limit;
+    if (!ToMatchLimit(env, info.Length() > 2 && info[2].IsObject() ? info[2].As<Napi::Object>() : Napi::Object::New(env), limit)) {
+        return env.Null();
+    }
+    
+    std::vector<uint32_t> offsets, patterns;
+    Threading::WorkerPool& pool = Threading::WorkerPool::Instance();
+    if (haystackLength < kParallelSearchBytes || pool.Size() < 2 || limit != SIZE_MAX) {
+        MatcherScanRange(*matcher, haystack, 0, haystackLength, 0, limit, offsets, patterns);
+    } else {
+        // Each segment re-reads maxLength - 1 bytes of context, enough to reach the
+        // automaton state a sequential scan would have at the segment start
+        const size_t segments = pool.Size() * 4;
+        std::vector<std::vector<uint32_t>> segmentOffsets(segments), segmentPatterns(segments);
+        pool.ParallelFor(segments, [&](size_t segment) {
+            size_t from = haystackLength * segment / segments;
+            size_t to = haystackLength * (segment + 1) / segments;
+            size_t context = std::min(from, matcher->maxLength - 1);
+            MatcherScanRange(*matcher, haystack, from - context, to, from, SIZE_MAX,
+                             segmentOffsets[segment], segmentPatterns[segment]);
+        });
+        for (size_t segment = 0; segment < segments; segment++) {
+            offsets.insert(offsets.end(), segmentOffsets[segment].begin(), segmentOffsets[segment].end());
+            patterns.insert(patterns.end(), segmentPatterns[segment].begin(), segmentPatterns[segment].end());
+        }
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("offsets", ToUint32Array(env, offsets));
+    result.Set("patterns", ToUint32Array(env, patterns));
+    return result;
+}
+
+/**
+ * Destroys a matcher
+ * @param info - CallbackInfo containing matcher handle
+ * @returns Success status
+ */
+Napi::Value DestroyMatcher(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!ToMatcher(env, info[0])) {
+        return Napi::Boolean::New(env, false);
+    }
+    uint64_t id = static_cast<uint64_t>(info[0].As<Napi::Object>().Get("id").As<Napi::Number>().DoubleValue());
+    return Napi::Boolean::New(env, matchers.Remove(id) != nullptr);
+}
+
+/**
+ * Reads an optional non-negative integer argument
+ * @returns False when present but invalid
+ */
+static bool ToOptionalIndex(const Napi::CallbackInfo& info, size_t index, double& value) {
+    if (info.Length() <= index || info[index].IsUndefined()) {
+        return true;
+    }
+    if (!info[index].IsNumber()) {
+        return false;
+    }
+    value = info[index].As<Napi::Number>().DoubleValue();
+    return value >= 0 && value == std::floor(value);
+}
+
+/**
+ * Resolves a byte view narrowed by optional offset and length arguments; throws on failure.
+ * Binary inputs are read in place, so no UTF-16 to UTF-8 transcode happens.
+ * @param env - Environment
+ * @param info - CallbackInfo
+ * @param viewIndex - Argument index of the view
+ * @param sliceIndex - Argument index of the offset; the length follows it
+ * @param data - Receives the first byte of the slice
+ * @param length - Receives the slice length
+ * @param storage - Backing store for string input
+ * @returns True on success
+ */
+static bool ToByteSlice(Napi::Env env, const Napi::CallbackInfo& info, size_t viewIndex, size_t sliceIndex,
+                        const uint8_t*& data, size_t& length, std::string& storage) {
+    if (info.Length() <= viewIndex || !ToByteInput(env, info[viewIndex], data, length, storage)) {
+        if (!env.IsExceptionPending()) {
+            Napi::TypeError::New(env, "Buffer or TypedArray required").ThrowAsJavaScriptException();
+        }
+        return false;
+    }
+    
+    double offset = 0;
+    double sliceLength = -1;
+    if (!ToOptionalIndex(info, sliceIndex, offset) || !ToOptionalIndex(info, sliceIndex + 1, sliceLength) ||
+        offset > static_cast<double>(length) ||
+        (sliceLength >= 0 && sliceLength > static_cast<double>(length) - offset)) {
+        Napi::RangeError::New(env, "Slice out of bounds").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    data += static_cast<size_t>(offset);
+    length = sliceLength < 0 ? length - static_cast<size_t>(offset) : static_cast<size_t>(sliceLength);
+    return true;
+}
+
+/**
+ * UTF-8 character count of a byte slice
+ * @param info - CallbackInfo containing buffer, optional offset and length
+ * @returns Length in characters
+ */
+Napi::Value BufferLength(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    const uint8_t* data;
+    size_t length;
+    std::string storage;
+    if (!ToByteSlice(env, info, 0, 1, data, length, storage)) {
+        return env.Null();
+    }
+    
+    return Napi::Number::New(env, static_cast<double>(CountUtf8Chars(data, length)));
+}
+
+/**
+ * Hashes a byte slice with one of the stringHash algorithms
+ * @param info - CallbackInfo containing buffer, algorithm, optional offset and length
+ * @returns Hash value
+ */
+Napi::Value BufferHash(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    const uint8_t* data;
+    size_t length;
+    std::string storage;
+    if (!ToByteSlice(env, info, 0, 2, data, length, storage)) {
+        return env.Null();
+    }
+    
+    std::string algorithm = "djb2";
+    if (info.Length() > 1 && info[1].IsString()) {
+        algorithm = info[1].As<Napi::String>();
+    }
+    HashAlgorithm hashAlgorithm;
+    if (!ParseHashAlgorithm(algorithm, hashAlgorithm)) {
+        Napi::TypeError::New(env, "Unknown hash algorithm").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    return Napi::Number::New(env, static_cast<double>(HashBytes(data, length, hashAlgorithm)));
+}
+
+/**
+ * Validates the encoding of a byte slice
+ * @param info - CallbackInfo containing buffer, validation type ('utf8' or 'ascii'), optional offset and length
+ * @returns Validation result
+ */
+Napi::Value BufferValidate(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    const uint8_t* data;
+    size_t length;
+    std::string storage;
+    if (!ToByteSlice(env, info, 0, 2, data, length, storage)) {
+        return env.Null();
+    }
+    if (info.Length() < 2 || !info[1].IsString()) {
+        Napi::TypeError::New(env, "Validation type required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string validationType = info[1].As<Napi::String>();
+    if (validationType == "utf8") {
+        return Napi::Boolean::New(env, IsValidUtf8(data, length));
+    } else if (validationType == "ascii") {
+        return Napi::Boolean::New(env, asciiKernel(data, length));
+    }
+    
+    Napi::TypeError::New(env, "Unknown validation type").ThrowAsJavaScriptException();
+    return env.Null();
+}
+
+/**
+ * Byte-wise comparison of two byte slices
+ * @param info - CallbackInfo containing two buffers, case sensitivity flag, then
+ *               optional offset and length for the first and for the second
+ * @returns Comparison result (-1, 0, 1)
+ */
+Napi::Value BufferCompare(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    const uint8_t* a;
+    const uint8_t* b;
+    size_t aLength, bLength;
+    std::string aStorage, bStorage;
+    if (!ToByteSlice(env, info, 0, 3, a, aLength, aStorage) || !ToByteSlice(env, info, 1, 5, b, bLength, bStorage)) {
+        return env.Null();
+    }
+    bool caseSensitive = !(info.Length() > 2 && info[2].IsBoolean()) || info[2].As<Napi::Boolean>();
+    
+    return Napi::Number::New(env, CompareBytes(a, aLength, b, bLength, !caseSensitive));
+}
+
+/**
+ * Reads an optional 64-bit hash seed
+ * @param value - Undefined, safe-integer Number or BigInt
+ * @param seed - Parsed seed
+ * @returns False if the value is negative, fractional, unsafe or out of range
+ */
+static bool ToHashSeed(const Napi::Value& value, uint64_t& seed) {
+    seed = 0;
+    if (value.IsUndefined()) {
+        return true;
+    }
+    if (value.IsBigInt()) {
+        bool lossless = false;
+        seed = value.As<Napi::BigInt>().Uint64Value(&lossless);
+        return lossless;
+    }
+    if (value.IsNumber()) {
+        double number = value.As<Napi::Number>().DoubleValue();
+        if (!(number >= 0) || number > 9007199254740991.0 || number != std::floor(number)) {
+            return false;
+        }
+        seed = static_cast<uint64_t>(number);
+        return true;
+    }
+    return false;
+}
+
+// Operations understood by StringBatch
+enum class BatchOperation { Length, Hash, Validate, Compare };
+
+/**
+ * Runs one operation over every string in a packed buffer. String i spans
+ * bytes offsets[i] to offsets[i + 1], so n strings take n + 1 offsets.
+ * Large batches are split across the worker pool.
+ * @param info - CallbackInfo containing operation ('length', 'hash', 'validate', 'compare'),
+ *               packed buffer, Uint32Array offsets and options
+ *               { algorithm, seed, type, needle, caseSensitive, output }
+ * @returns Uint32Array of lengths, BigUint64Array of hashes (low and high word per
+ *          string for xxh3-128), Uint8Array of 0/1 flags, or Int32Array of comparison
+ *          results against needle; written into options.output when given
+ */
+Napi::Value StringBatch(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 3 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "Operation, packed buffer and offsets required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const uint8_t* packed;
+    size_t packedLength;
+    std::string storage;
+    if (!ToByteInput(env, info[1], packed, packedLength, storage)) {
+        return env.Null();
+    }
+    if (!info[2].IsTypedArray() || info[2].As<Napi::TypedArray>().TypedArrayType() != napi_uint32_array) {
+        Napi::TypeError::New(env, "Offsets must be a Uint32Array").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    Napi::Uint32Array offsetArray = info[2].As<Napi::Uint32Array>();
+    if (offsetArray.ElementLength() == 0) {
+        Napi::RangeError::New(env, "Offsets need a final end offset").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    const uint32_t* offsets = offsetArray.Data();
+    const size_t count = offsetArray.ElementLength() - 1;
+    for (size_t i = 0; i < count; i++) {
+        if (offsets[i] > offsets[i + 1]) {
+            Napi::RangeError::New(env, "Offsets must be non-decreasing").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    }
+    if (offsets[count] > packedLength) {
+        Napi::RangeError::New(env, "Offsets exceed the packed buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    Napi::Object options = info.Length() > 3 && info[3].IsObject() ? info[3].As<Napi::Object>() : Napi::Object::New(env);
+    
+    std::string operationName = info[0].As<Napi::String>();
+    BatchOperation operation;
+    HashAlgorithm hashAlgorithm = HashAlgorithm::DJB2;
+    uint64_t seed = 0;
+    bool checkUtf8 = true;
+    bool foldCase = false;
+    const uint8_t* needle = nullptr;
+    size_t needleLength = 0;
+    std::string needleStorage;
+    napi_typedarray_type resultType;
+    size_t resultLength = count;
+    if (operationName == "length") {
+        operation = BatchOperation::Length;
+        resultType = napi_uint32_array;
+    } else if (operationName == "hash") {
+        operation = BatchOperation::Hash;
+        Napi::Value algorithm = options.Get("algorithm");
+        if (!algorithm.IsUndefined() &&
+            (!algorithm.IsString() || !ParseHashAlgorithm(algorithm.As<Napi::String>(), hashAlgorithm))) {
+            Napi::TypeError::New(env, "Unknown hash algorithm").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        if (!ToHashSeed(options.Get("seed"), seed)) {
+            Napi::RangeError::New(env, "Seed must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        resultType = napi_biguint64_array;
+        resultLength = hashAlgorithm == HashAlgorithm::XXH3_128 ? count * 2 : count;
+    } else if (operationName == "validate") {
+        operation = BatchOperation::Validate;
+        Napi::Value type = options.Get("type");
+        std::string validationType = type.IsString() ? type.As<Napi::String>().Utf8Value() : "utf8";
+        if (validationType != "utf8" && validationType != "ascii") {
+            Napi::TypeError::New(env, "Unknown validation type").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        checkUtf8 = validationType == "utf8";
+        resultType = napi_uint8_array;
+    } else if (operationName == "compare") {
+        operation = BatchOperation::Compare;
+        if (!ToByteInput(env, options.Get("needle"), needle, needleLength, needleStorage)) {
+            return env.Null();
+        }
+        foldCase = options.Get("caseSensitive").IsBoolean() && !options.Get("caseSensitive").As<Napi::Boolean>();
+        resultType = napi_int32_array;
+    } else {
+        Napi::TypeError::New(env, "Unknown batch operation").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // Reusing a caller array keeps hot batch loops free of allocations
+    Napi::TypedArray result;
+    Napi::Value provided = options.Get("output");
+    if (!provided.IsUndefined()) {
+        if (!provided.IsTypedArray() || provided.As<Napi::TypedArray>().TypedArrayType() != resultType) {
+            Napi::TypeError::New(env, "Output array type does not match the operation").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        result = provided.As<Napi::TypedArray>();
+        if (result.ElementLength() < resultLength) {
+            Napi::RangeError::New(env, "Output array is too small").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else {
+        switch (resultType) {
+            case napi_uint32_array: result = Napi::Uint32Array::New(env, resultLength); break;
+            case napi_biguint64_array: result = Napi::BigUint64Array::New(env, resultLength); break;
+            case napi_uint8_array: result = Napi::Uint8Array::New(env, resultLength); break;
+            default: result = Napi::Int32Array::New(env, resultLength); break;
+        }
+    }
+    void* output = static_cast<uint8_t*>(result.ArrayBuffer().Data()) + result.ByteOffset();
+    const bool wideHash = hashAlgorithm == HashAlgorithm::XXH3_128;
     
-    // Handle remaining bytes
-    for (size_t i = simdLen; i < minLen; i++) {
-        if (str1[i] != str2[i]) {
-            return Napi::Number::New(env, str1[i] < str2[i] ? -1 : 1);
+    auto runRange = [&](size_t from, size_t to) {
+        for (size_t i = from; i < to; i++) {
+            const uint8_t* data = packed + offsets[i];
+            size_t length = offsets[i + 1] - offsets[i];
+            switch (operation) {
+                case BatchOperation::Length:
+                    static_cast<uint32_t*>(output)[i] = static_cast<uint32_t>(CountUtf8Chars(data, length));
+                    break;
+                case BatchOperation::Hash:
+                    if (wideHash) {
+                        uint64_t* words = static_cast<uint64_t*>(output) + 2 * i;
+                        words[0] = Hash128Bytes(data, length, hashAlgorithm, seed, words[1]);
+                    } else {
+                        static_cast<uint64_t*>(output)[i] = HashBytes(data, length, hashAlgorithm, seed);
+                    }
+                    break;
+                case BatchOperation::Validate:
+                    static_cast<uint8_t*>(output)[i] = checkUtf8 ? IsValidUtf8(data, length) : asciiKernel(data, length);
+                    break;
+                case BatchOperation::Compare:
+                    static_cast<int32_t*>(output)[i] = CompareBytes(data, length, needle, needleLength, foldCase);
+                    break;
+            }
         }
-    }
+    };
     
-    // Strings are equal up to minimum length
-    if (str1.length() == str2.length()) {
-        return Napi::Number::New(env, 0);
+    Threading::WorkerPool& pool = Threading::WorkerPool::Instance();
+    const size_t totalBytes = offsets[count] - offsets[0];
+    if (totalBytes < kParallelSearchBytes || count < 2 || pool.Size() < 2) {
+        runRange(0, count);
     } else {
-        return Napi::Number::New(env, str1.length() < str2.length() ? -1 : 1);
+        // Split by item count; per-item cost is proportional to bytes, and with
+        // four chunks per worker the stealing deques even out skewed batches
+        const size_t chunks = std::min(count, pool.Size() * 4);
+        pool.ParallelFor(chunks, [&](size_t chunk) {
+            runRange(count * chunk / chunks, count * (chunk + 1) / chunks);
+        });
     }
+    
+    return result;
 }
 
 /**
- * UTF-8 aware string length calculation
- * @param info - CallbackInfo containing string parameter
- * @returns String length in characters (not bytes)
+ * Converts a digest to a BigInt; xxh3-128 digests become one 128-bit BigInt
+ * @returns BigInt value
  */
-Napi::Value StringLength(const Napi::CallbackInfo& info) {
+static Napi::Value ToHashValue(Napi::Env env, HashAlgorithm algorithm, uint64_t low, uint64_t high) {
+    if (algorithm == HashAlgorithm::XXH3_128) {
+        const uint64_t words[2] = {low, high};
+        return Napi::BigInt::New(env, 0, 2, words);
+    }
+    return Napi::BigInt::New(env, low);
+}
+
+/**
+ * Reads the algorithm name and seed shared by hash and createHasher; throws on failure
+ * @returns False when either argument is invalid
+ */
+static bool ToHashOptions(Napi::Env env, const Napi::CallbackInfo& info, size_t index,
+                          HashAlgorithm& algorithm, uint64_t& seed) {
+    algorithm = HashAlgorithm::XXH3;
+    if (info.Length() > index && !info[index].IsUndefined() &&
+        (!info[index].IsString() || !ParseHashAlgorithm(info[index].As<Napi::String>(), algorithm))) {
+        Napi::TypeError::New(env, "Unknown hash algorithm").ThrowAsJavaScriptException();
+        return false;
+    }
+    if (!ToHashSeed(info.Length() > index + 1 ? info[index + 1] : env.Undefined(), seed)) {
+        Napi::RangeError::New(env, "Seed must be a non-negative safe integer or BigInt").ThrowAsJavaScriptException();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Hashes bytes with the full algorithm width
+ * @param info - CallbackInfo containing input, algorithm (default 'xxh3') and optional seed
+ * @returns BigInt hash (128 bits for 'xxh3-128')
+ */
+Napi::Value Hash(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 1 || !info[0].IsString()) {
-        Napi::TypeError::New(env, "String parameter required").ThrowAsJavaScriptException();
+    const uint8_t* data;
+    size_t length;
+    std::string storage;
+    if (info.Length() < 1 || !ToByteInput(env, info[0], data, length, storage)) {
+        if (!env.IsExceptionPending()) {
+            Napi::TypeError::New(env, "Input required").ThrowAsJavaScriptException();
+        }
         return env.Null();
     }
-    
-    std::string str = info[0].As<Napi::String>();
-    
-    // Count UTF-8 characters
-    size_t length = 0;
-    for (size_t i = 0; i < str.length(); ) {
-        unsigned char c = str[i];
-        
-        if (c < 0x80) {
-            // ASCII character
-            i += 1;
-        } else if ((c >> 5) == 0x06) {
-            // 2-byte UTF-8 character
-            i += 2;
-        } else if ((c >> 4) == 0x0E) {
-            // 3-byte UTF-8 character
-            i += 3;
-        } else if ((c >> 3) == 0x1E) {
-            // 4-byte UTF-8 character
-            i += 4;
-        } else {
-            // Invalid UTF-8, treat as single byte
-            i += 1;
-        }
-        
-        length++;
+    HashAlgorithm algorithm;
+    uint64_t seed;
+    if (!ToHashOptions(env, info, 1, algorithm, seed)) {
+        return env.Null();
     }
     
-    return Napi::Number::New(env, static_cast<double>(length));
+    uint64_t high;
+    uint64_t low = Hash128Bytes(data, length, algorithm, seed, high);
+    return ToHashValue(env, algorithm, low, high);
 }
 
+// Incremental hash state behind a hasher handle
+struct StreamingHasher {
+    HashAlgorithm algorithm;
+    uint64_t state = 0;
+    uint64_t totalLength = 0;
+    // MurmurHash3 input not yet forming a 4-byte block
+    uint8_t tail[4];
+    size_t tailLength = 0;
+    std::unique_ptr<XXH3Stream> xxh3;
+};
+
+static HandleTable<StreamingHasher> hashers;
+
 /**
- * High-performance string copy with bounds checking
- * @param info - CallbackInfo containing source string, destination buffer, max length
- * @returns Number of bytes copied
+ * Creates an incremental hasher; wyhash has no streaming form and is rejected
+ * @param info - CallbackInfo containing algorithm (default 'xxh3') and optional seed
+ * @returns Hasher handle object
  */
-Napi::Value StringCopy(const Napi::CallbackInfo& info) {
+Napi::Value CreateHasher(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 3 || !info[0].IsString() || !info[1].IsBuffer() || !info[2].IsNumber()) {
-        Napi::TypeError::New(env, "Source string, destination buffer, and max length required").ThrowAsJavaScriptException();
+    HashAlgorithm algorithm;
+    uint64_t seed;
+    if (!ToHashOptions(env, info, 0, algorithm, seed)) {
         return env.Null();
     }
     
-    std::string src = info[0].As<Napi::String>();
-    Napi::Buffer<uint8_t> dest = info[1].As<Napi::Buffer<uint8_t>>();
-    size_t maxLength = info[2].As<Napi::Number>().Uint32Value();
-    
-    size_t copyLength = std::min(src.length(), std::min(maxLength, dest.Length()));
+    auto hasher = std::make_shared<StreamingHasher>();
+    hasher->algorithm = algorithm;
+    switch (algorithm) {
+        case HashAlgorithm::DJB2: hasher->state = 5381; break;
+        case HashAlgorithm::FNV1a: hasher->state = 14695981039346656037ULL; break;
+        case HashAlgorithm::CRC32:
+        case HashAlgorithm::CRC32C: hasher->state = 0xFFFFFFFFu; break;
+        case HashAlgorithm::XXH3:
+        case HashAlgorithm::XXH3_128:
+            hasher->xxh3 = std::make_unique<XXH3Stream>();
+            XXH3StreamReset(*hasher->xxh3, seed);
+            break;
+        case HashAlgorithm::WyHash:
+            Napi::TypeError::New(env, "wyhash cannot be computed incrementally").ThrowAsJavaScriptException();
+            return env.Null();
+        default:
+            break;
+    }
     
-    if (copyLength > 0) {
-        // Use SIMD for large copies
-        size_t simdLength = (copyLength / 32) * 32;
-        
-        for (size_t i = 0; i < simdLength; i += 32) {
-            __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src.data() + i));
-            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest.Data() + i), data);
-        }
-        
-        // Copy remaining bytes
-        for (size_t i = simdLength; i < copyLength; i++) {
-            dest.Data()[i] = src[i];
-        }
+    uint64_t hasherId = hashers.Insert(hasher);
+    if (hasherId == 0) {
+        Napi::Error::New(env, "Too many hasher handles").ThrowAsJavaScriptException();
+        return env.Null();
     }
     
-    return Napi::Number::New(env, static_cast<double>(copyLength));
+    Napi::Object handle = Napi::Object::New(env);
+    handle.Set("id", Napi::Number::New(env, static_cast<double>(hasherId)));
+    // Dropping the handle releases the state
+    handle.Set("handle", Napi::External<void>::New(env, nullptr, [hasherId](Napi::Env, void*) {
+        hashers.Remove(hasherId);
+    }));
+    handle.Set("algorithm", info.Length() > 0 && info[0].IsString() ? info[0] : Napi::String::New(env, "xxh3"));
+    return handle;
 }
 
 /**
- * Optimized string concatenation
- * @param info - CallbackInfo containing array of strings
- * @returns Concatenated string
+ * Resolves a hasher handle; throws on failure
+ * @returns Hasher, or null
  */
-Napi::Value StringConcat(const Napi::CallbackInfo& info) {
+static std::shared_ptr<StreamingHasher> ToHasher(Napi::Env env, const Napi::Value& value) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "Hasher handle object required").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    Napi::Value id = value.As<Napi::Object>().Get("id");
+    std::shared_ptr<StreamingHasher> hasher = id.IsNumber()
+        ? hashers.Get(static_cast<uint64_t>(id.As<Napi::Number>().DoubleValue()))
+        : nullptr;
+    if (!hasher) {
+        Napi::Error::New(env, "Invalid hasher handle").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    return hasher;
+}
+
+/**
+ * Feeds bytes to a hasher
+ * @param info - CallbackInfo containing hasher handle, input, optional offset and length
+ * @returns Total bytes hashed so far
+ */
+Napi::Value HasherUpdate(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 1 || !info[0].IsArray()) {
-        Napi::TypeError::New(env, "Array of strings required").ThrowAsJavaScriptException();
+    std::shared_ptr<StreamingHasher> hasher = ToHasher(env, info[0]);
+    if (!hasher) {
         return env.Null();
     }
-    
-    Napi::Array stringArray = info[0].As<Napi::Array>();
-    std::vector<std::string> strings;
-    size_t totalLength = 0;
-    
-    // First pass: collect strings and calculate total length
-    for (uint32_t i = 0; i < stringArray.Length(); i++) {
-        if (stringArray.Get(i).IsString()) {
-            std::string str = stringArray.Get(i).As<Napi::String>();
-            strings.push_back(str);
-            totalLength += str.length();
-        }
+    const uint8_t* data;
+    size_t length;
+    std::string storage;
+    if (!ToByteSlice(env, info, 1, 2, data, length, storage)) {
+        return env.Null();
     }
     
-    // Allocate result string with exact size
-    std::string result;
-    result.reserve(totalLength);
-    
-    // Second pass: concatenate strings
-    for (const auto& str : strings) {
-        result.append(str);
+    switch (hasher->algorithm) {
+        case HashAlgorithm::DJB2: hasher->state = Djb2Update(hasher->state, data, length); break;
+        case HashAlgorithm::FNV1a: hasher->state = Fnv1aUpdate(hasher->state, data, length); break;
+        case HashAlgorithm::SDBM: hasher->state = SdbmUpdate(hasher->state, data, length); break;
+        case HashAlgorithm::CRC32:
+            hasher->state = CrcUpdateScalar(crc32Tables, static_cast<uint32_t>(hasher->state), data, length);
+            break;
+        case HashAlgorithm::CRC32C:
+            hasher->state = crc32cKernel(static_cast<uint32_t>(hasher->state), data, length);
+            break;
+        case HashAlgorithm::Murmur3: {
+            uint32_t h1 = static_cast<uint32_t>(hasher->state);
+            size_t consumed = 0;
+            if (hasher->tailLength > 0) {
+                consumed = std::min(length, 4 - hasher->tailLength);
+                std::memcpy(hasher->tail + hasher->tailLength, data, consumed);
+                hasher->tailLength += consumed;
+                if (hasher->tailLength == 4) {
+                    h1 = MurmurBlocks(h1, hasher->tail, 1);
+                    hasher->tailLength = 0;
+                }
+            }
+            size_t blocks = (length - consumed) / 4;
+            h1 = MurmurBlocks(h1, data + consumed, blocks);
+            consumed += blocks * 4;
+            if (consumed < length) {
+                std::memcpy(hasher->tail + hasher->tailLength, data + consumed, length - consumed);
+                hasher->tailLength += length - consumed;
+            }
+            hasher->state = h1;
+            break;
+        }
+        case HashAlgorithm::XXH3:
+        case HashAlgorithm::XXH3_128:
+            XXH3StreamUpdate(*hasher->xxh3, data, length);
+            break;
+        case HashAlgorithm::WyHash:
+            break;
     }
+    hasher->totalLength += length;
     
-    return Napi::String::New(env, result);
+    return Napi::Number::New(env, static_cast<double>(hasher->totalLength));
 }
 
 /**
- * Boyer-Moore string search algorithm
- * @param info - CallbackInfo containing haystack, needle, case sensitivity
- * @returns Index of first occurrence or -1
+ * Gets the hash of everything fed so far; the hasher can keep taking input
+ * @param info - CallbackInfo containing hasher handle
+ * @returns BigInt hash (128 bits for 'xxh3-128')
  */
-Napi::Value StringSearch(const Napi::CallbackInfo& info) {
+Napi::Value HasherDigest(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsString()) {
-        Napi::TypeError::New(env, "Haystack and needle strings required").ThrowAsJavaScriptException();
+    std::shared_ptr<StreamingHasher> hasher = ToHasher(env, info[0]);
+    if (!hasher) {
         return env.Null();
     }
     
-    std::string haystack = info[0].As<Napi::String>();
-    std::string needle = info[1].As<Napi::String>();
-    bool caseSensitive = true;
-    
-    if (info.Length() > 2 && info[2].IsBoolean()) {
-        caseSensitive = info[2].As<Napi::Boolean>();
+    uint64_t low = hasher->state;
+    uint64_t high = 0;
+    switch (hasher->algorithm) {
+        case HashAlgorithm::CRC32:
+        case HashAlgorithm::CRC32C:
+            low = ~hasher->state & 0xFFFFFFFFu;
+            break;
+        case HashAlgorithm::Murmur3:
+            low = MurmurFinish(static_cast<uint32_t>(hasher->state), hasher->tail, hasher->tailLength, hasher->totalLength);
+            break;
+        case HashAlgorithm::XXH3:
+            low = XXH3StreamDigest64(*hasher->xxh3);
+            break;
+        case HashAlgorithm::XXH3_128: {
+            Hash128 hash = XXH3StreamDigest128(*hasher->xxh3);
+            low = hash.low;
+            high = hash.high;
+            break;
+        }
+        default:
+            break;
     }
+    return ToHashValue(env, hasher->algorithm, low, high);
+}
+
+/**
+ * Destroys a hasher
+ * @param info - CallbackInfo containing hasher handle
+ * @returns Success status
+ */
+Napi::Value DestroyHasher(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
     
-    if (needle.empty()) {
-        return Napi::Number::New(env, 0);
+    if (!ToHasher(env, info[0])) {
+        return Napi::Boolean::New(env, false);
     }
-    
-    if (!caseSensitive) {
-        std::transform(haystack.begin(), haystack.end(), haystack.begin(), ::tolower);
-        std::transform(needle.begin(), needle.end(), needle.begin(), ::tolower);
+    uint64_t id = static_cast<uint64_t>(info[0].As<Napi::Object>().Get("id").As<Napi::Number>().DoubleValue());
+    return Napi::Boolean::New(env, hashers.Remove(id) != nullptr);
+}
+
+// Text encodings understood by transcode
+enum class TextEncoding {
+    Utf8,
+    Utf16LE,
+    Latin1
+};
+
+static bool ParseTextEncoding(const std::string& name, TextEncoding& encoding) {
+    if (name == "utf8" || name == "utf-8") {
+        encoding = TextEncoding::Utf8;
+    } else if (name == "utf16le" || name == "utf-16le" || name == "ucs2" || name == "ucs-2") {
+        encoding = TextEncoding::Utf16LE;
+    } else if (name == "latin1" || name == "binary") {
+        encoding = TextEncoding::Latin1;
+    } else {
+        return false;
     }
-    
-    // Boyer-Moore bad character table
-    std::vector<int> badChar(256, -1);
-    for (size_t i = 0; i < needle.length(); i++) {
-        badChar[static_cast<unsigned char>(needle[i])] = static_cast<int>(i);
+    return true;
+}
+
+// UTF-8 size of UTF-16 units; a surrogate pair counts 2 + 2 bytes
+static size_t Utf8LengthFromUtf16(const char16_t* input, size_t length) {
+    size_t bytes = 0;
+    for (size_t i = 0; i < length; i++) {
+        uint32_t unit = input[i];
+        bytes += 1 + (unit >= 0x80) + (unit >= 0x800) - (unit >= 0xD800 && unit <= 0xDFFF);
     }
-    
-    // Search using Boyer-Moore algorithm
-    size_t haystackLen = haystack.length();
-    size_t needleLen = needle.length();
-    
-    for (size_t shift = 0; shift <= haystackLen - needleLen; ) {
-        int j = static_cast<int>(needleLen) - 1;
-        
-        while (j >= 0 && needle[j] == haystack[shift + j]) {
-            j--;
-        }
-        
-        if (j < 0) {
-            return Napi::Number::New(env, static_cast<double>(shift));
-        } else {
-            int badCharShift = j - badChar[static_cast<unsigned char>(haystack[shift + j])];
-            shift += std::max(1, badCharShift);
-        }
+    return bytes;
+}
+
+// UTF-8 size of Latin-1 bytes
+static size_t Utf8LengthFromLatin1(const uint8_t* input, size_t length) {
+    size_t bytes = length;
+    for (size_t i = 0; i < length; i++) {
+        bytes += input[i] >> 7;
     }
-    
-    return Napi::Number::New(env, -1);
+    return bytes;
 }
 
 /**
- * Multiple string hashing algorithms
- * @param info - CallbackInfo containing string and algorithm parameters
- * @returns Hash value
+ * Converts text between UTF-8, UTF-16LE and Latin-1 without going through JS strings.
+ * UTF-8 input is validated with the SIMD kernel first; same-encoding calls copy, validating UTF-8.
+ * @param info - CallbackInfo containing input, source encoding, target encoding and optional output Uint8Array
+ * @returns New Buffer, or bytes written when an output array is given
  */
-Napi::Value StringHash(const Napi::CallbackInfo& info) {
+Napi::Value Transcode(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 1 || !info[0].IsString()) {
-        Napi::TypeError::New(env, "String parameter required").ThrowAsJavaScriptException();
+    const uint8_t* data;
+    size_t length;
+    std::string storage;
+    if (info.Length() < 1 || !ToByteInput(env, info[0], data, length, storage)) {
+        if (!env.IsExceptionPending()) {
+            Napi::TypeError::New(env, "Buffer or TypedArray required").ThrowAsJavaScriptException();
+        }
+        return env.Null();
+    }
+    if (info.Length() < 3 || !info[1].IsString() || !info[2].IsString()) {
+        Napi::TypeError::New(env, "Source and target encodings required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    TextEncoding from, to;
+    if (!ParseTextEncoding(info[1].As<Napi::String>(), from) || !ParseTextEncoding(info[2].As<Napi::String>(), to)) {
+        Napi::TypeError::New(env, "Unknown encoding").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (from == TextEncoding::Utf16LE && length % 2 != 0) {
+        Napi::RangeError::New(env, "UTF-16 input must have an even byte length").ThrowAsJavaScriptException();
         return env.Null();
     }
     
-    std::string str = info[0].As<Napi::String>();
-    std::string algorithm = "djb2";
+    // UTF-16 views into a Buffer may start at an odd address
+    const char16_t* units = reinterpret_cast<const char16_t*>(data);
+    size_t unitCount = length / 2;
+    std::vector<char16_t> alignedUnits;
+    if (from == TextEncoding::Utf16LE && reinterpret_cast<uintptr_t>(data) % alignof(char16_t) != 0) {
+        alignedUnits.resize(unitCount);
+        std::memcpy(alignedUnits.data(), data, length);
+        units = alignedUnits.data();
+    }
     
-    if (info.Length() > 1 && info[1].IsString()) {
-        algorithm = info[1].As<Napi::String>();
+    // Exact output size, so results need no second copy
+    size_t outputLength = length;
+    if (from == TextEncoding::Utf8 && to != TextEncoding::Utf8) {
+        size_t fourByteLeads;
+        size_t characters = utf8CountKernel(data, length, fourByteLeads);
+        outputLength = to == TextEncoding::Utf16LE ? (characters + fourByteLeads) * 2 : characters;
+    } else if (from == TextEncoding::Utf16LE && to == TextEncoding::Utf8) {
+        outputLength = Utf8LengthFromUtf16(units, unitCount);
+    } else if (from == TextEncoding::Utf16LE && to == TextEncoding::Latin1) {
+        outputLength = unitCount;
+    } else if (from == TextEncoding::Latin1 && to == TextEncoding::Utf8) {
+        outputLength = Utf8LengthFromLatin1(data, length);
+    } else if (from == TextEncoding::Latin1 && to == TextEncoding::Utf16LE) {
+        outputLength = length * 2;
     }
     
-    uint64_t hash = 0;
-    
-    if (algorithm == "djb2") {
-        hash = 5381;
-        for (char c : str) {
-            hash = ((hash << 5) + hash) + static_cast<unsigned char>(c);
-        }
-    } else if (algorithm == "fnv1a") {
-        hash = 14695981039346656037ULL; // FNV offset basis
-        for (char c : str) {
-            hash ^= static_cast<unsigned char>(c);
-            hash *= 1099511628211ULL; // FNV prime
-        }
-    } else if (algorithm == "murmur3") {
-        // MurmurHash3 32-bit implementation
-        const uint32_t seed = 0;
-        const uint32_t c1 = 0xcc9e2d51;
-        const uint32_t c2 = 0x1b873593;
-        const uint32_t r1 = 15;
-        const uint32_t r2 = 13;
-        const uint32_t m = 5;
-        const uint32_t n = 0xe6546b64;
-        
-        uint32_t h1 = seed;
-        const uint8_t* data = reinterpret_cast<const uint8_t*>(str.data());
-        int len = static_cast<int>(str.length());
-        
-        const int nblocks = len / 4;
-        const uint32_t* blocks = reinterpret_cast<const uint32_t*>(data + nblocks * 4);
-        
-        for (int i = -nblocks; i; i++) {
-            uint32_t k1 = blocks[i];
-            
-            k1 *= c1;
-            k1 = (k1 << r1) | (k1 >> (32 - r1));
-            k1 *= c2;
-            
-            h1 ^= k1;
-            h1 = ((h1 << r2) | (h1 >> (32 - r2))) * m + n;
-        }
-        
-        const uint8_t* tail = reinterpret_cast<const uint8_t*>(data + nblocks * 4);
-        uint32_t k1 = 0;
-        
-        switch (len & 3) {
-            case 3: k1 ^= tail[2] << 16;
-            case 2: k1 ^= tail[1] << 8;
-            case 1: k1 ^= tail[0];
-                k1 *= c1;
-                k1 = (k1 << r1) | (k1 >> (32 - r1));
-                k1 *= c2;
-                h1 ^= k1;
-        }
-        
-        h1 ^= len;
-        h1 ^= h1 >> 16;
-        h1 *= 0x85ebca6b;
-        h1 ^= h1 >> 13;
-        h1 *= 0xc2b2ae35;
-        h1 ^= h1 >> 16;
-        
-        hash = h1;
-    } else if (algorithm == "crc32") {
-        // CRC32 implementation
-        static const uint32_t crc32_table[256] = {
-            0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F,
-            0xE963A535, 0x9E6495A3, 0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
-            // ... (full table would be here in production)
-        };
-        
-        hash = 0xFFFFFFFF;
-        for (char c : str) {
-            hash = crc32_table[(hash ^ static_cast<unsigned char>(c)) & 0xFF] ^ (hash >> 8);
+    bool hasOutput = info.Length() > 3 && !info[3].IsUndefined();
+    Napi::Uint8Array result;
+    if (hasOutput) {
+        if (!info[3].IsTypedArray() || info[3].As<Napi::TypedArray>().TypedArrayType() != napi_uint8_array) {
+            Napi::TypeError::New(env, "Output must be a Uint8Array").ThrowAsJavaScriptException();
+            return env.Null();
         }
-        hash ^= 0xFFFFFFFF;
-    } else if (algorithm == "sdbm") {
-        hash = 0;
-        for (char c : str) {
-            hash = static_cast<unsigned char>(c) + (hash << 6) + (hash << 16) - hash;
+        result = info[3].As<Napi::Uint8Array>();
+        if (result.ByteLength() < outputLength) {
+            Napi::RangeError::New(env, "Output array is too small").ThrowAsJavaScriptException();
+            return env.Null();
         }
     } else {
-        Napi::TypeError::New(env, "Unknown hash algorithm").ThrowAsJavaScriptException();
-        return env.Null();
+        result = Napi::Buffer<uint8_t>::New(env, outputLength);
     }
+    uint8_t* output = static_cast<uint8_t*>(result.ArrayBuffer().Data()) + result.ByteOffset();
     
-    return Napi::Number::New(env, static_cast<double>(hash));
-}
-
-/**
- * String validation and sanitization
- * @param info - CallbackInfo containing string and validation type
- * @returns Validation result or sanitized string
- */
-Napi::Value StringValidate(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    
-    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsString()) {
-        Napi::TypeError::New(env, "String and validation type required").ThrowAsJavaScriptException();
-        return env.Null();
+    // UTF-16 results for a caller's odd-aligned view go through a bounce buffer
+    std::vector<char16_t> bounce;
+    char16_t* unitOutput = reinterpret_cast<char16_t*>(output);
+    if (to == TextEncoding::Utf16LE && from != to && reinterpret_cast<uintptr_t>(output) % alignof(char16_t) != 0) {
+        bounce.resize(outputLength / 2);
+        unitOutput = bounce.data();
     }
     
-    std::string str = info[0].As<Napi::String>();
-    std::string validationType = info[1].As<Napi::String>();
-    
-    if (validationType == "utf8") {
-        // Validate UTF-8 encoding
-        bool isValid = true;
-        for (size_t i = 0; i < str.length(); ) {
-            unsigned char c = str[i];
-            
-            if (c < 0x80) {
-                i += 1;
-            } else if ((c >> 5) == 0x06) {
-                if (i + 1 >= str.length() || (str[i + 1] & 0xC0) != 0x80) {
-                    isValid = false;
-                    break;
-                }
-                i += 2;
-            } else if ((c >> 4) == 0x0E) {
-                if (i + 2 >= str.length() || 
-                    (str[i + 1] & 0xC0) != 0x80 || 
-                    (str[i + 2] & 0xC0) != 0x80) {
-                    isValid = false;
-                    break;
-                }
-                i += 3;
-            } else if ((c >> 3) == 0x1E) {
-                if (i + 3 >= str.length() || 
-                    (str[i + 1] & 0xC0) != 0x80 || 
-                    (str[i + 2] & 0xC0) != 0x80 || 
-                    (str[i + 3] & 0xC0) != 0x80) {
-                    isValid = false;
-                    break;
-                }
-                i += 4;
-            } else {
-                isValid = false;
-                break;
-            }
-        }
-        
-        return Napi::Boolean::New(env, isValid);
-    } else if (validationType == "ascii") {
-        bool isAscii = std::all_of(str.begin(), str.end(), [](unsigned char c) {
-            return c < 0x80;
-        });
-        return Napi::Boolean::New(env, isAscii);
-    } else if (validationType == "sanitize_html") {
-        // Basic HTML sanitization
-        std::string result = str;
-        
-        // Replace dangerous characters
-        size_t pos = 0;
-        while ((pos = result.find('<', pos)) != std::string::npos) {
-            result.replace(pos, 1, "&lt;");
-            pos += 4;
+    size_t written = 0;
+    const char* failure = nullptr;
+    if (from == to) {
+        if (from == TextEncoding::Utf8 && !IsValidUtf8(data, length)) {
+            failure = "Invalid UTF-8 input";
+        } else {
+            std::memmove(output, data, length);
+            written = length;
         }
-        
-        pos = 0;
-        while ((pos = result.find('>', pos)) != std::string::npos) {
-            result.replace(pos, 1, "&gt;");
-            pos += 4;
+    } else if (from == TextEncoding::Utf8) {
+        if (!IsValidUtf8(data, length)) {
+            failure = "Invalid UTF-8 input";
+        } else if (to == TextEncoding::Utf16LE) {
+            written = Utf8ToUtf16(data, length, unitOutput) * 2;
+        } else if ((written = Utf8ToLatin1(data, length, output)) == kTranscodeError) {
+            failure = "Input is not representable in Latin-1";
         }
-        
-        pos = 0;
-        while ((pos = result.find('&', pos)) != std::string::npos) {
-            if (result.substr(pos, 4) != "&lt;" && 
-                result.substr(pos, 4) != "&gt;" && 
-                result.substr(pos, 5) != "&amp;") {
-                result.replace(pos, 1, "&amp;");
-                pos += 5;
-            } else {
-                pos++;
-            }
+    } else if (from == TextEncoding::Utf16LE) {
+        written = to == TextEncoding::Utf8 ? Utf16ToUtf8(units, unitCount, output) : Utf16ToLatin1(units, unitCount, output);
+        if (written == kTranscodeError) {
+            failure = to == TextEncoding::Utf8 ? "Invalid UTF-16 input (unpaired surrogate)" : "Input is not representable in Latin-1";
         }
-        
-        return Napi::String::New(env, result);
+    } else {
+        written = to == TextEncoding::Utf8 ? Latin1ToUtf8(data, length, output) : Latin1ToUtf16(data, length, unitOutput) * 2;
+    }
+    if (failure) {
+        Napi::RangeError::New(env, failure).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (!bounce.empty()) {
+        std::memcpy(output, bounce.data(), written);
     }
     
-    Napi::TypeError::New(env, "Unknown validation type").ThrowAsJavaScriptException();
-    return env.Null();
+    if (hasOutput) {
+        return Napi::Number::New(env, static_cast<double>(written));
+    }
+    return result;
 }
 
 /**
- * Advanced string manipulation with regular expressions
- * @param info - CallbackInfo containing string, pattern, replacement
- * @returns Modified string
+ * Decodes a UTF-8 byte slice to a string. Valid input is transcoded with the
+ * SIMD kernels (ASCII becomes a one-byte string); malformed input falls back
+ * to the engine decoder, which substitutes U+FFFD.
+ * @param info - CallbackInfo containing buffer, optional offset and length
+ * @returns Decoded string
  */
-Napi::Value StringReplace(const Napi::CallbackInfo& info) {
+Napi::Value DecodeUtf8(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    if (info.Length() < 3 || !info[0].IsString() || !info[1].IsString() || !info[2].IsString()) {
-        Napi::TypeError::New(env, "String, pattern, and replacement required").ThrowAsJavaScriptException();
+    const uint8_t* data;
+    size_t length;
+    std::string storage;
+    if (!ToByteSlice(env, info, 0, 1, data, length, storage)) {
         return env.Null();
     }
     
-    std::string str = info[0].As<Napi::String>();
-    std::string pattern = info[1].As<Napi::String>();
-    std::string replacement = info[2].As<Napi::String>();
-    
-    // Simple string replacement (not regex for performance)
-    std::string result = str;
-    size_t pos = 0;
-    
-    while ((pos = result.find(pattern, pos)) != std::string::npos) {
-        result.replace(pos, pattern.length(), replacement);
-        pos += replacement.length();
+    if (asciiKernel(data, length)) {
+        napi_value value;
+        napi_create_string_latin1(env, reinterpret_cast<const char*>(data), length, &value);
+        return Napi::String(env, value);
     }
     
-    return Napi::String::New(env, result);
+    if (!IsValidUtf8(data, length)) {
+        return Napi::String::New(env, reinterpret_cast<const char*>(data), length);
+    }
+    size_t fourByteLeads;
+    size_t characters = utf8CountKernel(data, length, fourByteLeads);
+    std::vector<char16_t> units(characters + fourByteLeads);
+    size_t written = Utf8ToUtf16(data, length, units.data());
+    return Napi::String::New(env, units.data(), written);
 }
 
-}
\ No newline at end of file
+}
@@ -1,6 +1,16 @@
 #include "headers/lljs.h"
+#include "headers/handle_table.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 #ifdef _WIN32
 #ifndef WIN32_LEAN_AND_MEAN
 #define WIN32_LEAN_AND_MEAN
@@ -25,7 +35,21 @@
 #include <sys/types.h>
 #include <signal.h>
 #include <dirent.h>
+#include <fcntl.h>
 #include <fstream>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#ifdef __APPLE__
+#include <crt_externs.h>
+#define environ (*_NSGetEnviron())
+#else
+extern char** environ;
+#endif
+#endif
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
 #endif
 
 namespace LLJS::System {
@@ -318,4 +342,1107 @@ Napi::Value GetProcessList(const Napi::CallbackInfo& info) {
     return result;
 }
 
-}
\ No newline at end of file
+// Process table snapshots. A snapshot keeps the /proc directory fd, one
+// stat fd per process and its scratch buffers between reads, so each read
+// is a getdents64 pass plus one pread per process. In changedOnly mode only
+// processes that are new or whose counters moved since the previous read
+// are returned, along with the pids that exited.
+
+// One process as reported by a snapshot
+struct ProcessSample {
+    int32_t pid = 0;
+    int32_t ppid = 0;
+    uint8_t state = 0;      // Linux state letter ('R', 'S', ...), 0 where unknown
+    double userTime = 0;    // ms
+    double systemTime = 0;  // ms
+    double rss = 0;         // bytes
+    uint32_t threads = 0;
+    double startTime = 0;   // ms since boot (Linux) or since 1601 (Windows)
+    std::string name;
+};
+
+struct ProcessSnapshot {
+    struct Tracked {
+        int fd = -1;
+        uint64_t epoch = 0;
+        ProcessSample last;
+    };
+    
+    std::mutex mutex;
+    std::unordered_map<int32_t, Tracked> tracked;
+    uint64_t epoch = 0;
+    size_t maxOpenFiles = 0;
+    size_t openFiles = 0;
+#ifdef __linux__
+    int procFd = -1;
+    std::vector<char> dirBuffer = std::vector<char>(64 * 1024);
+    std::vector<char> statBuffer = std::vector<char>(4096);
+#endif
+    
+    ~ProcessSnapshot() {
+#ifdef __linux__
+        for (auto& entry : tracked) {
+            if (entry.second.fd >= 0) {
+                close(entry.second.fd);
+            }
+        }
+        if (procFd >= 0) {
+            close(procFd);
+        }
+#endif
+    }
+};
+
+static HandleTable<ProcessSnapshot> processSnapshots;
+
+#ifdef __linux__
+// Record layout returned by getdents64
+struct LinuxDirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+};
+
+/**
+ * Parses /proc/<pid>/stat. The command name may contain spaces and
+ * parentheses, so fields are counted from the last ')'.
+ * @param text - NUL-terminated file contents
+ * @param out - Receives the parsed fields
+ * @returns False if the text is truncated or malformed
+ */
+static bool ParseProcStat(const char* text, ProcessSample& out) {
+    static const double msPerTick = 1000.0 / static_cast<double>(sysconf(_SC_CLK_TCK));
+    static const double pageSize = static_cast<double>(sysconf(_SC_PAGESIZE));
+    
+    const char* open = std::strchr(text, '(');
+    const char* close = std::strrchr(text, ')');
+    if (!open || !close || close < open || close[1] != ' ' || close[2] == '\0') {
+        return false;
+    }
+    out.name.assign(open + 1, close);
+    out.state = static_cast<uint8_t>(close[2]);
+    
+    // Fields after the state, numbered from ppid = 1 up to rss = 21
+    long long fields[22];
+    const char* p = close + 3;
+    for (int i = 1; i <= 21; i++) {
+        char* end;
+        fields[i] = std::strtoll(p, &end, 10);
+        if (end == p) {
+            return false;
+        }
+        p = end;
+    }
+    out.ppid = static_cast<int32_t>(fields[1]);
+    out.userTime = static_cast<double>(fields[11]) * msPerTick;
+    out.systemTime = static_cast<double>(fields[12]) * msPerTick;
+    out.threads = static_cast<uint32_t>(fields[17]);
+    out.startTime = static_cast<double>(fields[19]) * msPerTick;
+    out.rss = static_cast<double>(fields[21]) * pageSize;
+    return true;
+}
+
+/**
+ * Reads one process through its cached stat fd, opening it when needed
+ * @param snapshot - Snapshot owning the fds
+ * @param pid - Process id
+ * @param tracked - Tracking entry of the process
+ * @param sample - Receives the parsed fields
+ * @returns False if the process is gone
+ */
+static bool ReadProcessStat(ProcessSnapshot& snapshot, int32_t pid, ProcessSnapshot::Tracked& tracked, ProcessSample& sample) {
+    char* buffer = snapshot.statBuffer.data();
+    size_t capacity = snapshot.statBuffer.size() - 1;
+    
+    // A cached fd of an exited process fails with ESRCH even if the pid was
+    // reused, so retry once with a fresh fd
+    for (int attempt = 0; attempt < 2; attempt++) {
+        bool cached = tracked.fd >= 0;
+        int fd = tracked.fd;
+        if (!cached) {
+            char path[32];
+            std::snprintf(path, sizeof(path), "%d/stat", pid);
+            fd = openat(snapshot.procFd, path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                return false;
+            }
+        }
+        
+        ssize_t length = pread(fd, buffer, capacity, 0);
+        bool keep = length > 0 && (cached || snapshot.openFiles < snapshot.maxOpenFiles);
+        if (!keep) {
+            close(fd);
+            if (cached) {
+                snapshot.openFiles--;
+            }
+            tracked.fd = -1;
+        } else if (!cached) {
+            tracked.fd = fd;
+            snapshot.openFiles++;
+        }
+        
+        if (length > 0) {
+            buffer[length] = '\0';
+            sample.pid = pid;
+            return ParseProcStat(buffer, sample);
+        }
+        if (!cached) {
+            return false;
+        }
+    }
+    return false;
+}
+
+/**
+ * Reads every process under /proc
+ * @param snapshot - Snapshot to update
+ * @param visit - Called with each process read this pass
+ * @returns False if /proc could not be listed
+ */
+template <typename Visit>
+static bool ScanProcesses(ProcessSnapshot& snapshot, const Visit& visit) {
+    if (lseek(snapshot.procFd, 0, SEEK_SET) < 0) {
+        return false;
+    }
+    for (;;) {
+        long bytes = syscall(SYS_getdents64, snapshot.procFd, snapshot.dirBuffer.data(), snapshot.dirBuffer.size());
+        if (bytes < 0) {
+            return false;
+        }
+        if (bytes == 0) {
+            return true;
+        }
+        for (long offset = 0; offset < bytes;) {
+            const LinuxDirent64* entry = reinterpret_cast<const LinuxDirent64*>(snapshot.dirBuffer.data() + offset);
+            offset += entry->d_reclen;
+            
+            const char* name = entry->d_name;
+            if (name[0] < '1' || name[0] > '9') {
+                continue;
+            }
+            char* end;
+            long pid = std::strtol(name, &end, 10);
+            if (*end != '\0') {
+                continue;
+            }
+            
+            ProcessSnapshot::Tracked& tracked = snapshot.tracked[static_cast<int32_t>(pid)];
+            ProcessSample sample;
+            if (ReadProcessStat(snapshot, static_cast<int32_t>(pid), tracked, sample)) {
+                visit(tracked, sample);
+            }
+        }
+    }
+}
+#elif defined(_WIN32)
+static inline double FileTimeToMilliseconds(const FILETIME& time) {
+    ULARGE_INTEGER value;
+    value.LowPart = time.dwLowDateTime;
+    value.HighPart = time.dwHighDateTime;
+    return static_cast<double>(value.QuadPart) / 10000.0;
+}
+
+/**
+ * Reads every process from one Toolhelp snapshot, adding times and working
+ * set where the process can be opened
+ * @param snapshot - Snapshot to update
+ * @param visit - Called with each process read this pass
+ * @returns False if the Toolhelp snapshot failed
+ */
+template <typename Visit>
+static bool ScanProcesses(ProcessSnapshot& snapshot, const Visit& visit) {
+    HANDLE toolhelp = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
+    if (toolhelp == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    PROCESSENTRY32 entry;
+    entry.dwSize = sizeof(entry);
+    for (BOOL more = Process32First(toolhelp, &entry); more; more = Process32Next(toolhelp, &entry)) {
+        ProcessSample sample;
+        sample.pid = static_cast<int32_t>(entry.th32ProcessID);
+        sample.ppid = static_cast<int32_t>(entry.th32ParentProcessID);
+        sample.threads = entry.cntThreads;
+        sample.name = entry.szExeFile;
+        
+        HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, entry.th32ProcessID);
+        if (process) {
+            FILETIME creation, exited, kernel, user;
+            if (GetProcessTimes(process, &creation, &exited, &kernel, &user)) {
+                sample.startTime = FileTimeToMilliseconds(creation);
+                sample.systemTime = FileTimeToMilliseconds(kernel);
+                sample.userTime = FileTimeToMilliseconds(user);
+            }
+            PROCESS_MEMORY_COUNTERS counters;
+            if (GetProcessMemoryInfo(process, &counters, sizeof(counters))) {
+                sample.rss = static_cast<double>(counters.WorkingSetSize);
+            }
+            CloseHandle(process);
+        }
+        visit(snapshot.tracked[sample.pid], sample);
+    }
+    CloseHandle(toolhelp);
+    return true;
+}
+#endif
+
+/**
+ * Creates a process table snapshot
+ * @param info - CallbackInfo containing optional { maxOpenFiles }: stat fds
+ *               kept open between reads (Linux; default half the fd limit, at most 16384)
+ * @returns Snapshot handle; released on close or garbage collection
+ */
+Napi::Value CreateProcessSnapshot(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+#if defined(__linux__) || defined(_WIN32)
+    auto snapshot = std::make_shared<ProcessSnapshot>();
+#ifdef __linux__
+    struct rlimit limit;
+    snapshot->maxOpenFiles = getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY
+        ? std::min<size_t>(static_cast<size_t>(limit.rlim_cur) / 2, 16384)
+        : 16384;
+#endif
+    if (info.Length() > 0 && info[0].IsObject()) {
+        Napi::Value maxOpenFiles = info[0].As<Napi::Object>().Get("maxOpenFiles");
+        if (maxOpenFiles.IsNumber()) {
+            snapshot->maxOpenFiles = static_cast<size_t>(std::max(0.0, maxOpenFiles.As<Napi::Number>().DoubleValue()));
+        }
+    }
+#ifdef __linux__
+    snapshot->procFd = open("/proc", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (snapshot->procFd < 0) {
+        Napi::Error::New(env, std::string("Failed to open /proc: ") + std::strerror(errno)).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+#endif
+    
+    uint64_t snapshotId = processSnapshots.Insert(snapshot);
+    if (snapshotId == 0) {
+        Napi::Error::New(env, "Too many process snapshot handles").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object handle = Napi::Object::New(env);
+    handle.Set("id", Napi::Number::New(env, static_cast<double>(snapshotId)));
+    // Dropping the handle closes the cached fds
+    handle.Set("handle", Napi::External<void>::New(env, nullptr, [snapshotId](Napi::Env, void*) {
+        processSnapshots.Remove(snapshotId);
+    }));
+    return handle;
+#else
+    Napi::Error::New(env, "Process snapshots require Linux /proc or Windows").ThrowAsJavaScriptException();
+    return env.Null();
+#endif
+}
+
+/**
+ * Resolves a snapshot handle; throws on failure
+ * @returns Snapshot, or null
+ */
+static std::shared_ptr<ProcessSnapshot> ToProcessSnapshot(Napi::Env env, const Napi::Value& value) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "Process snapshot handle object required").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    Napi::Value id = value.As<Napi::Object>().Get("id");
+    std::shared_ptr<ProcessSnapshot> snapshot = id.IsNumber()
+        ? processSnapshots.Get(static_cast<uint64_t>(id.As<Napi::Number>().DoubleValue()))
+        : nullptr;
+    if (!snapshot) {
+        Napi::Error::New(env, "Invalid process snapshot handle").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    return snapshot;
+}
+
+/**
+ * Reads the process table into columns
+ * @param info - CallbackInfo containing snapshot handle and optional
+ *               { changedOnly, names }; names defaults to true
+ * @returns { count, pid, ppid, state, userTime, systemTime, rss, threads,
+ *            startTime, names?, removed } with one TypedArray per column
+ */
+Napi::Value ReadProcessSnapshot(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<ProcessSnapshot> snapshot = ToProcessSnapshot(env, info[0]);
+    if (!snapshot) {
+        return env.Null();
+    }
+    bool changedOnly = false;
+    bool withNames = true;
+    if (info.Length() > 1 && info[1].IsObject()) {
+        Napi::Object options = info[1].As<Napi::Object>();
+        if (options.Get("changedOnly").IsBoolean()) {
+            changedOnly = options.Get("changedOnly").As<Napi::Boolean>();
+        }
+        if (options.Get("names").IsBoolean()) {
+            withNames = options.Get("names").As<Napi::Boolean>();
+        }
+    }
+    
+    std::vector<ProcessSample> rows;
+    std::vector<int32_t> removed;
+    {
+        std::lock_guard<std::mutex> lock(snapshot->mutex);
+        uint64_t epoch = ++snapshot->epoch;
+        rows.reserve(snapshot->tracked.size());
+        
+        bool scanned = ScanProcesses(*snapshot, [&](ProcessSnapshot::Tracked& tracked, ProcessSample& sample) {
+            const ProcessSample& last = tracked.last;
+            bool changed = tracked.epoch == 0 || last.startTime != sample.startTime ||
+                last.state != sample.state || last.userTime != sample.userTime ||
+                last.systemTime != sample.systemTime || last.rss != sample.rss ||
+                last.threads != sample.threads || last.ppid != sample.ppid;
+            tracked.epoch = epoch;
+            if (!changedOnly || changed) {
+                rows.push_back(sample);
+            }
+            tracked.last = std::move(sample);
+        });
+        if (!scanned) {
+            Napi::Error::New(env, std::string("Failed to read the process table: ") + std::strerror(errno)).ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        
+        // Entries not seen this pass have exited (or could not be read)
+        for (auto it = snapshot->tracked.begin(); it != snapshot->tracked.end();) {
+            if (it->second.epoch != epoch) {
+                if (it->second.epoch != 0) {
+                    removed.push_back(it->first);
+                }
+#ifdef __linux__
+                if (it->second.fd >= 0) {
+                    close(it->second.fd);
+                    snapshot->openFiles--;
+                }
+#endif
+                it = snapshot->tracked.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    
+    size_t count = rows.size();
+    Napi::Int32Array pid = Napi::Int32Array::New(env, count);
+    Napi::Int32Array ppid = Napi::Int32Array::New(env, count);
+    Napi::Uint8Array state = Napi::Uint8Array::New(env, count);
+    Napi::Float64Array userTime = Napi::Float64Array::New(env, count);
+    Napi::Float64Array systemTime = Napi::Float64Array::New(env, count);
+    Napi::Float64Array rss = Napi::Float64Array::New(env, count);
+    Napi::Uint32Array threads = Napi::Uint32Array::New(env, count);
+    Napi::Float64Array startTime = Napi::Float64Array::New(env, count);
+    for (size_t i = 0; i < count; i++) {
+        const ProcessSample& row = rows[i];
+        pid[i] = row.pid;
+        ppid[i] = row.ppid;
+        state[i] = row.state;
+        userTime[i] = row.userTime;
+        systemTime[i] = row.systemTime;
+        rss[i] = row.rss;
+        threads[i] = row.threads;
+        startTime[i] = row.startTime;
+    }
+    Napi::Int32Array removedPids = Napi::Int32Array::New(env, removed.size());
+    if (!removed.empty()) {
+        std::memcpy(removedPids.Data(), removed.data(), removed.size() * sizeof(int32_t));
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("count", Napi::Number::New(env, static_cast<double>(count)));
+    result.Set("pid", pid);
+    result.Set("ppid", ppid);
+    result.Set("state", state);
+    result.Set("userTime", userTime);
+    result.Set("systemTime", systemTime);
+    result.Set("rss", rss);
+    result.Set("threads", threads);
+    result.Set("startTime", startTime);
+    if (withNames) {
+        Napi::Array names = Napi::Array::New(env, count);
+        for (size_t i = 0; i < count; i++) {
+            names.Set(static_cast<uint32_t>(i), Napi::String::New(env, rows[i].name));
+        }
+        result.Set("names", names);
+    }
+    result.Set("removed", removedPids);
+    return result;
+}
+
+/**
+ * Releases a snapshot's fds before garbage collection would
+ * @param info - CallbackInfo containing snapshot handle
+ * @returns Success status
+ */
+Napi::Value DestroyProcessSnapshot(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!ToProcessSnapshot(env, info[0])) {
+        return Napi::Boolean::New(env, false);
+    }
+    uint64_t id = static_cast<uint64_t>(info[0].As<Napi::Object>().Get("id").As<Napi::Number>().DoubleValue());
+    return Napi::Boolean::New(env, processSnapshots.Remove(id) != nullptr);
+}
+
+#ifndef _WIN32
+// Child processes started with posix_spawn. glibc implements it with
+// clone(CLONE_VM | CLONE_VFORK), so the parent's page tables are never
+// copied however large the heap is, and argv is passed straight to exec
+// with no shell. One monitor thread polls every child's stdout/stderr
+// pipes and pidfd (Linux 5.3+; elsewhere exits are polled with WNOHANG)
+// and queues output and exit events per environment. Each batch of events
+// reaches JS in one ThreadSafeFunction call. Reads land in pooled 64 KB
+// chunks: a large read is handed to JS as a Buffer over the chunk, which
+// goes back to the pool when the Buffer is collected; a small read is
+// copied so it does not pin a whole chunk.
+
+static constexpr size_t kSpawnChunkSize = 64 * 1024;
+static constexpr size_t kSpawnCopyBelow = 4096;
+static constexpr size_t kSpawnPooledChunks = 256;
+static constexpr int kSpawnExitPollMs = 10;
+// Exit status of a child reaped elsewhere (waitpid failed with ECHILD)
+static constexpr int kSpawnStatusUnknown = -1;
+
+/**
+ * Free list of output chunks shared by every child
+ */
+class SpawnChunkPool {
+public:
+    static SpawnChunkPool& Instance() {
+        static SpawnChunkPool* pool = new SpawnChunkPool();
+        return *pool;
+    }
+    
+    uint8_t* Acquire() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!chunks.empty()) {
+                uint8_t* chunk = chunks.back();
+                chunks.pop_back();
+                return chunk;
+            }
+        }
+        return new uint8_t[kSpawnChunkSize];
+    }
+    
+    void Release(uint8_t* chunk) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (chunks.size() < kSpawnPooledChunks) {
+                chunks.push_back(chunk);
+                return;
+            }
+        }
+        delete[] chunk;
+    }
+    
+private:
+    std::mutex mutex;
+    std::vector<uint8_t*> chunks;
+};
+
+enum class SpawnEventKind { Stdout, Stderr, Exit };
+
+struct SpawnEvent {
+    uint64_t child = 0;
+    SpawnEventKind kind = SpawnEventKind::Exit;
+    uint8_t* chunk = nullptr;
+    size_t length = 0;
+    int status = 0;
+};
+
+// JS side of a child; lives in its dispatcher until the exit is delivered
+struct SpawnCallbacks {
+    explicit SpawnCallbacks(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+    
+    Napi::FunctionReference onStdout;
+    Napi::FunctionReference onStderr;
+    Napi::Promise::Deferred deferred;
+};
+
+// Per-environment delivery state; freed by the ThreadSafeFunction finalizer
+struct SpawnDispatcher {
+    Napi::ThreadSafeFunction tsfn;
+    std::mutex mutex;
+    std::vector<SpawnEvent> ready;
+    bool posted = false;
+    
+    // JS thread only
+    std::unordered_map<uint64_t, std::unique_ptr<SpawnCallbacks>> children;
+};
+
+static void DrainSpawnEvents(Napi::Env env, SpawnDispatcher* dispatcher);
+
+/**
+ * Queues an event and posts a drain unless one is already pending
+ * @param dispatcher - Target environment
+ * @param event - Event to deliver
+ */
+static void PostSpawnEvent(SpawnDispatcher* dispatcher, const SpawnEvent& event) {
+    {
+        std::lock_guard<std::mutex> lock(dispatcher->mutex);
+        dispatcher->ready.push_back(event);
+        if (dispatcher->posted) {
+            return;
+        }
+        dispatcher->posted = true;
+    }
+    dispatcher->tsfn.NonBlockingCall(dispatcher, [](Napi::Env env, Napi::Function, SpawnDispatcher* target) {
+        DrainSpawnEvents(env, target);
+    });
+}
+
+// A running child as seen by the monitor thread
+struct SpawnedChild {
+    uint64_t id = 0;
+    pid_t pid = -1;
+    int fds[2] = {-1, -1}; // stdout, stderr read ends
+    int pidFd = -1;
+    bool exited = false;
+    int status = 0;
+    SpawnDispatcher* dispatcher = nullptr; // null once the environment is gone
+};
+
+class SpawnMonitor {
+public:
+    // Never destroyed: the monitor thread keeps running through static teardown
+    static SpawnMonitor& Instance() {
+        static SpawnMonitor* monitor = new SpawnMonitor();
+        return *monitor;
+    }
+    
+    /**
+     * Starts watching a child
+     * @param child - Child with its pipes and pidfd set
+     */
+    void Add(std::unique_ptr<SpawnedChild> child) {
+        std::lock_guard<std::mutex> lock(mutex);
+        children.push_back(std::move(child));
+        Wake();
+    }
+    
+    /**
+     * Signals a child unless it has been reaped; reaping happens under the
+     * same lock, so the pid cannot have been reused by another process
+     * @param id - Spawn id
+     * @param signal - Signal number
+     * @returns True if the signal was sent
+     */
+    bool Signal(uint64_t id, int signal) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& child : children) {
+            if (child->id == id) {
+                return !child->exited && kill(child->pid, signal) == 0;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * Stops delivering to an environment that is being torn down
+     * @param dispatcher - Dispatcher about to be freed
+     */
+    void Detach(SpawnDispatcher* dispatcher) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& child : children) {
+            if (child->dispatcher == dispatcher) {
+                child->dispatcher = nullptr;
+            }
+        }
+    }
+    
+private:
+    SpawnMonitor() {
+        if (pipe(wakeFds) == 0) {
+            for (int fd : wakeFds) {
+                fcntl(fd, F_SETFD, FD_CLOEXEC);
+                fcntl(fd, F_SETFL, O_NONBLOCK);
+            }
+        }
+        std::thread([this]() { Run(); }).detach();
+    }
+    
+    void Wake() {
+        char byte = 0;
+        ssize_t ignored = write(wakeFds[1], &byte, 1);
+        (void)ignored;
+    }
+    
+    /**
+     * Reads what a pipe has ready and queues it
+     * @returns False at end of file
+     */
+    bool ReadPipe(SpawnedChild& child, int stream) {
+        SpawnChunkPool& pool = SpawnChunkPool::Instance();
+        for (;;) {
+            uint8_t* chunk = pool.Acquire();
+            ssize_t length = read(child.fds[stream], chunk, kSpawnChunkSize);
+            if (length <= 0) {
+                pool.Release(chunk);
+                return length < 0 && (errno == EAGAIN || errno == EINTR);
+            }
+            if (child.dispatcher) {
+                SpawnEvent event;
+                event.child = child.id;
+                event.kind = stream == 0 ? SpawnEventKind::Stdout : SpawnEventKind::Stderr;
+                event.chunk = chunk;
+                event.length = static_cast<size_t>(length);
+                PostSpawnEvent(child.dispatcher, event);
+            } else {
+                pool.Release(chunk);
+            }
+            if (static_cast<size_t>(length) < kSpawnChunkSize) {
+                return true;
+            }
+        }
+    }
+    
+    void Run() {
+        std::vector<pollfd> polls;
+        std::vector<std::pair<SpawnedChild*, int>> owners; // child and slot (0/1 pipe, 2 pidfd) per pollfd
+        for (;;) {
+            polls.clear();
+            owners.clear();
+            polls.push_back({wakeFds[0], POLLIN, 0});
+            owners.emplace_back(nullptr, -1);
+            bool pollExits = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (auto& child : children) {
+                    for (int stream = 0; stream < 2; stream++) {
+                        if (child->fds[stream] >= 0) {
+                            polls.push_back({child->fds[stream], POLLIN, 0});
+                            owners.emplace_back(child.get(), stream);
+                        }
+                    }
+                    if (!child->exited) {
+                        if (child->pidFd >= 0) {
+                            polls.push_back({child->pidFd, POLLIN, 0});
+                            owners.emplace_back(child.get(), 2);
+                        } else {
+                            pollExits = true;
+                        }
+                    }
+                }
+            }
+            
+            if (poll(polls.data(), polls.size(), pollExits ? kSpawnExitPollMs : -1) < 0 && errno != EINTR) {
+                continue;
+            }
+            
+            std::lock_guard<std::mutex> lock(mutex);
+            if (polls[0].revents) {
+                char drain[64];
+                while (read(wakeFds[0], drain, sizeof(drain)) > 0) {}
+            }
+            for (size_t i = 1; i < polls.size(); i++) {
+                if (!polls[i].revents) {
+                    continue;
+                }
+                SpawnedChild& child = *owners[i].first;
+                int slot = owners[i].second;
+                if (slot < 2 && !ReadPipe(child, slot)) {
+                    close(child.fds[slot]);
+                    child.fds[slot] = -1;
+                }
+            }
+            
+            // Reap exited children; the exit is delivered after the last output
+            for (auto it = children.begin(); it != children.end();) {
+                SpawnedChild& child = **it;
+                if (!child.exited) {
+                    int status = 0;
+                    pid_t reaped = waitpid(child.pid, &status, WNOHANG);
+                    if (reaped == child.pid) {
+                        child.exited = true;
+                        child.status = status;
+                    } else if (reaped < 0 && errno == ECHILD) {
+                        child.exited = true;
+                        child.status = kSpawnStatusUnknown;
+                    }
+                }
+                if (child.exited && child.fds[0] < 0 && child.fds[1] < 0) {
+                    if (child.dispatcher) {
+                        SpawnEvent event;
+                        event.child = child.id;
+                        event.kind = SpawnEventKind::Exit;
+                        event.status = child.status;
+                        PostSpawnEvent(child.dispatcher, event);
+                    }
+                    if (child.pidFd >= 0) {
+                        close(child.pidFd);
+                    }
+                    it = children.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+    }
+    
+    std::mutex mutex;
+    std::vector<std::unique_ptr<SpawnedChild>> children;
+    int wakeFds[2] = {-1, -1};
+};
+
+static std::mutex spawnDispatcherMutex;
+static std::unordered_map<napi_env, SpawnDispatcher*> spawnDispatchers;
+static std::atomic<uint64_t> spawnCounter{0};
+
+/**
+ * Gets the spawn dispatcher of an environment, creating it on first use
+ * @param env - N-API environment
+ * @returns Dispatcher
+ */
+static SpawnDispatcher* GetSpawnDispatcher(Napi::Env env) {
+    std::lock_guard<std::mutex> lock(spawnDispatcherMutex);
+    auto it = spawnDispatchers.find(env);
+    if (it != spawnDispatchers.end()) {
+        return it->second;
+    }
+    
+    SpawnDispatcher* dispatcher = new SpawnDispatcher();
+    dispatcher->tsfn = Napi::ThreadSafeFunction::New(env, Napi::Function(), "lljsSpawn", 0, 1,
+        [dispatcher, key = static_cast<napi_env>(env)](Napi::Env) {
+            SpawnMonitor::Instance().Detach(dispatcher);
+            {
+                std::lock_guard<std::mutex> guard(spawnDispatcherMutex);
+                spawnDispatchers.erase(key);
+            }
+            for (SpawnEvent& event : dispatcher->ready) {
+                if (event.chunk) {
+                    SpawnChunkPool::Instance().Release(event.chunk);
+                }
+            }
+            delete dispatcher;
+        });
+    // Only running children keep the event loop alive
+    dispatcher->tsfn.Unref(env);
+    spawnDispatchers[env] = dispatcher;
+    return dispatcher;
+}
+
+/**
+ * Wraps a read as a Buffer; small reads are copied and their chunk recycled
+ * @param env - N-API environment
+ * @param event - Output event owning a chunk
+ * @returns Buffer with the output
+ */
+static Napi::Buffer<uint8_t> SpawnChunkBuffer(Napi::Env env, const SpawnEvent& event) {
+    if (event.length < kSpawnCopyBelow) {
+        Napi::Buffer<uint8_t> copy = Napi::Buffer<uint8_t>::Copy(env, event.chunk, event.length);
+        SpawnChunkPool::Instance().Release(event.chunk);
+        return copy;
+    }
+    Napi::MemoryManagement::AdjustExternalMemory(env, static_cast<int64_t>(kSpawnChunkSize));
+    return Napi::Buffer<uint8_t>::New(env, event.chunk, event.length, [](Napi::Env env, uint8_t* chunk) {
+        Napi::MemoryManagement::AdjustExternalMemory(env, -static_cast<int64_t>(kSpawnChunkSize));
+        SpawnChunkPool::Instance().Release(chunk);
+    });
+}
+
+/**
+ * Delivers queued output and exits; executes on the JS thread
+ * @param env - N-API environment
+ * @param dispatcher - Dispatcher whose queue is drained
+ */
+static void DrainSpawnEvents(Napi::Env env, SpawnDispatcher* dispatcher) {
+    std::vector<SpawnEvent> ready;
+    {
+        std::lock_guard<std::mutex> lock(dispatcher->mutex);
+        ready.swap(dispatcher->ready);
+        dispatcher->posted = false;
+    }
+    
+    for (size_t i = 0; i < ready.size(); i++) {
+        const SpawnEvent& event = ready[i];
+        auto it = dispatcher->children.find(event.child);
+        if (it == dispatcher->children.end()) {
+            if (event.chunk) {
+                SpawnChunkPool::Instance().Release(event.chunk);
+            }
+            continue;
+        }
+        SpawnCallbacks& callbacks = *it->second;
+        
+        if (event.kind == SpawnEventKind::Exit) {
+            Napi::Object result = Napi::Object::New(env);
+            bool known = event.status != kSpawnStatusUnknown;
+            result.Set("code", known && WIFEXITED(event.status) ? Napi::Value(Napi::Number::New(env, WEXITSTATUS(event.status))) : env.Null());
+            result.Set("signal", known && WIFSIGNALED(event.status) ? Napi::Value(Napi::Number::New(env, WTERMSIG(event.status))) : env.Null());
+            callbacks.deferred.Resolve(result);
+            dispatcher->children.erase(it);
+            if (dispatcher->children.empty()) {
+                dispatcher->tsfn.Unref(env);
+            }
+            continue;
+        }
+        
+        Napi::Buffer<uint8_t> chunk = SpawnChunkBuffer(env, event);
+        Napi::FunctionReference& callback = event.kind == SpawnEventKind::Stdout ? callbacks.onStdout : callbacks.onStderr;
+        if (!callback.IsEmpty()) {
+            callback.Call({chunk});
+        }
+        if (env.IsExceptionPending()) {
+            // Let the exception surface as uncaught and deliver the rest in a fresh call
+            std::lock_guard<std::mutex> lock(dispatcher->mutex);
+            dispatcher->ready.insert(dispatcher->ready.begin(), ready.begin() + i + 1, ready.end());
+            if (!dispatcher->ready.empty() && !dispatcher->posted) {
+                dispatcher->posted = true;
+                dispatcher->tsfn.NonBlockingCall(dispatcher, [](Napi::Env env, Napi::Function, SpawnDispatcher* target) {
+                    DrainSpawnEvents(env, target);
+                });
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * Reads a stdio option
+ * @param options - Options object
+ * @param key - "stdin", "stdout" or "stderr"
+ * @param fallback - Default mode
+ * @param mode - Receives "pipe", "ignore" or "inherit"
+ * @returns False for an unknown mode
+ */
+static bool ToStdioMode(const Napi::Object& options, const char* key, const char* fallback, std::string& mode) {
+    Napi::Value value = options.Get(key);
+    mode = value.IsString() ? value.As<Napi::String>().Utf8Value() : std::string(fallback);
+    return mode == "pipe" || mode == "ignore" || mode == "inherit";
+}
+
+/**
+ * Makes a pipe whose ends are close-on-exec, the read end non-blocking
+ * @param fds - Receives read and write ends
+ * @returns False on failure
+ */
+static bool MakeOutputPipe(int fds[2]) {
+#ifdef __linux__
+    if (pipe2(fds, O_CLOEXEC) != 0) {
+        return false;
+    }
+#else
+    if (pipe(fds) != 0) {
+        return false;
+    }
+    fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+#endif
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+    return true;
+}
+#endif
+
+/**
+ * Spawns a process without a shell through posix_spawn
+ * @param info - CallbackInfo containing file, argv array (without argv[0]) and
+ *               options { cwd, env, stdin, stdout, stderr, onStdout, onStderr };
+ *               stdin defaults to "ignore", stdout and stderr to "pipe"
+ * @returns { id, pid, exited } where exited resolves to { code, signal }
+ */
+Napi::Value SpawnProcess(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+#ifdef _WIN32
+    Napi::Error::New(env, "spawn requires posix_spawn; use createProcess on Windows").ThrowAsJavaScriptException();
+    return env.Null();
+#else
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "File parameter required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    std::string file = info[0].As<Napi::String>();
+    
+    std::vector<std::string> args{file};
+    if (info.Length() > 1 && info[1].IsArray()) {
+        Napi::Array array = info[1].As<Napi::Array>();
+        for (uint32_t i = 0; i < array.Length(); i++) {
+            Napi::Value arg = array.Get(i);
+            if (!arg.IsString()) {
+                Napi::TypeError::New(env, "Arguments must be strings").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+            args.push_back(arg.As<Napi::String>());
+        }
+    }
+    
+    Napi::Object options = info.Length() > 2 && info[2].IsObject() ? info[2].As<Napi::Object>() : Napi::Object::New(env);
+    std::string modes[3];
+    if (!ToStdioMode(options, "stdin", "ignore", modes[0]) || modes[0] == "pipe" ||
+        !ToStdioMode(options, "stdout", "pipe", modes[1]) ||
+        !ToStdioMode(options, "stderr", "pipe", modes[2])) {
+        Napi::TypeError::New(env, "stdin must be 'ignore' or 'inherit'; stdout and stderr 'pipe', 'ignore' or 'inherit'").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::vector<std::string> environment;
+    Napi::Value envValue = options.Get("env");
+    if (envValue.IsObject()) {
+        Napi::Object object = envValue.As<Napi::Object>();
+        Napi::Array keys = object.GetPropertyNames();
+        for (uint32_t i = 0; i < keys.Length(); i++) {
+            std::string key = keys.Get(i).As<Napi::String>();
+            Napi::Value value = object.Get(key);
+            if (!value.IsUndefined()) {
+                environment.push_back(key + "=" + value.ToString().Utf8Value());
+            }
+        }
+    }
+    
+    std::string cwd;
+    Napi::Value cwdValue = options.Get("cwd");
+    if (cwdValue.IsString()) {
+        cwd = cwdValue.As<Napi::String>();
+#if !(defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))) && !defined(__APPLE__)
+        Napi::Error::New(env, "cwd requires posix_spawn_file_actions_addchdir_np").ThrowAsJavaScriptException();
+        return env.Null();
+#endif
+    }
+    
+    std::vector<char*> argv;
+    for (std::string& arg : args) {
+        argv.push_back(&arg[0]);
+    }
+    argv.push_back(nullptr);
+    std::vector<char*> envp;
+    for (std::string& entry : environment) {
+        envp.push_back(&entry[0]);
+    }
+    envp.push_back(nullptr);
+    
+    int pipes[2][2] = {{-1, -1}, {-1, -1}};
+    auto closePipes = [&pipes]() {
+        for (auto& ends : pipes) {
+            for (int& fd : ends) {
+                if (fd >= 0) {
+                    close(fd);
+                    fd = -1;
+                }
+            }
+        }
+    };
+    
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if (modes[0] == "ignore") {
+        posix_spawn_file_actions_addopen(&actions, 0, "/dev/null", O_RDONLY, 0);
+    }
+    for (int stream = 0; stream < 2; stream++) {
+        const std::string& mode = modes[stream + 1];
+        int target = stream + 1;
+        if (mode == "pipe") {
+            if (!MakeOutputPipe(pipes[stream])) {
+                posix_spawn_file_actions_destroy(&actions);
+                closePipes();
+                Napi::Error::New(env, std::string("Failed to create pipe: ") + std::strerror(errno)).ThrowAsJavaScriptException();
+                return env.Null();
+            }
+            // dup2 clears close-on-exec on the target; the original ends close at exec
+            posix_spawn_file_actions_adddup2(&actions, pipes[stream][1], target);
+        } else if (mode == "ignore") {
+            posix_spawn_file_actions_addopen(&actions, target, "/dev/null", O_WRONLY, 0);
+        }
+    }
+#if (defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))) || defined(__APPLE__)
+    if (!cwd.empty()) {
+        posix_spawn_file_actions_addchdir_np(&actions, cwd.c_str());
+    }
+#endif
+    
+    // Node ignores SIGPIPE and SIGXFSZ; restore the defaults so pipelines end by signal
+    posix_spawnattr_t attributes;
+    posix_spawnattr_init(&attributes);
+    sigset_t defaults;
+    sigemptyset(&defaults);
+    sigaddset(&defaults, SIGPIPE);
+    sigaddset(&defaults, SIGXFSZ);
+    posix_spawnattr_setsigdefault(&attributes, &defaults);
+    sigset_t mask;
+    sigemptyset(&mask);
+    posix_spawnattr_setsigmask(&attributes, &mask);
+    short flags = POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK;
+#ifdef POSIX_SPAWN_USEVFORK
+    flags |= POSIX_SPAWN_USEVFORK;
+#endif
+    posix_spawnattr_setflags(&attributes, flags);
+    
+    pid_t pid = -1;
+    int error = posix_spawnp(&pid, file.c_str(), &actions, &attributes, argv.data(),
+                             envValue.IsObject() ? envp.data() : environ);
+    posix_spawnattr_destroy(&attributes);
+    posix_spawn_file_actions_destroy(&actions);
+    for (auto& ends : pipes) {
+        if (ends[1] >= 0) {
+            close(ends[1]);
+            ends[1] = -1;
+        }
+    }
+    if (error != 0) {
+        closePipes();
+        Napi::Error::New(env, "Failed to spawn '" + file + "': " + std::strerror(error)).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    SpawnDispatcher* dispatcher = GetSpawnDispatcher(env);
+    auto child = std::make_unique<SpawnedChild>();
+    child->id = ++spawnCounter;
+    child->pid = pid;
+    child->fds[0] = pipes[0][0];
+    child->fds[1] = pipes[1][0];
+    child->dispatcher = dispatcher;
+#if defined(__linux__) && defined(SYS_pidfd_open)
+    child->pidFd = static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#endif
+    
+    auto callbacks = std::make_unique<SpawnCallbacks>(env);
+    Napi::Value onStdout = options.Get("onStdout");
+    Napi::Value onStderr = options.Get("onStderr");
+    if (onStdout.IsFunction()) {
+        callbacks->onStdout = Napi::Persistent(onStdout.As<Napi::Function>());
+    }
+    if (onStderr.IsFunction()) {
+        callbacks->onStderr = Napi::Persistent(onStderr.As<Napi::Function>());
+    }
+    Napi::Promise exited = callbacks->deferred.Promise();
+    if (dispatcher->children.empty()) {
+        dispatcher->tsfn.Ref(env);
+    }
+    dispatcher->children[child->id] = std::move(callbacks);
+    uint64_t id = child->id;
+    SpawnMonitor::Instance().Add(std::move(child));
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("id", Napi::Number::New(env, static_cast<double>(id)));
+    result.Set("pid", Napi::Number::New(env, pid));
+    result.Set("exited", exited);
+    return result;
+#endif
+}
+
+/**
+ * Signals a spawned process while it is still unreaped
+ * @param info - CallbackInfo containing spawn id and signal (default SIGTERM)
+ * @returns False once the process has exited
+ */
+Napi::Value KillSpawnedProcess(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        Napi::TypeError::New(env, "Spawn ID parameter required").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+#ifdef _WIN32
+    return Napi::Boolean::New(env, false);
+#else
+    uint64_t id = static_cast<uint64_t>(info[0].As<Napi::Number>().Int64Value());
+    int signal = info.Length() > 1 && info[1].IsNumber() ? info[1].As<Napi::Number>().Int32Value() : SIGTERM;
+    return Napi::Boolean::New(env, SpawnMonitor::Instance().Signal(id, signal));
+#endif
+}
+
+}
@@ -1,17 +1,26 @@
 #include "headers/lljs.h"
+#include "headers/thread_pool.h"
+#include "headers/handle_table.h"
+#include "headers/simd.h"
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
-#include <map>
+#include <cerrno>
 #include <memory>
 #include <functional>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <string>
 #ifdef _WIN32
 #ifndef WIN32_LEAN_AND_MEAN
 #define WIN32_LEAN_AND_MEAN
 #endif
 #include <windows.h>
 #include <process.h>
+#pragma comment(lib, "Synchronization.lib") // WaitOnAddress
 #else
 #include <pthread.h>
 #include <semaphore.h>
@@ -19,15 +28,13 @@
 #include <sys/syscall.h>
 #include <sched.h>
 #include <fcntl.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#endif
 #endif
 
 namespace LLJS::Threading {
 
-// Global counters for handle management
-static std::atomic<uint64_t> threadCounter{0};
-static std::atomic<uint64_t> mutexCounter{0};
-static std::atomic<uint64_t> semaphoreCounter{0};
-
 // Thread management structures
 struct ThreadInfo {
     std::unique_ptr<std::thread> thread;
@@ -44,25 +51,88 @@ struct MutexInfo {
     uint64_t id;
     bool isRecursive{false};
     bool isTimed{false};
+    // Thread holding the mutex through LockMutex and its recursion depth;
+    // depth is only touched while the mutex is held
+    std::atomic<std::thread::id> owner{};
+    int depth{0};
+    // Set by DestroyMutex while it holds the lock; late lockers back out
+    std::atomic<bool> destroyed{false};
 };
 
+/**
+ * Tries to take a mutex without waiting
+ * @param mutex - Mutex to lock
+ * @returns True if it was free and is now held
+ */
+static bool TryLockMutexInfo(MutexInfo& mutex) {
+    if (mutex.isRecursive && mutex.recursiveTimedMutex) {
+        return mutex.recursiveTimedMutex->try_lock();
+    }
+    return mutex.timedMutex && mutex.timedMutex->try_lock();
+}
+
+/**
+ * Releases a mutex taken with TryLockMutex or LockMutex
+ * @param mutex - Held mutex
+ */
+static void UnlockMutexInfo(MutexInfo& mutex) {
+    if (mutex.isRecursive && mutex.recursiveTimedMutex) {
+        mutex.recursiveTimedMutex->unlock();
+    } else if (mutex.timedMutex) {
+        mutex.timedMutex->unlock();
+    }
+}
+
 struct SemaphoreInfo {
     #ifdef _WIN32
-    HANDLE semaphore;
+    HANDLE semaphore = NULL;
     #else
-    sem_t* semaphore;
+    sem_t* semaphore = SEM_FAILED;
     char semName[64];
     #endif
     uint64_t id;
     int maxCount;
     std::atomic<int> currentCount;
+
+    ~SemaphoreInfo() {
+        #ifdef _WIN32
+        if (semaphore != NULL) {
+            CloseHandle(semaphore);
+        }
+        #else
+        if (semaphore != SEM_FAILED) {
+            sem_close(semaphore);
+        }
+        #endif
+    }
 };
 
-// Global storage for handles
-static std::map<uint64_t, std::unique_ptr<ThreadInfo>> threads;
-static std::map<uint64_t, std::unique_ptr<MutexInfo>> mutexes;
-static std::map<uint64_t, std::unique_ptr<SemaphoreInfo>> semaphores;
-static std::mutex globalMutex;
+// Handle tables. Lookups copy a shared_ptr under a short shard lock, so
+// blocking waits and joins never hold a table lock, and an object stays
+// alive until the last in-flight call on it returns.
+static HandleTable<ThreadInfo> threads;
+static HandleTable<MutexInfo> mutexes;
+static HandleTable<SemaphoreInfo> semaphores;
+
+// Unique suffix for POSIX semaphore names
+static std::atomic<uint64_t> semaphoreCounter{0};
+
+/**
+ * Reads the table id from a handle object
+ * @param handle - Handle object with a numeric id
+ * @returns Id, or 0 when missing or malformed
+ */
+static uint64_t HandleId(const Napi::Object& handle) {
+    Napi::Value id = handle.Get("id");
+    if (!id.IsNumber()) {
+        return 0;
+    }
+    double value = id.As<Napi::Number>().DoubleValue();
+    if (!(value > 0) || value > 9007199254740991.0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(value);
+}
 
 /**
  * Creates a new thread
@@ -79,9 +149,14 @@ Napi::Value CreateThread(const Napi::CallbackInfo& info) {
     
     Napi::Function func = info[0].As<Napi::Function>();
     
-    // Create thread info
-    auto threadInfo = std::make_unique<ThreadInfo>();
-    threadInfo->id = ++threadCounter;
+    // Reserve the handle before starting so the thread is never untracked
+    auto threadInfo = std::make_shared<ThreadInfo>();
+    uint64_t threadId = threads.Insert(threadInfo);
+    if (threadId == 0) {
+        Napi::Error::New(env, "Too many thread handles").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    threadInfo->id = threadId;
     
     // Create the actual thread
     try {
@@ -96,13 +171,6 @@ Napi::Value CreateThread(const Napi::CallbackInfo& info) {
             }
         });
         
-        uint64_t threadId = threadInfo->id;
-        
-        {
-            std::lock_guard<std::mutex> lock(globalMutex);
-            threads[threadId] = std::move(threadInfo);
-        }
-        
         // Return thread handle
         Napi::Object handle = Napi::Object::New(env);
         handle.Set("id", Napi::Number::New(env, static_cast<double>(threadId)));
@@ -110,6 +178,7 @@ Napi::Value CreateThread(const Napi::CallbackInfo& info) {
         
         return handle;
     } catch (const std::exception&) {
+        threads.Remove(threadId);
         Napi::Error::New(env, "Failed to create thread").ThrowAsJavaScriptException();
         return env.Null();
     }
@@ -128,25 +197,19 @@ Napi::Value JoinThread(const Napi::CallbackInfo& info) {
         return Napi::Number::New(env, -1);
     }
     
-    Napi::Object handle = info[0].As<Napi::Object>();
-    uint64_t threadId = static_cast<uint64_t>(handle.Get("id").As<Napi::Number>().DoubleValue());
-    
-    std::lock_guard<std::mutex> lock(globalMutex);
-    auto it = threads.find(threadId);
-    if (it == threads.end()) {
+    // Claim the handle first; the join itself runs with no table lock held
+    std::shared_ptr<ThreadInfo> thread = threads.Remove(HandleId(info[0].As<Napi::Object>()));
+    if (!thread) {
         Napi::Error::New(env, "Invalid thread handle").ThrowAsJavaScriptException();
         return Napi::Number::New(env, -1);
     }
     
     try {
-        if (it->second->thread && it->second->thread->joinable()) {
-            it->second->thread->join();
+        if (thread->thread && thread->thread->joinable()) {
+            thread->thread->join();
         }
         
-        int exitCode = it->second->exitCode;
-        threads.erase(it);
-        
-        return Napi::Number::New(env, exitCode);
+        return Napi::Number::New(env, thread->exitCode);
     } catch (const std::exception&) {
         Napi::Error::New(env, "Failed to join thread").ThrowAsJavaScriptException();
         return Napi::Number::New(env, -1);
@@ -166,21 +229,16 @@ Napi::Value DetachThread(const Napi::CallbackInfo& info) {
         return Napi::Boolean::New(env, false);
     }
     
-    Napi::Object handle = info[0].As<Napi::Object>();
-    uint64_t threadId = static_cast<uint64_t>(handle.Get("id").As<Napi::Number>().DoubleValue());
-    
-    std::lock_guard<std::mutex> lock(globalMutex);
-    auto it = threads.find(threadId);
-    if (it == threads.end()) {
+    std::shared_ptr<ThreadInfo> thread = threads.Remove(HandleId(info[0].As<Napi::Object>()));
+    if (!thread) {
         return Napi::Boolean::New(env, false);
     }
     
     try {
-        if (it->second->thread && it->second->thread->joinable()) {
-            it->second->thread->detach();
+        if (thread->thread && thread->thread->joinable()) {
+            thread->thread->detach();
         }
         
-        threads.erase(it);
         return Napi::Boolean::New(env, true);
     } catch (const std::exception&) {
         return Napi::Boolean::New(env, false);
@@ -218,8 +276,7 @@ Napi::Value CreateMutex(const Napi::CallbackInfo& info) {
     }
     
     try {
-        auto mutexInfo = std::make_unique<MutexInfo>();
-        mutexInfo->id = ++mutexCounter;
+        auto mutexInfo = std::make_shared<MutexInfo>();
         mutexInfo->isRecursive = recursive;
         mutexInfo->isTimed = true; // Enable timed operations
         
@@ -229,12 +286,12 @@ Napi::Value CreateMutex(const Napi::CallbackInfo& info) {
             mutexInfo->timedMutex = std::make_unique<std::timed_mutex>();
         }
         
-        uint64_t mutexId = mutexInfo->id;
-        
-        {
-            std::lock_guard<std::mutex> lock(globalMutex);
-            mutexes[mutexId] = std::move(mutexInfo);
+        uint64_t mutexId = mutexes.Insert(mutexInfo);
+        if (mutexId == 0) {
+            Napi::Error::New(env, "Too many mutex handles").ThrowAsJavaScriptException();
+            return env.Null();
         }
+        mutexInfo->id = mutexId;
         
         Napi::Object handle = Napi::Object::New(env);
         handle.Set("id", Napi::Number::New(env, static_cast<double>(mutexId)));
@@ -260,44 +317,50 @@ Napi::Value LockMutex(const Napi::CallbackInfo& info) {
         return Napi::Boolean::New(env, false);
     }
     
-    Napi::Object handle = info[0].As<Napi::Object>();
-    uint64_t mutexId = static_cast<uint64_t>(handle.Get("id").As<Napi::Number>().DoubleValue());
-    
     int timeout = -1; // Infinite timeout by default
     if (info.Length() > 1 && info[1].IsNumber()) {
         timeout = info[1].As<Napi::Number>().Int32Value();
     }
     
-    std::lock_guard<std::mutex> lock(globalMutex);
-    auto it = mutexes.find(mutexId);
-    if (it == mutexes.end()) {
+    std::shared_ptr<MutexInfo> mutex = mutexes.Get(HandleId(info[0].As<Napi::Object>()));
+    if (!mutex) {
         return Napi::Boolean::New(env, false);
     }
     
     try {
+        bool success = false;
+        
         if (timeout == -1) {
             // Blocking lock
-            if (it->second->isRecursive && it->second->recursiveTimedMutex) {
-                it->second->recursiveTimedMutex->lock();
-            } else if (it->second->timedMutex) {
-                it->second->timedMutex->lock();
-            } else {
-                return Napi::Boolean::New(env, false);
+            if (mutex->isRecursive && mutex->recursiveTimedMutex) {
+                mutex->recursiveTimedMutex->lock();
+                success = true;
+            } else if (mutex->timedMutex) {
+                mutex->timedMutex->lock();
+                success = true;
             }
-            return Napi::Boolean::New(env, true);
         } else {
             // Timed lock
             auto timeoutDuration = std::chrono::milliseconds(timeout);
-            bool success = false;
             
-            if (it->second->isRecursive && it->second->recursiveTimedMutex) {
-                success = it->second->recursiveTimedMutex->try_lock_for(timeoutDuration);
-            } else if (it->second->timedMutex) {
-                success = it->second->timedMutex->try_lock_for(timeoutDuration);
+            if (mutex->isRecursive && mutex->recursiveTimedMutex) {
+                success = mutex->recursiveTimedMutex->try_lock_for(timeoutDuration);
+            } else if (mutex->timedMutex) {
+                success = mutex->timedMutex->try_lock_for(timeoutDuration);
             }
-            
-            return Napi::Boolean::New(env, success);
         }
+        
+        if (success && mutex->destroyed.load()) {
+            // Destroyed while this call was waiting; the handle is gone
+            UnlockMutexInfo(*mutex);
+            success = false;
+        }
+        if (success) {
+            mutex->owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+            mutex->depth++;
+        }
+        
+        return Napi::Boolean::New(env, success);
     } catch (const std::exception&) {
         return Napi::Boolean::New(env, false);
     }
@@ -306,7 +369,7 @@ Napi::Value LockMutex(const Napi::CallbackInfo& info) {
 /**
  * Unlocks a mutex
  * @param info - CallbackInfo containing mutex handle
- * @returns Success status
+ * @returns Success status; false unless the calling thread holds the mutex
  */
 Napi::Value UnlockMutex(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
@@ -316,20 +379,25 @@ Napi::Value UnlockMutex(const Napi::CallbackInfo& info) {
         return Napi::Boolean::New(env, false);
     }
     
-    Napi::Object handle = info[0].As<Napi::Object>();
-    uint64_t mutexId = static_cast<uint64_t>(handle.Get("id").As<Napi::Number>().DoubleValue());
+    std::shared_ptr<MutexInfo> mutex = mutexes.Get(HandleId(info[0].As<Napi::Object>()));
+    if (!mutex) {
+        return Napi::Boolean::New(env, false);
+    }
     
-    std::lock_guard<std::mutex> lock(globalMutex);
-    auto it = mutexes.find(mutexId);
-    if (it == mutexes.end()) {
+    // Unlocking a mutex this thread does not hold is undefined behaviour. Only
+    // the owner can have stored its own id, so the check cannot race.
+    if (mutex->owner.load(std::memory_order_relaxed) != std::this_thread::get_id()) {
         return Napi::Boolean::New(env, false);
     }
+    if (--mutex->depth == 0) {
+        mutex->owner.store(std::thread::id(), std::memory_order_relaxed);
+    }
     
     try {
-        if (it->second->isRecursive && it->second->recursiveTimedMutex) {
-            it->second->recursiveTimedMutex->unlock();
-        } else if (it->second->timedMutex) {
-            it->second->timedMutex->unlock();
+        if (mutex->isRecursive && mutex->recursiveTimedMutex) {
+            mutex->recursiveTimedMutex->unlock();
+        } else if (mutex->timedMutex) {
+            mutex->timedMutex->unlock();
         } else {
             return Napi::Boolean::New(env, false);
         }
@@ -340,6 +408,39 @@ Napi::Value UnlockMutex(const Napi::CallbackInfo& info) {
     }
 }
 
+/**
+ * Destroys a mutex and invalidates its handle
+ * @param info - CallbackInfo containing mutex handle
+ * @returns Success status; false if the handle is unknown or the mutex is held
+ */
+Napi::Value DestroyMutex(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Mutex handle object required").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    uint64_t mutexId = HandleId(info[0].As<Napi::Object>());
+    std::shared_ptr<MutexInfo> mutex = mutexes.Get(mutexId);
+    if (!mutex) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    // Hold the mutex across the check and the removal so no lock can land in between;
+    // a recursive mutex held by this thread still shows up in depth
+    if (!TryLockMutexInfo(*mutex)) {
+        return Napi::Boolean::New(env, false);
+    }
+    bool removed = false;
+    if (mutex->depth == 0) {
+        mutex->destroyed.store(true);
+        removed = mutexes.Remove(mutexId) != nullptr;
+    }
+    UnlockMutexInfo(*mutex);
+    return Napi::Boolean::New(env, removed);
+}
+
 /**
  * Creates a semaphore
  * @param info - CallbackInfo containing initial count and max count
@@ -362,8 +463,7 @@ Napi::Value CreateSemaphore(const Napi::CallbackInfo& info) {
     }
     
     try {
-        auto semInfo = std::make_unique<SemaphoreInfo>();
-        semInfo->id = ++semaphoreCounter;
+        auto semInfo = std::make_shared<SemaphoreInfo>();
         semInfo->maxCount = maxCount;
         semInfo->currentCount = initialCount;
         
@@ -376,7 +476,8 @@ Napi::Value CreateSemaphore(const Napi::CallbackInfo& info) {
         }
         #else
         // Create a unique semaphore name
-        snprintf(semInfo->semName, sizeof(semInfo->semName), "/lljs_sem_%lu", semInfo->id);
+        snprintf(semInfo->semName, sizeof(semInfo->semName), "/lljs_sem_%ld_%llu",
+                 static_cast<long>(getpid()), static_cast<unsigned long long>(++semaphoreCounter));
         
         // Remove any existing semaphore with the same name
         sem_unlink(semInfo->semName);
@@ -387,14 +488,17 @@ Napi::Value CreateSemaphore(const Napi::CallbackInfo& info) {
             Napi::Error::New(env, "Failed to create semaphore").ThrowAsJavaScriptException();
             return env.Null();
         }
-        #endif
         
-        uint64_t semId = semInfo->id;
+        // The open descriptor keeps it alive; drop the name so it never outlives the process
+        sem_unlink(semInfo->semName);
+        #endif
         
-        {
-            std::lock_guard<std::mutex> lock(globalMutex);
-            semaphores[semId] = std::move(semInfo);
+        uint64_t semId = semaphores.Insert(semInfo);
+        if (semId == 0) {
+            Napi::Error::New(env, "Too many semaphore handles").ThrowAsJavaScriptException();
+            return env.Null();
         }
+        semInfo->id = semId;
         
         Napi::Object handle = Napi::Object::New(env);
         handle.Set("id", Napi::Number::New(env, static_cast<double>(semId)));
@@ -421,17 +525,13 @@ Napi::Value WaitSemaphore(const Napi::CallbackInfo& info) {
         return Napi::Boolean::New(env, false);
     }
     
-    Napi::Object handle = info[0].As<Napi::Object>();
-    uint64_t semId = static_cast<uint64_t>(handle.Get("id").As<Napi::Number>().DoubleValue());
-    
     int timeout = -1; // Infinite timeout by default
     if (info.Length() > 1 && info[1].IsNumber()) {
         timeout = info[1].As<Napi::Number>().Int32Value();
     }
     
-    std::lock_guard<std::mutex> lock(globalMutex);
-    auto it = semaphores.find(semId);
-    if (it == semaphores.end()) {
+    std::shared_ptr<SemaphoreInfo> sem = semaphores.Get(HandleId(info[0].As<Napi::Object>()));
+    if (!sem) {
         return Napi::Boolean::New(env, false);
     }
     
@@ -441,15 +541,19 @@ Napi::Value WaitSemaphore(const Napi::CallbackInfo& info) {
         if (timeout == -1) {
             // Blocking wait
             #ifdef _WIN32
-            DWORD result = WaitForSingleObject(it->second->semaphore, INFINITE);
+            DWORD result = WaitForSingleObject(sem->semaphore, INFINITE);
             success = (result == WAIT_OBJECT_0);
             #else
-            success = (sem_wait(it->second->semaphore) == 0);
+            int rc;
+            do {
+                rc = sem_wait(sem->semaphore);
+            } while (rc != 0 && errno == EINTR);
+            success = (rc == 0);
             #endif
         } else {
             // Timed wait
             #ifdef _WIN32
-            DWORD result = WaitForSingleObject(it->second->semaphore, static_cast<DWORD>(timeout));
+            DWORD result = WaitForSingleObject(sem->semaphore, static_cast<DWORD>(timeout));
             success = (result == WAIT_OBJECT_0);
             #else
             struct timespec ts;
@@ -461,12 +565,16 @@ Napi::Value WaitSemaphore(const Napi::CallbackInfo& info) {
                 ts.tv_sec += ts.tv_nsec / 1000000000;
                 ts.tv_nsec %= 1000000000;
             }
-            success = (sem_timedwait(it->second->semaphore, &ts) == 0);
+            int rc;
+            do {
+                rc = sem_timedwait(sem->semaphore, &ts);
+            } while (rc != 0 && errno == EINTR);
+            success = (rc == 0);
             #endif
         }
         
         if (success) {
-            it->second->currentCount--;
+            sem->currentCount.fetch_sub(1);
         }
         
         return Napi::Boolean::New(env, success);
@@ -488,9 +596,6 @@ Napi::Value SignalSemaphore(const Napi::CallbackInfo& info) {
         return Napi::Number::New(env, -1);
     }
     
-    Napi::Object handle = info[0].As<Napi::Object>();
-    uint64_t semId = static_cast<uint64_t>(handle.Get("id").As<Napi::Number>().DoubleValue());
-    
     int count = 1; // Default release count
     if (info.Length() > 1 && info[1].IsNumber()) {
         count = info[1].As<Napi::Number>().Int32Value();
@@ -500,40 +605,1016 @@ Napi::Value SignalSemaphore(const Napi::CallbackInfo& info) {
         return Napi::Number::New(env, -1);
     }
     
-    std::lock_guard<std::mutex> lock(globalMutex);
-    auto it = semaphores.find(semId);
-    if (it == semaphores.end()) {
+    std::shared_ptr<SemaphoreInfo> sem = semaphores.Get(HandleId(info[0].As<Napi::Object>()));
+    if (!sem) {
         return Napi::Number::New(env, -1);
     }
     
     try {
-        int previousCount = it->second->currentCount.load();
-        
-        // Check if we can release without exceeding max count
-        if (previousCount + count > it->second->maxCount) {
-            return Napi::Number::New(env, -1);
-        }
+        // Reserve the release atomically so concurrent signals cannot exceed max count
+        int previousCount = sem->currentCount.load();
+        do {
+            if (static_cast<int64_t>(previousCount) + count > sem->maxCount) {
+                return Napi::Number::New(env, -1);
+            }
+        } while (!sem->currentCount.compare_exchange_weak(previousCount, previousCount + count));
         
         // Release the semaphore
         #ifdef _WIN32
         LONG prevCount;
-        if (!ReleaseSemaphore(it->second->semaphore, static_cast<LONG>(count), &prevCount)) {
+        if (!ReleaseSemaphore(sem->semaphore, static_cast<LONG>(count), &prevCount)) {
+            sem->currentCount.fetch_sub(count);
             return Napi::Number::New(env, -1);
         }
         #else
         for (int i = 0; i < count; i++) {
-            if (sem_post(it->second->semaphore) != 0) {
+            if (sem_post(sem->semaphore) != 0) {
+                sem->currentCount.fetch_sub(count - i);
                 return Napi::Number::New(env, -1);
             }
         }
         #endif
         
-        it->second->currentCount += count;
-        
         return Napi::Number::New(env, previousCount);
     } catch (const std::exception&) {
         return Napi::Number::New(env, -1);
     }
 }
 
-}
\ No newline at end of file
+/**
+ * Destroys a semaphore and invalidates its handle
+ * @param info - CallbackInfo containing semaphore handle
+ * @returns Success status
+ */
+Napi::Value DestroySemaphore(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Semaphore handle object required").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    // Waiters still blocked on it keep the native semaphore alive until they return
+    return Napi::Boolean::New(env, semaphores.Remove(HandleId(info[0].As<Napi::Object>())) != nullptr);
+}
+
+// Pool thread identity, used to route nested submissions to the local deque
+static thread_local WorkerPool* currentPool = nullptr;
+static thread_local size_t currentWorker = 0;
+
+WorkerPool& WorkerPool::Instance() {
+    // Intentionally leaked; worker threads are torn down with the process
+    static WorkerPool* pool = new WorkerPool(std::max(1u, std::thread::hardware_concurrency()));
+    return *pool;
+}
+
+WorkerPool::WorkerPool(size_t threadCount) {
+    for (size_t i = 0; i < threadCount; i++) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (size_t i = 0; i < threadCount; i++) {
+        workers.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+}
+
+void WorkerPool::Submit(Task task) {
+    size_t target = currentPool == this ? currentWorker : nextQueue++ % queues.size();
+    
+    // Count before publishing so a thief never decrements below zero
+    pending++;
+    {
+        std::lock_guard<std::mutex> lock(queues[target]->mutex);
+        queues[target]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wake.notify_one();
+}
+
+bool WorkerPool::TryTake(size_t index, Task& task) {
+    // Newest local work first keeps caches warm
+    {
+        WorkerQueue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            pending--;
+            return true;
+        }
+    }
+    
+    // Steal the oldest work of the other workers
+    for (size_t offset = 1; offset < queues.size(); offset++) {
+        WorkerQueue& victim = *queues[(index + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            pending--;
+            stolen++;
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+void WorkerPool::WorkerLoop(size_t index) {
+    currentPool = this;
+    currentWorker = index;
+    
+    Task task;
+    for (;;) {
+        if (TryTake(index, task)) {
+            task();
+            task = nullptr;
+            executed++;
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this]() { return pending.load() > 0; });
+    }
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1 || workers.size() <= 1) {
+        for (size_t i = 0; i < count; i++) {
+            body(i);
+        }
+        return;
+    }
+    
+    // Shared so helpers that start after the loop finished still see valid state
+    struct LoopState {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto state = std::make_shared<LoopState>();
+    const std::function<void(size_t)>* bodyPtr = &body;
+    
+    auto run = [state, bodyPtr, count]() {
+        size_t i;
+        while ((i = state->next.fetch_add(1)) < count) {
+            (*bodyPtr)(i);
+            if (state->done.fetch_add(1) + 1 == count) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->finished.notify_all();
+            }
+        }
+    };
+    
+    size_t helpers = std::min(count - 1, workers.size());
+    for (size_t h = 0; h < helpers; h++) {
+        Submit(run);
+    }
+    run();
+    
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&]() { return state->done.load() == count; });
+}
+
+WorkerPool::Stats WorkerPool::GetStats() const {
+    return { workers.size(), pending.load(), executed.load(), stolen.load() };
+}
+
+size_t WorkerPool::SetAffinity(const std::vector<std::vector<uint32_t>>& sets) {
+    size_t pinned = 0;
+    for (size_t i = 0; i < workers.size() && !sets.empty(); i++) {
+        pinned += CPU::SetThreadAffinity(&workers[i], sets[i % sets.size()]) ? 1 : 0;
+    }
+    return pinned;
+}
+
+// Native kernels runBatch can execute on the pool
+enum class BatchKernel { Hash, Search, Sum, Dot };
+
+// One input viewed as raw storage
+struct BatchItem {
+    const uint8_t* data;
+    size_t byteLength;
+    napi_typedarray_type type;
+};
+
+// A submitted batch; deleted on the JS thread once its promise settles
+struct BatchJob {
+    explicit BatchJob(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+    
+    BatchKernel kernel;
+    String::HashAlgorithm algorithm = String::HashAlgorithm::DJB2;
+    std::string pattern;
+    BatchItem vector{nullptr, 0, napi_float64_array};
+    std::vector<BatchItem> items;
+    std::vector<uint64_t> hashes;
+    std::vector<double> values;
+    std::vector<Napi::ObjectReference> inputRefs; // keep inputs alive while workers read them
+    Napi::Promise::Deferred deferred;
+    Napi::ThreadSafeFunction tsfn;
+    std::atomic<size_t> remaining{0};
+};
+
+/**
+ * Views a TypedArray (including Buffer) as raw storage
+ * @param value - TypedArray value
+ * @returns Item pointing at the backing store
+ */
+static BatchItem ToBatchItem(const Napi::Value& value) {
+    Napi::TypedArray array = value.As<Napi::TypedArray>();
+    const uint8_t* data = static_cast<const uint8_t*>(array.ArrayBuffer().Data()) + array.ByteOffset();
+    return { data, array.ByteLength(), array.TypedArrayType() };
+}
+
+/**
+ * Runs the batch kernel on one item; executes on a pool thread
+ * @param job - Batch
+ * @param index - Item index
+ */
+static void RunBatchItem(BatchJob* job, size_t index) {
+    const BatchItem& item = job->items[index];
+    switch (job->kernel) {
+        case BatchKernel::Hash:
+            job->hashes[index] = String::HashBytes(item.data, item.byteLength, job->algorithm);
+            break;
+        case BatchKernel::Search: {
+            size_t found = String::FindBytes(item.data, item.byteLength,
+                                             reinterpret_cast<const uint8_t*>(job->pattern.data()), job->pattern.size());
+            job->values[index] = found == SIZE_MAX ? -1.0 : static_cast<double>(found);
+            break;
+        }
+        case BatchKernel::Sum:
+            job->values[index] = item.type == napi_float64_array
+                ? Math::SumElements(reinterpret_cast<const double*>(item.data), item.byteLength / sizeof(double))
+                : Math::SumElements(reinterpret_cast<const float*>(item.data), item.byteLength / sizeof(float));
+            break;
+        case BatchKernel::Dot: {
+            size_t length = std::min(item.byteLength, job->vector.byteLength);
+            job->values[index] = item.type == napi_float64_array
+                ? Math::DotProduct(reinterpret_cast<const double*>(item.data),
+                                   reinterpret_cast<const double*>(job->vector.data), length / sizeof(double))
+                : Math::DotProduct(reinterpret_cast<const float*>(item.data),
+                                   reinterpret_cast<const float*>(job->vector.data), length / sizeof(float));
+            break;
+        }
+    }
+}
+
+/**
+ * Resolves a finished batch; runs on the JS thread
+ * @param env - N-API environment
+ * @param job - Completed batch (deleted here)
+ */
+static void SettleBatch(Napi::Env env, BatchJob* job) {
+    size_t count = job->items.size();
+    if (job->kernel == BatchKernel::Hash) {
+        Napi::BigUint64Array result = Napi::BigUint64Array::New(env, count);
+        std::copy(job->hashes.begin(), job->hashes.end(), result.Data());
+        job->deferred.Resolve(result);
+    } else {
+        Napi::Float64Array result = Napi::Float64Array::New(env, count);
+        std::copy(job->values.begin(), job->values.end(), result.Data());
+        job->deferred.Resolve(result);
+    }
+    delete job;
+}
+
+/**
+ * Runs a native kernel over a batch of inputs on the worker pool
+ * @param info - CallbackInfo containing kernel name, input array and options
+ * @returns Promise resolving to per-item results (BigUint64Array for hash, Float64Array otherwise)
+ */
+Napi::Value RunBatch(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsArray()) {
+        Napi::TypeError::New(env, "Kernel name and input array required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string kernelName = info[0].As<Napi::String>();
+    Napi::Array inputs = info[1].As<Napi::Array>();
+    Napi::Object options = (info.Length() > 2 && info[2].IsObject()) ? info[2].As<Napi::Object>() : Napi::Object::New(env);
+    
+    auto job = std::make_unique<BatchJob>(env);
+    bool floatInputs = false;
+    
+    if (kernelName == "hash") {
+        job->kernel = BatchKernel::Hash;
+        std::string algorithm = "djb2";
+        if (options.Has("algorithm") && options.Get("algorithm").IsString()) {
+            algorithm = options.Get("algorithm").As<Napi::String>();
+        }
+        if (!String::ParseHashAlgorithm(algorithm, job->algorithm)) {
+            Napi::TypeError::New(env, "Unknown hash algorithm").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else if (kernelName == "search") {
+        job->kernel = BatchKernel::Search;
+        Napi::Value pattern = options.Get("pattern");
+        if (pattern.IsString()) {
+            job->pattern = pattern.As<Napi::String>();
+        } else if (pattern.IsTypedArray()) {
+            BatchItem bytes = ToBatchItem(pattern);
+            job->pattern.assign(reinterpret_cast<const char*>(bytes.data), bytes.byteLength);
+        } else {
+            Napi::TypeError::New(env, "Search pattern (string or Buffer) required").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else if (kernelName == "sum" || kernelName == "dot") {
+        job->kernel = kernelName == "sum" ? BatchKernel::Sum : BatchKernel::Dot;
+        floatInputs = true;
+    } else {
+        Napi::TypeError::New(env, "Unknown batch kernel").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // Validate and pin every input before any work starts
+    job->items.reserve(inputs.Length());
+    job->inputRefs.reserve(inputs.Length() + 1);
+    for (uint32_t i = 0; i < inputs.Length(); i++) {
+        Napi::Value input = inputs.Get(i);
+        if (!input.IsTypedArray()) {
+            Napi::TypeError::New(env, "Batch inputs must be Buffers or TypedArrays").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        BatchItem item = ToBatchItem(input);
+        if (floatInputs && item.type != napi_float64_array && item.type != napi_float32_array) {
+            Napi::TypeError::New(env, "Only Float64Array and Float32Array are supported").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        job->items.push_back(item);
+        job->inputRefs.push_back(Napi::Persistent(input.As<Napi::Object>()));
+    }
+    
+    if (job->kernel == BatchKernel::Dot) {
+        Napi::Value vector = options.Get("vector");
+        if (!vector.IsTypedArray()) {
+            Napi::TypeError::New(env, "Dot kernel requires a vector option").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        job->vector = ToBatchItem(vector);
+        for (const BatchItem& item : job->items) {
+            if (item.type != job->vector.type) {
+                Napi::TypeError::New(env, "Vector must be a TypedArray of the same type as the inputs").ThrowAsJavaScriptException();
+                return env.Null();
+            }
+        }
+        job->inputRefs.push_back(Napi::Persistent(vector.As<Napi::Object>()));
+    }
+    
+    size_t count = job->items.size();
+    Napi::Promise promise = job->deferred.Promise();
+    if (job->kernel == BatchKernel::Hash) {
+        job->hashes.resize(count);
+    } else {
+        job->values.resize(count);
+    }
+    
+    if (count == 0) {
+        SettleBatch(env, job.release());
+        return promise;
+    }
+    
+    job->tsfn = Napi::ThreadSafeFunction::New(env, Napi::Function(), "lljsRunBatch", 0, 1);
+    job->remaining = count;
+    
+    // One task per item so idle workers can steal the tail of an uneven batch
+    BatchJob* shared = job.release();
+    WorkerPool& pool = WorkerPool::Instance();
+    for (size_t i = 0; i < count; i++) {
+        pool.Submit([shared, i]() {
+            RunBatchItem(shared, i);
+            if (shared->remaining.fetch_sub(1) == 1) {
+                // The JS side may delete the job as soon as the call lands
+                Napi::ThreadSafeFunction tsfn = shared->tsfn;
+                tsfn.BlockingCall(shared, [](Napi::Env env, Napi::Function, BatchJob* job) {
+                    SettleBatch(env, job);
+                });
+                tsfn.Release();
+            }
+        });
+    }
+    
+    return promise;
+}
+
+/**
+ * Gets worker pool statistics
+ * @param info - CallbackInfo (no parameters required)
+ * @returns Object with threads, pending, executed and stolen counts
+ */
+Napi::Value GetPoolInfo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    WorkerPool::Stats stats = WorkerPool::Instance().GetStats();
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("threads", Napi::Number::New(env, static_cast<double>(stats.threads)));
+    result.Set("pending", Napi::Number::New(env, static_cast<double>(stats.pending)));
+    result.Set("executed", Napi::Number::New(env, static_cast<double>(stats.executed)));
+    result.Set("stolen", Napi::Number::New(env, static_cast<double>(stats.stolen)));
+    return result;
+}
+
+/**
+ * Pins the worker pool threads
+ * @param info - CallbackInfo containing one CPU index array shared by every
+ *               worker, or an array of arrays assigned round-robin (worker i gets sets[i % n])
+ * @returns True if every worker was pinned
+ */
+Napi::Value SetPoolAffinity(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::vector<std::vector<uint32_t>> sets;
+    if (info.Length() >= 1 && info[0].IsArray()) {
+        Napi::Array array = info[0].As<Napi::Array>();
+        bool nested = array.Length() > 0 && array.Get(0u).IsArray();
+        for (uint32_t i = 0; i < (nested ? array.Length() : 1); i++) {
+            sets.emplace_back();
+            Napi::Value set = nested ? array.Get(i) : info[0];
+            if (!set.IsArray() || !CPU::ToCPUSet(set, sets.back()) || sets.back().empty()) {
+                sets.clear();
+                break;
+            }
+        }
+    }
+    if (sets.empty()) {
+        Napi::TypeError::New(env, "Array of CPU indices or array of CPU index arrays required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    WorkerPool& pool = WorkerPool::Instance();
+    return Napi::Boolean::New(env, pool.SetAffinity(sets) == pool.Size());
+}
+
+// Shared-memory rings. All state lives in the caller's SharedArrayBuffer so
+// every worker_thread that holds the buffer operates on the same ring.
+//
+// Layout, one cache line per field group so producers and consumers never
+// false-share:
+//   [0]   magic, kind, capacity, slotSize, slotStride (u32)
+//   [64]  tail, cached head (producer line)
+//   [128] head, cached tail (consumer line)
+//   [192] notEmpty, notFull, consumersWaiting, producersWaiting (u32 park words)
+//   [256] capacity slots of { u64 sequence, u32 length, u32 pad, payload }
+
+static constexpr uint32_t kRingMagic = 0x4c4c5252; // "LLRR"
+static constexpr size_t kRingLine = 64;
+static constexpr size_t kRingHeaderBytes = 4 * kRingLine;
+static constexpr size_t kRingSlotHeader = 16;
+static constexpr uint32_t kRingMaxCapacity = 1u << 30;
+static constexpr uint32_t kRingMaxSlotSize = 1u << 30;
+static constexpr int kRingSpinCount = 64;
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t) && std::atomic<uint64_t>::is_always_lock_free,
+              "ring counters must be plain lock-free words");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && std::atomic<uint32_t>::is_always_lock_free,
+              "ring park words must be plain lock-free words");
+
+enum class RingKind : uint32_t {
+    SPSC = 1,
+    MPMC = 2
+};
+
+struct RingView {
+    uint8_t* base;
+    RingKind kind;
+    uint32_t capacity;
+    uint32_t slotSize;
+    uint32_t slotStride;
+
+    std::atomic<uint64_t>& Tail() const { return *reinterpret_cast<std::atomic<uint64_t>*>(base + kRingLine); }
+    uint64_t& CachedHead() const { return *reinterpret_cast<uint64_t*>(base + kRingLine + 8); }
+    std::atomic<uint64_t>& Head() const { return *reinterpret_cast<std::atomic<uint64_t>*>(base + 2 * kRingLine); }
+    uint64_t& CachedTail() const { return *reinterpret_cast<uint64_t*>(base + 2 * kRingLine + 8); }
+    std::atomic<uint32_t>& Word(size_t index) const {
+        return reinterpret_cast<std::atomic<uint32_t>*>(base + 3 * kRingLine)[index];
+    }
+    std::atomic<uint32_t>& NotEmpty() const { return Word(0); }
+    std::atomic<uint32_t>& NotFull() const { return Word(1); }
+    std::atomic<uint32_t>& ConsumersWaiting() const { return Word(2); }
+    std::atomic<uint32_t>& ProducersWaiting() const { return Word(3); }
+
+    uint8_t* Slot(uint64_t position) const {
+        return base + kRingHeaderBytes + static_cast<size_t>(position & (capacity - 1)) * slotStride;
+    }
+    static std::atomic<uint64_t>& Sequence(uint8_t* slot) { return *reinterpret_cast<std::atomic<uint64_t>*>(slot); }
+    static uint32_t& Length(uint8_t* slot) { return *reinterpret_cast<uint32_t*>(slot + 8); }
+    static uint8_t* Payload(uint8_t* slot) { return slot + kRingSlotHeader; }
+};
+
+/**
+ * Computes the slot stride for a payload size
+ * @param slotSize - Maximum message size in bytes
+ * @returns Slot size including its header, 8-byte aligned
+ */
+static uint64_t RingSlotStride(uint64_t slotSize) {
+    return (kRingSlotHeader + slotSize + 7) & ~static_cast<uint64_t>(7);
+}
+
+/**
+ * Gets the backing store of a TypedArray, including views over SharedArrayBuffer
+ * @param env - Environment
+ * @param value - TypedArray value
+ * @param data - Receives the first byte of the view
+ * @param byteLength - Receives the view length in bytes
+ * @returns True when value is a TypedArray
+ */
+static bool TypedArrayBytes(Napi::Env env, const Napi::Value& value, uint8_t*& data, size_t& byteLength) {
+    if (!value.IsTypedArray()) {
+        return false;
+    }
+    void* raw = nullptr;
+    size_t length = 0;
+    napi_typedarray_type type;
+    if (napi_get_typedarray_info(env, value, &type, &length, &raw, nullptr, nullptr) != napi_ok) {
+        return false;
+    }
+    data = static_cast<uint8_t*>(raw);
+    byteLength = value.As<Napi::TypedArray>().ByteLength();
+    return true;
+}
+
+/**
+ * Validates a ring view and reads its geometry; throws on failure
+ * @param env - Environment
+ * @param value - Uint8Array over the ring's SharedArrayBuffer
+ * @param ring - Receives the ring geometry
+ * @returns True when the view holds an initialized ring
+ */
+static bool ToRingView(Napi::Env env, const Napi::Value& value, RingView& ring) {
+    uint8_t* data;
+    size_t byteLength;
+    if (!TypedArrayBytes(env, value, data, byteLength) || reinterpret_cast<uintptr_t>(data) % 8 != 0 ||
+        byteLength < kRingHeaderBytes) {
+        Napi::TypeError::New(env, "Ring must be an 8-byte aligned Uint8Array over a ring buffer").ThrowAsJavaScriptException();
+        return false;
+    }
+
+    const uint32_t* header = reinterpret_cast<const uint32_t*>(data);
+    uint32_t capacity = header[2];
+    uint32_t slotSize = header[3];
+    uint32_t stride = header[4];
+    bool validKind = header[1] == static_cast<uint32_t>(RingKind::SPSC) || header[1] == static_cast<uint32_t>(RingKind::MPMC);
+    if (header[0] != kRingMagic || !validKind || capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+        stride != RingSlotStride(slotSize) ||
+        byteLength < kRingHeaderBytes + static_cast<uint64_t>(capacity) * stride) {
+        Napi::TypeError::New(env, "Buffer does not contain an initialized ring").ThrowAsJavaScriptException();
+        return false;
+    }
+
+    ring = { data, static_cast<RingKind>(header[1]), capacity, slotSize, stride };
+    return true;
+}
+
+/**
+ * Hints the core that the caller is spinning
+ */
+static inline void CpuRelax() {
+#if defined(LLJS_ARCH_X86)
+    _mm_pause();
+#elif defined(LLJS_ARCH_ARM64) && !defined(_MSC_VER)
+    __asm__ __volatile__("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+/**
+ * Sleeps until *word may differ from expected (futex / WaitOnAddress)
+ * @param word - 32-bit park word
+ * @param expected - Value observed before deciding to sleep
+ * @param timeoutMs - Maximum sleep in milliseconds, -1 for no limit
+ */
+static void ParkOnAddress(std::atomic<uint32_t>* word, uint32_t expected, int timeoutMs) {
+#ifdef _WIN32
+    WaitOnAddress(word, &expected, sizeof(expected), timeoutMs < 0 ? INFINITE : static_cast<DWORD>(timeoutMs));
+#elif defined(__linux__)
+    struct timespec ts;
+    struct timespec* timeout = nullptr;
+    if (timeoutMs >= 0) {
+        ts.tv_sec = timeoutMs / 1000;
+        ts.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000;
+        timeout = &ts;
+    }
+    // Returns early on EAGAIN when the word already moved; callers re-check
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+#else
+    // No address-wait primitive: poll at millisecond granularity
+    if (word->load(std::memory_order_acquire) == expected) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs < 0 ? 1 : std::min(timeoutMs, 1)));
+    }
+#endif
+}
+
+/**
+ * Wakes one thread parked on word
+ * @param word - 32-bit park word
+ */
+static void UnparkAddress(std::atomic<uint32_t>* word) {
+#ifdef _WIN32
+    WakeByAddressSingle(word);
+#elif defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+/**
+ * Retries a ring operation, spinning briefly and then parking on word
+ * @param attempt - Non-blocking operation; returns true on success
+ * @param word - Park word bumped by the opposite side
+ * @param waiters - Count of threads parked on word
+ * @param timeoutMs - 0 to try once, -1 to wait forever, otherwise milliseconds
+ * @returns True if the operation succeeded before the timeout
+ */
+template <typename Attempt>
+static bool RingWait(Attempt attempt, std::atomic<uint32_t>& word, std::atomic<uint32_t>& waiters, int timeoutMs) {
+    if (attempt()) {
+        return true;
+    }
+    if (timeoutMs == 0) {
+        return false;
+    }
+    for (int i = 0; i < kRingSpinCount; i++) {
+        CpuRelax();
+        if (attempt()) {
+            return true;
+        }
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (true) {
+        // Announce before the final check so a concurrent notify cannot be missed
+        waiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint32_t observed = word.load(std::memory_order_acquire);
+        if (attempt()) {
+            waiters.fetch_sub(1);
+            return true;
+        }
+
+        int remaining = -1;
+        if (timeoutMs > 0) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            if (left.count() <= 0) {
+                waiters.fetch_sub(1);
+                return false;
+            }
+            remaining = static_cast<int>(left.count());
+        }
+
+        ParkOnAddress(&word, observed, remaining);
+        waiters.fetch_sub(1);
+        if (attempt()) {
+            return true;
+        }
+    }
+}
+
+/**
+ * Wakes one parked thread after publishing work; free when nobody is parked
+ * @param word - Park word
+ * @param waiters - Count of threads parked on word
+ */
+static void RingNotify(std::atomic<uint32_t>& word, std::atomic<uint32_t>& waiters) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_relaxed) > 0) {
+        word.fetch_add(1, std::memory_order_release);
+        UnparkAddress(&word);
+    }
+}
+
+/**
+ * Attempts to append one message without blocking
+ * @param ring - Ring geometry
+ * @param data - Message bytes
+ * @param length - Message length, at most slotSize
+ * @returns True if the message was stored
+ */
+static bool RingTryPush(const RingView& ring, const uint8_t* data, uint32_t length) {
+    if (ring.kind == RingKind::SPSC) {
+        uint64_t tail = ring.Tail().load(std::memory_order_relaxed);
+        if (tail - ring.CachedHead() >= ring.capacity) {
+            ring.CachedHead() = ring.Head().load(std::memory_order_acquire);
+            if (tail - ring.CachedHead() >= ring.capacity) {
+                return false;
+            }
+        }
+        uint8_t* slot = ring.Slot(tail);
+        RingView::Length(slot) = length;
+        if (length > 0) {
+            memcpy(RingView::Payload(slot), data, length);
+        }
+        ring.Tail().store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Bounded MPMC queue: each slot's sequence says whose turn it is
+    uint64_t position = ring.Tail().load(std::memory_order_relaxed);
+    uint8_t* slot;
+    while (true) {
+        slot = ring.Slot(position);
+        uint64_t sequence = RingView::Sequence(slot).load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence - position);
+        if (diff == 0) {
+            if (ring.Tail().compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            position = ring.Tail().load(std::memory_order_relaxed);
+        }
+    }
+    RingView::Length(slot) = length;
+    if (length > 0) {
+        memcpy(RingView::Payload(slot), data, length);
+    }
+    RingView::Sequence(slot).store(position + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Attempts to remove one message without blocking
+ * @param ring - Ring geometry
+ * @param out - Destination with room for slotSize bytes
+ * @param length - Receives the message length
+ * @returns True if a message was removed
+ */
+static bool RingTryPop(const RingView& ring, uint8_t* out, uint32_t& length) {
+    if (ring.kind == RingKind::SPSC) {
+        uint64_t head = ring.Head().load(std::memory_order_relaxed);
+        if (head == ring.CachedTail()) {
+            ring.CachedTail() = ring.Tail().load(std::memory_order_acquire);
+            if (head == ring.CachedTail()) {
+                return false;
+            }
+        }
+        uint8_t* slot = ring.Slot(head);
+        length = std::min(RingView::Length(slot), ring.slotSize);
+        if (length > 0) {
+            memcpy(out, RingView::Payload(slot), length);
+        }
+        ring.Head().store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    uint64_t position = ring.Head().load(std::memory_order_relaxed);
+    uint8_t* slot;
+    while (true) {
+        slot = ring.Slot(position);
+        uint64_t sequence = RingView::Sequence(slot).load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence - (position + 1));
+        if (diff == 0) {
+            if (ring.Head().compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            position = ring.Head().load(std::memory_order_relaxed);
+        }
+    }
+    length = std::min(RingView::Length(slot), ring.slotSize);
+    if (length > 0) {
+        memcpy(out, RingView::Payload(slot), length);
+    }
+    RingView::Sequence(slot).store(position + ring.capacity, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Reads an optional ring timeout argument
+ * @param info - CallbackInfo
+ * @param index - Argument index
+ * @returns Milliseconds; 0 (the default) never blocks, negative waits forever
+ */
+static int RingTimeout(const Napi::CallbackInfo& info, size_t index) {
+    if (info.Length() <= index || !info[index].IsNumber()) {
+        return 0;
+    }
+    int timeout = info[index].As<Napi::Number>().Int32Value();
+    return timeout < 0 ? -1 : timeout;
+}
+
+/**
+ * Validates ring geometry arguments; throws on failure
+ * @param env - Environment
+ * @param capacityValue - Slot count, a power of two
+ * @param slotSizeValue - Maximum message size in bytes
+ * @param capacity - Receives the slot count
+ * @param slotSize - Receives the slot size
+ * @returns True when both are valid
+ */
+static bool ToRingGeometry(Napi::Env env, const Napi::Value& capacityValue, const Napi::Value& slotSizeValue,
+                           uint32_t& capacity, uint32_t& slotSize) {
+    if (!capacityValue.IsNumber() || !slotSizeValue.IsNumber()) {
+        Napi::TypeError::New(env, "Capacity and slot size parameters required").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    double requestedCapacity = capacityValue.As<Napi::Number>().DoubleValue();
+    double requestedSlotSize = slotSizeValue.As<Napi::Number>().DoubleValue();
+    if (!(requestedCapacity >= 2) || requestedCapacity > kRingMaxCapacity ||
+        requestedCapacity != std::floor(requestedCapacity) ||
+        (static_cast<uint32_t>(requestedCapacity) & (static_cast<uint32_t>(requestedCapacity) - 1)) != 0) {
+        Napi::RangeError::New(env, "Capacity must be a power of two of at least 2").ThrowAsJavaScriptException();
+        return false;
+    }
+    if (!(requestedSlotSize >= 1) || requestedSlotSize > kRingMaxSlotSize ||
+        requestedSlotSize != std::floor(requestedSlotSize)) {
+        Napi::RangeError::New(env, "Slot size must be a positive integer").ThrowAsJavaScriptException();
+        return false;
+    }
+    
+    capacity = static_cast<uint32_t>(requestedCapacity);
+    slotSize = static_cast<uint32_t>(requestedSlotSize);
+    return true;
+}
+
+/**
+ * Computes the SharedArrayBuffer size needed for a ring
+ * @param info - CallbackInfo containing capacity and slot size
+ * @returns Byte length
+ */
+Napi::Value RingByteLength(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    uint32_t capacity, slotSize;
+    if (!ToRingGeometry(env, info[0], info[1], capacity, slotSize)) {
+        return env.Null();
+    }
+    
+    uint64_t bytes = kRingHeaderBytes + static_cast<uint64_t>(capacity) * RingSlotStride(slotSize);
+    return Napi::Number::New(env, static_cast<double>(bytes));
+}
+
+/**
+ * Formats a ring in place; no other thread may use the buffer meanwhile
+ * @param info - CallbackInfo containing Uint8Array view, capacity, slot size and kind ('spsc' or 'mpmc')
+ * @returns Success status
+ */
+Napi::Value RingInit(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    uint32_t capacity, slotSize;
+    if (!ToRingGeometry(env, info[1], info[2], capacity, slotSize)) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    RingKind kind = RingKind::SPSC;
+    if (info.Length() > 3 && info[3].IsString()) {
+        std::string name = info[3].As<Napi::String>().Utf8Value();
+        if (name == "mpmc") {
+            kind = RingKind::MPMC;
+        } else if (name != "spsc") {
+            Napi::TypeError::New(env, "Ring kind must be 'spsc' or 'mpmc'").ThrowAsJavaScriptException();
+            return Napi::Boolean::New(env, false);
+        }
+    }
+    
+    uint64_t stride = RingSlotStride(slotSize);
+    
+    uint8_t* data;
+    size_t byteLength;
+    if (!TypedArrayBytes(env, info[0], data, byteLength) || reinterpret_cast<uintptr_t>(data) % 8 != 0) {
+        Napi::TypeError::New(env, "Ring must be an 8-byte aligned Uint8Array").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    if (byteLength < kRingHeaderBytes + static_cast<uint64_t>(capacity) * stride) {
+        Napi::RangeError::New(env, "Buffer is too small for the ring").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    memset(data, 0, kRingHeaderBytes);
+    uint32_t* header = reinterpret_cast<uint32_t*>(data);
+    header[1] = static_cast<uint32_t>(kind);
+    header[2] = capacity;
+    header[3] = slotSize;
+    header[4] = static_cast<uint32_t>(stride);
+    
+    RingView ring{ data, kind, capacity, slotSize, static_cast<uint32_t>(stride) };
+    for (uint32_t i = 0; i < capacity; i++) {
+        uint8_t* slot = ring.Slot(i);
+        RingView::Sequence(slot).store(i, std::memory_order_relaxed);
+        RingView::Length(slot) = 0;
+    }
+    
+    // Publish the magic last so attachers never see a half-formatted ring
+    reinterpret_cast<std::atomic<uint32_t>*>(header)->store(kRingMagic, std::memory_order_release);
+    return Napi::Boolean::New(env, true);
+}
+
+/**
+ * Appends a message to a ring, parking while it is full
+ * @param info - CallbackInfo containing ring view, TypedArray message and optional timeout in ms
+ * @returns True if the message was enqueued
+ */
+Napi::Value RingPush(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Ring view and message parameters required").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    RingView ring;
+    if (!ToRingView(env, info[0], ring)) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    uint8_t* data;
+    size_t length;
+    if (!TypedArrayBytes(env, info[1], data, length)) {
+        Napi::TypeError::New(env, "Message must be a TypedArray or Buffer").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    if (length > ring.slotSize) {
+        Napi::RangeError::New(env, "Message is larger than the ring slot size").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+    
+    uint32_t messageLength = static_cast<uint32_t>(length);
+    bool pushed = RingWait([&]() { return RingTryPush(ring, data, messageLength); },
+                           ring.NotFull(), ring.ProducersWaiting(), RingTimeout(info, 2));
+    if (pushed) {
+        RingNotify(ring.NotEmpty(), ring.ConsumersWaiting());
+    }
+    return Napi::Boolean::New(env, pushed);
+}
+
+/**
+ * Removes a message from a ring, parking while it is empty
+ * @param info - CallbackInfo containing ring view, TypedArray destination (at least slotSize bytes) and optional timeout in ms
+ * @returns Message length in bytes, or -1 if the ring stayed empty
+ */
+Napi::Value RingPop(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Ring view and output parameters required").ThrowAsJavaScriptException();
+        return Napi::Number::New(env, -1);
+    }
+    
+    RingView ring;
+    if (!ToRingView(env, info[0], ring)) {
+        return Napi::Number::New(env, -1);
+    }
+    
+    uint8_t* out;
+    size_t capacity;
+    if (!TypedArrayBytes(env, info[1], out, capacity)) {
+        Napi::TypeError::New(env, "Output must be a TypedArray or Buffer").ThrowAsJavaScriptException();
+        return Napi::Number::New(env, -1);
+    }
+    if (capacity < ring.slotSize) {
+        Napi::RangeError::New(env, "Output must hold at least slotSize bytes").ThrowAsJavaScriptException();
+        return Napi::Number::New(env, -1);
+    }
+    
+    uint32_t length = 0;
+    bool popped = RingWait([&]() { return RingTryPop(ring, out, length); },
+                           ring.NotEmpty(), ring.ConsumersWaiting(), RingTimeout(info, 2));
+    if (!popped) {
+        return Napi::Number::New(env, -1);
+    }
+    RingNotify(ring.NotFull(), ring.ProducersWaiting());
+    return Napi::Number::New(env, length);
+}
+
+/**
+ * Gets ring geometry and an approximate fill level
+ * @param info - CallbackInfo containing ring view
+ * @returns Object with kind, capacity, slotSize and size
+ */
+Napi::Value RingInfo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    RingView ring;
+    if (info.Length() < 1 || !ToRingView(env, info[0], ring)) {
+        if (!env.IsExceptionPending()) {
+            Napi::TypeError::New(env, "Ring view parameter required").ThrowAsJavaScriptException();
+        }
+        return env.Null();
+    }
+    
+    uint64_t head = ring.Head().load(std::memory_order_acquire);
+    uint64_t tail = ring.Tail().load(std::memory_order_acquire);
+    uint64_t size = tail > head ? std::min<uint64_t>(tail - head, ring.capacity) : 0;
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("kind", Napi::String::New(env, ring.kind == RingKind::MPMC ? "mpmc" : "spsc"));
+    result.Set("capacity", Napi::Number::New(env, ring.capacity));
+    result.Set("slotSize", Napi::Number::New(env, ring.slotSize));
+    result.Set("size", Napi::Number::New(env, static_cast<double>(size)));
+    return result;
+}
+
+}
@@ -1,12 +1,18 @@
 #include "headers/lljs.h"
+#include "headers/handle_table.h"
 #include <chrono>
+#include <cmath>
 #include <thread>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
-#include <map>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
-#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #ifdef _WIN32
 #include <windows.h>
 #include <profileapi.h>
@@ -16,22 +22,15 @@
 #include <time.h>
 #include <unistd.h>
 #endif
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+#if defined(LLJS_ARCH_X86) && !defined(_MSC_VER)
+#include <x86intrin.h>
+#endif
 
 namespace LLJS::Time {
 
-// Timer management
-struct TimerInfo {
-    std::unique_ptr<std::thread> timerThread;
-    std::atomic<bool> running{true};
-    uint64_t interval; // microseconds
-    std::function<void()> callback;
-    uint64_t id;
-};
-
-static std::atomic<uint64_t> timerCounter{0};
-static std::map<uint64_t, std::unique_ptr<TimerInfo>> timers;
-static std::mutex timerMutex;
-
 /**
  * Gets high-resolution time in nanoseconds
  * @param info - CallbackInfo (no parameters required)
@@ -152,74 +151,513 @@ Napi::Value GetTimestamp(const Napi::CallbackInfo& info) {
     }
 }
 
+// Timer wheel. One process-wide thread drives a hierarchical wheel of four
+// levels with 256 slots each. A level-0 slot is 2^16 ns (~65 us) wide, so
+// the levels cover ~16 ms, ~4 s, ~18 min and ~78 h. Longer deadlines wait in
+// an overflow list until the top level wraps. Timers live in intrusive
+// lists, so inserting and cancelling are O(1). A level-L slot is re-sorted
+// into the lower levels once the wheel reaches it. The thread sleeps until
+// the earliest deadline and yields through the last few microseconds.
+// Expired timers are queued per environment and delivered in one
+// ThreadSafeFunction call per batch.
+
+static constexpr unsigned kWheelTickShift = 16;
+static constexpr unsigned kWheelLevelBits = 8;
+static constexpr unsigned kWheelLevels = 4;
+static constexpr size_t kWheelSlots = size_t(1) << kWheelLevelBits;
+static constexpr size_t kWheelWords = kWheelSlots / 64;
+static constexpr int kWheelOverflow = kWheelLevels;
+static constexpr uint64_t kWheelSpinNs = 20000;
+static constexpr double kMaxTimerIntervalMicros = 1e15; // ~31 years, keeps deadlines within 64-bit ns
+
+struct TimerDispatcher;
+
+struct WheelTimer {
+    // Links and expiry state; guarded by the wheel mutex
+    WheelTimer* prev = nullptr;
+    WheelTimer* next = nullptr;
+    int level = -1; // -1 while unlinked
+    uint32_t slot = 0;
+    uint64_t deadline = 0; // ns on the wheel clock
+    uint64_t interval = 0; // ns
+    bool periodic = true;
+    
+    // Set when the expiry is queued, cleared when JS runs it; overruns of a
+    // queued periodic timer are coalesced into the pending call
+    std::atomic<bool> queued{false};
+    uint64_t id = 0;
+    TimerDispatcher* dispatcher = nullptr;
+    
+    // JS thread only
+    bool unref = false;
+    Napi::FunctionReference callback;
+};
+
+// Per-environment delivery state; freed by the ThreadSafeFunction finalizer
+struct TimerDispatcher {
+    Napi::ThreadSafeFunction tsfn;
+    std::mutex mutex;
+    std::vector<uint64_t> ready;
+    bool posted = false;
+    
+    // JS thread only
+    std::unordered_map<uint64_t, std::unique_ptr<WheelTimer>> timers;
+    size_t refs = 0;
+};
+
+static void DrainTimers(Napi::Env env, TimerDispatcher* dispatcher);
+
+/**
+ * Queues an expired timer for its environment
+ * @param timer - Expired timer
+ * @returns True when the dispatcher needs a new ThreadSafeFunction call
+ */
+static bool QueueExpiry(WheelTimer* timer) {
+    if (timer->queued.exchange(true, std::memory_order_acq_rel)) {
+        return false;
+    }
+    TimerDispatcher* dispatcher = timer->dispatcher;
+    std::lock_guard<std::mutex> lock(dispatcher->mutex);
+    dispatcher->ready.push_back(timer->id);
+    if (dispatcher->posted) {
+        return false;
+    }
+    dispatcher->posted = true;
+    return true;
+}
+
 /**
- * Creates a high-precision timer
- * @param info - CallbackInfo containing callback function and interval
- * @returns Timer handle object
+ * Posts a drain of the dispatcher's ready queue to its JS thread
+ * @param dispatcher - Dispatcher with a fresh batch
  */
-Napi::Value CreateTimer(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
+static void PostDrain(TimerDispatcher* dispatcher) {
+    dispatcher->tsfn.NonBlockingCall(dispatcher, [](Napi::Env env, Napi::Function, TimerDispatcher* target) {
+        DrainTimers(env, target);
+    });
+}
+
+class TimerWheel {
+public:
+    // Never destroyed: the wheel thread keeps running through static teardown
+    static TimerWheel& Instance() {
+        static TimerWheel* wheel = new TimerWheel();
+        return *wheel;
+    }
     
-    if (info.Length() < 2 || !info[0].IsFunction() || !info[1].IsNumber()) {
-        Napi::TypeError::New(env, "Callback function and interval in microseconds required").ThrowAsJavaScriptException();
-        return env.Null();
+    /**
+     * Current wheel clock
+     * @returns Nanoseconds since the wheel started
+     */
+    uint64_t Now() const {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - origin).count());
     }
     
-    Napi::Function callback = info[0].As<Napi::Function>();
-    uint64_t interval = info[1].As<Napi::Number>().Uint32Value();
+    /**
+     * Links a timer by its deadline
+     * @param timer - Unlinked timer with deadline and interval set
+     */
+    void Schedule(WheelTimer* timer) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            Link(timer);
+        }
+        wake.notify_one();
+    }
     
-    if (interval == 0) {
-        Napi::TypeError::New(env, "Timer interval must be greater than 0").ThrowAsJavaScriptException();
-        return env.Null();
+    /**
+     * Unlinks a timer; expirations already queued are dropped by the caller
+     * @param timer - Timer to cancel
+     */
+    void Cancel(WheelTimer* timer) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (timer->level >= 0) {
+            Unlink(timer);
+        }
     }
     
-    try {
-        auto timerInfo = std::make_unique<TimerInfo>();
-        timerInfo->id = ++timerCounter;
-        timerInfo->interval = interval;
-        
-        // Create timer thread
-        timerInfo->timerThread = std::make_unique<std::thread>([callback, interval, env, timerInfo = timerInfo.get()]() {
-            auto nextTime = std::chrono::high_resolution_clock::now();
-            
-            while (timerInfo->running.load()) {
-                nextTime += std::chrono::microseconds(interval);
-                
-                // Call the JavaScript callback
-                try {
-                    callback.Call(env.Global(), {});
-                } catch (...) {
-                    // Handle callback exceptions
+    /**
+     * Unlinks every timer of an environment that is going away
+     * @param dispatcher - Dispatcher being finalized
+     */
+    void Detach(TimerDispatcher* dispatcher) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& entry : dispatcher->timers) {
+            if (entry.second->level >= 0) {
+                Unlink(entry.second.get());
+            }
+        }
+    }
+    
+private:
+    TimerWheel() : origin(std::chrono::steady_clock::now()) {
+        std::thread([this]() { Run(); }).detach();
+    }
+    
+    WheelTimer*& Head(int level, uint32_t slot) {
+        return level == kWheelOverflow ? overflow : slots[level][slot];
+    }
+    
+    void Link(WheelTimer* timer) {
+        uint64_t tick = std::max(timer->deadline >> kWheelTickShift, current);
+        // Lowest level whose slot range still shares every higher digit with the current tick
+        uint64_t differing = tick ^ current;
+        int level = 0;
+        while (level < static_cast<int>(kWheelLevels) && (differing >> ((level + 1) * kWheelLevelBits)) != 0) {
+            level++;
+        }
+        uint32_t slot = 0;
+        if (level >= static_cast<int>(kWheelLevels)) {
+            level = kWheelOverflow;
+        } else {
+            slot = static_cast<uint32_t>((tick >> (level * kWheelLevelBits)) & (kWheelSlots - 1));
+            occupied[level][slot / 64] |= 1ull << (slot % 64);
+        }
+        WheelTimer*& head = Head(level, slot);
+        timer->level = level;
+        timer->slot = slot;
+        timer->prev = nullptr;
+        timer->next = head;
+        if (head) {
+            head->prev = timer;
+        }
+        head = timer;
+    }
+    
+    void Unlink(WheelTimer* timer) {
+        WheelTimer*& head = Head(timer->level, timer->slot);
+        if (timer->prev) {
+            timer->prev->next = timer->next;
+        } else {
+            head = timer->next;
+        }
+        if (timer->next) {
+            timer->next->prev = timer->prev;
+        }
+        if (!head && timer->level != kWheelOverflow) {
+            occupied[timer->level][timer->slot / 64] &= ~(1ull << (timer->slot % 64));
+        }
+        timer->prev = timer->next = nullptr;
+        timer->level = -1;
+    }
+    
+    // Re-sorts one slot (or the overflow list) into the levels below
+    void Cascade(int level, uint32_t slot) {
+        WheelTimer* timer = Head(level, slot);
+        while (timer) {
+            WheelTimer* next = timer->next;
+            Unlink(timer);
+            Link(timer);
+            timer = next;
+        }
+    }
+    
+    // Moves the wheel to a tick, cascading every level whose slot boundary it lands on
+    void Enter(uint64_t tick) {
+        current = tick;
+        if ((tick & ((1ull << (kWheelLevels * kWheelLevelBits)) - 1)) == 0) {
+            Cascade(kWheelOverflow, 0);
+        }
+        for (int level = kWheelLevels - 1; level >= 1; level--) {
+            if ((tick & ((1ull << (level * kWheelLevelBits)) - 1)) == 0) {
+                Cascade(level, static_cast<uint32_t>((tick >> (level * kWheelLevelBits)) & (kWheelSlots - 1)));
+            }
+        }
+    }
+    
+    // First occupied slot index at or after `from`, or kWheelSlots
+    uint32_t NextOccupied(int level, uint32_t from) const {
+        for (uint32_t word = from / 64; word < kWheelWords; word++) {
+            uint64_t bits = occupied[level][word];
+            if (word == from / 64) {
+                bits &= ~0ull << (from % 64);
+            }
+            if (bits) {
+                return word * 64 + SIMD::CountTrailingZeros(bits);
+            }
+        }
+        return static_cast<uint32_t>(kWheelSlots);
+    }
+    
+    // Next tick at which a slot expires or cascades; UINT64_MAX when the wheel is empty
+    uint64_t NextEventTick() const {
+        uint64_t best = UINT64_MAX;
+        uint32_t slot = NextOccupied(0, static_cast<uint32_t>(current & (kWheelSlots - 1)));
+        if (slot < kWheelSlots) {
+            best = (current & ~static_cast<uint64_t>(kWheelSlots - 1)) | slot;
+        }
+        for (unsigned level = 1; level < kWheelLevels && best == UINT64_MAX; level++) {
+            unsigned shift = level * kWheelLevelBits;
+            uint32_t index = static_cast<uint32_t>((current >> shift) & (kWheelSlots - 1));
+            slot = index + 1 < kWheelSlots ? NextOccupied(level, index + 1) : static_cast<uint32_t>(kWheelSlots);
+            if (slot < kWheelSlots) {
+                best = ((current >> (shift + kWheelLevelBits)) << (shift + kWheelLevelBits)) |
+                       (static_cast<uint64_t>(slot) << shift);
+            }
+        }
+        if (best == UINT64_MAX && overflow) {
+            unsigned span = kWheelLevels * kWheelLevelBits;
+            best = ((current >> span) + 1) << span;
+        }
+        return best;
+    }
+    
+    // Fires every timer in the current level-0 slot that is due
+    void ExpireCurrent(uint64_t now, std::vector<TimerDispatcher*>& posts) {
+        WheelTimer* timer = slots[0][current & (kWheelSlots - 1)];
+        while (timer) {
+            WheelTimer* next = timer->next;
+            if (timer->deadline <= now) {
+                Unlink(timer);
+                if (timer->periodic) {
+                    // Fixed rate; intervals missed while the wheel was late are skipped
+                    timer->deadline += timer->interval;
+                    if (timer->deadline <= now) {
+                        timer->deadline += ((now - timer->deadline) / timer->interval + 1) * timer->interval;
+                    }
+                    Link(timer);
+                }
+                if (QueueExpiry(timer)) {
+                    posts.push_back(timer->dispatcher);
+                }
+            }
+            timer = next;
+        }
+    }
+    
+    // Earliest deadline in the current level-0 slot
+    uint64_t CurrentSlotDeadline() const {
+        uint64_t earliest = UINT64_MAX;
+        for (WheelTimer* timer = slots[0][current & (kWheelSlots - 1)]; timer; timer = timer->next) {
+            earliest = std::min(earliest, timer->deadline);
+        }
+        return earliest;
+    }
+    
+    void Run() {
+#ifdef __linux__
+        // Default 50 us slack would swallow most of the sub-millisecond precision
+        prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+        std::vector<TimerDispatcher*> posts;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            uint64_t now = Now();
+            uint64_t nowTick = now >> kWheelTickShift;
+            while (current < nowTick) {
+                uint64_t next = NextEventTick();
+                if (next > nowTick) {
+                    Enter(nowTick);
                     break;
                 }
-                
-                // High-precision sleep until next interval
-                std::this_thread::sleep_until(nextTime);
+                if (next > current) {
+                    Enter(next);
+                    continue; // a cascade may have filled slots before nowTick
+                }
+                ExpireCurrent(now, posts);
+                Enter(current + 1);
+            }
+            ExpireCurrent(now, posts);
+            
+            // Posting under the lock keeps dispatchers alive until the call is queued
+            for (TimerDispatcher* dispatcher : posts) {
+                PostDrain(dispatcher);
             }
+            posts.clear();
+            
+            uint64_t next = NextEventTick();
+            if (next == UINT64_MAX) {
+                wake.wait(lock);
+                continue;
+            }
+            uint64_t target = next == current ? CurrentSlotDeadline() : next << kWheelTickShift;
+            now = Now();
+            if (target > now + kWheelSpinNs) {
+                wake.wait_until(lock, origin + std::chrono::nanoseconds(target - kWheelSpinNs));
+            } else if (target > now) {
+                lock.unlock();
+                std::this_thread::yield();
+                lock.lock();
+            }
+        }
+    }
+    
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::chrono::steady_clock::time_point origin;
+    WheelTimer* slots[kWheelLevels][kWheelSlots] = {};
+    uint64_t occupied[kWheelLevels][kWheelWords] = {};
+    WheelTimer* overflow = nullptr;
+    uint64_t current = 0; // first tick not yet fully expired
+};
+
+static std::mutex dispatcherMutex;
+static std::unordered_map<napi_env, TimerDispatcher*> dispatchers;
+static std::atomic<uint64_t> timerCounter{0};
+
+/**
+ * Gets the dispatcher of an environment
+ * @param env - N-API environment
+ * @param create - Create it when missing
+ * @returns Dispatcher, or null
+ */
+static TimerDispatcher* GetDispatcher(Napi::Env env, bool create) {
+    std::lock_guard<std::mutex> lock(dispatcherMutex);
+    auto it = dispatchers.find(env);
+    if (it != dispatchers.end() || !create) {
+        return it != dispatchers.end() ? it->second : nullptr;
+    }
+    
+    TimerDispatcher* dispatcher = new TimerDispatcher();
+    // Finalized with the environment; no timer can reach the dispatcher afterwards
+    dispatcher->tsfn = Napi::ThreadSafeFunction::New(env, Napi::Function(), "lljsTimerWheel", 0, 1,
+        [dispatcher, key = static_cast<napi_env>(env)](Napi::Env) {
+            TimerWheel::Instance().Detach(dispatcher);
+            {
+                std::lock_guard<std::mutex> guard(dispatcherMutex);
+                dispatchers.erase(key);
+            }
+            delete dispatcher;
         });
-        
-        uint64_t timerId = timerInfo->id;
-        
-        {
-            std::lock_guard<std::mutex> lock(timerMutex);
-            timers[timerId] = std::move(timerInfo);
+    // Only active, referenced timers keep the event loop alive
+    dispatcher->tsfn.Unref(env);
+    dispatchers[env] = dispatcher;
+    return dispatcher;
+}
+
+/**
+ * Counts a referenced timer; the first one keeps the event loop alive
+ * @param env - N-API environment
+ * @param dispatcher - Environment's dispatcher
+ */
+static void RetainLoop(Napi::Env env, TimerDispatcher* dispatcher) {
+    if (dispatcher->refs++ == 0) {
+        dispatcher->tsfn.Ref(env);
+    }
+}
+
+/**
+ * Drops a referenced timer; the loop may exit once none are left
+ * @param env - N-API environment
+ * @param dispatcher - Environment's dispatcher
+ */
+static void ReleaseLoop(Napi::Env env, TimerDispatcher* dispatcher) {
+    if (--dispatcher->refs == 0) {
+        dispatcher->tsfn.Unref(env);
+    }
+}
+
+/**
+ * Runs a batch of expired timers; executes on the JS thread
+ * @param env - N-API environment
+ * @param dispatcher - Dispatcher whose ready queue is drained
+ */
+static void DrainTimers(Napi::Env env, TimerDispatcher* dispatcher) {
+    std::vector<uint64_t> ready;
+    {
+        std::lock_guard<std::mutex> lock(dispatcher->mutex);
+        ready.swap(dispatcher->ready);
+        dispatcher->posted = false;
+    }
+    
+    for (size_t i = 0; i < ready.size(); i++) {
+        auto it = dispatcher->timers.find(ready[i]);
+        if (it == dispatcher->timers.end()) {
+            continue; // destroyed after it expired
         }
+        WheelTimer* timer = it->second.get();
+        timer->queued.store(false, std::memory_order_release);
         
-        Napi::Object handle = Napi::Object::New(env);
-        handle.Set("id", Napi::Number::New(env, static_cast<double>(timerId)));
-        handle.Set("interval", Napi::Number::New(env, static_cast<double>(interval)));
+        // A one-shot timer is finished once it fires; keep it alive through the call
+        std::unique_ptr<WheelTimer> finished;
+        if (!timer->periodic) {
+            finished = std::move(it->second);
+            dispatcher->timers.erase(it);
+            if (!finished->unref) {
+                ReleaseLoop(env, dispatcher);
+            }
+        }
         
-        return handle;
-    } catch (const std::exception& e) {
-        Napi::Error::New(env, std::string("Failed to create timer: ") + e.what()).ThrowAsJavaScriptException();
+        timer->callback.Call({});
+        if (env.IsExceptionPending()) {
+            // Let the exception surface as uncaught and run the rest in a fresh call
+            std::lock_guard<std::mutex> lock(dispatcher->mutex);
+            dispatcher->ready.insert(dispatcher->ready.begin(), ready.begin() + i + 1, ready.end());
+            if (!dispatcher->ready.empty() && !dispatcher->posted) {
+                dispatcher->posted = true;
+                PostDrain(dispatcher);
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * Creates a high-precision timer on the shared timer wheel
+ * @param info - CallbackInfo containing callback function, interval in microseconds and optional options (repeat, unref)
+ * @returns Timer handle object
+ */
+Napi::Value CreateTimer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[0].IsFunction() || !info[1].IsNumber()) {
+        Napi::TypeError::New(env, "Callback function and interval in microseconds required").ThrowAsJavaScriptException();
         return env.Null();
     }
+    
+    double interval = info[1].As<Napi::Number>().DoubleValue();
+    if (!(interval > 0)) {
+        Napi::TypeError::New(env, "Timer interval must be greater than 0").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (interval > kMaxTimerIntervalMicros) {
+        Napi::RangeError::New(env, "Timer interval is too large").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    bool repeat = true;
+    bool unref = false;
+    if (info.Length() > 2 && info[2].IsObject()) {
+        Napi::Object options = info[2].As<Napi::Object>();
+        Napi::Value value = options.Get("repeat");
+        if (value.IsBoolean()) {
+            repeat = value.As<Napi::Boolean>();
+        }
+        value = options.Get("unref");
+        unref = value.IsBoolean() && value.As<Napi::Boolean>();
+    }
+    
+    TimerDispatcher* dispatcher = GetDispatcher(env, true);
+    TimerWheel& wheel = TimerWheel::Instance();
+    
+    auto timer = std::make_unique<WheelTimer>();
+    timer->id = ++timerCounter;
+    timer->interval = std::max<uint64_t>(1, static_cast<uint64_t>(interval * 1000.0));
+    timer->deadline = wheel.Now() + timer->interval;
+    timer->periodic = repeat;
+    timer->unref = unref;
+    timer->dispatcher = dispatcher;
+    timer->callback = Napi::Persistent(info[0].As<Napi::Function>());
+    
+    uint64_t timerId = timer->id;
+    WheelTimer* scheduled = timer.get();
+    dispatcher->timers[timerId] = std::move(timer);
+    if (!unref) {
+        RetainLoop(env, dispatcher);
+    }
+    wheel.Schedule(scheduled);
+    
+    Napi::Object handle = Napi::Object::New(env);
+    handle.Set("id", Napi::Number::New(env, static_cast<double>(timerId)));
+    handle.Set("interval", Napi::Number::New(env, interval));
+    handle.Set("repeat", Napi::Boolean::New(env, repeat));
+    return handle;
 }
 
 /**
- * Stops and destroys a timer
+ * Cancels and destroys a timer; expirations already queued for it are dropped
  * @param info - CallbackInfo containing timer handle
- * @returns Success status
+ * @returns True if the timer was still active
  */
 Napi::Value DestroyTimer(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
@@ -229,24 +667,22 @@ Napi::Value DestroyTimer(const Napi::CallbackInfo& info) {
         return Napi::Boolean::New(env, false);
     }
     
-    Napi::Object handle = info[0].As<Napi::Object>();
-    uint64_t timerId = static_cast<uint64_t>(handle.Get("id").As<Napi::Number>().DoubleValue());
-    
-    std::lock_guard<std::mutex> lock(timerMutex);
-    auto it = timers.find(timerId);
-    if (it == timers.end()) {
+    Napi::Value id = info[0].As<Napi::Object>().Get("id");
+    TimerDispatcher* dispatcher = GetDispatcher(env, false);
+    if (!id.IsNumber() || !dispatcher) {
         return Napi::Boolean::New(env, false);
     }
     
-    // Stop the timer
-    it->second->running = false;
-    
-    // Wait for thread to finish
-    if (it->second->timerThread && it->second->timerThread->joinable()) {
-        it->second->timerThread->join();
+    auto it = dispatcher->timers.find(static_cast<uint64_t>(id.As<Napi::Number>().DoubleValue()));
+    if (it == dispatcher->timers.end()) {
+        return Napi::Boolean::New(env, false);
     }
     
-    timers.erase(it);
+    TimerWheel::Instance().Cancel(it->second.get());
+    if (!it->second->unref) {
+        ReleaseLoop(env, dispatcher);
+    }
+    dispatcher->timers.erase(it);
     return Napi::Boolean::New(env, true);
 }
 
@@ -397,4 +833,695 @@ Napi::Value GetTimeZoneInfo(const Napi::CallbackInfo& info) {
     return result;
 }
 
-}
\ No newline at end of file
+// Cycle counter. x86 reads the TSC, using rdtscp where available so the read
+// waits for earlier instructions; AArch64 reads the virtual counter, whose
+// rate the CPU reports. The TSC rate is measured against steady_clock.
+// InitCycleClock takes the first sample at module load and the first
+// conversion takes the second, at least kCycleCalibrationNs later. Other
+// targets fall back to steady_clock nanoseconds.
+
+static constexpr int64_t kCycleCalibrationNs = 10000000;
+
+enum class CycleSource {
+    TSC,
+    CNTVCT,
+    SteadyClock
+};
+
+struct CycleClock {
+    CycleSource source = CycleSource::SteadyClock;
+    bool invariant = false;
+    bool ordered = false;
+    uint64_t startCycles = 0;
+    int64_t startNs = 0;
+    double frequency = 1e9; // Hz
+    uint64_t overhead = 0;  // ticks for back-to-back reads
+    std::once_flag calibrated;
+};
+
+static CycleClock cycleClock;
+
+static inline int64_t SteadyNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Reads the raw cycle counter
+ * @returns Counter ticks
+ */
+static inline uint64_t ReadCycleCounter() {
+#if defined(LLJS_ARCH_X86)
+    if (cycleClock.ordered) {
+        unsigned int aux;
+        return __rdtscp(&aux);
+    }
+    return __rdtsc();
+#elif defined(LLJS_ARCH_ARM64) && defined(_MSC_VER)
+    return static_cast<uint64_t>(_ReadStatusReg(ARM64_CNTVCT));
+#elif defined(LLJS_ARCH_ARM64)
+    uint64_t value;
+    __asm__ volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(value) : : "memory");
+    return value;
+#else
+    return static_cast<uint64_t>(SteadyNanoseconds());
+#endif
+}
+
+/**
+ * Samples the counter and steady_clock together, keeping the tightest of a few brackets
+ * @param cycles - Receives the counter midpoint
+ * @param nanoseconds - Receives the steady_clock reading
+ */
+static void SampleCycleClock(uint64_t& cycles, int64_t& nanoseconds) {
+    uint64_t tightest = UINT64_MAX;
+    for (int i = 0; i < 8; i++) {
+        uint64_t before = ReadCycleCounter();
+        int64_t now = SteadyNanoseconds();
+        uint64_t after = ReadCycleCounter();
+        if (after - before < tightest) {
+            tightest = after - before;
+            cycles = before + (after - before) / 2;
+            nanoseconds = now;
+        }
+    }
+}
+
+/**
+ * Detects the counter source and takes the first calibration sample
+ */
+void InitCycleClock() {
+#if defined(LLJS_ARCH_X86)
+    cycleClock.source = CycleSource::TSC;
+    cycleClock.invariant = CPU::HasInvariantTSC();
+    cycleClock.ordered = CPU::HasRDTSCP();
+#elif defined(LLJS_ARCH_ARM64)
+    // The generic timer runs at a fixed, architecturally reported rate
+    cycleClock.source = CycleSource::CNTVCT;
+    cycleClock.invariant = true;
+    cycleClock.ordered = true;
+#else
+    cycleClock.invariant = true;
+#endif
+    SampleCycleClock(cycleClock.startCycles, cycleClock.startNs);
+}
+
+/**
+ * Finishes calibration on first use
+ * @returns Cycle clock with frequency and overhead set
+ */
+static const CycleClock& CalibratedCycleClock() {
+    std::call_once(cycleClock.calibrated, []() {
+        if (cycleClock.source == CycleSource::TSC) {
+            int64_t waited = SteadyNanoseconds() - cycleClock.startNs;
+            if (waited < kCycleCalibrationNs) {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(kCycleCalibrationNs - waited));
+            }
+            uint64_t cycles;
+            int64_t nanoseconds;
+            SampleCycleClock(cycles, nanoseconds);
+            cycleClock.frequency = static_cast<double>(cycles - cycleClock.startCycles) * 1e9 /
+                                   static_cast<double>(nanoseconds - cycleClock.startNs);
+        } else if (cycleClock.source == CycleSource::CNTVCT) {
+#if defined(LLJS_ARCH_ARM64) && defined(_MSC_VER)
+            cycleClock.frequency = static_cast<double>(_ReadStatusReg(ARM64_CNTFRQ));
+#elif defined(LLJS_ARCH_ARM64)
+            uint64_t frequency;
+            __asm__ volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+            cycleClock.frequency = static_cast<double>(frequency);
+#endif
+        }
+        
+        uint64_t overhead = UINT64_MAX;
+        for (int i = 0; i < 64; i++) {
+            uint64_t before = ReadCycleCounter();
+            uint64_t after = ReadCycleCounter();
+            overhead = std::min(overhead, after - before);
+        }
+        cycleClock.overhead = overhead;
+    });
+    return cycleClock;
+}
+
+/**
+ * Reads the cycle counter (TSC on x86, CNTVCT on ARM64)
+ * @param info - CallbackInfo (no parameters required)
+ * @returns Counter ticks as a BigInt
+ */
+Napi::Value ReadCycles(const Napi::CallbackInfo& info) {
+    return Napi::BigInt::New(info.Env(), ReadCycleCounter());
+}
+
+/**
+ * Writes the cycle counter into a BigUint64Array slot without allocating
+ * @param info - CallbackInfo containing target BigUint64Array and optional index (default 0)
+ * @returns Undefined
+ */
+Napi::Value WriteCycles(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    // One typedarray query instead of the wrapper's per-property lookups; this runs in hot loops
+    napi_typedarray_type type;
+    size_t length = 0;
+    void* data = nullptr;
+    if (info.Length() < 1 ||
+        napi_get_typedarray_info(env, info[0], &type, &length, &data, nullptr, nullptr) != napi_ok ||
+        type != napi_biguint64_array) {
+        Napi::TypeError::New(env, "BigUint64Array target required").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+    
+    double index = info.Length() > 1 && info[1].IsNumber() ? info[1].As<Napi::Number>().DoubleValue() : 0;
+    if (!(index >= 0) || index >= static_cast<double>(length)) {
+        Napi::RangeError::New(env, "Index out of range").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+    
+    static_cast<uint64_t*>(data)[static_cast<size_t>(index)] = ReadCycleCounter();
+    return env.Undefined();
+}
+
+/**
+ * Converts a cycle count (usually a difference of two reads) to nanoseconds
+ * @param info - CallbackInfo containing cycle count as number or BigInt
+ * @returns Nanoseconds
+ */
+Napi::Value CyclesToNanoseconds(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    double cycles;
+    if (info.Length() > 0 && info[0].IsBigInt()) {
+        bool lossless = false;
+        cycles = static_cast<double>(info[0].As<Napi::BigInt>().Uint64Value(&lossless));
+        if (!lossless) {
+            Napi::RangeError::New(env, "Cycle count must be a non-negative BigInt that fits in 64 bits").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+    } else if (info.Length() > 0 && info[0].IsNumber()) {
+        cycles = info[0].As<Napi::Number>().DoubleValue();
+    } else {
+        Napi::TypeError::New(env, "Cycle count (number or bigint) required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    return Napi::Number::New(env, cycles * 1e9 / CalibratedCycleClock().frequency);
+}
+
+/**
+ * Describes the cycle counter; the first call may wait for calibration to finish
+ * @param info - CallbackInfo (no parameters required)
+ * @returns Object with source, frequency (Hz), invariant, ordered and overhead (ticks per read)
+ */
+Napi::Value GetCycleClockInfo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    const CycleClock& clock = CalibratedCycleClock();
+    
+    const char* source = "steady_clock";
+    if (clock.source == CycleSource::TSC) {
+        source = clock.ordered ? "rdtscp" : "rdtsc";
+    } else if (clock.source == CycleSource::CNTVCT) {
+        source = "cntvct";
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("source", Napi::String::New(env, source));
+    result.Set("frequency", Napi::Number::New(env, clock.frequency));
+    result.Set("invariant", Napi::Boolean::New(env, clock.invariant));
+    result.Set("ordered", Napi::Boolean::New(env, clock.ordered));
+    result.Set("overhead", Napi::Number::New(env, static_cast<double>(clock.overhead)));
+    return result;
+}
+
+// HDR histogram. Values are bucketed with a fixed number of significant
+// decimal digits: a bucket doubles the range of the previous one, and each
+// bucket splits its range into the same number of linear sub-buckets.
+// Counts are relaxed atomics, so any thread holding the id can record
+// without locking. Snapshots drain counts with exchange(), so a
+// snapshot-and-reset loses nothing recorded concurrently.
+
+static constexpr uint64_t kHistogramMaxValue = uint64_t(1) << 62;
+
+struct Histogram {
+    uint64_t lowest = 1;
+    uint64_t highest = 0;
+    int sigfigs = 3;
+    unsigned unitMagnitude = 0;
+    unsigned subBucketHalfCountMagnitude = 0;
+    uint64_t subBucketCount = 0;
+    uint64_t subBucketHalfCount = 0;
+    uint64_t subBucketMask = 0;
+    size_t countsLength = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> counts;
+    std::atomic<uint64_t> minValue{UINT64_MAX};
+    std::atomic<uint64_t> maxValue{0};
+    
+    unsigned BucketIndex(uint64_t value) const {
+        unsigned pow2Ceiling = 64 - SIMD::CountLeadingZeros(value | subBucketMask);
+        return pow2Ceiling - unitMagnitude - (subBucketHalfCountMagnitude + 1);
+    }
+    
+    size_t CountsIndex(uint64_t value) const {
+        unsigned bucket = BucketIndex(value);
+        uint64_t subBucket = value >> (bucket + unitMagnitude);
+        return (static_cast<size_t>(bucket + 1) << subBucketHalfCountMagnitude) +
+               static_cast<size_t>(subBucket - subBucketHalfCount);
+    }
+    
+    uint64_t ValueAtIndex(size_t index) const {
+        int64_t bucket = static_cast<int64_t>(index >> subBucketHalfCountMagnitude) - 1;
+        uint64_t subBucket = (index & (subBucketHalfCount - 1)) + subBucketHalfCount;
+        if (bucket < 0) {
+            subBucket -= subBucketHalfCount;
+            bucket = 0;
+        }
+        return subBucket << (bucket + unitMagnitude);
+    }
+    
+    // Width of the range of values that share a count with `value`
+    uint64_t EquivalentRange(uint64_t value) const {
+        unsigned bucket = BucketIndex(value);
+        uint64_t subBucket = value >> (bucket + unitMagnitude);
+        return uint64_t(1) << (unitMagnitude + (subBucket >= subBucketCount ? bucket + 1 : bucket));
+    }
+    
+    uint64_t LowestEquivalent(uint64_t value) const {
+        unsigned bucket = BucketIndex(value);
+        return (value >> (bucket + unitMagnitude)) << (bucket + unitMagnitude);
+    }
+    
+    uint64_t HighestEquivalent(uint64_t value) const {
+        return LowestEquivalent(value) + EquivalentRange(value) - 1;
+    }
+    
+    uint64_t MedianEquivalent(uint64_t value) const {
+        return LowestEquivalent(value) + (EquivalentRange(value) >> 1);
+    }
+    
+    /**
+     * Records occurrences of a value; values above the range count as the highest trackable value
+     * @param value - Value to record
+     * @param count - Occurrences
+     */
+    void Record(uint64_t value, uint64_t count) {
+        value = std::min(value, highest);
+        counts[CountsIndex(value)].fetch_add(count, std::memory_order_relaxed);
+        uint64_t seen = minValue.load(std::memory_order_relaxed);
+        while (value < seen && !minValue.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+        }
+        seen = maxValue.load(std::memory_order_relaxed);
+        while (value > seen && !maxValue.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+        }
+    }
+};
+
+// Counts copied out of a histogram; percentiles are computed on the copy
+struct HistogramCounts {
+    std::vector<uint64_t> counts;
+    uint64_t total = 0;
+    uint64_t minValue = 0;
+    uint64_t maxValue = 0;
+};
+
+static HandleTable<Histogram> histograms;
+
+/**
+ * Copies (and optionally drains) a histogram's counts
+ * @param histogram - Source histogram
+ * @param reset - Zero the counts while copying them
+ * @returns Snapshot
+ */
+static HistogramCounts TakeHistogramSnapshot(Histogram& histogram, bool reset) {
+    HistogramCounts snapshot;
+    snapshot.counts.resize(histogram.countsLength);
+    for (size_t i = 0; i < histogram.countsLength; i++) {
+        uint64_t count = reset ? histogram.counts[i].exchange(0, std::memory_order_relaxed)
+                               : histogram.counts[i].load(std::memory_order_relaxed);
+        snapshot.counts[i] = count;
+        snapshot.total += count;
+    }
+    if (reset) {
+        snapshot.minValue = histogram.minValue.exchange(UINT64_MAX, std::memory_order_relaxed);
+        snapshot.maxValue = histogram.maxValue.exchange(0, std::memory_order_relaxed);
+    } else {
+        snapshot.minValue = histogram.minValue.load(std::memory_order_relaxed);
+        snapshot.maxValue = histogram.maxValue.load(std::memory_order_relaxed);
+    }
+    if (snapshot.total == 0) {
+        snapshot.minValue = snapshot.maxValue = 0;
+    }
+    return snapshot;
+}
+
+/**
+ * Value at a percentile of a snapshot
+ * @param histogram - Histogram the snapshot came from
+ * @param snapshot - Counts
+ * @param percentile - Percentile in [0, 100]
+ * @returns Highest value equivalent to the percentile's bucket, capped at the recorded maximum
+ */
+static double SnapshotPercentile(const Histogram& histogram, const HistogramCounts& snapshot, double percentile) {
+    if (snapshot.total == 0) {
+        return 0;
+    }
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(snapshot.total) + 0.5));
+    uint64_t running = 0;
+    for (size_t i = 0; i < snapshot.counts.size(); i++) {
+        running += snapshot.counts[i];
+        if (running >= target) {
+            uint64_t value = histogram.HighestEquivalent(histogram.ValueAtIndex(i));
+            return static_cast<double>(std::min(std::max(value, snapshot.minValue), snapshot.maxValue));
+        }
+    }
+    return static_cast<double>(snapshot.maxValue);
+}
+
+/**
+ * Reads a non-negative value to record
+ * @returns False (with a pending exception) on invalid input
+ */
+static bool ToHistogramValue(Napi::Env env, const Napi::Value& value, uint64_t& result) {
+    if (value.IsBigInt()) {
+        bool lossless = false;
+        result = value.As<Napi::BigInt>().Uint64Value(&lossless);
+        if (!lossless) {
+            Napi::RangeError::New(env, "Value must be a non-negative BigInt that fits in 64 bits").ThrowAsJavaScriptException();
+            return false;
+        }
+        return true;
+    }
+    if (!value.IsNumber()) {
+        Napi::TypeError::New(env, "Value (number or bigint) required").ThrowAsJavaScriptException();
+        return false;
+    }
+    double number = value.As<Napi::Number>().DoubleValue();
+    if (!(number >= 0)) {
+        Napi::RangeError::New(env, "Value must be a non-negative number").ThrowAsJavaScriptException();
+        return false;
+    }
+    result = number >= static_cast<double>(kHistogramMaxValue) ? kHistogramMaxValue : static_cast<uint64_t>(number);
+    return true;
+}
+
+/**
+ * Creates an HDR histogram
+ * @param info - CallbackInfo containing optional options (lowest, highest, sigfigs)
+ * @returns Histogram handle object
+ */
+Napi::Value CreateHistogram(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    // Defaults cover 1 ns to one hour at three significant digits
+    double lowest = 1;
+    double highest = 3.6e12;
+    double sigfigs = 3;
+    if (info.Length() > 0 && info[0].IsObject()) {
+        Napi::Object options = info[0].As<Napi::Object>();
+        if (options.Get("lowest").IsNumber()) {
+            lowest = options.Get("lowest").As<Napi::Number>().DoubleValue();
+        }
+        if (options.Get("highest").IsNumber()) {
+            highest = options.Get("highest").As<Napi::Number>().DoubleValue();
+        }
+        if (options.Get("sigfigs").IsNumber()) {
+            sigfigs = options.Get("sigfigs").As<Napi::Number>().DoubleValue();
+        }
+    }
+    
+    if (!(lowest >= 1) || !(highest >= 2 * lowest) || highest > static_cast<double>(kHistogramMaxValue)) {
+        Napi::RangeError::New(env, "Histogram needs lowest >= 1 and lowest * 2 <= highest <= 2^62").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (!(sigfigs >= 1 && sigfigs <= 5) || sigfigs != std::floor(sigfigs)) {
+        Napi::RangeError::New(env, "Histogram sigfigs must be an integer from 1 to 5").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    auto histogram = std::make_shared<Histogram>();
+    histogram->lowest = static_cast<uint64_t>(lowest);
+    histogram->highest = static_cast<uint64_t>(highest);
+    histogram->sigfigs = static_cast<int>(sigfigs);
+    
+    uint64_t singleUnitResolution = 2;
+    for (int i = 0; i < histogram->sigfigs; i++) {
+        singleUnitResolution *= 10;
+    }
+    unsigned subBucketCountMagnitude = 64 - SIMD::CountLeadingZeros(singleUnitResolution - 1);
+    histogram->subBucketHalfCountMagnitude = subBucketCountMagnitude - 1;
+    histogram->unitMagnitude = 63 - SIMD::CountLeadingZeros(histogram->lowest);
+    histogram->subBucketCount = uint64_t(1) << subBucketCountMagnitude;
+    histogram->subBucketHalfCount = histogram->subBucketCount / 2;
+    histogram->subBucketMask = (histogram->subBucketCount - 1) << histogram->unitMagnitude;
+    if (histogram->unitMagnitude + histogram->subBucketHalfCountMagnitude > 61) {
+        Napi::RangeError::New(env, "Histogram lowest value is too large for the requested sigfigs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    size_t bucketCount = 1;
+    uint64_t smallestUntrackable = histogram->subBucketCount << histogram->unitMagnitude;
+    while (smallestUntrackable <= histogram->highest) {
+        if (smallestUntrackable > static_cast<uint64_t>(INT64_MAX) / 2) {
+            bucketCount++;
+            break;
+        }
+        smallestUntrackable <<= 1;
+        bucketCount++;
+    }
+    histogram->countsLength = (bucketCount + 1) * static_cast<size_t>(histogram->subBucketHalfCount);
+    histogram->counts.reset(new std::atomic<uint64_t>[histogram->countsLength]);
+    for (size_t i = 0; i < histogram->countsLength; i++) {
+        histogram->counts[i].store(0, std::memory_order_relaxed);
+    }
+    
+    uint64_t histogramId = histograms.Insert(histogram);
+    if (histogramId == 0) {
+        Napi::Error::New(env, "Too many histogram handles").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object handle = Napi::Object::New(env);
+    handle.Set("id", Napi::Number::New(env, static_cast<double>(histogramId)));
+    // Dropping the handle releases the counts; other threads attach by id
+    handle.Set("handle", Napi::External<void>::New(env, nullptr, [histogramId](Napi::Env, void*) {
+        histograms.Remove(histogramId);
+    }));
+    handle.Set("lowest", Napi::Number::New(env, static_cast<double>(histogram->lowest)));
+    handle.Set("highest", Napi::Number::New(env, static_cast<double>(histogram->highest)));
+    handle.Set("sigfigs", Napi::Number::New(env, histogram->sigfigs));
+    return handle;
+}
+
+/**
+ * Resolves a histogram handle; throws on failure
+ * @returns Histogram, or null
+ */
+static std::shared_ptr<Histogram> ToHistogram(Napi::Env env, const Napi::Value& value) {
+    if (!value.IsObject()) {
+        Napi::TypeError::New(env, "Histogram handle object required").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    Napi::Value id = value.As<Napi::Object>().Get("id");
+    std::shared_ptr<Histogram> histogram = id.IsNumber()
+        ? histograms.Get(static_cast<uint64_t>(id.As<Napi::Number>().DoubleValue()))
+        : nullptr;
+    if (!histogram) {
+        Napi::Error::New(env, "Invalid histogram handle").ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    return histogram;
+}
+
+/**
+ * Records a value; safe to call concurrently from any thread
+ * @param info - CallbackInfo containing histogram handle, value and optional count (default 1)
+ * @returns Undefined
+ */
+Napi::Value HistogramRecord(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<Histogram> histogram = ToHistogram(env, info[0]);
+    uint64_t value;
+    if (!histogram || !ToHistogramValue(env, info[1], value)) {
+        return env.Undefined();
+    }
+    uint64_t count = 1;
+    if (info.Length() > 2 && info[2].IsNumber()) {
+        double requested = info[2].As<Napi::Number>().DoubleValue();
+        count = requested >= 1 ? static_cast<uint64_t>(requested) : 0;
+    }
+    if (count > 0) {
+        histogram->Record(value, count);
+    }
+    return env.Undefined();
+}
+
+/**
+ * Times a function with the cycle counter and records the duration in nanoseconds
+ * @param info - CallbackInfo containing histogram handle and function
+ * @returns The function's return value
+ */
+Napi::Value HistogramTime(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<Histogram> histogram = ToHistogram(env, info[0]);
+    if (!histogram) {
+        return env.Null();
+    }
+    if (info.Length() < 2 || !info[1].IsFunction()) {
+        Napi::TypeError::New(env, "Function to time required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Function fn = info[1].As<Napi::Function>();
+    double nanosecondsPerCycle = 1e9 / CalibratedCycleClock().frequency;
+    uint64_t start = ReadCycleCounter();
+    Napi::Value result = fn.Call({});
+    uint64_t end = ReadCycleCounter();
+    if (env.IsExceptionPending()) {
+        return env.Null();
+    }
+    histogram->Record(static_cast<uint64_t>(static_cast<double>(end - start) * nanosecondsPerCycle), 1);
+    return result;
+}
+
+/**
+ * Adds every count of another histogram; the ranges may differ
+ * @param info - CallbackInfo containing target and source histogram handles
+ * @returns Number of values added
+ */
+Napi::Value HistogramAdd(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<Histogram> target = ToHistogram(env, info[0]);
+    if (!target) {
+        return env.Null();
+    }
+    std::shared_ptr<Histogram> source = ToHistogram(env, info[1]);
+    if (!source) {
+        return env.Null();
+    }
+    
+    HistogramCounts snapshot = TakeHistogramSnapshot(*source, false);
+    bool sameLayout = source->countsLength == target->countsLength &&
+                      source->unitMagnitude == target->unitMagnitude &&
+                      source->subBucketHalfCountMagnitude == target->subBucketHalfCountMagnitude;
+    for (size_t i = 0; i < snapshot.counts.size(); i++) {
+        if (snapshot.counts[i] == 0) {
+            continue;
+        }
+        if (sameLayout) {
+            target->counts[i].fetch_add(snapshot.counts[i], std::memory_order_relaxed);
+        } else {
+            target->Record(source->MedianEquivalent(source->ValueAtIndex(i)), snapshot.counts[i]);
+        }
+    }
+    if (snapshot.total > 0) {
+        // Keep the exact extremes rather than their bucket equivalents
+        target->Record(snapshot.minValue, 0);
+        target->Record(snapshot.maxValue, 0);
+    }
+    return Napi::Number::New(env, static_cast<double>(snapshot.total));
+}
+
+/**
+ * Gets the value at a percentile
+ * @param info - CallbackInfo containing histogram handle and percentile (0-100)
+ * @returns Value, or 0 for an empty histogram
+ */
+Napi::Value HistogramPercentile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<Histogram> histogram = ToHistogram(env, info[0]);
+    if (!histogram) {
+        return env.Null();
+    }
+    if (info.Length() < 2 || !info[1].IsNumber()) {
+        Napi::TypeError::New(env, "Percentile required").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    HistogramCounts snapshot = TakeHistogramSnapshot(*histogram, false);
+    return Napi::Number::New(env, SnapshotPercentile(*histogram, snapshot, info[1].As<Napi::Number>().DoubleValue()));
+}
+
+/**
+ * Summarizes a histogram, optionally resetting it atomically per bucket
+ * @param info - CallbackInfo containing histogram handle and optional reset flag
+ * @returns Object with count, min, max, mean, stddev, p50, p90, p99, p999 and p9999
+ */
+Napi::Value HistogramSnapshot(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<Histogram> histogram = ToHistogram(env, info[0]);
+    if (!histogram) {
+        return env.Null();
+    }
+    bool reset = info.Length() > 1 && info[1].IsBoolean() && info[1].As<Napi::Boolean>();
+    HistogramCounts snapshot = TakeHistogramSnapshot(*histogram, reset);
+    
+    double mean = 0;
+    double stddev = 0;
+    if (snapshot.total > 0) {
+        double sum = 0;
+        for (size_t i = 0; i < snapshot.counts.size(); i++) {
+            if (snapshot.counts[i]) {
+                sum += static_cast<double>(histogram->MedianEquivalent(histogram->ValueAtIndex(i))) * snapshot.counts[i];
+            }
+        }
+        mean = sum / static_cast<double>(snapshot.total);
+        double squares = 0;
+        for (size_t i = 0; i < snapshot.counts.size(); i++) {
+            if (snapshot.counts[i]) {
+                double deviation = static_cast<double>(histogram->MedianEquivalent(histogram->ValueAtIndex(i))) - mean;
+                squares += deviation * deviation * snapshot.counts[i];
+            }
+        }
+        stddev = std::sqrt(squares / static_cast<double>(snapshot.total));
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("count", Napi::Number::New(env, static_cast<double>(snapshot.total)));
+    result.Set("min", Napi::Number::New(env, static_cast<double>(snapshot.minValue)));
+    result.Set("max", Napi::Number::New(env, static_cast<double>(snapshot.maxValue)));
+    result.Set("mean", Napi::Number::New(env, mean));
+    result.Set("stddev", Napi::Number::New(env, stddev));
+    static const std::pair<const char*, double> kPercentiles[] = {
+        {"p50", 50}, {"p90", 90}, {"p99", 99}, {"p999", 99.9}, {"p9999", 99.99}
+    };
+    for (const auto& percentile : kPercentiles) {
+        result.Set(percentile.first, Napi::Number::New(env, SnapshotPercentile(*histogram, snapshot, percentile.second)));
+    }
+    return result;
+}
+
+/**
+ * Zeroes a histogram
+ * @param info - CallbackInfo containing histogram handle
+ * @returns Success status
+ */
+Napi::Value HistogramReset(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<Histogram> histogram = ToHistogram(env, info[0]);
+    if (!histogram) {
+        return Napi::Boolean::New(env, false);
+    }
+    TakeHistogramSnapshot(*histogram, true);
+    return Napi::Boolean::New(env, true);
+}
+
+/**
+ * Releases a histogram before garbage collection would
+ * @param info - CallbackInfo containing histogram handle
+ * @returns Success status
+ */
+Napi::Value DestroyHistogram(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (!ToHistogram(env, info[0])) {
+        return Napi::Boolean::New(env, false);
+    }
+    uint64_t histogramId = static_cast<uint64_t>(info[0].As<Napi::Object>().Get("id").As<Napi::Number>().DoubleValue());
+    return Napi::Boolean::New(env, histograms.Remove(histogramId) != nullptr);
+}
+
+}
@@ -1,4 +1,7 @@
-import LLJS, { Memory, CPU, System, Time, Math as LLJSMath } from '../src/index';
+import LLJS, { Memory, CPU, System, Time, IO, Threading, Math as LLJSMath, MathOpcode, WalkEntryType } from '../src/index';
+import * as fs from 'fs';
+import * as os from 'os';
+import * as path from 'path';
 
 // Check if native module is available
 const isNativeAvailable = (() => {
@@ -64,6 +67,18 @@ describeWithNative('LLJS Memory Module (Native)', () => {
     }
   });
 
+  test('should free native buffers deterministically', () => {
+    const buffer = Memory.allocateBuffer(4096) as Buffer;
+    const view = buffer.subarray(0, 16);
+    expect(Memory.getMemoryUsage().buffers?.bytes).toBeGreaterThanOrEqual(4096);
+
+    expect(Memory.freeBuffer(buffer)).toBe(true);
+    expect(buffer.length).toBe(0);
+    expect(view.length).toBe(0);
+    expect(Memory.freeBuffer(buffer)).toBe(false);
+    expect(Memory.freeBuffer(Buffer.alloc(8))).toBe(false);
+  });
+
   test('should copy memory between buffers', () => {
     const source = Buffer.from('Hello, World!');
     const dest = Memory.allocateBuffer(20);
@@ -86,6 +101,20 @@ describeWithNative('LLJS Memory Module (Native)', () => {
     }
   });
 
+  test('should stream and split large copies and fills', () => {
+    const size = (8 << 20) + 37;
+    const source = Buffer.alloc(size);
+    for (let i = 0; i < size; i += 4093) source[i] = i & 0xff;
+    const dest = Buffer.alloc(size + 3).subarray(3);
+
+    expect(Memory.copyMemory(dest, source, size, { streaming: true, parallel: true })).toBe(true);
+    expect(dest.equals(source)).toBe(true);
+    expect(Memory.setMemory(dest, 0x5a, size, { streaming: true })).toBe(true);
+    expect(dest[0]).toBe(0x5a);
+    expect(dest[size - 1]).toBe(0x5a);
+    expect(() => Memory.copyMemory(dest, source, size + 1)).toThrow();
+  });
+
   test('should compare memory regions', () => {
     const buffer1 = Buffer.from('test');
     const buffer2 = Buffer.from('test');
@@ -107,6 +136,39 @@ describeWithNative('LLJS Memory Module (Native)', () => {
     expect(buffer).not.toBeNull();
     expect(buffer?.length).toBe(1024);
   });
+
+  test('should allocate page-mapped memory with huge page, lock and prefault options', () => {
+    const buffer = Memory.alignedAlloc(4 << 20, 4096, { hugePages: '2M', lock: true, prefault: true });
+    expect(buffer.length).toBe(4 << 20);
+    // Without reserved huge pages the allocation falls back and says so
+    expect([4096, 16384, 65536, 2 << 20]).toContain(buffer.pageSize);
+    expect(typeof buffer.locked).toBe('boolean');
+    buffer.fill(1);
+    expect(buffer[buffer.length - 1]).toBe(1);
+    expect(Memory.freeBuffer(buffer)).toBe(true);
+    expect(() => Memory.alignedAlloc(4096, 3, {})).toThrow();
+    expect(() => Memory.alignedAlloc(4096, 64, { hugePages: '4K' as any })).toThrow();
+  });
+
+  test('should allocate, release and reset pooled buffers', () => {
+    const pool = Memory.createPool({ slabSize: 4096, classes: [256, 1024], alignment: 64 });
+    const first = Memory.poolAlloc(pool, 100);
+    const second = Memory.poolAlloc(pool, 200);
+    expect(first.length).toBe(100);
+    expect(second.byteOffset - first.byteOffset).toBe(256);
+
+    expect(Memory.poolRelease(pool, first)).toBe(true);
+    expect(Memory.poolRelease(pool, first)).toBe(false);
+    expect(Memory.poolAlloc(pool, 50).byteOffset).toBe(first.byteOffset);
+
+    const scratch = Memory.poolArenaAlloc(pool, 10);
+    expect(Memory.poolRelease(pool, scratch)).toBe(false);
+    expect(Memory.getMemoryUsage().pools?.usedBytes).toBeGreaterThan(0);
+
+    expect(Memory.poolReset(pool)).toBe(true);
+    expect(Memory.poolArenaAlloc(pool, 10).byteOffset).toBe(scratch.byteOffset);
+    expect(Memory.destroyPool(pool)).toBe(true);
+  });
 });
 
 describeWithNative('LLJS CPU Module (Native)', () => {
@@ -121,6 +183,11 @@ describeWithNative('LLJS CPU Module (Native)', () => {
     expect(cpuInfo.cores).toBeGreaterThan(0);
   });
 
+  test('should report the active SIMD level', () => {
+    const cpuInfo = CPU.getCPUInfo();
+    expect(['scalar', 'sse2', 'avx2', 'avx512', 'neon']).toContain(cpuInfo.simd);
+  });
+
   test('should get core count', () => {
     const coreCount = CPU.getCoreCount();
     expect(typeof coreCount).toBe('number');
@@ -154,6 +221,16 @@ describeWithNative('LLJS CPU Module (Native)', () => {
     expect(registers).toHaveProperty('warning');
   });
 
+  test('should prefetch buffer ranges', () => {
+    const data = new Float64Array(4096);
+    expect(CPU.prefetchRange(data)).toBe(data.byteLength);
+    expect(CPU.prefetchRange(data, 64, 1000, 0)).toBe(1000);
+    expect(() => CPU.prefetchRange(data, 8, data.byteLength)).toThrow();
+    expect(() => CPU.prefetchRange(data, -1)).toThrow(RangeError);
+    expect(() => CPU.prefetchMemory(-1)).toThrow(RangeError);
+    expect(() => CPU.prefetchMemory(NaN)).toThrow(RangeError);
+  });
+
   test('should get CPU temperature', () => {
     const temp = CPU.getCPUTemperature();
     expect(typeof temp).toBe('number');
@@ -168,6 +245,54 @@ describeWithNative('LLJS CPU Module (Native)', () => {
     expect(freq).toHaveProperty('max');
     expect(typeof freq.current).toBe('number');
   });
+
+  test('should count events around a region with perf counters', () => {
+    let counters: ReturnType<typeof CPU.perfCounters.open>;
+    try {
+      counters = CPU.perfCounters.open(['task-clock', 'page-faults']);
+    } catch (error) {
+      // Non-Linux hosts, or perf_event_paranoid forbidding even software events
+      expect(String(error)).toMatch(/perf/i);
+      return;
+    }
+    counters.start();
+    let sum = 0;
+    for (let i = 0; i < 1e6; i++) {
+      sum += i;
+    }
+    const output = new Float64Array(2);
+    expect(counters.stop(output)).toBe(output);
+    expect(sum).toBeGreaterThan(0);
+    expect(output[0]).toBeGreaterThan(0);
+    expect(counters.read()[0]).toBeGreaterThanOrEqual(output[0]);
+    expect(counters.close()).toBe(true);
+    expect(() => CPU.perfCounters.open(['bogus'] as any)).toThrow();
+  });
+
+  test('should report topology and place memory and pool threads on it', () => {
+    const topology = CPU.getTopology();
+    expect(topology.cpus.length).toBeGreaterThan(0);
+    for (const cpu of topology.cpus) {
+      expect(topology.packages[cpu.package]).toContain(cpu.cpu);
+      expect(topology.cores[cpu.core]).toContain(cpu.cpu);
+    }
+    const node = topology.nodes[0].node;
+    expect(topology.nodes[0].cpus.length).toBeGreaterThan(0);
+
+    const buffer = Memory.allocateOnNode(8192, node);
+    expect(buffer.length).toBe(8192);
+    buffer.fill(7);
+    const placed = Memory.getMemoryNode(buffer, 4096);
+    expect(placed === node || placed === -1).toBe(true);
+    expect(() => Memory.getMemoryNode(buffer, 2 ** 32 + 1)).toThrow(RangeError);
+    expect(Memory.freeBuffer(buffer)).toBe(true);
+
+    if (process.platform === 'linux') {
+      expect(Threading.setPoolAffinity(topology.cores)).toBe(true);
+      expect(Threading.setPoolAffinity(null)).toBe(true);
+    }
+    expect(() => Threading.setPoolAffinity([] as any)).toThrow();
+  });
 });
 
 describeWithNative('LLJS System Module (Native)', () => {
@@ -214,6 +339,51 @@ describeWithNative('LLJS System Module (Native)', () => {
       expect(typeof process.name).toBe('string');
     }
   });
+
+  test('should read the process table in columns with a changed-only mode', () => {
+    const snapshot = System.createProcessSnapshot();
+    const table = snapshot.read();
+    expect(table.count).toBeGreaterThan(0);
+    expect(table.pid).toBeInstanceOf(Int32Array);
+    expect(table.rss).toHaveLength(table.count);
+    expect(table.names).toHaveLength(table.count);
+
+    const self = Array.from(table.pid).indexOf(process.pid);
+    if (process.platform === 'linux') {
+      expect(self).toBeGreaterThanOrEqual(0);
+      expect(table.rss[self]).toBeGreaterThan(0);
+      expect(table.threads[self]).toBeGreaterThan(0);
+      expect(table.ppid[self]).toBe(process.ppid);
+    }
+
+    const changes = snapshot.read({ changedOnly: true, names: false });
+    expect(changes.count).toBeLessThanOrEqual(table.count);
+    expect(changes.names).toBeUndefined();
+    expect(snapshot.close()).toBe(true);
+    expect(() => snapshot.read()).toThrow();
+  });
+
+  if (process.platform !== 'win32') {
+    test('should spawn a process without a shell and collect its output', async () => {
+      const child = System.spawn(process.execPath, ['-e', 'process.stdout.write("a b"); process.stderr.write("e"); process.exit(3)']);
+      expect(child.pid).toBeGreaterThan(0);
+      const result = await child.exited;
+      expect(result.code).toBe(3);
+      expect(result.signal).toBeNull();
+      expect(result.stdout!.toString()).toBe('a b');
+      expect(result.stderr!.toString()).toBe('e');
+      expect(child.kill()).toBe(false);
+    });
+
+    test('should spawn children with default signal dispositions', async () => {
+      // yes must die of SIGPIPE (status 128 + 13) rather than report EPIPE
+      const child = System.spawn('/bin/sh', ['-c', '{ yes; echo $? >&2; } | head -1']);
+      const result = await child.exited;
+      expect(result.code).toBe(0);
+      expect(result.stdout!.toString()).toBe('y\n');
+      expect(result.stderr!.toString()).toBe('141\n');
+    });
+  }
 });
 
 describeWithNative('LLJS Time Module (Native)', () => {
@@ -267,6 +437,72 @@ describeWithNative('LLJS Time Module (Native)', () => {
     expect(tzInfo).toHaveProperty('daylightName');
     expect(tzInfo).toHaveProperty('isDST');
   });
+
+  test('should run one-shot and periodic timers on the timer wheel', async () => {
+    const wait = (ms: number) => new Promise(resolve => setTimeout(resolve, ms));
+    let once = 0;
+    let ticks = 0;
+    const oneShot = Time.createTimer(() => once++, 500, { repeat: false });
+    const periodic = Time.createTimer(() => ticks++, 1000);
+    expect(oneShot.repeat).toBe(false);
+    expect(periodic.interval).toBe(1000);
+
+    await wait(50);
+    expect(once).toBe(1);
+    expect(ticks).toBeGreaterThan(5);
+    expect(Time.destroyTimer(oneShot)).toBe(false);
+    expect(Time.destroyTimer(periodic)).toBe(true);
+
+    const stopped = ticks;
+    await wait(20);
+    expect(ticks).toBe(stopped);
+    expect(() => Time.createTimer(() => {}, 0)).toThrow();
+  });
+
+  test('should read and convert the calibrated cycle counter', () => {
+    const clock = Time.getCycleClockInfo();
+    expect(clock.frequency).toBeGreaterThan(0);
+    expect(typeof clock.invariant).toBe('boolean');
+
+    const slots = new BigUint64Array(2);
+    Time.writeCycles(slots, 0);
+    Time.sleep(5);
+    Time.writeCycles(slots, 1);
+    expect(slots[1]).toBeGreaterThan(slots[0]);
+    const elapsed = Time.cyclesToNanoseconds(slots[1] - slots[0]);
+    expect(elapsed).toBeGreaterThan(4e6);
+    expect(elapsed).toBeLessThan(1e9);
+    expect(typeof Time.readCycles()).toBe('bigint');
+    expect(() => Time.writeCycles(slots, 2)).toThrow();
+    expect(() => Time.cyclesToNanoseconds(-1n)).toThrow(RangeError);
+    expect(() => Time.cyclesToNanoseconds(2n ** 64n)).toThrow(RangeError);
+  });
+
+  test('should record HDR histogram percentiles and merge histograms', () => {
+    const histogram = Time.createHistogram({ lowest: 1, highest: 1e9, sigfigs: 3 });
+    for (let value = 1; value <= 10000; value++) {
+      histogram.record(value);
+    }
+    expect(histogram.percentile(50)).toBeGreaterThanOrEqual(5000);
+    expect(histogram.percentile(50)).toBeLessThanOrEqual(5005);
+    expect(histogram.percentile(99)).toBeGreaterThanOrEqual(9900);
+    expect(histogram.percentile(99)).toBeLessThanOrEqual(9910);
+
+    const other = Time.createHistogram();
+    other.record(1e6, 10);
+    expect(other.time(() => 42)).toBe(42);
+    expect(histogram.add(other)).toBe(11);
+    expect(Time.attachHistogram(histogram.id).snapshot().count).toBe(10011);
+
+    const drained = histogram.snapshot(true);
+    expect(drained.count).toBe(10011);
+    expect(drained.max).toBeGreaterThanOrEqual(1e6);
+    expect(histogram.snapshot().count).toBe(0);
+    expect(() => histogram.record(-1)).toThrow();
+    expect(() => histogram.record(-1n)).toThrow(RangeError);
+    expect(() => histogram.record(2n ** 70n)).toThrow(RangeError);
+    expect(Time.destroyHistogram(other)).toBe(true);
+  });
 });
 
 describeWithNative('LLJS Math Module (Native)', () => {
@@ -302,6 +538,23 @@ describeWithNative('LLJS Math Module (Native)', () => {
     expect(dotResult).toBe(32); // 1*4 + 2*5 + 3*6
   });
 
+  test('should perform vector operations on typed arrays in place', () => {
+    const a = new Float64Array([1, 2, 3, 4, 5]);
+    const b = new Float64Array([5, 4, 3, 2, 1]);
+    const out = new Float64Array(5);
+    
+    const addResult = LLJSMath.vectorOperations({ operation: 'add', a, b, out });
+    expect(addResult).toBe(out);
+    expect(Array.from(out)).toEqual([6, 6, 6, 6, 6]);
+    
+    const dotResult = LLJSMath.vectorOperations({
+      operation: 'dot',
+      a: new Float32Array([1, 2, 3]),
+      b: new Float32Array([4, 5, 6])
+    });
+    expect(dotResult).toBe(32);
+  });
+
   test('should perform matrix operations', () => {
     const matrix = [[1, 2], [3, 4]];
     const transposed = LLJSMath.matrixOperations({
@@ -311,6 +564,53 @@ describeWithNative('LLJS Math Module (Native)', () => {
     expect(transposed).toEqual([[1, 3], [2, 4]]);
   });
 
+  test('should perform matrix operations on flat typed storage', () => {
+    const a = { data: new Float64Array([4, 3, 6, 3]), rows: 2, cols: 2 };
+    const identity = { data: new Float64Array([1, 0, 0, 1]), rows: 2, cols: 2 };
+    
+    const product = LLJSMath.matrixOperations({ operation: 'multiply', matrix: a, matrix2: identity }) as any;
+    expect(Array.from(product.data)).toEqual([4, 3, 6, 3]);
+    expect(LLJSMath.matrixOperations({ operation: 'determinant', matrix: a })).toBeCloseTo(-6);
+    
+    const inverse = LLJSMath.matrixOperations({ operation: 'inverse', matrix: a }) as any;
+    const check = LLJSMath.matrixOperations({ operation: 'multiply', matrix: a, matrix2: inverse }) as any;
+    Array.from(check.data as Float64Array).forEach((v, i) => expect(v).toBeCloseTo(i % 3 === 0 ? 1 : 0));
+    
+    const rhs = { data: new Float32Array([10, 12]), rows: 2, cols: 1 };
+    const x = LLJSMath.matrixOperations({
+      operation: 'solve',
+      matrix: { data: new Float32Array([4, 3, 6, 3]), rows: 2, cols: 2 },
+      matrix2: rhs
+    }) as any;
+    expect(x.data).toBeInstanceOf(Float32Array);
+    expect(x.data[0]).toBeCloseTo(1);
+    expect(x.data[1]).toBeCloseTo(2);
+  });
+
+  test('should multiply matrices that do not fill whole tiles', () => {
+    // 17x13 * 13x9 leaves row and column remainders; 70x260 * 260x19 also crosses the row and depth blocks
+    for (const [m, k, n] of [[17, 13, 9], [70, 260, 19]]) {
+      for (const Type of [Float64Array, Float32Array]) {
+        const a = new Type(m * k).map((_, i) => ((i * 7) % 11) - 5);
+        const b = new Type(k * n).map((_, i) => ((i * 5) % 13) - 6);
+        const product = LLJSMath.matrixOperations({
+          operation: 'multiply',
+          matrix: { data: a, rows: m, cols: k },
+          matrix2: { data: b, rows: k, cols: n }
+        }) as any;
+        expect(product.rows).toBe(m);
+        expect(product.cols).toBe(n);
+        for (let i = 0; i < m; i++) {
+          for (let j = 0; j < n; j++) {
+            let sum = 0;
+            for (let p = 0; p < k; p++) sum += a[i * k + p] * b[p * n + j];
+            expect(product.data[i * n + j]).toBe(sum);
+          }
+        }
+      }
+    }
+  });
+
   test('should perform bitwise operations', () => {
     const andResult = LLJSMath.bitwiseOperations('and', 0xFF, 0x0F);
     expect(andResult).toBe(0x0F);
@@ -320,6 +620,35 @@ describeWithNative('LLJS Math Module (Native)', () => {
     
     const xorResult = LLJSMath.bitwiseOperations('xor', 0xFF, 0xFF);
     expect(xorResult).toBe(0x00);
+
+    expect(LLJSMath.bitwiseOperations('not', 0)).toBe(0xFFFFFFFF);
+    expect(LLJSMath.bitwiseOperations('shl', 0x80000000, 1)).toBe(0);
+    expect(LLJSMath.bitwiseOperations('rotl', 0x80000000, 1)).toBe(1);
+    expect(LLJSMath.bitwiseOperations('clz', 1)).toBe(31);
+  });
+
+  test('should run batched commands in one native call', () => {
+    expect(LLJSMath.bitwiseOperations(MathOpcode.popcount, 0xFF)).toBe(8);
+
+    const batch = LLJSMath.createCommandBuffer(4);
+    const sqrt = batch.push(MathOpcode.sqrt, 81);
+    const and = batch.push(MathOpcode.and, 0xFF, 0x0F);
+    const shl = batch.push(MathOpcode.shl, 1, 10);
+    expect(batch.execute()).toBe(3);
+    expect(batch.result(sqrt)).toBe(9);
+    expect(batch.result(and)).toBe(0x0F);
+    expect(batch.result(shl)).toBe(1024);
+
+    batch.clear();
+    batch.push(99 as any, 1);
+    expect(() => batch.execute()).toThrow();
+
+    batch.clear();
+    batch.push(MathOpcode.sqrt, 4);
+    for (const opcode of [NaN, Infinity, 1e12, 2.5]) {
+      batch.commands[0] = opcode;
+      expect(() => batch.execute()).toThrow(RangeError);
+    }
   });
 
   test('should generate random numbers', () => {
@@ -332,6 +661,28 @@ describeWithNative('LLJS Math Module (Native)', () => {
     });
   });
 
+  test('should fill typed arrays with reproducible random samples', () => {
+    const a = LLJSMath.fillRandom(new Float64Array(100000), { distribution: 'normal', seed: 42 });
+    const b = LLJSMath.fillRandom(new Float64Array(100000), { distribution: 'normal', seed: 42 });
+    expect(Array.from(a.subarray(0, 16))).toEqual(Array.from(b.subarray(0, 16)));
+    
+    const mean = a.reduce((sum, v) => sum + v, 0) / a.length;
+    expect(Math.abs(mean)).toBeLessThan(0.05);
+    
+    const dice = LLJSMath.fillRandom(new Int32Array(1000), { min: 1, max: 6, seed: 1 });
+    dice.forEach(v => {
+      expect(v).toBeGreaterThanOrEqual(1);
+      expect(v).toBeLessThanOrEqual(6);
+    });
+
+    // Float32 spacing at 1e8 is 8, so about half of the samples would round up to max
+    const narrow = LLJSMath.fillRandom(new Float32Array(1000), { min: 1e8, max: 1e8 + 8, seed: 3 });
+    narrow.forEach(v => expect(v).toBe(1e8));
+
+    expect(() => LLJSMath.fillRandom(new Float64Array(4), { seed: -1n })).toThrow(RangeError);
+    expect(() => LLJSMath.fillRandom(new Float64Array(4), { seed: 2n ** 70n })).toThrow(RangeError);
+  });
+
   test('should perform FFT', () => {
     const input = [[1, 0], [0, 0], [0, 0], [0, 0]]; // Simple input
     const result = LLJSMath.fastFourierTransform(input);
@@ -343,6 +694,28 @@ describeWithNative('LLJS Math Module (Native)', () => {
       expect(result[0]).toHaveLength(2); // [real, imaginary]
     }
   });
+
+  test('should run planned real and complex FFTs in place', () => {
+    const plan = LLJSMath.createFFTPlan(4);
+    const data = new Float64Array([1, 0, 0, 0, 0, 0, 0, 0]);
+    expect(LLJSMath.executeFFTPlan(plan, data)).toBe(data);
+    expect(Array.from(data)).toEqual([1, 0, 1, 0, 1, 0, 1, 0]);
+    
+    // Non-power-of-two real frames, batched
+    const forward = LLJSMath.createFFTPlan(6, { real: true });
+    const inverse = LLJSMath.createFFTPlan(6, { real: true, inverse: true });
+    const frames = new Float64Array([1, 2, 3, 4, 5, 6, 6, 5, 4, 3, 2, 1]);
+    const spectra = LLJSMath.executeFFTPlan(forward, frames);
+    expect(spectra).toHaveLength(2 * forward.outputLength);
+    expect(spectra[0]).toBeCloseTo(21);
+    
+    const restored = LLJSMath.executeFFTPlan(inverse, spectra);
+    Array.from(restored).forEach((v, i) => expect(v).toBeCloseTo(frames[i]));
+    
+    expect(LLJSMath.destroyFFTPlan(plan)).toBe(true);
+    LLJSMath.destroyFFTPlan(forward);
+    LLJSMath.destroyFFTPlan(inverse);
+  });
 });
 
 describeWithNative('LLJS String Module (Native)', () => {
@@ -403,6 +776,306 @@ describeWithNative('LLJS String Module (Native)', () => {
     const result = LLJS.String.stringReplace('hello world', 'world', 'universe');
     expect(result).toBe('hello universe');
   });
+
+  test('should find all matches and scan with a compiled matcher', () => {
+    const log = Buffer.from('ok ERROR disk\nwarn: Timeout\nERROR net timeout\n');
+    expect(Array.from(LLJS.String.findAll(log, 'ERROR'))).toEqual([3, 28]);
+    expect(LLJS.String.findAll(log, 'timeout', { caseSensitive: false })).toHaveLength(2);
+    expect(Array.from(LLJS.String.findAll('aaaa', 'aa', { overlapping: true }))).toEqual([0, 1, 2]);
+    
+    const matcher = LLJS.String.createMatcher(['ERROR', 'timeout']);
+    const { offsets, patterns } = LLJS.String.matcherScan(matcher, log);
+    expect(Array.from(offsets)).toEqual([3, 28, 38]);
+    expect(Array.from(patterns)).toEqual([0, 0, 1]);
+    expect(LLJS.String.destroyMatcher(matcher)).toBe(true);
+  });
+
+  test('should run string ops on buffer slices and packed batches', () => {
+    const bytes = Buffer.from('[héllo]');
+    expect(LLJS.String.bufferLength(bytes, 1, bytes.length - 2)).toBe(5);
+    expect(LLJS.String.bufferHash(bytes, 'fnv1a', 1, bytes.length - 2)).toBe(LLJS.String.stringHash('héllo', 'fnv1a'));
+    expect(LLJS.String.bufferValidate(bytes, 'utf8', 0, 3)).toBe(false);
+    expect(LLJS.String.bufferCompare(Buffer.from('ABC'), Buffer.from('abc'), false)).toBe(0);
+    expect(LLJS.String.bufferCompare(Buffer.from('xxABCyy'), Buffer.from('abc!'), false, 2, 3, 0, 3)).toBe(0);
+    expect(LLJS.String.bufferCompare(Buffer.from('abc'), Buffer.from('abd'), true, 0, 2, 0, 2)).toBe(0);
+    expect(() => LLJS.String.bufferCompare(Buffer.from('abc'), Buffer.from('abc'), true, 4)).toThrow(RangeError);
+    
+    const words = ['alpha', 'ümlaut', '', 'Beta'];
+    const { buffer, offsets } = LLJS.String.packStrings(words);
+    expect(Array.from(LLJS.String.stringBatch('length', buffer, offsets))).toEqual([5, 6, 0, 4]);
+    expect(Array.from(LLJS.String.stringBatch('validate', buffer, offsets, { type: 'ascii' }))).toEqual([1, 0, 1, 1]);
+    expect(Array.from(LLJS.String.stringBatch('compare', buffer, offsets, { needle: 'beta', caseSensitive: false }))).toEqual([-1, 1, -1, 0]);
+    const hashes = LLJS.String.stringBatch('hash', buffer, offsets, { algorithm: 'crc32' });
+    expect(Number(hashes[1])).toBe(LLJS.String.stringHash('ümlaut', 'crc32'));
+    expect(() => LLJS.String.bufferLength(bytes, 100)).toThrow(RangeError);
+  });
+
+  test('should hash with xxh3, crc32c and streaming hashers', () => {
+    expect(LLJS.String.hash('123456789', 'crc32c')).toBe(0xe3069283n);
+    expect(LLJS.String.hash('123456789', 'crc32')).toBe(0xcbf43926n);
+    expect(LLJS.String.hash('', 'wyhash', 0)).toBe(0x93228a4de0eec5a2n);
+    expect(LLJS.String.hash('abc', 'xxh3', 1)).not.toBe(LLJS.String.hash('abc', 'xxh3', 2));
+
+    // Reference digests from xxHash's sanity check, over its PRIME32/PRIME64 byte generator;
+    // the lengths cover the short, mid-size and long (vector kernel) paths
+    const prime64 = 11400714785074694797n;
+    const sanity = Buffer.alloc(2367);
+    let generator = 2654435761n;
+    for (let i = 0; i < sanity.length; i++) {
+      sanity[i] = Number(generator >> 56n);
+      generator = (generator * prime64) & 0xffffffffffffffffn;
+    }
+    const vectors: Array<[number, bigint, bigint]> = [
+      [0, 0x2d06800538d394c2n, 0xa8a6b918b2f0364an],
+      [1, 0xc44bdff4074eecdbn, 0x032be332dd766ef8n],
+      [6, 0x27b56a84cd2d7325n, 0x84589c116ab59ab9n],
+      [24, 0xa3fe70bf9d3510ebn, 0x850e80fc35bdd690n],
+      [195, 0xcd94217ee362ec3an, 0xba68003d370cb3d9n],
+      [2048, 0xdd59e2c3a5f038e0n, 0x66f81670669ababcn],
+      [2367, 0xcb37aeb9e5d361edn, 0xd2db3415b942b42an]
+    ];
+    for (const [length, unseeded, seeded] of vectors) {
+      expect(LLJS.String.hash(sanity.subarray(0, length), 'xxh3')).toBe(unseeded);
+      expect(LLJS.String.hash(sanity.subarray(0, length), 'xxh3', prime64)).toBe(seeded);
+    }
+    expect(LLJS.String.hash('', 'xxh3-128')).toBe(0x99aa06d3014798d86001c324468d497fn);
+
+    const data = Buffer.alloc(5000);
+    for (let i = 0; i < data.length; i++) data[i] = (i * 31) & 0xff;
+    for (const algorithm of ['xxh3', 'xxh3-128', 'crc32c', 'murmur3'] as const) {
+      const hasher = LLJS.String.createHasher(algorithm, algorithm.startsWith('xxh3') ? 9 : 0);
+      hasher.update(data, 0, 3).update(data, 3, 1500).update(data.subarray(1503));
+      expect(hasher.digest()).toBe(LLJS.String.hash(data, algorithm, algorithm.startsWith('xxh3') ? 9 : 0));
+      expect(LLJS.String.destroyHasher(hasher)).toBe(true);
+    }
+    expect(() => LLJS.String.createHasher('wyhash')).toThrow(TypeError);
+
+    const { buffer, offsets } = LLJS.String.packStrings(['shard:1', 'shard:2', 'shard:3']);
+    const output = new BigUint64Array(3);
+    expect(LLJS.String.stringBatch('hash', buffer, offsets, { algorithm: 'xxh3', seed: 42n, output })).toBe(output);
+    expect(output[2]).toBe(LLJS.String.hash('shard:3', 'xxh3', 42n));
+    const wide = LLJS.String.stringBatch('hash', buffer, offsets, { algorithm: 'xxh3-128' });
+    expect((wide[1] << 64n) | wide[0]).toBe(LLJS.String.hash('shard:1', 'xxh3-128'));
+  });
+
+  test('should validate and transcode UTF-8 with the SIMD kernels', () => {
+    const text = 'ascii, кириллица, 中文, 😀 '.repeat(40);
+    const utf8 = Buffer.from(text);
+    expect(LLJS.String.bufferValidate(utf8, 'utf8')).toBe(true);
+    expect(LLJS.String.bufferLength(utf8)).toBe([...text].length);
+    for (const bad of [[0xC0, 0xAF], [0xED, 0xA0, 0x80], [0xF4, 0x90, 0x80, 0x80], [0xE2, 0x82]]) {
+      expect(LLJS.String.bufferValidate(Buffer.concat([utf8, Buffer.from(bad)]), 'utf8')).toBe(false);
+    }
+
+    const utf16 = LLJS.String.transcode(utf8, 'utf8', 'utf16le');
+    expect(utf16.equals(Buffer.from(text, 'utf16le'))).toBe(true);
+    expect(LLJS.String.transcode(utf16, 'utf16le', 'utf8').equals(utf8)).toBe(true);
+    expect(LLJS.String.decodeUtf8(utf8, 7, 18)).toBe('кириллица');
+
+    const latin1 = Buffer.from('café crème', 'latin1');
+    const output = new Uint8Array(32);
+    const written = LLJS.String.transcode(latin1, 'latin1', 'utf8', output);
+    expect(Buffer.from(output.subarray(0, written)).toString()).toBe('café crème');
+    expect(() => LLJS.String.transcode(utf8, 'utf8', 'latin1')).toThrow(RangeError);
+  });
+});
+
+describeWithNative('LLJS IO Module (Native)', () => {
+  const tempFile = path.join(os.tmpdir(), `lljs-io-${process.pid}.bin`);
+
+  afterAll(() => {
+    fs.rmSync(tempFile, { force: true });
+  });
+
+  test('should walk a directory tree with native filters in batches', async () => {
+    const root = fs.mkdtempSync(path.join(os.tmpdir(), 'lljs-walk-'));
+    try {
+      fs.mkdirSync(path.join(root, 'a', 'b'), { recursive: true });
+      fs.mkdirSync(path.join(root, 'skip'));
+      fs.writeFileSync(path.join(root, 'top.log'), 'x');
+      fs.writeFileSync(path.join(root, 'a', 'b', 'deep.log'), 'x'.repeat(100));
+      fs.writeFileSync(path.join(root, 'a', 'note.txt'), 'x');
+      fs.writeFileSync(path.join(root, 'skip', 'hidden.log'), 'x');
+
+      const found = new Map<string, number>();
+      const summary = await IO.walk(root, (batch) => {
+        for (let i = 0; i < batch.count; i++) {
+          expect(batch.types[i]).toBe(WalkEntryType.file);
+          found.set(batch.paths[i], batch.sizes![i]);
+        }
+      }, { include: '*.log', exclude: 'skip', batchSize: 1 });
+
+      expect([...found.keys()].sort()).toEqual(['a/b/deep.log', 'top.log']);
+      expect(found.get('a/b/deep.log')).toBe(100);
+      expect(summary.entries).toBe(2);
+      expect(summary.stopped).toBe(false);
+
+      const small = await IO.walk(root, () => {}, { include: '**/*.log', maxSize: 10 });
+      expect(small.entries).toBe(1);
+
+      await expect(IO.walk(root, () => { throw new Error('stop here'); })).rejects.toThrow('stop here');
+    } finally {
+      fs.rmSync(root, { recursive: true, force: true });
+    }
+  });
+
+  test('should batch reads, writes and fsync through an I/O ring', async () => {
+    const batches: Array<{ userData: number; result: number }> = [];
+    let wake: () => void = () => {};
+    const ring = IO.createRing((batch) => {
+      for (let i = 0; i < batch.count; i++) batches.push({ userData: batch.userData[i], result: batch.results[i] });
+      wake();
+    });
+    const waitFor = (count: number) => new Promise<void>((resolve) => {
+      wake = () => { if (batches.length >= count) resolve(); };
+      wake();
+    });
+    try {
+      expect(['io_uring', 'iocp', 'threadpool']).toContain(ring.backend);
+      const file = ring.registerFile(tempFile, 'w');
+      const source = ring.registerBuffer(Buffer.from('0123456789'));
+      const target = Buffer.alloc(4);
+      const into = ring.registerBuffer(target);
+
+      ring.write(file, source, 0, 1);
+      expect(ring.submit()).toBe(1);
+      await waitFor(1);
+      expect(batches[0]).toEqual({ userData: 1, result: 10 });
+      ring.fsync(file, 2);
+      expect(ring.submit()).toBe(1);
+      await waitFor(2);
+      expect(batches[1]).toEqual({ userData: 2, result: 0 });
+
+      const reader = ring.registerFile(tempFile, 'r');
+      ring.read(reader, into, 3n, 3, 4);
+      ring.submit();
+      await waitFor(3);
+      expect(batches[2]).toEqual({ userData: 3, result: 4 });
+      expect(target.toString()).toBe('3456');
+    } finally {
+      expect(ring.close()).toBe(true);
+    }
+  });
+
+  test('should write and read files asynchronously into caller buffers', async () => {
+    const data = Buffer.from('hello async world');
+    await expect(IO.writeFileAsync(tempFile, data)).resolves.toBe(data.length);
+
+    const target = Buffer.alloc(5);
+    await expect(IO.readFileAsync(tempFile, target, 6)).resolves.toBe(5);
+    expect(target.toString()).toBe('async');
+
+    const tooBig = Buffer.alloc(64);
+    await expect(IO.readFileAsync(tempFile, tooBig)).resolves.toBe(data.length);
+  });
+
+  test('should perform positional reads and writes on handles', async () => {
+    const handle = IO.openFile(tempFile, 'rw');
+    try {
+      await expect(IO.writeAt(handle, Buffer.from('ASYNC'), 6)).resolves.toBe(5);
+      const target = Buffer.alloc(11);
+      await expect(IO.readAt(handle, target, 6, 11)).resolves.toBe(11);
+      expect(target.toString()).toBe('ASYNC world');
+    } finally {
+      IO.closeFile(handle);
+    }
+  });
+
+  test('should scatter and gather with 64-bit positions', async () => {
+    const handle = IO.openFile(tempFile, 'w');
+    try {
+      const parts = [Buffer.from('abc'), Buffer.from('defgh'), Buffer.from('ij')];
+      await expect(IO.pwritev(handle, parts, 4n)).resolves.toBe(10);
+    } finally {
+      IO.closeFile(handle);
+    }
+
+    const reader = IO.openFile(tempFile, 'r');
+    try {
+      const first = Buffer.alloc(6);
+      const second = Buffer.alloc(8);
+      await expect(IO.preadv(reader, [first, second], 4n)).resolves.toBe(10);
+      expect(first.toString()).toBe('abcdef');
+      expect(second.subarray(0, 4).toString()).toBe('ghij');
+      expect(IO.seekFile(reader, 2n, 0)).toBe(2);
+    } finally {
+      IO.closeFile(reader);
+    }
+
+    expect(IO.readFile(tempFile, 6n, 1000).toString()).toBe('cdefghij');
+    expect(() => IO.readFile(tempFile, -1)).toThrow();
+  });
+
+  test('should map files without copying', () => {
+    const data = Buffer.alloc(8192 + 17, 0x5a);
+    fs.writeFileSync(tempFile, data);
+
+    const mapped = IO.mapFile(tempFile, { offset: 4100, advice: 'sequential' });
+    expect(mapped.length).toBe(data.length - 4100);
+    expect(mapped.equals(data.subarray(4100))).toBe(true);
+    expect(IO.madvise(mapped.subarray(0, 16), 'willneed')).toBe(true);
+
+    const writable = IO.mapFile(tempFile, { readonly: false, length: 16 });
+    writable[0] = 0x01;
+    expect(IO.msync(writable)).toBe(true);
+    expect(fs.readFileSync(tempFile)[0]).toBe(0x01);
+  });
+});
+
+describeWithNative('LLJS Threading Module (Native)', () => {
+  test('should run native kernels on the worker pool', async () => {
+    const items = [Buffer.from('abc'), Buffer.from('needle in a haystack'), Buffer.alloc(0)];
+
+    const hashes = await Threading.runBatch('hash', items, { algorithm: 'djb2' });
+    expect(hashes).toBeInstanceOf(BigUint64Array);
+    expect(Number(hashes[0])).toBe(LLJS.String.stringHash('abc', 'djb2'));
+
+    const found = await Threading.runBatch('search', items, { pattern: 'haystack' });
+    expect(Array.from(found)).toEqual([-1, 12, -1]);
+
+    const vectors = [new Float64Array([1, 2, 3]), new Float64Array([4, 5])];
+    const sums = await Threading.runBatch('sum', vectors);
+    expect(Array.from(sums)).toEqual([6, 9]);
+
+    const dots = await Threading.runBatch('dot', vectors, { vector: new Float64Array([1, 1, 1]) });
+    expect(Array.from(dots)).toEqual([6, 9]);
+
+    expect(Threading.getPoolInfo().threads).toBeGreaterThan(0);
+  });
+
+  test('should invalidate destroyed mutex and semaphore handles', () => {
+    const mutex = Threading.createMutex();
+    expect(Threading.lockMutex(mutex, 10)).toBe(true);
+    expect(Threading.destroyMutex(mutex)).toBe(false);
+    expect(Threading.unlockMutex(mutex)).toBe(true);
+    expect(Threading.unlockMutex(mutex)).toBe(false);
+    expect(Threading.destroyMutex(mutex)).toBe(true);
+    expect(Threading.lockMutex(mutex, 10)).toBe(false);
+    expect(Threading.createMutex().id).not.toBe(mutex.id);
+
+    const sem = Threading.createSemaphore(0, 1);
+    expect(Threading.signalSemaphore(sem)).toBe(0);
+    expect(Threading.signalSemaphore(sem)).toBe(-1);
+    expect(Threading.waitSemaphore(sem, 10)).toBe(true);
+    expect(Threading.destroySemaphore(sem)).toBe(true);
+    expect(Threading.waitSemaphore(sem, 0)).toBe(false);
+  });
+
+  test('should pass messages through shared-memory rings', () => {
+    for (const kind of ['spsc', 'mpmc'] as const) {
+      const ring = Threading.createRing(4, 8, kind);
+      const out = new Uint8Array(8);
+      expect(Threading.ringPop(ring, out)).toBe(-1);
+      for (let i = 0; i < 4; i++) {
+        expect(Threading.ringPush(ring, new Uint8Array([i, i + 1]))).toBe(true);
+      }
+      expect(Threading.ringPush(ring, new Uint8Array([9]))).toBe(false);
+      expect(Threading.getRingInfo(Threading.attachRing(ring.buffer))).toEqual({ kind, capacity: 4, slotSize: 8, size: 4 });
+      expect(Threading.ringPop(ring, out)).toBe(2);
+      expect(Array.from(out.subarray(0, 2))).toEqual([0, 1]);
+      expect(() => Threading.ringPush(ring, new Uint8Array(9))).toThrow(RangeError);
+    }
+  });
 });
 
 describeWithNative('LLJS Integration Tests (Native)', () => {